@@ -37,6 +37,12 @@
 using MutexType = tbb::queuing_mutex;
 #endif
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <vector>
+
 #include <itkAmoebaOptimizer.h>
 #include <itkFFTConvolutionImageFilter.h>
 #include <itkNumericTraits.h>
@@ -73,6 +79,8 @@ using PixelValue_T = double;
 namespace
 {
 const QString InternalGrayscalePrefex = "_INTERNAL_Grayscale_";
+const QString LookupTableArrayName = "Offsets";
+const QString LookupTableParametersArrayName = "Parameters";
 
 // std::vector<double> convertParams2Vec(const FFTDewarpHelper::ParametersType& params)
 //{
@@ -110,62 +118,176 @@ FFTDewarpHelper::ParametersType convertVec2Params(const std::vector<double>& vec
 //{
 //  return FFTDewarpHelper::pixelIndex(sizeVec[0], sizeVec[1]);
 //}
-SizeVec2Type pixelIndexToSizeVec(const FFTDewarpHelper::PixelIndex& pixelType)
-{
-  return SizeVec2Type(static_cast<size_t>(pixelType[0]), static_cast<size_t>(pixelType[1]));
-}
-size_t flatten(const SizeVec2Type& xyPos, const SizeVec3Type& dimensions)
+using DewarpLookupTable = std::vector<int64_t>;
+
+/**
+ * @brief The DewarpLookupTableGenerator class fills in the source tuple index for each pixel
+ * of a tile, or -1 where the dewarped position falls outside of the tile.  The table only
+ * depends on the warp, so it is shared by every DataArray in the AttributeMatrix.
+ */
+class DewarpLookupTableGenerator
 {
-  const size_t x = xyPos[0];
-  const size_t y = xyPos[1];
-
-  const size_t width = dimensions[0];
-
-  return x + y * width;
-}
-size_t flatten(const FFTDewarpHelper::PixelIndex& xyPos, const SizeVec3Type& dimensions)
-{
-  return flatten(pixelIndexToSizeVec(xyPos), dimensions);
-}
+public:
+  DewarpLookupTableGenerator(DewarpLookupTable& table, const FFTDewarpHelper::ParametersType& parameters, const SizeVec3Type& dimensions, const FFTDewarpHelper::PixelIndex& offset)
+  : m_Table(table)
+  , m_Parameters(parameters)
+  , m_Dimensions(dimensions)
+  , m_Offset(offset)
+  {
+  }
 
-template <typename T>
-void clearTuple(const typename DataArray<T>::Pointer& da, size_t numComponents, size_t tupleId)
-{
-  T initValue = da->getInitValue();
-  typename std::vector<T> blankTuple(numComponents, initValue);
-  da->setTuple(tupleId, blankTuple);
-}
+  void operator()(const SIMPLRange2D& range) const
+  {
+    const int64_t width = static_cast<int64_t>(m_Dimensions[0]);
+    const int64_t height = static_cast<int64_t>(m_Dimensions[1]);
+    const int64_t minCol = static_cast<int64_t>(range.minCol());
+    const int64_t maxCol = static_cast<int64_t>(range.maxCol());
+
+    std::vector<int64_t> oldX(range.maxCol() - range.minCol());
+    std::vector<int64_t> oldY(oldX.size());
+    for(size_t y = range.minRow(); y < range.maxRow(); y++)
+    {
+      FFTDewarpHelper::getOldIndexRow(static_cast<int64_t>(y), minCol, maxCol, m_Offset, m_Parameters, oldX.data(), oldY.data());
+      int64_t* tableRow = m_Table.data() + y * width;
+      for(int64_t x = minCol; x < maxCol; x++)
+      {
+        const int64_t srcX = oldX[x - minCol];
+        const int64_t srcY = oldY[x - minCol];
+        // Cannot flatten invalid { X,Y } positions
+        const bool valid = srcX >= 0 && srcY >= 0 && srcX < width && srcY < height;
+        tableRow[x] = valid ? srcX + srcY * width : -1;
+      }
+    }
+  }
 
+private:
+  DewarpLookupTable& m_Table;
+  const FFTDewarpHelper::ParametersType& m_Parameters;
+  SizeVec3Type m_Dimensions;
+  FFTDewarpHelper::PixelIndex m_Offset;
+};
+
+/**
+ * @brief The DewarpRemapper class copies each tuple from its source position in the
+ * unwarped data, or fills it with the array's init value when there is no source.
+ */
 template <typename T>
-void transformDataPixel(double x_trans, double y_trans, const SizeVec2Type& newPixel, const FFTDewarpHelper::ParametersType& parameters, const SizeVec3Type& dimensions,
-                        const typename DataArray<T>::Pointer& da, const typename DataArray<T>::Pointer& tempDACopy)
+class DewarpRemapper
 {
-  FFTDewarpHelper::PixelIndex offset = FFTDewarpHelper::pixelIndex(x_trans, y_trans);
-  FFTDewarpHelper::PixelIndex oldPixelIndex = FFTDewarpHelper::getOldIndex(FFTDewarpHelper::pixelIndex(newPixel[0], newPixel[1]), offset, parameters);
+public:
+  DewarpRemapper(T* destination, const T* source, size_t numComps, T initValue, const DewarpLookupTable& table, size_t width)
+  : m_Destination(destination)
+  , m_Source(source)
+  , m_NumComps(numComps)
+  , m_InitValue(initValue)
+  , m_Table(table)
+  , m_Width(width)
+  {
+  }
 
-  auto compDims = tempDACopy->getComponentDimensions();
-  size_t numComponents = std::accumulate(compDims.begin(), compDims.end(), 0);
-  size_t newIndex = flatten(newPixel, dimensions);
+  void operator()(const SIMPLRange2D& range) const
+  {
+    for(size_t y = range.minRow(); y < range.maxRow(); y++)
+    {
+      for(size_t x = range.minCol(); x < range.maxCol(); x++)
+      {
+        const size_t newIndex = x + y * m_Width;
+        const int64_t oldIndex = m_Table[newIndex];
+        T* destTuple = m_Destination + newIndex * m_NumComps;
+        if(oldIndex < 0)
+        {
+          std::fill_n(destTuple, m_NumComps, m_InitValue);
+        }
+        else
+        {
+          std::copy_n(m_Source + static_cast<size_t>(oldIndex) * m_NumComps, m_NumComps, destTuple);
+        }
+      }
+    }
+  }
 
-  // Cannot flatten invalid { X,Y } positions
-  if(oldPixelIndex[0] < 0 || oldPixelIndex[1] < 0 || oldPixelIndex[0] >= dimensions[0] || oldPixelIndex[1] >= dimensions[1])
+private:
+  T* m_Destination;
+  const T* m_Source;
+  size_t m_NumComps;
+  T m_InitValue;
+  const DewarpLookupTable& m_Table;
+  size_t m_Width;
+};
+
+/**
+ * @brief Converts the lookup table into per-pixel (dx, dy) offsets to its source pixel so it
+ * can be stored in a 2 component Int32 DataArray.  Pixels without a source point to x = -1.
+ */
+void encodeLookupTable(const DewarpLookupTable& table, const SizeVec3Type& dimensions, Int32ArrayType& offsets)
+{
+  const size_t width = dimensions[0];
+  const size_t height = dimensions[1];
+  int32_t* data = offsets.data();
+  for(size_t y = 0; y < height; y++)
   {
-    clearTuple<T>(da, numComponents, newIndex);
-    return;
+    for(size_t x = 0; x < width; x++)
+    {
+      const size_t index = x + y * width;
+      const int64_t oldIndex = table[index];
+      if(oldIndex < 0)
+      {
+        data[2 * index] = -static_cast<int32_t>(x) - 1;
+        data[2 * index + 1] = 0;
+      }
+      else
+      {
+        data[2 * index] = static_cast<int32_t>(static_cast<int64_t>(oldIndex % width) - static_cast<int64_t>(x));
+        data[2 * index + 1] = static_cast<int32_t>(static_cast<int64_t>(oldIndex / width) - static_cast<int64_t>(y));
+      }
+    }
   }
+}
 
-  size_t oldIndex = flatten(oldPixelIndex, dimensions);
-  if((oldIndex >= da->getNumberOfTuples()) || (newIndex >= da->getNumberOfTuples()))
+DewarpLookupTable decodeLookupTable(const Int32ArrayType& offsets, const SizeVec3Type& dimensions)
+{
+  const int64_t width = static_cast<int64_t>(dimensions[0]);
+  const int64_t height = static_cast<int64_t>(dimensions[1]);
+  DewarpLookupTable table(dimensions[0] * dimensions[1]);
+  const int32_t* data = offsets.data();
+  for(int64_t y = 0; y < height; y++)
   {
-    return;
+    for(int64_t x = 0; x < width; x++)
+    {
+      const size_t index = static_cast<size_t>(x + y * width);
+      const int64_t srcX = x + data[2 * index];
+      const int64_t srcY = y + data[2 * index + 1];
+      const bool valid = srcX >= 0 && srcY >= 0 && srcX < width && srcY < height;
+      table[index] = valid ? srcX + srcY * width : -1;
+    }
   }
+  return table;
+}
+
+/**
+ * @brief Returns the values a lookup table depends on: the polynomial parameters followed by
+ * the x and y translation of the tile center.
+ */
+std::vector<double> getLookupTableSignature(const FFTDewarpHelper::ParametersType& parameters, double x_trans, double y_trans)
+{
+  std::vector<double> signature(parameters.begin(), parameters.end());
+  signature.push_back(x_trans);
+  signature.push_back(y_trans);
+  return signature;
+}
 
-  T* oldTuplePtr = tempDACopy->getTuplePointer(oldIndex);
-  da->setTuple(newIndex, oldTuplePtr);
+DewarpLookupTable createLookupTable(const FFTDewarpHelper::ParametersType& parameters, const SizeVec3Type& dimensions, double x_trans, double y_trans)
+{
+  DewarpLookupTable table(dimensions[0] * dimensions[1]);
+
+  ParallelData2DAlgorithm dataAlg;
+  dataAlg.setRange(0, 0, dimensions[1], dimensions[0]);
+  dataAlg.execute(DewarpLookupTableGenerator(table, parameters, dimensions, FFTDewarpHelper::pixelIndex(x_trans, y_trans)));
+  return table;
 }
 
 template <typename T>
-void transformDataArray(const FFTDewarpHelper::ParametersType& parameters, const SizeVec3Type& dimensions, double x_trans, double y_trans, const typename DataArray<T>::Pointer& da)
+void transformDataArray(const DewarpLookupTable& table, const SizeVec3Type& dimensions, std::vector<uint8_t>& scratch, const typename DataArray<T>::Pointer& da)
 {
   // Do not resize items that do not match the geometry.
   size_t flattenedDims = std::accumulate(dimensions.begin(), dimensions.end(), 1, std::multiplies<double>());
@@ -176,79 +298,71 @@ void transformDataArray(const FFTDewarpHelper::ParametersType& parameters, const
     return;
   }
 
-  typename DataArray<T>::Pointer daCopy = std::dynamic_pointer_cast<DataArray<T>>(da->deepCopy());
-
-  const size_t width = dimensions[0];
-  const size_t height = dimensions[1];
-
-  ParallelTaskAlgorithm taskAlg;
-  std::function<void(void)> fn;
-
-  // Loop over pixels
-  for(size_t x = 0; x < width; x++)
+  // The remap reads from a snapshot of the original values.  The scratch buffer is reused
+  // for every array instead of deep copying each DataArray.
+  const size_t numBytes = totalItems * sizeof(T);
+  if(scratch.size() < numBytes)
   {
-    for(size_t y = 0; y < height; y++)
-    {
-      SizeVec2Type newPixel{x, y};
-
-      fn = std::bind(&transformDataPixel<T>, x_trans, y_trans, newPixel, parameters, dimensions, da, daCopy);
-      taskAlg.execute(fn);
-    }
+    scratch.resize(numBytes);
   }
-  taskAlg.wait();
+  std::memcpy(scratch.data(), da->data(), numBytes);
+
+  ParallelData2DAlgorithm dataAlg;
+  dataAlg.setRange(0, 0, dimensions[1], dimensions[0]);
+  dataAlg.execute(DewarpRemapper<T>(da->data(), reinterpret_cast<const T*>(scratch.data()), numComps, da->getInitValue(), table, dimensions[0]));
 }
 
-void transformIDataArray(const FFTDewarpHelper::ParametersType& parameters, const SizeVec3Type& dimensions, double x_trans, double y_trans, const IDataArray::Pointer& da)
+void transformIDataArray(const DewarpLookupTable& table, const SizeVec3Type& dimensions, std::vector<uint8_t>& scratch, const IDataArray::Pointer& da)
 {
   if(std::dynamic_pointer_cast<Int8ArrayType>(da))
   {
     Int8ArrayType::Pointer array = std::dynamic_pointer_cast<Int8ArrayType>(da);
-    transformDataArray<int8_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<int8_t>(table, dimensions, scratch, array);
   }
   else if(std::dynamic_pointer_cast<UInt8ArrayType>(da))
   {
     UInt8ArrayType::Pointer array = std::dynamic_pointer_cast<UInt8ArrayType>(da);
-    transformDataArray<uint8_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<uint8_t>(table, dimensions, scratch, array);
   }
   else if(std::dynamic_pointer_cast<Int16ArrayType>(da))
   {
     Int16ArrayType::Pointer array = std::dynamic_pointer_cast<Int16ArrayType>(da);
-    transformDataArray<int16_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<int16_t>(table, dimensions, scratch, array);
   }
   else if(std::dynamic_pointer_cast<UInt16ArrayType>(da))
   {
     UInt16ArrayType::Pointer array = std::dynamic_pointer_cast<UInt16ArrayType>(da);
-    transformDataArray<uint16_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<uint16_t>(table, dimensions, scratch, array);
   }
   else if(std::dynamic_pointer_cast<Int32ArrayType>(da))
   {
     Int32ArrayType::Pointer array = std::dynamic_pointer_cast<Int32ArrayType>(da);
-    transformDataArray<int32_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<int32_t>(table, dimensions, scratch, array);
   }
   else if(std::dynamic_pointer_cast<UInt32ArrayType>(da))
   {
     UInt32ArrayType::Pointer array = std::dynamic_pointer_cast<UInt32ArrayType>(da);
-    transformDataArray<uint32_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<uint32_t>(table, dimensions, scratch, array);
   }
   else if(std::dynamic_pointer_cast<Int64ArrayType>(da))
   {
     Int64ArrayType::Pointer array = std::dynamic_pointer_cast<Int64ArrayType>(da);
-    transformDataArray<int64_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<int64_t>(table, dimensions, scratch, array);
   }
   else if(std::dynamic_pointer_cast<UInt64ArrayType>(da))
   {
     UInt64ArrayType::Pointer array = std::dynamic_pointer_cast<UInt64ArrayType>(da);
-    transformDataArray<uint64_t>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<uint64_t>(table, dimensions, scratch, array);
   }
   else if(std::dynamic_pointer_cast<FloatArrayType>(da))
   {
     FloatArrayType::Pointer array = std::dynamic_pointer_cast<FloatArrayType>(da);
-    transformDataArray<float>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<float>(table, dimensions, scratch, array);
   }
   else if(std::dynamic_pointer_cast<DoubleArrayType>(da))
   {
     DoubleArrayType::Pointer array = std::dynamic_pointer_cast<DoubleArrayType>(da);
-    transformDataArray<double>(parameters, dimensions, x_trans, y_trans, array);
+    transformDataArray<double>(table, dimensions, scratch, array);
   }
 }
 } // namespace
@@ -295,6 +409,10 @@ void ApplyDewarpParameters::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_STRING_FP("Transformed Data Container Prefix", TransformPrefix, FilterParameter::Category::CreatedArray, ApplyDewarpParameters));
   parameters.push_back(SIMPL_NEW_STRING_FP("Mask Array Name", MaskName, FilterParameter::Category::CreatedArray, ApplyDewarpParameters));
 
+  QStringList linkedProps = {"LookupTablePrefix"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Store Lookup Tables", StoreLookupTables, FilterParameter::Category::Parameter, ApplyDewarpParameters, linkedProps));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Lookup Table Prefix", LookupTablePrefix, FilterParameter::Category::CreatedArray, ApplyDewarpParameters));
+
   setFilterParameters(parameters);
 }
 
@@ -352,6 +470,85 @@ void ApplyDewarpParameters::dataCheck()
       newMontage->setDataContainer(index, dcCopy);
     }
   }
+
+  m_ExistingLookupTables.clear();
+  if(!m_StoreLookupTables)
+  {
+    return;
+  }
+
+  // One lookup table is stored in the Transform DataContainer for each unique tile size.
+  // Tables that already exist are reused instead of evaluating the polynomial again.
+  DataContainer::Pointer transformDC = dca->getPrereqDataContainer(this, m_TransformPath.getDataContainerName());
+  if(nullptr == transformDC)
+  {
+    return;
+  }
+
+  QSet<QString> createdTables;
+  for(const auto& dc : *oldMontage)
+  {
+    ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
+    if(nullptr == imageGeom)
+    {
+      continue;
+    }
+
+    const SizeVec3Type dims = imageGeom->getDimensions();
+    const QString tableName = getLookupTableName(dims[0], dims[1]);
+    if(createdTables.contains(tableName) || m_ExistingLookupTables.contains(tableName))
+    {
+      continue;
+    }
+
+    AttributeMatrix::Pointer tableAM = transformDC->getAttributeMatrix(tableName);
+    if(nullptr != tableAM)
+    {
+      Int32ArrayType::Pointer offsets = tableAM->getAttributeArrayAs<Int32ArrayType>(::LookupTableArrayName);
+      if(nullptr == offsets || offsets->getNumberOfComponents() != 2 || offsets->getNumberOfTuples() != dims[0] * dims[1])
+      {
+        QString ss = tr("AttributeMatrix %1 exists but does not contain a lookup table for %2x%3 tiles").arg(tableName).arg(dims[0]).arg(dims[1]);
+        setErrorCondition(-66730, ss);
+        return;
+      }
+      m_ExistingLookupTables.insert(tableName);
+    }
+    else
+    {
+      std::vector<size_t> tDims = {dims[0], dims[1], 1};
+      tableAM = transformDC->createNonPrereqAttributeMatrix(this, tableName, tDims, AttributeMatrix::Type::Generic);
+      if(nullptr == tableAM)
+      {
+        return;
+      }
+      tableAM->createNonPrereqArray<Int32ArrayType>(this, ::LookupTableArrayName, 0, {2});
+      createdTables.insert(tableName);
+    }
+
+    // The parameters each table was generated from are stored beside it.  Tables saved without
+    // them start out as NaN, which never matches, so they are regenerated on the next execute.
+    const size_t signatureSize = FFTDewarpHelper::getReqParameterSize() + 2;
+    const QString parametersName = getLookupTableParametersName(tableName);
+    AttributeMatrix::Pointer parametersAM = transformDC->getAttributeMatrix(parametersName);
+    if(nullptr != parametersAM)
+    {
+      DoubleArrayType::Pointer signature = parametersAM->getAttributeArrayAs<DoubleArrayType>(::LookupTableParametersArrayName);
+      if(nullptr == signature || signature->getNumberOfTuples() != 1 || signature->getNumberOfComponents() != signatureSize)
+      {
+        QString ss = tr("AttributeMatrix %1 exists but does not contain the parameters of lookup table %2").arg(parametersName).arg(tableName);
+        setErrorCondition(-66731, ss);
+        return;
+      }
+      continue;
+    }
+
+    parametersAM = transformDC->createNonPrereqAttributeMatrix(this, parametersName, {1}, AttributeMatrix::Type::Generic);
+    if(nullptr == parametersAM)
+    {
+      return;
+    }
+    parametersAM->createNonPrereqArray<DoubleArrayType>(this, ::LookupTableParametersArrayName, std::numeric_limits<double>::quiet_NaN(), {signatureSize});
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -423,6 +620,22 @@ size_t ApplyDewarpParameters::getSingleParamCount() const
   return FFTDewarpHelper::getReqPartialParameterSize();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ApplyDewarpParameters::getLookupTableName(size_t width, size_t height) const
+{
+  return QString("%1%2x%3").arg(m_LookupTablePrefix).arg(width).arg(height);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ApplyDewarpParameters::getLookupTableParametersName(const QString& tableName) const
+{
+  return tableName + "_Parameters";
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -462,8 +675,18 @@ void ApplyDewarpParameters::warpDataContainers(const FFTDewarpHelper::Parameters
 {
   // Duplicate the DataContainers used and Warp them based on the transformVector generated.
   AbstractMontage::Pointer montage = getDataContainerArray()->getMontage(m_MontageName);
+  DataContainer::Pointer transformDC = getDataContainerArray()->getDataContainer(m_TransformPath.getDataContainerName());
+
+  // Every tile of the same size is warped around the same offset, so they all share a table
+  std::map<std::pair<size_t, size_t>, DewarpLookupTable> tables;
+  std::vector<uint8_t> scratch;
   for(const auto& dcOrig : *montage)
   {
+    if(getCancel())
+    {
+      return;
+    }
+
     DataContainerShPtr dc = getDataContainerArray()->getDataContainer(m_TransformPrefix + dcOrig->getName());
     ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
     SizeVec3Type dimensions = imageGeom->getDimensions();
@@ -480,9 +703,47 @@ void ApplyDewarpParameters::warpDataContainers(const FFTDewarpHelper::Parameters
       UInt8ArrayType::Pointer maskArray = am->getAttributeArrayAs<UInt8ArrayType>(m_MaskName);
       maskArray->setInitValue(0);
 
+      const std::pair<size_t, size_t> tileSize = {dimensions[0], dimensions[1]};
+      auto tableIter = tables.find(tileSize);
+      if(tableIter == tables.end())
+      {
+        const QString tableName = getLookupTableName(dimensions[0], dimensions[1]);
+        Int32ArrayType::Pointer offsets;
+        DoubleArrayType::Pointer storedSignature;
+        if(m_StoreLookupTables && nullptr != transformDC)
+        {
+          AttributeMatrix::Pointer tableAM = transformDC->getAttributeMatrix(tableName);
+          AttributeMatrix::Pointer parametersAM = transformDC->getAttributeMatrix(getLookupTableParametersName(tableName));
+          if(nullptr != tableAM && nullptr != parametersAM)
+          {
+            offsets = tableAM->getAttributeArrayAs<Int32ArrayType>(::LookupTableArrayName);
+            storedSignature = parametersAM->getAttributeArrayAs<DoubleArrayType>(::LookupTableParametersArrayName);
+          }
+        }
+
+        // An existing table is only valid for the exact transform it was generated from
+        const std::vector<double> signature = getLookupTableSignature(parameters, x_trans, y_trans);
+        bool reuseTable = nullptr != offsets && nullptr != storedSignature && m_ExistingLookupTables.contains(tableName);
+        reuseTable = reuseTable && std::equal(signature.begin(), signature.end(), storedSignature->data());
+        if(reuseTable)
+        {
+          tableIter = tables.emplace(tileSize, decodeLookupTable(*offsets, dimensions)).first;
+        }
+        else
+        {
+          tableIter = tables.emplace(tileSize, createLookupTable(parameters, dimensions, x_trans, y_trans)).first;
+          if(nullptr != offsets && nullptr != storedSignature)
+          {
+            encodeLookupTable(tableIter->second, dimensions, *offsets);
+            std::copy(signature.begin(), signature.end(), storedSignature->data());
+          }
+        }
+      }
+
+      const DewarpLookupTable& table = tableIter->second;
       for(const auto& da : *am)
       {
-        transformIDataArray(parameters, dimensions, x_trans, y_trans, da);
+        transformIDataArray(table, dimensions, scratch, da);
       }
     }
   }
@@ -713,6 +974,38 @@ void ApplyDewarpParameters::setTransformPrefix(const QString& value)
   m_TransformPrefix = value;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ApplyDewarpParameters::getStoreLookupTables() const
+{
+  return m_StoreLookupTables;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ApplyDewarpParameters::setStoreLookupTables(bool value)
+{
+  m_StoreLookupTables = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ApplyDewarpParameters::getLookupTablePrefix() const
+{
+  return m_LookupTablePrefix;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ApplyDewarpParameters::setLookupTablePrefix(const QString& value)
+{
+  m_LookupTablePrefix = value;
+}
+
 // -----------------------------------------------------------------------------
 bool ApplyDewarpParameters::getUseDataArray() const
 {
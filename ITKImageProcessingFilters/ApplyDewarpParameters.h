@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include <QtCore/QSet>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLArray.hpp"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -69,6 +71,8 @@ class ITKImageProcessing_EXPORT ApplyDewarpParameters : public AbstractFilter
   PYB11_PROPERTY(QString MaskName READ getMaskName WRITE setMaskName)
   PYB11_PROPERTY(DataArrayPath TransformPath READ getTransformPath WRITE setTransformPath)
   PYB11_PROPERTY(QString TransformPrefix READ getTransformPrefix WRITE setTransformPrefix)
+  PYB11_PROPERTY(bool StoreLookupTables READ getStoreLookupTables WRITE setStoreLookupTables)
+  PYB11_PROPERTY(QString LookupTablePrefix READ getLookupTablePrefix WRITE setLookupTablePrefix)
   PYB11_END_BINDINGS()
   // clang-format on
 
@@ -129,6 +133,14 @@ public:
   void setTransformPrefix(const QString& value);
   Q_PROPERTY(QString TransformPrefix READ getTransformPrefix WRITE setTransformPrefix)
 
+  bool getStoreLookupTables() const;
+  void setStoreLookupTables(bool value);
+  Q_PROPERTY(bool StoreLookupTables READ getStoreLookupTables WRITE setStoreLookupTables)
+
+  QString getLookupTablePrefix() const;
+  void setLookupTablePrefix(const QString& value);
+  Q_PROPERTY(QString LookupTablePrefix READ getLookupTablePrefix WRITE setLookupTablePrefix)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -231,6 +243,23 @@ protected:
    */
   size_t getSingleParamCount() const;
 
+  /**
+   * @brief Returns the name of the AttributeMatrix that stores the lookup table for tiles
+   * of the given dimensions.
+   * @param width
+   * @param height
+   * @return
+   */
+  QString getLookupTableName(size_t width, size_t height) const;
+
+  /**
+   * @brief Returns the name of the AttributeMatrix that stores the transform parameters the
+   * lookup table of the given name was generated from.
+   * @param tableName
+   * @return
+   */
+  QString getLookupTableParametersName(const QString& tableName) const;
+
 private:
   QString m_MontageName;
   QString m_AttributeMatrixName;
@@ -238,6 +267,12 @@ private:
   QString m_MaskName = "Mask";
   bool m_UseDataArray = true;
   DataArrayPath m_TransformPath;
+  bool m_StoreLookupTables = false;
+  QString m_LookupTablePrefix = "DewarpLookup_";
+
+  // Lookup tables that were already present in the Transform DataContainer before this filter ran.
+  // They are only reused when the parameters stored with them match the current transform.
+  QSet<QString> m_ExistingLookupTables;
 
   // FloatVec7Type m_XFactors = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
   // FloatVec7Type m_YFactors = {0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
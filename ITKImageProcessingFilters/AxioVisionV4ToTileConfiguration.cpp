@@ -31,12 +31,13 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "AxioVisionV4ToTileConfiguration.h"
 
+#include <algorithm>
 #include <array>
 #include <fstream>
+#include <map>
 
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
-#include <QtXml/QDomDocument>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -49,6 +50,7 @@
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 #include "ITKImageProcessing/ZeissXml/ZeissTagMappingConstants.h"
 #include "ITKImageProcessing/ZeissXml/ZeissTagsXmlSection.h"
+#include "ITKImageProcessing/ZeissXml/ZeissXMLReader.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -147,59 +149,64 @@ void AxioVisionV4ToTileConfiguration::execute()
 
   // Parse the XML file to get all the meta-data information and create all the
   // data structure that is needed.
-  QFile xmlFile(getInputFile());
-  readMetaXml(&xmlFile);
+  readMetaXml();
 }
 
 // -----------------------------------------------------------------------------
-void AxioVisionV4ToTileConfiguration::readMetaXml(QIODevice* device)
+void AxioVisionV4ToTileConfiguration::readMetaXml()
 {
-  QString errorStr;
-  int errorLine;
-  int errorColumn;
+  // Each <pXXX> element is reduced to its row/column index and stage position while the file streams by
+  struct PhotoInfo
+  {
+    QString PhotoTag;
+    std::array<int32_t, 2> RCIndex = {{0, 0}};
+    std::array<float, 3> Origin = {{0.0f, 0.0f, 0.0f}};
+  };
+  std::map<int32_t, PhotoInfo> photos;
 
-  QDomDocument domDocument;
-  QDomElement root;
-  ZeissTagsXmlSection::Pointer rootTagsSection;
+  ZeissXMLReader::Pointer reader = ZeissXMLReader::New(getInputFile());
+  reader->setPhotoHandler([this, &photos](int32_t photoIndex, const QString& photoTag, const ZeissTagsXmlSection::Pointer& photoTagsSection) {
+    // Send a status update on the progress
+    QString msg = QString("%1: Importing %2").arg(getHumanLabel()).arg(photoTag);
+    notifyStatusMessage(msg);
 
-  // We are reading from the file, so set the FileWasRead flag to true
-  if(!domDocument.setContent(device, true, &errorStr, &errorLine, &errorColumn))
-  {
-    QString ss = QObject::tr("Parse error at line %1, column %2:\n%3").arg(errorLine).arg(errorColumn).arg(errorStr);
-    setErrorCondition(-70000, ss);
-    return;
-  }
+    // Get the Row Index (Zero Based)
+    int32_t rowIndex = MetaXmlUtils::GetInt32Entry(this, photoTagsSection.get(), Zeiss::MetaXML::ImageIndexVId);
+    if(getErrorCode() < 0)
+    {
+      return false;
+    }
+    // Get the Columnn Index (Zero Based)
+    int32_t colIndex = MetaXmlUtils::GetInt32Entry(this, photoTagsSection.get(), Zeiss::MetaXML::ImageIndexUId);
+    if(getErrorCode() < 0)
+    {
+      return false;
+    }
 
-  root = domDocument.documentElement();
+    PhotoInfo& photo = photos[photoIndex];
+    photo.PhotoTag = photoTag;
+    photo.RCIndex = {{rowIndex, colIndex}};
 
-  QDomElement tags = root.firstChildElement(ITKImageProcessingConstants::Xml::Tags);
-  if(tags.isNull())
-  {
-    QString ss = QObject::tr("Could not find the <ROOT><Tags> element. Aborting Parsing. Is the file a Zeiss _meta.xml file");
-    setErrorCondition(-70001, ss);
-    return;
-  }
+    //#######################################################################
+    // Get the Origin to the Stage Positions
+    photo.Origin[0] = MetaXmlUtils::GetFloatEntry(this, photoTagsSection.get(), Zeiss::MetaXML::StagePositionXId);
+    photo.Origin[1] = MetaXmlUtils::GetFloatEntry(this, photoTagsSection.get(), Zeiss::MetaXML::StagePositionYId);
+    photo.Origin[2] = 0.0f;
+    return true;
+  });
 
-  // First parse the <ROOT><Tags> section to get the values of how many images we are going to have
-  rootTagsSection = MetaXmlUtils::ParseTagsSection(this, tags);
-  if(nullptr == rootTagsSection.get())
+  if(!reader->parse())
   {
+    if(reader->getErrorCode() < 0)
+    {
+      setErrorCondition(reader->getErrorCode(), reader->getErrorMessage());
+    }
     return;
   }
 
-  QDomElement rootCopy = root.cloneNode().toElement();
-
-  // Now parse each of the <pXXX> tags
-  parseImages(root, rootTagsSection.get());
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void AxioVisionV4ToTileConfiguration::parseImages(QDomElement& root, ZeissTagsXmlSection* rootTagsSection)
-{
-
-  int32_t imageCount = MetaXmlUtils::GetInt32Entry(this, rootTagsSection, Zeiss::MetaXML::ImageCountRawId);
+  // The <ROOT><Tags> section has the values of how many images we are going to have
+  ZeissTagsXmlSection::Pointer rootTagsSection = reader->getRootTagsSection();
+  int32_t imageCount = MetaXmlUtils::GetInt32Entry(this, rootTagsSection.get(), Zeiss::MetaXML::ImageCountRawId);
   if(getErrorCode() < 0)
   {
     return;
@@ -211,14 +218,14 @@ void AxioVisionV4ToTileConfiguration::parseImages(QDomElement& root, ZeissTagsXm
 
   QFileInfo fi(imageName);
 
-  // Figure out the max padding digits for both the imageCount (we need that to generate the proper xml tag) and
-  // the row/col values because we need to have a consistent numbering format for later filters.
-  int imageCountPadding = MetaXmlUtils::CalculatePaddingDigits(imageCount);
-  //  int32_t rowCountPadding = MetaXmlUtils::CalculatePaddingDigits(rowCount);
-  //  int32_t colCountPadding = MetaXmlUtils::CalculatePaddingDigits(colCount);
-  // int charPaddingCount = std::max(rowCountPadding, colCountPadding);
+  //#######################################################################
+  // Get the Spacing of the geometry
+  bool ok = false;
+  std::array<float, 3> scaling = {{1.0f, 1.0f, 1.0f}};
+  scaling[0] = reader->getScalingValue("Factor_0").toFloat(&ok);
+  scaling[1] = reader->getScalingValue("Factor_1").toFloat(&ok);
+  scaling[2] = 1.0;
 
-  DataContainerArray::Pointer dca = getDataContainerArray();
   QTextStream outTextStream;
   QFile outFile(getOutputFile());
   if(!getInPreflight())
@@ -241,106 +248,28 @@ void AxioVisionV4ToTileConfiguration::parseImages(QDomElement& root, ZeissTagsXm
                   << "\n";
   }
 
-  std::vector<std::array<int32_t, 3>> allDims;
   std::vector<std::array<float, 3>> allResolution;
   std::vector<std::array<float, 3>> allOrigins;
   std::vector<std::array<int32_t, 2>> allRCIndices;
   std::vector<QString> allNames;
 
   std::array<float, 3> minOrigin = {{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), 0.0f}};
-  std::array<int32_t, 2> maxRC = {{0, 0}};
 
   // Loop over every image in the _meta.xml file
   for(int p = 0; p < imageCount; p++)
   {
-    // Generate the xml tag that is for this image
-    QString pTag;
-    QTextStream out(&pTag);
-    out << "p";
-    out.setFieldWidth(imageCountPadding);
-    out.setFieldAlignment(QTextStream::AlignRight);
-    out.setPadChar('0');
-    out << p;
-
-    // Send a status update on the progress
-    QString msg = QString("%1: Importing file %2 of %3").arg(getHumanLabel()).arg(p).arg(imageCount);
-    notifyStatusMessage(msg);
-
-    // Drill down into the XML document....
-    QDomElement photoEle = root.firstChildElement(pTag);
-    if(photoEle.isNull())
+    auto photoIter = photos.find(p);
+    if(photoIter == photos.end())
     {
-      QString ss = QObject::tr("Could not find the <ROOT><%1> element. Aborting Parsing. Is the file a Zeiss _meta.xml file").arg(pTag);
+      QString ss = QObject::tr("Could not find the <ROOT><p%1> element. Aborting Parsing. Is the file a Zeiss _meta.xml file").arg(p);
       setErrorCondition(-70002, ss);
       return;
     }
-    // Get the TAGS section
-    QDomElement tags = photoEle.firstChildElement(ITKImageProcessingConstants::Xml::Tags);
-    if(tags.isNull())
-    {
-      QString ss = QObject::tr("Could not find the <ROOT><%1><Tags> element. Aborting Parsing. Is the file a Zeiss _meta.xml file").arg(pTag);
-      setErrorCondition(-70003, ss);
-      return;
-    }
-    // Now Parse the TAGS section
-    ZeissTagsXmlSection::Pointer photoTagsSection = MetaXmlUtils::ParseTagsSection(this, tags);
-    if(nullptr == photoTagsSection.get())
-    {
-      QString ss = QObject::tr("Error Parsing the <ROOT><%1><Tags> element. Aborting Parsing. Is the file a Zeiss AxioVision _meta.xml file").arg(pTag);
-      setErrorCondition(-70004, ss);
-      return;
-    }
-
-    // Get the Row Index (Zero Based)
-    int32_t rowIndex = MetaXmlUtils::GetInt32Entry(this, photoTagsSection.get(), Zeiss::MetaXML::ImageIndexVId);
-    if(getErrorCode() < 0)
-    {
-      return;
-    }
-    // Get the Columnn Index (Zero Based)
-    int32_t colIndex = MetaXmlUtils::GetInt32Entry(this, photoTagsSection.get(), Zeiss::MetaXML::ImageIndexUId);
-    if(getErrorCode() < 0)
-    {
-      return;
-    }
+    const PhotoInfo& photo = photoIter->second;
 
-    std::array<int32_t, 2> rcIndex = {{rowIndex, colIndex}};
-    allRCIndices.push_back(rcIndex);
-
-    if(rcIndex[0] > maxRC[0])
-    {
-      maxRC[0] = rcIndex[0];
-    }
-    if(rcIndex[1] > maxRC[1])
-    {
-      maxRC[1] = rcIndex[1];
-    }
-
-    //#######################################################################
-    // Get Pixel Dimensions of the image.
-    std::array<int32_t, 3> dims;
-    AbstractZeissMetaData::Pointer ptr = photoTagsSection->getEntry(Zeiss::MetaXML::ImageWidthPixelId);
-    Int32ZeissMetaEntry::Pointer int32Entry = ZeissMetaEntry::convert<Int32ZeissMetaEntry>(ptr);
-    Q_ASSERT_X(int32Entry.get() != nullptr, "Could not Cast to Int32ZeissMetaEntry", "");
-
-    dims[0] = int32Entry->getValue();
-
-    ptr = photoTagsSection->getEntry(Zeiss::MetaXML::ImageHeightPixelId);
-    int32Entry = ZeissMetaEntry::convert<Int32ZeissMetaEntry>(ptr);
-    Q_ASSERT_X(int32Entry.get() != nullptr, "Could not Cast to Int32ZeissMetaEntry", "");
-
-    dims[1] = int32Entry->getValue();
-    dims[2] = 1;
-
-    allDims.push_back(dims);
-
-    //#######################################################################
-    // Get the Origin to the Stage Positions
-    std::array<float, 3> origin;
-    origin[0] = MetaXmlUtils::GetFloatEntry(this, photoTagsSection.get(), Zeiss::MetaXML::StagePositionXId);
-    origin[1] = MetaXmlUtils::GetFloatEntry(this, photoTagsSection.get(), Zeiss::MetaXML::StagePositionYId);
-    origin[2] = 0.0f;
+    allRCIndices.push_back(photo.RCIndex);
 
+    const std::array<float, 3>& origin = photo.Origin;
     allOrigins.push_back(origin);
 
     if(origin[0] < minOrigin[0])
@@ -356,45 +285,36 @@ void AxioVisionV4ToTileConfiguration::parseImages(QDomElement& root, ZeissTagsXm
       minOrigin[2] = origin[2];
     }
 
-    //#######################################################################
-    // Get the Spacing of the geometry
-    bool ok = false;
-    std::array<float, 3> scaling = {{1.0f, 1.0f, 1.0f}};
-    QDomElement scalingDom = root.firstChildElement(ITKImageProcessingConstants::Xml::Scaling).firstChildElement("Factor_0");
-    scaling[0] = scalingDom.text().toFloat(&ok);
-    scalingDom = root.firstChildElement(ITKImageProcessingConstants::Xml::Scaling).firstChildElement("Factor_1");
-    scaling[1] = scalingDom.text().toFloat(&ok);
-    scaling[2] = 1.0;
-
     allResolution.push_back(scaling);
 
-    QString name = fi.completeBaseName() + "_" + pTag + "." + fi.suffix();
+    QString name = fi.completeBaseName() + "_" + photo.PhotoTag + "." + fi.suffix();
     allNames.push_back(name);
   }
 
   /* The Montage config file must be written as Rows going fastest and not in a Snake style */
-  for(int32_t row = 0; row <= maxRC[0]; row++)
+  std::vector<size_t> order;
+  order.reserve(allRCIndices.size());
+  for(size_t p = 0; p < allRCIndices.size(); p++)
   {
-    for(int32_t col = 0; col <= maxRC[1]; col++)
+    if(allRCIndices[p][0] >= 0 && allRCIndices[p][1] >= 0)
+    {
+      order.push_back(p);
+    }
+  }
+  std::stable_sort(order.begin(), order.end(), [&allRCIndices](size_t a, size_t b) { return allRCIndices[a] < allRCIndices[b]; });
+
+  for(const auto& p : order)
+  {
+    std::array<float, 3> origin = allOrigins[p];
+    std::array<float, 3> resolution = allResolution[p];
+
+    origin[0] = (origin[0] - minOrigin[0]) / resolution[0];
+    origin[1] = (origin[1] - minOrigin[1]) / resolution[1];
+    origin[2] = (origin[2] - minOrigin[2]) / resolution[2];
+    if(!getInPreflight())
     {
-      for(size_t p = 0; p < imageCount; p++)
-      {
-        std::array<int32_t, 2>& rcIndex = allRCIndices.at(p);
-        if(rcIndex[0] == row && rcIndex[1] == col)
-        {
-          std::array<float, 3> origin = allOrigins[p];
-          std::array<float, 3> resolution = allResolution[p];
-
-          origin[0] = (origin[0] - minOrigin[0]) / resolution[0];
-          origin[1] = (origin[1] - minOrigin[1]) / resolution[1];
-          origin[2] = (origin[2] - minOrigin[2]) / resolution[2];
-          if(!getInPreflight())
-          {
-            outTextStream << allNames[p] << "; ; (" << origin[0] << ", " << origin[1] << ")"
-                          << "\n";
-          }
-        }
-      }
+      outTextStream << allNames[p] << "; ; (" << origin[0] << ", " << origin[1] << ")"
+                    << "\n";
     }
   }
 }
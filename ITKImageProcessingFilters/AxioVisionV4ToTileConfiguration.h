@@ -34,14 +34,11 @@
 #include <memory>
 
 #include <QtCore/QTextStream>
-#include <QtXml/QDomElement>
 
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
 #include "ITKImageProcessing/ITKImageProcessingPlugin.h"
 
-class ZeissTagsXmlSection;
-class QIODevice;
 
 /**
  * @brief The AxioVisionV4ToTileConfiguration class. See [Filter documentation](@ref metaxmltofijiconfig) for details.
@@ -172,19 +169,9 @@ protected:
   void initialize();
 
   /**
-   * @brief readMetaXml
-   * @param device
+   * @brief Reads the _meta.xml input file in a single streaming pass and writes the tile configuration
    */
-  void readMetaXml(QIODevice* device);
-
-  /**
-   * @brief parseImages
-   * @param root
-   * @param rootTagsSection
-   */
-  void parseImages(QDomElement& root, ZeissTagsXmlSection* rootTagsSection);
-
-  void initializeImageGeom(const QDomElement& root, ZeissTagsXmlSection* photoTagsSection, QTextStream& out);
+  void readMetaXml();
 
 private:
   QString m_InputFile = {};
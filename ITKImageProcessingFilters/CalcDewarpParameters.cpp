@@ -37,6 +37,9 @@
 using MutexType = tbb::queuing_mutex;
 #endif
 
+#include <array>
+#include <cmath>
+
 #include <itkFFTConvolutionImageFilter.h>
 #include <itkNumericTraits.h>
 
@@ -78,16 +81,16 @@ namespace
 const QString InternalGrayscalePrefex = "_INTERNAL_Grayscale_";
 
 // -----------------------------------------------------------------------------
-// std::vector<double> convertParams2Vec(const FFTDewarpHelper::ParametersType& params)
-//{
-//  const size_t size = params.size();
-//  std::vector<double> vec(size);
-//  for(size_t i = 0; i < size; i++)
-//  {
-//    vec[i] = params[i];
-//  }
-//  return vec;
-//}
+std::vector<double> convertParams2Vec(const FFTDewarpHelper::ParametersType& params)
+{
+  const size_t size = params.size();
+  std::vector<double> vec(size);
+  for(size_t i = 0; i < size; i++)
+  {
+    vec[i] = params[i];
+  }
+  return vec;
+}
 
 // -----------------------------------------------------------------------------
 FFTDewarpHelper::ParametersType convertVec2Params(const std::vector<double>& vec)
@@ -112,6 +115,24 @@ FFTDewarpHelper::ParametersType convertVec2Params(const std::vector<double>& vec
 //  return list;
 //}
 
+// -----------------------------------------------------------------------------
+// Polynomial degree of each term, in the order u, v, u^2, v^2, uv, u^2v, uv^2
+constexpr std::array<int, 7> k_TermDegrees = {1, 1, 2, 2, 2, 3, 3};
+
+// -----------------------------------------------------------------------------
+// Converts dewarp parameters to a pixel size 'ratio' times larger.  A term of degree d
+// scales by ratio^(d - 1); the linear terms are unchanged.
+FFTDewarpHelper::ParametersType rescaleParameters(const FFTDewarpHelper::ParametersType& params, double ratio)
+{
+  const size_t halfSize = FFTDewarpHelper::getReqPartialParameterSize();
+  FFTDewarpHelper::ParametersType rescaled(params);
+  for(size_t i = 0; i < params.size(); i++)
+  {
+    rescaled[i] = params[i] * std::pow(ratio, k_TermDegrees[i % halfSize] - 1);
+  }
+  return rescaled;
+}
+
 // -----------------------------------------------------------------------------
 double calcDelta(double maxDelta, double mMax)
 {
@@ -173,6 +194,9 @@ void CalcDewarpParameters::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Max Iterations", MaxIterations, FilterParameter::Category::Parameter, CalcDewarpParameters));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Delta", Delta, FilterParameter::Category::Parameter, CalcDewarpParameters));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("Fractional Convergence Tolerance", FractionalTolerance, FilterParameter::Category::Parameter, CalcDewarpParameters));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Concurrent Evaluation", ConcurrentEvaluation, FilterParameter::Category::Parameter, CalcDewarpParameters));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Parallel Restarts", ParallelRestarts, FilterParameter::Category::Parameter, CalcDewarpParameters));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Pyramid Levels", PyramidLevels, FilterParameter::Category::Parameter, CalcDewarpParameters));
 
   std::vector<QString> linkedSpecifySimplexProps{"XFactors", "YFactors"};
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Specify Initial Simplex", SpecifyInitialSimplex, FilterParameter::Category::Parameter, CalcDewarpParameters, linkedSpecifySimplexProps));
@@ -200,6 +224,18 @@ void CalcDewarpParameters::dataCheck()
   clearErrorCode();
   clearWarningCode();
 
+  if(m_ParallelRestarts < 0)
+  {
+    setErrorCondition(-87001, QObject::tr("Parallel Restarts must be 0 or greater"));
+    return;
+  }
+
+  if(m_PyramidLevels < 0 || m_PyramidLevels > 4)
+  {
+    setErrorCondition(-87002, QObject::tr("Pyramid Levels must be between 0 and 4"));
+    return;
+  }
+
   if(!checkMontageRequirements())
   {
     return;
@@ -240,47 +276,79 @@ void CalcDewarpParameters::execute()
     setErrorCondition(err, QObject::tr("Sub-filter ConvertColorToGrayScale failed"));
     return;
   }
+  // The optimizer needs an initial guess; this is supplied through a filter parameter
   std::vector<double> xyParameters = getPxyVec();
   FFTDewarpHelper::ParametersType transformParams = ::convertVec2Params(xyParameters);
 
-  // The optimizer needs an initial guess; this is supplied through a filter parameter
-  FFTDewarpHelper::ParametersType initialParams = ::convertVec2Params(xyParameters);
-
   using CostFunctionType = FFTConvolutionCostFunction;
   using ConstFucntionPointerType = typename CostFunctionType::Pointer;
-  // This needs to be an ItkSmartPointer type because another object is going to increase the refcount
-  ConstFucntionPointerType costFunctionObject = CostFunctionType::New();
   GridMontageShPtr gridMontage = std::dynamic_pointer_cast<GridMontage>(getDataContainerArray()->getMontage(getMontageName()));
-  costFunctionObject->Initialize(gridMontage, getDataContainerArray(), m_AttributeMatrixName, getGrayscaleArrayName());
 
-  // Calculate parameter step sizes
-  const double imgX = costFunctionObject->getImageDimX();
-  const double imgY = costFunctionObject->getImageDimY();
-  FFTDewarpHelper::ParametersType stepSizes = ::convertVec2Params(getStepSizes(xyParameters, imgX, imgY));
+  // Each pyramid level halves the downsampling of the one before it and starts from its result.
+  // The last level always runs at full resolution.
+  m_Iterations = 0;
+  for(int level = m_PyramidLevels; level >= 0; level--)
+  {
+    const size_t factor = static_cast<size_t>(1) << level;
+    if(factor > 1)
+    {
+      notifyStatusMessage(QString("Optimizing at 1/%1 resolution").arg(factor));
+    }
 
-  m_Optimizer = AmoebaOptimizer::New();
-  m_Optimizer->SetMaximumNumberOfIterations(m_MaxIterations);
-  m_Optimizer->SetFractionalTolerance(m_FractionalTolerance);
-  m_Optimizer->SetInitialPosition(initialParams);
-  m_Optimizer->SetInitialSimplexDelta(stepSizes);
-  // m_Optimizer->SetOptimizeWithRestarts(true);
+    // This needs to be an ItkSmartPointer type because another object is going to increase the refcount
+    ConstFucntionPointerType costFunctionObject = CostFunctionType::New();
+    costFunctionObject->Initialize(gridMontage, getDataContainerArray(), m_AttributeMatrixName, getGrayscaleArrayName(), factor);
+
+    FFTDewarpHelper::ParametersType initialParams = ::rescaleParameters(transformParams, static_cast<double>(factor));
+
+    // Calculate parameter step sizes for this level's parameters and tile dimensions
+    const double imgX = costFunctionObject->getImageDimX();
+    const double imgY = costFunctionObject->getImageDimY();
+    FFTDewarpHelper::ParametersType stepSizes = ::convertVec2Params(getStepSizes(::convertParams2Vec(initialParams), imgX, imgY));
+
+    m_Optimizer = AmoebaOptimizer::New();
+    m_Optimizer->SetMaximumNumberOfIterations(m_MaxIterations);
+    m_Optimizer->SetFractionalTolerance(m_FractionalTolerance);
+    m_Optimizer->SetInitialPosition(initialParams);
+    m_Optimizer->SetInitialSimplexDelta(stepSizes);
+    // FFTConvolutionCostFunction can be evaluated from several threads at once, but each
+    // evaluation already runs its overlaps in parallel, so this is left to the user
+    m_Optimizer->SetConcurrentEvaluation(m_ConcurrentEvaluation);
+    if(m_ParallelRestarts > 0)
+    {
+      m_Optimizer->SetOptimizeWithRestarts(true);
+      m_Optimizer->SetNumberOfParallelRestarts(static_cast<unsigned int>(m_ParallelRestarts));
+    }
+
+    m_Optimizer->SetSIMPLFilter(this);
+    m_Optimizer->SetCostFunction(costFunctionObject); // Note: Increases the refcount for costFunctionObject
+    m_Optimizer->MaximizeOn();                        // Search for the greatest value
+    m_Optimizer->StartOptimization();
 
-  m_Optimizer->SetSIMPLFilter(this);
-  m_Optimizer->SetCostFunction(costFunctionObject); // Note: Increases the refcount for costFunctionObject
-  m_Optimizer->MaximizeOn();                        // Search for the greatest value
-  m_Optimizer->StartOptimization();
+    // Newer versions of the optimizer allow for easier methods of output information
+    // to be obtained, but until then, we have to do some string parsing from the
+    // optimizer's stop description
+    QString stopReason = QString::fromStdString(m_Optimizer->GetStopConditionDescription());
+    transformParams = ::rescaleParameters(m_Optimizer->GetCurrentPosition(), 1.0 / factor);
 
-  // Newer versions of the optimizer allow for easier methods of output information
-  // to be obtained, but until then, we have to do some string parsing from the
-  // optimizer's stop description
-  QString stopReason = QString::fromStdString(m_Optimizer->GetStopConditionDescription());
-  transformParams = m_Optimizer->GetCurrentPosition();
+    // cache value
+    m_Optimizer->GetValue();
+    m_Iterations += getIterationsFromStopDescription(stopReason, m_MaxIterations);
 
-  // cache value
-  m_Optimizer->GetValue();
-  getIterationsFromStopDescription(stopReason, m_MaxIterations);
+    notifyStatusMessage(QString::fromStdString(m_Optimizer->GetStopConditionDescription()));
+
+    if(getCancel())
+    {
+      deleteGrayscaleIPF();
+      m_Optimizer = nullptr;
+      return;
+    }
+  }
 
-  notifyStatusMessage(QString::fromStdString(m_Optimizer->GetStopConditionDescription()));
+  if(m_PyramidLevels > 0)
+  {
+    notifyStatusMessage(QString("%1 iterations over %2 pyramid levels").arg(m_Iterations).arg(m_PyramidLevels + 1));
+  }
 
   // ...otherwise, set the appropriate values for the filter's output data array
   AttributeMatrixShPtr transformAM = getDataContainerArray()->getDataContainer(m_TransformDCName)->getAttributeMatrix(m_TransformMatrixName);
@@ -299,6 +367,14 @@ void CalcDewarpParameters::execute()
   m_Optimizer = nullptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint CalcDewarpParameters::getIterations() const
+{
+  return m_Iterations;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -714,6 +790,54 @@ void CalcDewarpParameters::setDelta(int value)
   m_StepDelta = value;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalcDewarpParameters::getConcurrentEvaluation() const
+{
+  return m_ConcurrentEvaluation;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalcDewarpParameters::setConcurrentEvaluation(bool value)
+{
+  m_ConcurrentEvaluation = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int CalcDewarpParameters::getParallelRestarts() const
+{
+  return m_ParallelRestarts;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalcDewarpParameters::setParallelRestarts(int value)
+{
+  m_ParallelRestarts = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int CalcDewarpParameters::getPyramidLevels() const
+{
+  return m_PyramidLevels;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalcDewarpParameters::setPyramidLevels(int value)
+{
+  m_PyramidLevels = value;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
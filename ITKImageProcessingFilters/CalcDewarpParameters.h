@@ -70,6 +70,9 @@ class ITKImageProcessing_EXPORT CalcDewarpParameters : public AbstractFilter
   PYB11_PROPERTY(uint32_t MaxIterations READ getMaxIterations WRITE setMaxIterations)
   PYB11_PROPERTY(double FractionalTolerance READ getFractionalTolerance WRITE setFractionalTolerance)
   PYB11_PROPERTY(int Delta READ getDelta WRITE setDelta)
+  PYB11_PROPERTY(bool ConcurrentEvaluation READ getConcurrentEvaluation WRITE setConcurrentEvaluation)
+  PYB11_PROPERTY(int ParallelRestarts READ getParallelRestarts WRITE setParallelRestarts)
+  PYB11_PROPERTY(int PyramidLevels READ getPyramidLevels WRITE setPyramidLevels)
   PYB11_PROPERTY(bool SpecifyInitialSimplex READ getSpecifyInitialSimplex WRITE setSpecifyInitialSimplex)
   PYB11_PROPERTY(FloatVec7Type XFactors READ getXFactors WRITE setXFactors)
   PYB11_PROPERTY(FloatVec7Type YFactors READ getYFactors WRITE setYFactors)
@@ -124,6 +127,18 @@ public:
   void setDelta(int value);
   Q_PROPERTY(int Delta READ getDelta WRITE setDelta)
 
+  bool getConcurrentEvaluation() const;
+  void setConcurrentEvaluation(bool value);
+  Q_PROPERTY(bool ConcurrentEvaluation READ getConcurrentEvaluation WRITE setConcurrentEvaluation)
+
+  int getParallelRestarts() const;
+  void setParallelRestarts(int value);
+  Q_PROPERTY(int ParallelRestarts READ getParallelRestarts WRITE setParallelRestarts)
+
+  int getPyramidLevels() const;
+  void setPyramidLevels(int value);
+  Q_PROPERTY(int PyramidLevels READ getPyramidLevels WRITE setPyramidLevels)
+
   bool getSpecifyInitialSimplex() const;
   void setSpecifyInitialSimplex(bool value);
   Q_PROPERTY(bool SpecifyInitialSimplex READ getSpecifyInitialSimplex WRITE setSpecifyInitialSimplex)
@@ -211,6 +226,13 @@ public:
    */
   void execute() override;
 
+  /**
+   * @brief Returns the number of optimizer iterations used by the last execute, summed over
+   * every pyramid level.
+   * @return
+   */
+  uint getIterations() const;
+
 public Q_SLOTS:
   /**
    * @brief Cancel the operation
@@ -291,8 +313,12 @@ private:
   AmoebaOptimizer::Pointer m_Optimizer = nullptr;
   QString m_MontageName;
   uint m_MaxIterations = 1000;
+  uint m_Iterations = 0;
   double m_FractionalTolerance = 1E-5;
   int m_StepDelta = 5;
+  bool m_ConcurrentEvaluation = false;
+  int m_ParallelRestarts = 0;
+  int m_PyramidLevels = 0;
   bool m_SpecifyInitialSimplex = true;
   QString m_AttributeMatrixName;
   QString m_IPFColorsArrayName = "IPFColor";
@@ -22,6 +22,7 @@
 ITKBinomialBlurImage::ITKBinomialBlurImage()
 {
   m_Repetitions = StaticCastScalar<double, double, double>(1u);
+  m_NumberOfStreamDivisions = 1;
 }
 
 // -----------------------------------------------------------------------------
@@ -37,6 +38,7 @@ void ITKBinomialBlurImage::setupFilterParameters()
   FilterParameterVectorType parameters;
 
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("Repetitions", Repetitions, FilterParameter::Category::Parameter, ITKBinomialBlurImage));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Stream Divisions", NumberOfStreamDivisions, FilterParameter::Category::Parameter, ITKBinomialBlurImage));
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
@@ -61,6 +63,7 @@ void ITKBinomialBlurImage::readFilterParameters(AbstractFilterParametersReader*
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setRepetitions(reader->readValue("Repetitions", getRepetitions()));
+  setNumberOfStreamDivisions(reader->readValue("NumberOfStreamDivisions", getNumberOfStreamDivisions()));
 
   reader->closeFilterGroup();
 }
@@ -73,6 +76,10 @@ void ITKBinomialBlurImage::dataCheckImpl()
 {
   // Check consistency of parameters
   this->CheckIntegerEntry<unsigned int, double>(m_Repetitions, "Repetitions", true);
+  if(m_NumberOfStreamDivisions < 1)
+  {
+    setErrorCondition(-55573, "NumberOfStreamDivisions must be at least 1");
+  }
 
   ITKImageProcessingBase::dataCheckImpl<InputPixelType, OutputPixelType, Dimension>();
 }
@@ -100,7 +107,7 @@ void ITKBinomialBlurImage::filter()
   typedef itk::BinomialBlurImageFilter<InputImageType, OutputImageType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
   filter->SetRepetitions(static_cast<unsigned int>(m_Repetitions));
-  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, static_cast<unsigned int>(m_NumberOfStreamDivisions));
 }
 
 // -----------------------------------------------------------------------------
@@ -188,3 +195,15 @@ double ITKBinomialBlurImage::getRepetitions() const
 {
   return m_Repetitions;
 }
+
+// -----------------------------------------------------------------------------
+void ITKBinomialBlurImage::setNumberOfStreamDivisions(int value)
+{
+  m_NumberOfStreamDivisions = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKBinomialBlurImage::getNumberOfStreamDivisions() const
+{
+  return m_NumberOfStreamDivisions;
+}
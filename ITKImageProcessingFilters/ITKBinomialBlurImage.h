@@ -19,6 +19,7 @@
 
 // Auto includes
 #include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
 #include <itkBinomialBlurImageFilter.h>
 
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
@@ -36,6 +37,7 @@ class ITKImageProcessing_EXPORT ITKBinomialBlurImage : public ITKImageProcessing
   PYB11_SHARED_POINTERS(ITKBinomialBlurImage)
   PYB11_FILTER_NEW_MACRO(ITKBinomialBlurImage)
   PYB11_PROPERTY(double Repetitions READ getRepetitions WRITE setRepetitions)
+  PYB11_PROPERTY(int NumberOfStreamDivisions READ getNumberOfStreamDivisions WRITE setNumberOfStreamDivisions)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -71,6 +73,17 @@ public:
   double getRepetitions() const;
   Q_PROPERTY(double Repetitions READ getRepetitions WRITE setRepetitions)
 
+  /**
+   * @brief Setter property for NumberOfStreamDivisions
+   */
+  void setNumberOfStreamDivisions(int value);
+  /**
+   * @brief Getter property for NumberOfStreamDivisions
+   * @return Value of NumberOfStreamDivisions
+   */
+  int getNumberOfStreamDivisions() const;
+  Q_PROPERTY(int NumberOfStreamDivisions READ getNumberOfStreamDivisions WRITE setNumberOfStreamDivisions)
+
   /**
    * @brief newFilterInstance Reimplemented from @see AbstractFilter class
    */
@@ -135,6 +148,7 @@ public:
 
 private:
   double m_Repetitions = {};
+  int m_NumberOfStreamDivisions = {};
 };
 
 #ifdef __clang__
@@ -106,14 +106,15 @@ void ITKCurvatureAnisotropicDiffusionImage::filter()
 {
   typedef typename itk::NumericTraits<InputPixelType>::RealType FloatPixelType;
   typedef itk::Image<FloatPixelType, Dimension> FloatImageType;
-  typedef itk::CurvatureAnisotropicDiffusionImageFilter<FloatImageType, FloatImageType> FilterType;
+  typedef itk::Image<InputPixelType, Dimension> InputImageType;
+  typedef itk::CurvatureAnisotropicDiffusionImageFilter<InputImageType, FloatImageType> FilterType;
 
   typename FilterType::Pointer filter = FilterType::New();
   filter->SetTimeStep(static_cast<double>(m_TimeStep));
   filter->SetConductanceParameter(static_cast<double>(m_ConductanceParameter));
   filter->SetConductanceScalingUpdateInterval(static_cast<unsigned int>(m_ConductanceScalingUpdateInterval));
   filter->SetNumberOfIterations(static_cast<uint32_t>(m_NumberOfIterations));
-  this->ITKImageProcessingBase::filterCastToFloat<InputPixelType, InputPixelType, Dimension, FilterType, FloatImageType>(filter);
+  this->ITKImageProcessingBase::filter<InputPixelType, InputPixelType, Dimension, FilterType>(filter);
 }
 
 // -----------------------------------------------------------------------------
@@ -99,12 +99,13 @@ void ITKCurvatureFlowImage::filter()
 {
   typedef typename itk::NumericTraits<InputPixelType>::RealType FloatPixelType;
   typedef itk::Image<FloatPixelType, Dimension> FloatImageType;
-  typedef itk::CurvatureFlowImageFilter<FloatImageType, FloatImageType> FilterType;
+  typedef itk::Image<InputPixelType, Dimension> InputImageType;
+  typedef itk::CurvatureFlowImageFilter<InputImageType, FloatImageType> FilterType;
 
   typename FilterType::Pointer filter = FilterType::New();
   filter->SetTimeStep(static_cast<double>(m_TimeStep));
   filter->SetNumberOfIterations(static_cast<uint32_t>(m_NumberOfIterations));
-  this->ITKImageProcessingBase::filterCastToFloat<InputPixelType, InputPixelType, Dimension, FilterType, FloatImageType>(filter);
+  this->ITKImageProcessingBase::filter<InputPixelType, InputPixelType, Dimension, FilterType>(filter);
 }
 
 // -----------------------------------------------------------------------------
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
@@ -14,6 +15,8 @@
 #include "SIMPLib/ITK/itkInPlaceImageToDream3DDataFilter.h"
 
 #include <itkCastImageFilter.h>
+#include <itkImageRegionConstIterator.h>
+#include <itkImageRegionSplitterSlowDimension.h>
 #include <itkNumericTraits.h>
 #include "itkImageToImageFilter.h"
 
@@ -148,44 +151,15 @@ protected:
   }
 
   /**
-   * @brief Applies the filter
+   * @brief Applies the filter. When numberOfStreamDivisions is larger than 1 the output is computed
+   * one region of the slowest dimension at a time and written straight into the output DataArray.
    */
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType>
-  void filter(FilterType* filter, const std::string& outputArrayName, const DataArrayPath& selectedArray)
+  void filter(FilterType* filter, const std::string& outputArrayName, const DataArrayPath& selectedArray, unsigned int numberOfStreamDivisions = 1)
   {
     try
     {
-      DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(selectedArray.getDataContainerName());
-
-      using OutputImageType = itk::Image<OutputPixelType, Dimension>;
-      using toITKType = itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension>;
-      // Create a Bridge to wrap an existing DREAM.3D array with an ItkImage container
-      typename toITKType::Pointer toITK = toITKType::New();
-      toITK->SetInput(dc);
-      toITK->SetInPlace(true);
-      toITK->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
-      toITK->SetDataArrayName(selectedArray.getDataArrayName().toStdString());
-
-      itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
-      interruption->SetFilter(this);
-
-      // Set up filter
-      filter->SetInput(toITK->GetOutput());
-      filter->AddObserver(itk::ProgressEvent(), interruption);
-      filter->Update();
-
-      typename OutputImageType::Pointer image = OutputImageType::New();
-      image = filter->GetOutput();
-      image->DisconnectPipeline();
-
-      using toDream3DType = itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension>;
-      typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
-      toDream3DFilter->SetInput(image);
-      toDream3DFilter->SetInPlace(true);
-      toDream3DFilter->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
-      toDream3DFilter->SetDataArrayName(outputArrayName);
-      toDream3DFilter->SetDataContainer(dc);
-      toDream3DFilter->Update();
+      executeChain<InputPixelType, OutputPixelType, Dimension>(outputArrayName, selectedArray, numberOfStreamDivisions, filter);
     } catch(itk::ExceptionObject& err)
     {
       if(!getCancel())
@@ -198,54 +172,47 @@ protected:
   }
 
   /**
-   * @brief Applies the filter, casting the input to float
+   * @brief Applies an ordered list of ITK filters as a single fused ITK pipeline. Each stage is
+   * connected directly to the output of the previous one, intermediate buffers are released as soon
+   * as the next stage has consumed them, and only the output of the last stage is written back into
+   * the DataContainer. The input of the first stage must accept itk::Image<InputPixelType, Dimension>;
+   * when the last stage does not produce itk::Image<OutputPixelType, Dimension> its output is cast.
    */
-
-  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType, typename FloatImageType>
-  void filterCastToFloat(FilterType* filter, const std::string& outputArrayName, const DataArrayPath& selectedArray)
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename... FilterTypes>
+  void filterChain(const std::string& outputArrayName, const DataArrayPath& selectedArray, FilterTypes*... filters)
   {
     try
     {
-      DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(selectedArray.getDataContainerName());
-
-      using toITKType = itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension>;
-      // Create a Bridge to wrap an existing DREAM.3D array with an ItkImage container
-      typename toITKType::Pointer toITK = toITKType::New();
-      toITK->SetInput(dc);
-      toITK->SetInPlace(true);
-      toITK->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
-      toITK->SetDataArrayName(selectedArray.getDataArrayName().toStdString());
+      executeChain<InputPixelType, OutputPixelType, Dimension>(outputArrayName, selectedArray, 1, filters...);
+    } catch(itk::ExceptionObject& err)
+    {
+      if(!getCancel())
+      {
+        QString errorMessage = "ITK exception was thrown while filtering input image: %1";
+        setErrorCondition(-55555, errorMessage.arg(err.GetDescription()));
+      }
+      return;
+    }
+  }
 
-      itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
-      interruption->SetFilter(this);
+  /**
+   * @brief Applies the filter, casting the input to float. The float result is cast directly into the
+   * output DataArray. Filters that can read the input pixel type themselves (e.g. the dense finite
+   * difference filters, which cast while copying their input) should use filter() with a float output
+   * image instead, which avoids the float copy of the input as well. When streamed, the float buffers
+   * only ever hold the input region needed for the current stream division.
+   */
 
-      using InputImageType = typename toITKType::ImageType;
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType, typename FloatImageType>
+  void filterCastToFloat(FilterType* filter, const std::string& outputArrayName, const DataArrayPath& selectedArray, unsigned int numberOfStreamDivisions = 1)
+  {
+    try
+    {
+      using InputImageType = itk::Image<InputPixelType, Dimension>;
       using CasterToType = itk::CastImageFilter<InputImageType, FloatImageType>;
       typename CasterToType::Pointer casterTo = CasterToType::New();
-      casterTo->SetInput(toITK->GetOutput());
-
-      // Set up filter
-      filter->SetInput(casterTo->GetOutput());
-      filter->AddObserver(itk::ProgressEvent(), interruption);
-
-      using OutputImageType = itk::Image<OutputPixelType, Dimension>;
-      using CasterFromType = itk::CastImageFilter<FloatImageType, OutputImageType>;
-      typename CasterFromType::Pointer casterFrom = CasterFromType::New();
-      casterFrom->SetInput(filter->GetOutput());
-      casterFrom->Update();
-
-      typename OutputImageType::Pointer image = OutputImageType::New();
-      image = casterFrom->GetOutput();
-      image->DisconnectPipeline();
-
-      using toDream3DType = itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension>;
-      typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
-      toDream3DFilter->SetInput(image);
-      toDream3DFilter->SetInPlace(true);
-      toDream3DFilter->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
-      toDream3DFilter->SetDataArrayName(outputArrayName);
-      toDream3DFilter->SetDataContainer(dc);
-      toDream3DFilter->Update();
+
+      executeChain<InputPixelType, OutputPixelType, Dimension>(outputArrayName, selectedArray, numberOfStreamDivisions, casterTo.GetPointer(), filter);
     } catch(itk::ExceptionObject& err)
     {
       QString errorMessage = "ITK exception was thrown while filtering input image: %1";
@@ -317,6 +284,193 @@ protected:
     return false;
   }
 
+  /**
+   * @brief Wraps the selected array as an ITK image, runs the given stages as one ITK pipeline and
+   * moves the output of the last stage into the DataContainer, or streams it there in pieces when
+   * numberOfStreamDivisions is larger than 1. Intermediate stages release their buffers once the
+   * next stage has consumed them. When the last stage does not produce OutputPixelType
+   * its output is cast while being written into the DataArray. ITK exceptions are not caught here.
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename... FilterTypes>
+  void executeChain(const std::string& outputArrayName, const DataArrayPath& selectedArray, unsigned int numberOfStreamDivisions, FilterTypes*... filters)
+  {
+    DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(selectedArray.getDataContainerName());
+
+    using toITKType = itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension>;
+    // Create a Bridge to wrap an existing DREAM.3D array with an ItkImage container
+    typename toITKType::Pointer toITK = toITKType::New();
+    toITK->SetInput(dc);
+    toITK->SetInPlace(true);
+    toITK->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
+    toITK->SetDataArrayName(selectedArray.getDataArrayName().toStdString());
+
+    itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
+    interruption->SetFilter(this);
+
+    // Set up the stages and pull the whole pipeline through the last one
+    auto* lastStage = connectStages(toITK->GetOutput(), interruption.GetPointer(), filters...);
+
+    using LastImageType = typename std::remove_pointer<decltype(lastStage->GetOutput())>::type;
+    using SameImageType = std::is_same<LastImageType, itk::Image<OutputPixelType, Dimension>>;
+    writeOutput<OutputPixelType>(lastStage->GetOutput(), numberOfStreamDivisions, dc, selectedArray.getAttributeMatrixName(), outputArrayName, SameImageType());
+  }
+
+  /**
+   * @brief writeOutput The last stage produces OutputPixelType: hand its buffer over to the DataContainer
+   * without copying, unless the output is streamed.
+   */
+  template <typename OutputPixelType, typename ImageType>
+  void writeOutput(ImageType* output, unsigned int numberOfStreamDivisions, const DataContainer::Pointer& dc, const QString& attributeMatrixName, const std::string& outputArrayName,
+                   std::true_type /* sameImageType */)
+  {
+    if(numberOfStreamDivisions > 1)
+    {
+      streamToDataArray<OutputPixelType>(output, numberOfStreamDivisions, dc, attributeMatrixName, outputArrayName);
+      return;
+    }
+    output->Update();
+
+    typename ImageType::Pointer image = output;
+    image->DisconnectPipeline();
+
+    using toDream3DType = itk::InPlaceImageToDream3DDataFilter<OutputPixelType, ImageType::ImageDimension>;
+    typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
+    toDream3DFilter->SetInput(image);
+    toDream3DFilter->SetInPlace(true);
+    toDream3DFilter->SetAttributeMatrixArrayName(attributeMatrixName.toStdString());
+    toDream3DFilter->SetDataArrayName(outputArrayName);
+    toDream3DFilter->SetDataContainer(dc);
+    toDream3DFilter->Update();
+  }
+
+  /**
+   * @brief writeOutput The last stage produces another pixel type (usually float): cast its output
+   * directly into the output DataArray instead of allocating a cast image first.
+   */
+  template <typename OutputPixelType, typename ImageType>
+  void writeOutput(ImageType* output, unsigned int numberOfStreamDivisions, const DataContainer::Pointer& dc, const QString& attributeMatrixName, const std::string& outputArrayName,
+                   std::false_type /* sameImageType */)
+  {
+    streamToDataArray<OutputPixelType>(output, numberOfStreamDivisions, dc, attributeMatrixName, outputArrayName);
+  }
+
+  /**
+   * @brief streamToDataArray Updates the pipeline producing 'output' one piece of the slowest dimension
+   * at a time, using the same splitting as itk::StreamingImageFilter, and casts every piece into its
+   * place in the output DataArray. The full size output image is never assembled in memory.
+   */
+  template <typename OutputPixelType, typename ImageType>
+  void streamToDataArray(ImageType* output, unsigned int numberOfStreamDivisions, const DataContainer::Pointer& dc, const QString& attributeMatrixName, const std::string& outputArrayName)
+  {
+    constexpr unsigned int Dimension = ImageType::ImageDimension;
+    using ValueType = typename itk::NumericTraits<OutputPixelType>::ValueType;
+    using OutputArrayType = DataArray<ValueType>;
+
+    output->UpdateOutputInformation();
+    const typename ImageType::RegionType largestRegion = output->GetLargestPossibleRegion();
+
+    // Reuse the array allocated during the data check when it matches the output image
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix(attributeMatrixName);
+    const QString arrayName = QString::fromStdString(outputArrayName);
+    typename OutputArrayType::Pointer outputArray = am->getAttributeArrayAs<OutputArrayType>(arrayName);
+    if(nullptr == outputArray || outputArray->getNumberOfTuples() != largestRegion.GetNumberOfPixels())
+    {
+      outputArray = OutputArrayType::CreateArray(largestRegion.GetNumberOfPixels(), ITKDream3DHelper::GetComponentsDimensions<OutputPixelType>(), arrayName, true);
+      if(nullptr == outputArray)
+      {
+        QString errorMessage = "Unable to allocate the output array %1 with %2 tuples";
+        setErrorCondition(-55564, errorMessage.arg(arrayName).arg(largestRegion.GetNumberOfPixels()));
+        return;
+      }
+      am->insertOrAssign(outputArray);
+    }
+    auto* destination = reinterpret_cast<OutputPixelType*>(outputArray->getVoidPointer(0));
+
+    itk::ImageRegionSplitterSlowDimension::Pointer splitter = itk::ImageRegionSplitterSlowDimension::New();
+    const unsigned int numberOfPieces = splitter->GetNumberOfSplits(largestRegion, numberOfStreamDivisions);
+    for(unsigned int piece = 0; piece < numberOfPieces; piece++)
+    {
+      if(getCancel())
+      {
+        return;
+      }
+      typename ImageType::RegionType streamRegion = largestRegion;
+      splitter->GetSplit(piece, numberOfPieces, streamRegion);
+
+      output->SetRequestedRegion(streamRegion);
+      output->PropagateRequestedRegion();
+      output->UpdateOutputData();
+
+      // Pieces span every dimension below the split one, so they are contiguous in the DataArray
+      size_t offset = 0;
+      size_t stride = 1;
+      for(unsigned int d = 0; d < Dimension; d++)
+      {
+        offset += static_cast<size_t>(streamRegion.GetIndex(d) - largestRegion.GetIndex(d)) * stride;
+        stride *= largestRegion.GetSize(d);
+      }
+      OutputPixelType* piecePtr = destination + offset;
+      itk::ImageRegionConstIterator<ImageType> it(output, streamRegion);
+      for(it.GoToBegin(); !it.IsAtEnd(); ++it, ++piecePtr)
+      {
+        *piecePtr = castPixel<OutputPixelType>(it.Get(), std::is_arithmetic<OutputPixelType>());
+      }
+    }
+  }
+
+  /**
+   * @brief castPixel Casts a scalar pixel
+   */
+  template <typename OutputPixelType, typename InputPixelType>
+  static OutputPixelType castPixel(const InputPixelType& value, std::true_type /* isScalar */)
+  {
+    static_assert(std::is_arithmetic<InputPixelType>::value, "A multi-component pixel cannot be cast to a scalar pixel");
+    return static_cast<OutputPixelType>(value);
+  }
+
+  /**
+   * @brief castPixel Casts a vector, RGB or RGBA pixel one component at a time
+   */
+  template <typename OutputPixelType, typename InputPixelType>
+  static OutputPixelType castPixel(const InputPixelType& value, std::false_type /* isScalar */)
+  {
+    using OutputValueType = typename itk::NumericTraits<OutputPixelType>::ValueType;
+    using InputValueType = typename itk::NumericTraits<InputPixelType>::ValueType;
+    constexpr size_t length = sizeof(OutputPixelType) / sizeof(OutputValueType);
+    static_assert(!std::is_arithmetic<InputPixelType>::value && length == sizeof(InputPixelType) / sizeof(InputValueType), "Pixels must have the same number of components");
+
+    OutputPixelType output;
+    for(size_t c = 0; c < length; c++)
+    {
+      output[c] = static_cast<OutputValueType>(value[c]);
+    }
+    return output;
+  }
+
+  /**
+   * @brief connectStages Connects the last stage of a chain to its input and returns it
+   */
+  template <typename InputImageType, typename FilterType>
+  static FilterType* connectStages(const InputImageType* input, itk::Command* observer, FilterType* filter)
+  {
+    filter->SetInput(input);
+    filter->AddObserver(itk::ProgressEvent(), observer);
+    return filter;
+  }
+
+  /**
+   * @brief connectStages Connects an intermediate stage to its input and marks its output for release
+   * once the downstream stage has consumed it, then connects the remaining stages.
+   */
+  template <typename InputImageType, typename FilterType, typename NextFilterType, typename... RemainingFilterTypes>
+  static auto connectStages(const InputImageType* input, itk::Command* observer, FilterType* filter, NextFilterType* next, RemainingFilterTypes*... remaining)
+  {
+    filter->SetInput(input);
+    filter->AddObserver(itk::ProgressEvent(), observer);
+    filter->ReleaseDataFlagOn();
+    return connectStages(filter->GetOutput(), observer, next, remaining...);
+  }
+
   /**
    * @brief Applies the filter
    */
@@ -138,29 +138,38 @@ protected:
   }
 
   /**
-   * @brief Applies the filter
+   * @brief Applies the filter, optionally streamed over numberOfStreamDivisions pieces
    */
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType>
-  void filter(FilterType* filter)
+  void filter(FilterType* filter, unsigned int numberOfStreamDivisions = 1)
   {
     std::string outputArrayName = getSelectedCellArrayPath().getDataArrayName().toStdString();
 
     outputArrayName = getNewCellArrayName().toStdString();
 
-    ITKImageBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, outputArrayName, getSelectedCellArrayPath());
+    ITKImageBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, outputArrayName, getSelectedCellArrayPath(), numberOfStreamDivisions);
+  }
+
+  /**
+   * @brief Applies an ordered list of ITK filters as a single fused pipeline, see ITKImageBase::filterChain
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename... FilterTypes>
+  void filterChain(FilterTypes*... filters)
+  {
+    ITKImageBase::filterChain<InputPixelType, OutputPixelType, Dimension>(getNewCellArrayName().toStdString(), getSelectedCellArrayPath(), filters...);
   }
 
   /**
    * @brief Applies the filter, casting the input to float
    */
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType, typename FloatImageType>
-  void filterCastToFloat(FilterType* filter)
+  void filterCastToFloat(FilterType* filter, unsigned int numberOfStreamDivisions = 1)
   {
     std::string outputArrayName = getSelectedCellArrayPath().getDataArrayName().toStdString();
 
     outputArrayName = getNewCellArrayName().toStdString();
 
-    ITKImageBase::filterCastToFloat<InputPixelType, OutputPixelType, Dimension, FilterType, FloatImageType>(filter, outputArrayName, getSelectedCellArrayPath());
+    ITKImageBase::filterCastToFloat<InputPixelType, OutputPixelType, Dimension, FilterType, FloatImageType>(filter, outputArrayName, getSelectedCellArrayPath(), numberOfStreamDivisions);
   }
 
   /**
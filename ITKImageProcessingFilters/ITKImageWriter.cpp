@@ -32,14 +32,20 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ITKImageWriter.h"
 
-#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <QtCore/QDir>
 
 // ITK includes
 #include <itkImageFileWriter.h>
-#include <itkImageSeriesWriter.h>
-#include <itkNumericSeriesFileNames.h>
+#include <itkImageIOFactory.h>
 #include <itksys/SystemTools.hxx>
 
 /* For registering ImageIO Factories in Python*/
@@ -66,7 +72,7 @@
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/ITK/itkInPlaceDream3DDataToImageFilter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
 
 #define DREAM3D_USE_RGB_RGBA 1
@@ -209,102 +215,428 @@ bool ITKImageWriter::is2DFormat()
   return index != -1;
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename TPixel, unsigned int Dimensions>
-void ITKImageWriter::writeAs2DStack(typename itk::Image<TPixel, Dimensions>* image, unsigned long z_size)
+namespace
 {
-  typedef itk::NumericSeriesFileNames NamesGeneratorType;
-  NamesGeneratorType::Pointer namesGenerator = NamesGeneratorType::New();
-  std::string path = itksys::SystemTools::GetFilenamePath(getFileName().toStdString());
-  std::string filename = itksys::SystemTools::GetFilenameWithoutExtension(getFileName().toStdString());
-  std::string extension = itksys::SystemTools::GetFilenameExtension(getFileName().toStdString());
-  std::string format = path + "/" + filename + "%03d" + extension;
-  namesGenerator->SetSeriesFormat(format);
-  namesGenerator->SetIncrementIndex(1);
-  namesGenerator->SetStartIndex(0);
-  namesGenerator->SetEndIndex(z_size - 1);
-  typedef itk::Image<TPixel, Dimensions> InputImageType;
-  typedef itk::Image<TPixel, Dimensions - 1> OutputImageType;
-  typedef itk::ImageSeriesWriter<InputImageType, OutputImageType> SeriesWriterType;
-  typename SeriesWriterType::Pointer writer = SeriesWriterType::New();
-  writer->SetInput(image);
-  writer->SetFileNames(namesGenerator->GetFileNames());
-  writer->UseCompressionOn();
-  writer->Update();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename TPixel, unsigned int Dimensions>
-void ITKImageWriter::writeAsOneFile(typename itk::Image<TPixel, Dimensions>* image)
+/**
+ * @brief Writes every slice of one plane of a volume to its own file. A few threads copy slices
+ * out of the volume into reusable 2D images while a larger pool compresses and writes them, so
+ * the copies overlap with the disk I/O. The number of images in flight is bounded, which bounds
+ * the queue between the two pools. Both pools are sized by the number of slices, and a single
+ * slice is written on the calling thread without starting any pool.
+ */
+template <typename TPixel>
+class SliceWriterEngine
 {
-  typedef itk::Image<TPixel, Dimensions> ImageType;
-  typedef itk::ImageFileWriter<ImageType> FileWriterType;
-  typename FileWriterType::Pointer writer = FileWriterType::New();
+public:
+  using ImageType = itk::Image<TPixel, 2>;
+  using ImagePointerType = typename ImageType::Pointer;
+  using FileWriterType = itk::ImageFileWriter<ImageType>;
+
+  SliceWriterEngine(const TPixel* source, const SizeVec3Type& dims, int plane, std::vector<std::string> fileNames)
+  : m_Source(source)
+  , m_Dims(dims)
+  , m_Plane(plane)
+  , m_FileNames(std::move(fileNames))
+  {
+    m_Width = (m_Plane == ITKImageWriter::YZPlane) ? m_Dims[1] : m_Dims[0];
+    m_Height = (m_Plane == ITKImageWriter::XYPlane) ? m_Dims[1] : m_Dims[2];
+  }
+  ~SliceWriterEngine()
+  {
+    stop();
+    join();
+  }
+  SliceWriterEngine(const SliceWriterEngine&) = delete;            // Copy Constructor Not Implemented
+  SliceWriterEngine(SliceWriterEngine&&) = delete;                 // Move Constructor Not Implemented
+  SliceWriterEngine& operator=(const SliceWriterEngine&) = delete; // Copy Assignment Not Implemented
+  SliceWriterEngine& operator=(SliceWriterEngine&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Writes all of the slices and reports progress and the first error on the filter. Must be
+   * called from the thread that runs the filter.
+   * @param filter
+   */
+  void run(ITKImageWriter* filter)
+  {
+    const size_t numSlices = m_FileNames.size();
+    if(numSlices == 0)
+    {
+      return;
+    }
+    if(numSlices == 1)
+    {
+      m_MaxImages = 1;
+      ImagePointerType image = acquireImage();
+      if(image.IsNotNull())
+      {
+        copySlice(0, image->GetBufferPointer());
+        writeSlice(itk::ImageIOBase::Pointer(), {0, image});
+      }
+      reportError(filter);
+      return;
+    }
 
-  QString progress = QString("Saving %1").arg(getFileName());
-  notifyStatusMessage(progress);
+    // Copying a slice is much cheaper than compressing it, so one extractor feeds about four writers
+    const size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1U);
+    const size_t numWriters = std::min(hardwareThreads, numSlices);
+    const size_t numExtractors = std::max<size_t>(numWriters / 4, 1);
 
-  writer->SetInput(image);
-  writer->SetFileName(getFileName().toStdString().c_str());
-  writer->UseCompressionOn();
-  writer->Update();
-}
+    // One image per thread plus a full queue for the writers to drain
+    m_MaxImages = std::min(numExtractors + 2 * numWriters, numSlices);
+    m_ActiveExtractors = numExtractors;
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename TPixel, typename UnusedTPixel, unsigned int Dimensions>
-void ITKImageWriter::writeImage()
-{
-  using ImageType = itk::Image<TPixel, Dimensions>;
-  using ToITKType = itk::InPlaceDream3DDataToImageFilter<TPixel, Dimensions>;
+    // ImageIO objects are looked up once here so that the writers do not hit the factory concurrently
+    std::vector<itk::ImageIOBase::Pointer> imageIOs(numWriters);
+    for(auto& imageIO : imageIOs)
+    {
+      imageIO = itk::ImageIOFactory::CreateImageIO(m_FileNames[0].c_str(), itk::ImageIOFactory::WriteMode);
+    }
 
-  DataArrayPath path = getImageArrayPath();
-  DataContainer::Pointer container = getDataContainerArray()->getDataContainer(path.getDataContainerName());
+    for(size_t i = 0; i < numExtractors; i++)
+    {
+      m_Threads.emplace_back([this] { runGuarded([this] { extractSlices(); }); });
+    }
+    for(size_t i = 0; i < numWriters; i++)
+    {
+      itk::ImageIOBase::Pointer imageIO = imageIOs[i];
+      m_Threads.emplace_back([this, imageIO] { runGuarded([this, imageIO] { writeSlices(imageIO); }); });
+    }
+
+    size_t written = 0;
+    size_t reported = numSlices;
+    while(true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Progress.wait_for(lock, std::chrono::milliseconds(100), [&] { return m_Stop || m_Written != written; });
+        written = m_Written;
+        if(m_Stop || written == numSlices)
+        {
+          break;
+        }
+      }
+      if(written != reported)
+      {
+        filter->notifyStatusMessage(QString("Writing slice %1 of %2").arg(written + 1).arg(numSlices));
+        reported = written;
+      }
+      if(filter->getCancel())
+      {
+        stop();
+        break;
+      }
+    }
+    join();
+    reportError(filter);
+  }
+
+private:
+  struct ExtractedSlice
+  {
+    size_t slice = 0;
+    ImagePointerType image;
+  };
+
+  const TPixel* m_Source = nullptr;
+  SizeVec3Type m_Dims;
+  int m_Plane = ITKImageWriter::XYPlane;
+  std::vector<std::string> m_FileNames;
+  size_t m_Width = 0;
+  size_t m_Height = 0;
+
+  std::vector<std::thread> m_Threads;
+  std::atomic<size_t> m_NextSlice = {0};
+  std::mutex m_Mutex;
+  std::condition_variable m_ImageAvailable;
+  std::condition_variable m_NotEmpty;
+  std::condition_variable m_Progress;
+  std::deque<ExtractedSlice> m_Queue;
+  std::vector<ImagePointerType> m_FreeImages;
+  size_t m_NumImages = 0;
+  size_t m_MaxImages = 1;
+  size_t m_ActiveExtractors = 0;
+  size_t m_Written = 0;
+  bool m_Stop = false;
+  int32_t m_ErrorCode = 0;
+  QString m_ErrorMessage;
+
+  void stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Stop = true;
+    }
+    m_ImageAvailable.notify_all();
+    m_NotEmpty.notify_all();
+    m_Progress.notify_all();
+  }
 
-  try
+  void join()
   {
-    typename ToITKType::Pointer toITK = ToITKType::New();
-    toITK->SetInput(container);
-    toITK->SetAttributeMatrixArrayName(path.getAttributeMatrixName().toStdString());
-    toITK->SetDataArrayName(path.getDataArrayName().toStdString());
-    toITK->SetInPlace(true);
-    toITK->Update();
-    if(this->is2DFormat() && Dimensions == 3)
+    for(auto& thread : m_Threads)
     {
-      typename ImageType::SizeType size = toITK->GetOutput()->GetLargestPossibleRegion().GetSize();
-      if(size[2] < 2)
+      if(thread.joinable())
       {
-        setErrorCondition(-21012, "Image is 2D, not 3D.");
-        return;
+        thread.join();
+      }
+    }
+    m_Threads.clear();
+  }
+
+  void reportError(ITKImageWriter* filter) const
+  {
+    if(m_ErrorCode < 0)
+    {
+      filter->setErrorCondition(m_ErrorCode, m_ErrorMessage);
+    }
+  }
+
+  /**
+   * @brief Runs the body of a pool thread. An exception must not escape a std::thread, so anything the
+   * body did not handle itself stops the engine and is reported as an error.
+   */
+  template <typename Body>
+  void runGuarded(Body body)
+  {
+    try
+    {
+      body();
+    } catch(std::exception& err)
+    {
+      fail(-21016, QString("Unexpected exception while writing the slices: %1").arg(err.what()));
+    } catch(...)
+    {
+      fail(-21016, "Unknown exception while writing the slices");
+    }
+  }
+
+  void fail(int32_t code, const QString& message)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      if(m_ErrorCode == 0)
+      {
+        m_ErrorCode = code;
+        m_ErrorMessage = message;
+      }
+    }
+    stop();
+  }
+
+  /**
+   * @brief Returns a free image, allocating a new one while the pool is below its limit. Returns
+   * a null pointer once the engine has stopped.
+   */
+  ImagePointerType acquireImage()
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_Mutex);
+      m_ImageAvailable.wait(lock, [this] { return m_Stop || !m_FreeImages.empty() || m_NumImages < m_MaxImages; });
+      if(m_Stop)
+      {
+        return ImagePointerType();
+      }
+      if(!m_FreeImages.empty())
+      {
+        ImagePointerType image = m_FreeImages.back();
+        m_FreeImages.pop_back();
+        return image;
+      }
+      m_NumImages++;
+    }
+
+    try
+    {
+      typename ImageType::SizeType size;
+      size[0] = m_Width;
+      size[1] = m_Height;
+      typename ImageType::RegionType region;
+      region.SetSize(size);
+      ImagePointerType image = ImageType::New();
+      image->SetRegions(region);
+      image->Allocate();
+      return image;
+    } catch(std::exception& err)
+    {
+      fail(-21013, QString("Unable to allocate a %1 x %2 slice image: %3").arg(m_Width).arg(m_Height).arg(err.what()));
+    }
+    return ImagePointerType();
+  }
+
+  void copySlice(size_t slice, TPixel* destination) const
+  {
+    const size_t dimX = m_Dims[0];
+    const size_t dimY = m_Dims[1];
+    const size_t dimZ = m_Dims[2];
+    if(m_Plane == ITKImageWriter::XYPlane)
+    {
+      const TPixel* plane = m_Source + slice * dimX * dimY;
+      std::copy(plane, plane + dimX * dimY, destination);
+    }
+    else if(m_Plane == ITKImageWriter::XZPlane)
+    {
+      // Every Z level contributes one contiguous X row
+      for(size_t z = 0; z < dimZ; z++)
+      {
+        const TPixel* row = m_Source + (z * dimY + slice) * dimX;
+        std::copy(row, row + dimX, destination + z * dimX);
       }
-      this->writeAs2DStack<TPixel, Dimensions>(toITK->GetOutput(), size[2]);
     }
     else
     {
-      this->writeAsOneFile<TPixel, Dimensions>(toITK->GetOutput());
+      for(size_t z = 0; z < dimZ; z++)
+      {
+        const TPixel* column = m_Source + z * dimX * dimY + slice;
+        TPixel* row = destination + z * dimY;
+        for(size_t y = 0; y < dimY; y++)
+        {
+          row[y] = column[y * dimX];
+        }
+      }
+    }
+  }
+
+  void extractSlices()
+  {
+    while(true)
+    {
+      const size_t slice = m_NextSlice++;
+      if(slice >= m_FileNames.size())
+      {
+        break;
+      }
+      ImagePointerType image = acquireImage();
+      if(image.IsNull())
+      {
+        break;
+      }
+      copySlice(slice, image->GetBufferPointer());
+      {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Queue.push_back({slice, image});
+      }
+      m_NotEmpty.notify_one();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_ActiveExtractors--;
+    }
+    m_NotEmpty.notify_all();
+  }
+
+  void writeSlices(itk::ImageIOBase::Pointer imageIO)
+  {
+    while(true)
+    {
+      ExtractedSlice extracted;
+      {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotEmpty.wait(lock, [this] { return m_Stop || !m_Queue.empty() || m_ActiveExtractors == 0; });
+        if(m_Stop || m_Queue.empty())
+        {
+          return;
+        }
+        extracted = m_Queue.front();
+        m_Queue.pop_front();
+      }
+
+      if(!writeSlice(imageIO, extracted))
+      {
+        return;
+      }
+    }
+  }
+
+  /**
+   * @brief Writes one extracted slice and returns its image to the pool. Returns false if the write failed.
+   */
+  bool writeSlice(const itk::ImageIOBase::Pointer& imageIO, const ExtractedSlice& extracted)
+  {
+    try
+    {
+      typename FileWriterType::Pointer writer = FileWriterType::New();
+      if(imageIO.IsNotNull())
+      {
+        writer->SetImageIO(imageIO);
+      }
+      writer->SetInput(extracted.image);
+      writer->SetFileName(m_FileNames[extracted.slice]);
+      writer->UseCompressionOn();
+      writer->Update();
+    } catch(itk::ExceptionObject& err)
+    {
+      QString errorMessage = "ITK exception was thrown while writing output file: %1";
+      fail(-21011, errorMessage.arg(err.GetDescription()));
+      return false;
+    } catch(std::exception& err)
+    {
+      QString errorMessage = "Exception was thrown while writing output file %1: %2";
+      fail(-21015, errorMessage.arg(QString::fromStdString(m_FileNames[extracted.slice])).arg(err.what()));
+      return false;
     }
-  } catch(itk::ExceptionObject& err)
+
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_FreeImages.push_back(extracted.image);
+      m_Written++;
+    }
+    m_ImageAvailable.notify_one();
+    m_Progress.notify_one();
+    return true;
+  }
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename TPixel, typename UnusedTPixel, unsigned int Dimension>
+void ITKImageWriter::writeSlices()
+{
+  DataArrayPath path = getImageArrayPath();
+  DataContainer::Pointer container = getDataContainerArray()->getDataContainer(path.getDataContainerName());
+  IDataArray::Pointer currentData = container->getAttributeMatrix(path.getAttributeMatrixName())->getAttributeArray(path.getDataArrayName());
+  if(sizeof(TPixel) != currentData->getTypeSize() * currentData->getNumberOfComponents())
   {
-    QString errorMessage = "ITK exception was thrown while writing output file: %1";
-    setErrorCondition(-21011, errorMessage.arg(err.GetDescription()));
+    QString errorMessage = "The %1 components of array %2 do not match the size of the pixel type.";
+    setErrorCondition(-21014, errorMessage.arg(currentData->getNumberOfComponents()).arg(path.getDataArrayName()));
     return;
   }
-}
 
-#define ITKIW_PREP_DC(dimA, dimB)                                                                                                                                                                      \
-  size_t dA = dimA;                                                                                                                                                                                    \
-  size_t dB = dimB;                                                                                                                                                                                    \
-  size_t numElements = dA * dB;                                                                                                                                                                        \
-  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, attributeMatrix->getName(), AttributeMatrix::Type::Cell);                                                                                  \
-  dc->addOrReplaceAttributeMatrix(am);                                                                                                                                                                 \
-  imageGeom->setDimensions(tDims.data());                                                                                                                                                              \
-  IDataArray::Pointer sliceData = currentData->createNewArray(numElements, cDims, currentData->getName(), true);                                                                                       \
-  am->insertOrAssign(sliceData);
+  SizeVec3Type dims = container->getGeometryAs<ImageGeom>()->getDimensions();
+  size_t numSlices = 0;
+  if(ITKImageWriter::XYPlane == m_Plane)
+  {
+    numSlices = dims[2];
+  }
+  else if(ITKImageWriter::XZPlane == m_Plane)
+  {
+    numSlices = dims[1];
+  }
+  else if(ITKImageWriter::YZPlane == m_Plane)
+  {
+    numSlices = dims[0];
+  }
+
+  // Every file name is known up front so the writer threads never touch the filter
+  QFileInfo fi(getFileName());
+  QString basePath = fi.absolutePath() + "/" + fi.completeBaseName();
+  std::vector<std::string> fileNames(numSlices);
+  for(size_t slice = 0; slice < numSlices; slice++)
+  {
+    QString adjustedFilePath = basePath;
+    if(numSlices != 1)
+    {
+      adjustedFilePath += QString("_%1").arg(slice);
+    }
+    adjustedFilePath += "." + fi.suffix();
+    fileNames[slice] = adjustedFilePath.toStdString();
+  }
+
+  SliceWriterEngine<TPixel> engine(static_cast<const TPixel*>(currentData->getVoidPointer(0)), dims, m_Plane, std::move(fileNames));
+  engine.run(this);
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -354,110 +686,7 @@ void ITKImageWriter::execute()
     return;
   }
 
-  ImageGeom::Pointer currentGeom = container->getGeometryAs<ImageGeom>();
-  SizeVec3Type dims = currentGeom->getDimensions();
-
-  DataContainerArray::Pointer dca = DataContainerArray::New();
-  DataContainer::Pointer dc = DataContainer::New(container->getName());
-  dca->addOrReplaceDataContainer(dc);
-  ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(attributeMatrix->getName());
-  dc->setGeometry(imageGeom);
-
-  IDataArray::Pointer currentData = attributeMatrix->getAttributeArray(path.getDataArrayName());
-  size_t nComp = currentData->getNumberOfComponents();
-  std::vector<size_t> cDims = {static_cast<size_t>(currentData->getNumberOfComponents())};
-
-  if(ITKImageWriter::XYPlane == m_Plane) // XY plane
-  {
-    std::vector<size_t> tDims = {dims[0], dims[1], 1};
-    ITKIW_PREP_DC(dims[0], dims[1])
-
-    for(size_t slice = 0; slice < dims[2]; ++slice)
-    {
-      for(size_t axisA = 0; axisA < dA; ++axisA)
-      {
-        for(size_t axisB = 0; axisB < dB; ++axisB)
-        {
-          size_t index = (slice * dA * dB) + (axisA * dB) + axisB;
-          copyTuple(index, axisA, dB, axisB, nComp, currentData.get(), sliceData.get());
-        }
-      }
-      saveImageData(dca, slice, dims[2]);
-    }
-  }
-  else if(ITKImageWriter::XZPlane == m_Plane) // XZ plane
-  {
-    std::vector<size_t> tDims = {dims[0], dims[2], 1};
-    ITKIW_PREP_DC(dims[2], dims[0])
-
-    for(size_t slice = 0; slice < dims[1]; ++slice)
-    {
-      for(size_t axisA = 0; axisA < dA; ++axisA)
-      {
-        for(size_t axisB = 0; axisB < dB; ++axisB)
-        {
-          size_t index = (dims[1] * axisA * dB) + (slice * dB) + axisB;
-          copyTuple(index, axisA, dB, axisB, nComp, currentData.get(), sliceData.get());
-        }
-      }
-      saveImageData(dca, slice, dims[1]);
-    }
-  }
-  else if(ITKImageWriter::YZPlane == m_Plane) // YZ plane
-  {
-    std::vector<size_t> tDims = {dims[1], dims[2], 1};
-    ITKIW_PREP_DC(dims[2], dims[1])
-
-    for(size_t slice = 0; slice < dims[0]; ++slice) // X
-    {
-      for(size_t axisA = 0; axisA < dA; ++axisA) // Z
-      {
-        for(size_t axisB = 0; axisB < dB; ++axisB) // Y
-        {
-          size_t index = (dims[0] * axisA * dB) + (axisB * dims[0]) + slice;
-          copyTuple(index, axisA, dB, axisB, nComp, currentData.get(), sliceData.get());
-        }
-      }
-      saveImageData(dca, slice, dims[0]);
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ITKImageWriter::copyTuple(size_t index, size_t axisA, size_t dB, size_t axisB, size_t nComp, IDataArray* currentData, IDataArray* sliceData)
-{
-  size_t indexNew = (axisA * dB) + axisB;
-
-  void* source = currentData->getVoidPointer((nComp * index));
-  void* destination = sliceData->getVoidPointer(nComp * indexNew);
-  ::memcpy(destination, source, currentData->getTypeSize() * nComp);
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ITKImageWriter::saveImageData(DataContainerArray::Pointer dca, size_t slice, size_t maxSlice)
-{
-  QString originalFileName = getFileName();
-  QFileInfo fi(originalFileName);
-
-  QString adjustedFilePath;
-  QTextStream out(&adjustedFilePath);
-  out << fi.absolutePath() << "/" << fi.completeBaseName();
-  if(maxSlice != 1)
-  {
-    out << "_" << slice;
-  }
-  out << "." << fi.suffix();
-
-  setFileName(adjustedFilePath);
-  DataContainerArray::Pointer originalDataContainerArray = getDataContainerArray();
-  setDataContainerArray(dca);
-  Dream3DArraySwitchMacro(this->writeImage, getImageArrayPath(), -21010);
-  setDataContainerArray(originalDataContainerArray);
-  setFileName(originalFileName);
+  Dream3DArraySwitchMacro(this->writeSlices, getImageArrayPath(), -21010);
 }
 
 // -----------------------------------------------------------------------------
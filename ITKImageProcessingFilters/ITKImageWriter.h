@@ -213,47 +213,17 @@ protected:
   void initialize();
 
   /**
-   * @brief Converts Dream3D data to an ITK image and calls the actual writer.
+   * @brief Extracts every slice of the selected plane and writes each one to its own file.
+   * Slices are always written as 2D images, so the Dimension of the input is not used.
    */
   template <typename TPixel, typename UnusedTPixel, unsigned int Dimension>
-  void writeImage();
-
-  /**
-   * @brief writeAs2DStack Writes 3D images as a stack of 2D images.
-   */
-  template <typename TPixel, unsigned int Dimensions>
-  void writeAs2DStack(typename itk::Image<TPixel, Dimensions>* image, unsigned long z_size);
-
-  /**
-   * @brief writeAsOneFile Writes images as one file.
-   */
-  template <typename TPixel, unsigned int Dimensions>
-  void writeAsOneFile(typename itk::Image<TPixel, Dimensions>* image);
+  void writeSlices();
 
 private:
   QString m_FileName = {""};
   DataArrayPath m_ImageArrayPath = {"", "", ""};
   int m_Plane = {};
 
-  /**
-   * @brief copyTuple
-   * @param index
-   * @param axisA
-   * @param dB
-   * @param axisB
-   * @param nComp
-   * @param currentData
-   * @param sliceData
-   */
-  void copyTuple(size_t index, size_t axisA, size_t dB, size_t axisB, size_t nComp, IDataArray* currentData, IDataArray* sliceData);
-  /**
-   * @brief saveImageData
-   * @param dca
-   * @param slice
-   * @param maxSlice
-   */
-  void saveImageData(DataContainerArray::Pointer dca, size_t slice, size_t maxSlice);
-
 public:
   ITKImageWriter(const ITKImageWriter&) = delete;            // Copy Constructor Not Implemented
   ITKImageWriter(ITKImageWriter&&) = delete;                 // Move Constructor Not Implemented
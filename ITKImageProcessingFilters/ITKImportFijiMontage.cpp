@@ -412,9 +412,9 @@ void ITKImportFijiMontage::generateCache()
 
   FloatVec3Type minCoord = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
   FloatVec3Type minSpacing = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
-  std::vector<ImageGeom::Pointer> geometries;
 
-  // Get the meta information from disk for each image
+  std::vector<QString> fileNames;
+  fileNames.reserve(bounds.size());
   for(auto& bound : bounds)
   {
     // This will update the FileName to the absolutePath
@@ -422,60 +422,28 @@ void ITKImportFijiMontage::generateCache()
     QString absolutePath = fi.absolutePath() + QDir::separator() + bound.Filename;
     bound.Filename = absolutePath;
     bound.LengthUnit = static_cast<IGeometry::LengthUnit>(getLengthUnit());
+    fileNames.push_back(bound.Filename);
+  }
 
-    DataArrayPath dap(::k_DCName, ITKImageProcessing::Montage::k_AMName, ITKImageProcessing::Montage::k_AAName);
-    AbstractFilter::Pointer imageImportFilter = MontageImportHelper::CreateImageImportFilter(this, bound.Filename, dap);
-    imageImportFilter->preflight();
-    if(imageImportFilter->getErrorCode() < 0)
-    {
-      setErrorCondition(imageImportFilter->getErrorCode(), "Error Preflighting Image Import Filter.");
-      continue;
-    }
+  // Get the meta information for each image from the tile header index, reading only the tiles that changed
+  std::vector<MontageImportHelper::TileHeader> headers =
+      MontageImportHelper::ReadTileHeaders(this, getInputFile(), fileNames, getImageDataArrayName(), getConvertToGrayScale(), getColorWeights());
 
-    DataContainerArray::Pointer importImageDca = imageImportFilter->getDataContainerArray();
+  for(size_t i = 0; i < bounds.size(); i++)
+  {
+    BoundsType& bound = bounds[i];
+    if(headers[i].ImageDataProxy.get() == nullptr)
     {
-      DataContainer::Pointer fromDc = importImageDca->getDataContainer(::k_DCName);
-      AttributeMatrix::Pointer fromCellAttrMat = fromDc->getAttributeMatrix(ITKImageProcessing::Montage::k_AMName);
-      IDataArray::Pointer fromImageData = fromCellAttrMat->getAttributeArray(ITKImageProcessing::Montage::k_AAName);
-      fromImageData->setName(getImageDataArrayName());
-      bound.ImageDataProxy = fromImageData;
-
-      // Set the Origin based on the values from the Fiji Config File
-      // Set the spacing to the default 1,1,1
-      ImageGeom::Pointer imageGeom = fromDc->getGeometryAs<ImageGeom>();
-      bound.Dims = imageGeom->getDimensions();
-      imageGeom->setSpacing(bound.Spacing);
-      imageGeom->setOrigin(bound.Origin);
-      minSpacing = imageGeom->getSpacing();
-      //
-      minCoord[0] = std::min(bound.Origin[0], minCoord[0]);
-      minCoord[1] = std::min(bound.Origin[1], minCoord[1]);
-      minCoord[2] = 0.0f;
-      geometries.push_back(imageGeom);
+      continue;
     }
+    bound.ImageDataProxy = headers[i].ImageDataProxy;
+    bound.Dims = headers[i].Dims;
 
-    if(getConvertToGrayScale())
-    {
-      DataArrayPath daPath(::k_DCName, ITKImageProcessing::Montage::k_AMName, ITKImageProcessing::Montage::k_AAName);
-      AbstractFilter::Pointer grayScaleFilter = MontageImportHelper::CreateColorToGrayScaleFilter(this, daPath, getColorWeights(), ITKImageProcessing::Montage::k_GrayScaleTempArrayName);
-      grayScaleFilter->setDataContainerArray(importImageDca);
-      grayScaleFilter->preflight();
-      if(grayScaleFilter->getErrorCode() < 0)
-      {
-        setErrorCondition(grayScaleFilter->getErrorCode(), "Error Preflighting Color to GrayScale filter");
-        continue;
-      }
-
-      DataContainerArray::Pointer colorToGrayDca = grayScaleFilter->getDataContainerArray();
-      DataContainer::Pointer fromDc = colorToGrayDca->getDataContainer(::k_DCName);
-      AttributeMatrix::Pointer fromCellAttrMat = fromDc->getAttributeMatrix(ITKImageProcessing::Montage::k_AMName);
-      // Remove the RGB Attribute Array so we can rename the gray scale AttributeArray
-      IDataArray::Pointer rgbImageArray = fromCellAttrMat->removeAttributeArray(ITKImageProcessing::Montage::k_AAName);
-      QString grayScaleArrayName = ITKImageProcessing::Montage::k_GrayScaleTempArrayName + ITKImageProcessing::Montage::k_AAName;
-      IDataArray::Pointer fromGrayScaleData = fromCellAttrMat->removeAttributeArray(grayScaleArrayName);
-      fromGrayScaleData->setName(getImageDataArrayName());
-      bound.ImageDataProxy = fromGrayScaleData;
-    }
+    // The Origin comes from the Fiji Config File and the spacing is the default 1,1,1
+    minSpacing = bound.Spacing;
+    minCoord[0] = std::min(bound.Origin[0], minCoord[0]);
+    minCoord[1] = std::min(bound.Origin[1], minCoord[1]);
+    minCoord[2] = 0.0f;
 
     d_ptr->m_MaxCol = std::max(bound.Col, d_ptr->m_MaxCol);
     d_ptr->m_MaxRow = std::max(bound.Row, d_ptr->m_MaxRow);
@@ -501,13 +469,9 @@ void ITKImportFijiMontage::generateCache()
       overrideSpacing = m_Spacing;
     }
     FloatVec3Type delta = {minCoord[0] - overrideOrigin[0], minCoord[1] - overrideOrigin[1], minCoord[2] - overrideOrigin[2]};
-    for(size_t i = 0; i < geometries.size(); i++)
+    for(auto& bound : bounds)
     {
-      ImageGeom::Pointer imageGeom = geometries[i];
-      BoundsType& bound = bounds.at(i);
       std::transform(bound.Origin.begin(), bound.Origin.end(), delta.begin(), bound.Origin.begin(), std::minus<>());
-      imageGeom->setOrigin(bound.Origin); // Sync up the ImageGeom with the calculated values
-      imageGeom->setSpacing(overrideSpacing);
     }
   }
   ss << "\nOrigin: " << overrideOrigin[0] << ", " << overrideOrigin[1] << ", " << overrideOrigin[2];
@@ -593,6 +557,7 @@ void ITKImportFijiMontage::readImages()
   int32_t colCountPadding = MetaXmlUtils::CalculatePaddingDigits(m_ColumnCount);
   int charPaddingCount = std::max(rowCountPadding, colCountPadding);
 
+  std::vector<MontageImportHelper::TileImportInfo> tiles;
   for(const auto& bound : bounds)
   {
     if(bound.Row < m_MontageStart[1] || bound.Row > m_MontageEnd[1] || bound.Col < m_MontageStart[0] || bound.Col > m_MontageEnd[0])
@@ -600,10 +565,6 @@ void ITKImportFijiMontage::readImages()
       continue;
     }
 
-    QString msg;
-    QTextStream out(&msg);
-    out << "Importing " << bound.Filename;
-    notifyStatusMessage(msg);
     // Create our DataContainer Name using a Prefix and a rXXcYY format.
     QString dcName = getDataContainerPath().getDataContainerName();
     QTextStream dcNameStream(&dcName);
@@ -624,65 +585,16 @@ void ITKImportFijiMontage::readImages()
 
     image->setUnits(static_cast<IGeometry::LengthUnit>(m_LengthUnit));
 
-    // Create the Image Geometry
-    SizeVec3Type dims = image->getDimensions();
-    // FloatVec3Type origin = image->getOrigin();
-    // FloatVec3Type spacing = image->getSpacing();
-
-    std::vector<size_t> tDims = {dims[0], dims[1], dims[2]};
     // The Cell AttributeMatrix is also already created at this point
-    AttributeMatrix::Pointer cellAttrMat = dc->getAttributeMatrix(getCellAttributeMatrixName());
-    // Instantiate the Image Import Filter to actually read the image into a data array
-    DataArrayPath dap(::k_DCName, ITKImageProcessing::Montage::k_AMName, getImageDataArrayName()); // This is just a temp path for the subfilter to use
-    AbstractFilter::Pointer imageImportFilter = MontageImportHelper::CreateImageImportFilter(this, bound.Filename, dap);
-    if(nullptr == imageImportFilter.get())
-    {
-      continue;
-    }
-    // This same filter was used to preflight so as long as nothing changes on disk this really should work....
-    imageImportFilter->execute();
-    if(imageImportFilter->getErrorCode() < 0)
-    {
-      setErrorCondition(imageImportFilter->getErrorCode(), "Error Executing Image Import Filter.");
-      continue;
-    }
-    // Now transfer the image data from the actual image data read from disk into our existing Attribute Matrix
-    DataContainerArray::Pointer importImageDca = imageImportFilter->getDataContainerArray();
-    DataContainer::Pointer fromDc = importImageDca->getDataContainer(::k_DCName);
-    AttributeMatrix::Pointer fromCellAttrMat = fromDc->getAttributeMatrix(ITKImageProcessing::Montage::k_AMName);
-    // IDataArray::Pointer fromImageData = fromCellAttrMat->getAttributeArray(getImageDataArrayName());
-
-    if(getConvertToGrayScale())
-    {
-      AbstractFilter::Pointer grayScaleFilter = MontageImportHelper::CreateColorToGrayScaleFilter(this, dap, getColorWeights(), ITKImageProcessing::Montage::k_GrayScaleTempArrayName);
-      grayScaleFilter->setDataContainerArray(importImageDca); // Use the Data COntainer array that was use for the import. It is setup and ready to go
-      connect(grayScaleFilter.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), this, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)));
-      grayScaleFilter->execute();
-      if(grayScaleFilter->getErrorCode() < 0)
-      {
-        setErrorCondition(grayScaleFilter->getErrorCode(), "Error Executing Color to GrayScale filter");
-        continue;
-      }
-
-      DataContainerArray::Pointer c2gDca = grayScaleFilter->getDataContainerArray();
-      DataContainer::Pointer c2gDc = c2gDca->getDataContainer(::k_DCName);
-      AttributeMatrix::Pointer c2gAttrMat = c2gDc->getAttributeMatrix(ITKImageProcessing::Montage::k_AMName);
-
-      QString grayScaleArrayName = ITKImageProcessing::Montage::k_GrayScaleTempArrayName + getImageDataArrayName();
-      // IDataArray::Pointer fromGrayScaleData = fromCellAttrMat->getAttributeArray(grayScaleArrayName);
-
-      IDataArray::Pointer rgbImageArray = c2gAttrMat->removeAttributeArray(ITKImageProcessing::Montage::k_AAName);
-      IDataArray::Pointer gray = c2gAttrMat->removeAttributeArray(grayScaleArrayName);
-      gray->setName(getImageDataArrayName());
-      cellAttrMat->addOrReplaceAttributeArray(gray);
-    }
-    else
-    {
-      // Copy the IDataArray (which contains the image data) from the temp data container array into our persistent data structure
-      IDataArray::Pointer gray = fromCellAttrMat->removeAttributeArray(getImageDataArrayName());
-      cellAttrMat->addOrReplaceAttributeArray(gray);
-    }
+    MontageImportHelper::TileImportInfo tile;
+    tile.FileName = bound.Filename;
+    tile.CellAttributeMatrix = dc->getAttributeMatrix(getCellAttributeMatrixName());
+    tile.EstimatedBytes = MontageImportHelper::EstimateTileBytes(image->getDimensions(), bound.ImageDataProxy, getConvertToGrayScale());
+    tiles.push_back(tile);
   }
+
+  notifyStatusMessage(QString("Importing %1 images").arg(tiles.size()));
+  MontageImportHelper::ReadTiles(this, tiles, getImageDataArrayName(), getConvertToGrayScale(), getColorWeights());
 }
 
 // -----------------------------------------------------------------------------
@@ -34,6 +34,17 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ITKImportImageStack.h"
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#endif
+
 #include <QtCore/QFileInfo>
 
 #include "SIMPLib/Common/Constants.h"
@@ -266,11 +277,132 @@ void ITKImportImageStack::dataCheck()
   cellAttrMat->addOrReplaceAttributeArray(resizedImageDataPtr);
 }
 
+namespace
+{
+/**
+ * @brief The SliceResult struct holds the outcome of reading one slice of the stack
+ */
+struct SliceResult
+{
+  int32_t errorCode = 0;
+  QString message;
+};
+
+/**
+ * @brief Reads the slice with a full ITKImageReader sub filter and copies it into the stack.  This
+ * handles files whose pixels ITK has to convert, which cannot be decoded straight into the stack.
+ */
+template <typename TPixel>
+SliceResult readSliceWithReader(const QString& filePath, size_t slice, const SizeVec3Type& dims, DataArray<TPixel>& outputData)
+{
+  using DataArrayType = DataArray<TPixel>;
+  using DataArrayPointerType = typename DataArrayType::Pointer;
+
+  SliceResult result;
+  const QString dcName = "Slice";
+  const QString attrMatName = "CellData";
+  const QString arrayName = "ImageData";
+
+  ITKImageReader::Pointer imageReader = ITKImageReader::New();
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  imageReader->setDataContainerArray(dca);
+  imageReader->setDataContainerName(DataArrayPath(dcName, "", ""));
+  imageReader->setCellAttributeMatrixName(attrMatName);
+  imageReader->setImageDataArrayName(arrayName);
+  imageReader->setFileName(filePath);
+  imageReader->execute();
+  if(imageReader->getErrorCode() < 0)
+  {
+    result.errorCode = imageReader->getErrorCode();
+    result.message = QString("Error reading image %1").arg(filePath);
+    return result;
+  }
+
+  // Check the ImageGeometry of the imported Image matches the destination
+  ImageGeom::Pointer importedImageGeom = dca->getDataContainer(dcName)->template getGeometryAs<ImageGeom>();
+  SizeVec3Type importedDims = importedImageGeom->getDimensions();
+  if(dims[0] != importedDims[0] || dims[1] != importedDims[1])
+  {
+    QTextStream out(&result.message);
+    out << "Slice " << slice << " image dimensions are different than the first slice.\n";
+    out << "  First Slice Dims are:  " << dims[0] << " x " << dims[1] << "\n";
+    out << "  Current Slice Dims are:" << importedDims[0] << " x " << importedDims[1] << "\n";
+    result.errorCode = -64510;
+    return result;
+  }
+
+  // Compute the Tuple Index we are at:
+  size_t tuplesPerSlice = dims[0] * dims[1];
+  size_t tupleIndex = slice * tuplesPerSlice;
+  // get the current Slice data...
+  DataArrayPointerType tempData = dca->getDataContainer(dcName)->getAttributeMatrix(attrMatName)->template getAttributeArrayAs<DataArrayType>(arrayName);
+  // Copy that into the output array...
+  if(nullptr == tempData || !outputData.copyFromArray(tupleIndex, tempData, 0, tuplesPerSlice))
+  {
+    result.errorCode = -64511;
+    result.message = QString("Error copying source image data into destination array.    Slice:%1    TupleIndex:%2    MaxTupleIndex:%3").arg(slice).arg(tupleIndex).arg(outputData.getSize());
+  }
+  return result;
+}
+
+/**
+ * @brief Decodes the slice with its ImageIO straight into its z offset in the stack.  Files whose
+ * layout does not match the first slice exactly fall back to readSliceWithReader.
+ */
+template <typename TPixel>
+SliceResult readSlice(const QString& filePath, size_t slice, const SizeVec3Type& dims, itk::ImageIOBase::IOComponentType componentType, DataArray<TPixel>& outputData)
+{
+  const size_t numComps = outputData.getNumberOfComponents();
+  const size_t tuplesPerSlice = dims[0] * dims[1];
+
+  itk::ImageIOBase::Pointer imageIO = itk::ImageIOFactory::CreateImageIO(filePath.toLatin1(), itk::ImageIOFactory::ReadMode);
+  if(nullptr == imageIO)
+  {
+    return readSliceWithReader<TPixel>(filePath, slice, dims, outputData);
+  }
+
+  try
+  {
+    imageIO->SetFileName(filePath.toLatin1());
+    imageIO->ReadImageInformation();
+
+    bool sameLayout = imageIO->GetComponentType() == componentType && imageIO->GetNumberOfComponents() == numComps && imageIO->GetNumberOfDimensions() >= 2;
+    sameLayout = sameLayout && imageIO->GetDimensions(0) == dims[0] && imageIO->GetDimensions(1) == dims[1];
+    for(unsigned int d = 2; sameLayout && d < imageIO->GetNumberOfDimensions(); d++)
+    {
+      sameLayout = imageIO->GetDimensions(d) == 1;
+    }
+    sameLayout = sameLayout && imageIO->GetImageSizeInBytes() == tuplesPerSlice * numComps * sizeof(TPixel);
+    if(!sameLayout)
+    {
+      return readSliceWithReader<TPixel>(filePath, slice, dims, outputData);
+    }
+
+    itk::ImageIORegion region(imageIO->GetNumberOfDimensions());
+    for(unsigned int d = 0; d < imageIO->GetNumberOfDimensions(); d++)
+    {
+      region.SetIndex(d, 0);
+      region.SetSize(d, imageIO->GetDimensions(d));
+    }
+    imageIO->SetIORegion(region);
+    imageIO->Read(outputData.getTuplePointer(slice * tuplesPerSlice));
+  } catch(itk::ExceptionObject& err)
+  {
+    SliceResult result;
+    result.errorCode = -64512;
+    result.message = QString("Error reading image %1: %2").arg(filePath).arg(err.GetDescription());
+    return result;
+  }
+
+  return {};
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename TPixel>
-void readImageStack(ITKImportImageStack* filter, const QVector<QString>& fileList)
+void readImageStack(ITKImportImageStack* filter, const QVector<QString>& fileList, itk::ImageIOBase::IOComponentType componentType)
 {
 
   DataArrayPath dcName = filter->getDataContainerName();
@@ -280,7 +412,6 @@ void readImageStack(ITKImportImageStack* filter, const QVector<QString>& fileLis
   DataContainer::Pointer dc = filter->getDataContainerArray()->getDataContainer(dcName);
   ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
   SizeVec3Type dims = imageGeom->getDimensions();
-  size_t tuplesPerSlice = dims[0] * dims[1];
   AttributeMatrix::Pointer cellAttrMatr = dc->getAttributeMatrix(attrMatName);
   using DataArrayType = DataArray<TPixel>;
   using DataArrayPointerType = typename DataArrayType::Pointer;
@@ -295,65 +426,96 @@ void readImageStack(ITKImportImageStack* filter, const QVector<QString>& fileLis
 
   outputData->allocate(); // This most likely didn't happen during the preflight because how we are doing things is a bit unorthodox so make sure the data array is allocated.
 
-  // Variables for the progress Reporting
-  size_t slice = 0;
-  int64_t zStartIndex = 0;
-  int64_t z = zStartIndex;
-  float total = static_cast<float>(fileList.size() - zStartIndex);
-  // Loop over all the files importing them one by one and copying the data into the data array
-  for(const auto& filePath : fileList)
-  {
-    QString msg = "Importing: " + filePath;
-    filter->notifyStatusMessage(msg.toLatin1().data());
-
-    // Create a subfilter to read each image, although for preflight we are going to read the first image in the
-    // list and hope the rest are correct.
-    ITKImageReader::Pointer imageReader = ITKImageReader::New();
-    DataContainerArray::Pointer dca = DataContainerArray::New();
-    imageReader->setDataContainerArray(dca);
-    imageReader->setDataContainerName(dcName);
-    imageReader->setCellAttributeMatrixName(attrMatName);
-    imageReader->setImageDataArrayName(arrayName);
-    imageReader->setFileName(filePath);
-    imageReader->execute();
-    if(imageReader->getErrorCode() < 0)
+  // Each slice owns a disjoint range of the output array, so slices are decoded in parallel by
+  // one dedicated thread per core. They are not TBB tasks because this thread waits for them, and
+  // that wait must not depend on TBB having a free worker. This thread only reports progress and
+  // cancels. Errors are reported in slice order once every started slice has finished.
+  const size_t numSlices = static_cast<size_t>(fileList.size());
+  std::vector<SliceResult> results(numSlices);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  const size_t numWorkers = std::min<size_t>(std::max<size_t>(std::thread::hardware_concurrency(), 1), numSlices);
+  std::mutex mutex;
+  std::condition_variable sliceDone;
+  std::atomic<size_t> nextSlice = {0};
+  std::atomic<bool> stop = {false};
+  size_t finished = 0;
+
+  auto decodeSlices = [&]() {
+    while(!stop)
     {
-      msg = QString("Error reading image %1").arg(filePath);
-      filter->setErrorCondition(imageReader->getErrorCode(), msg);
-      return;
+      const size_t slice = nextSlice++;
+      if(slice >= numSlices)
+      {
+        return;
+      }
+      SliceResult result = readSlice<TPixel>(fileList[static_cast<int>(slice)], slice, dims, componentType, *outputData);
+      if(result.errorCode < 0)
+      {
+        stop = true;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        results[slice] = result;
+        finished++;
+      }
+      sliceDone.notify_one();
     }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(numWorkers);
+  for(size_t w = 0; w < numWorkers; w++)
+  {
+    workers.emplace_back(decodeSlices);
+  }
 
-    // Check the ImageGeometry of the imported Image matches the destination
-    ImageGeom::Pointer importedImageGeom = dca->getDataContainer(dcName)->template getGeometryAs<ImageGeom>();
-    SizeVec3Type importedDims = importedImageGeom->getDimensions();
-    if(dims[0] != importedDims[0] || dims[1] != importedDims[1])
+  size_t reported = 0;
+  while(true)
+  {
+    size_t done = 0;
     {
-      msg.clear();
-      QTextStream out(&msg);
-      out << "Slice " << slice << " image dimensions are different than the first slice.\n";
-      out << "  First Slice Dims are:  " << dims[0] << " x " << dims[1] << "\n";
-      out << "  Current Slice Dims are:" << importedDims[0] << " x " << importedDims[1] << "\n";
-      filter->setErrorCondition(-64510, msg);
-      return;
+      std::unique_lock<std::mutex> lock(mutex);
+      sliceDone.wait_for(lock, std::chrono::milliseconds(100), [&] { return finished != reported; });
+      done = finished;
     }
-
-    // Compute the Tuple Index we are at:
-    size_t tupleIndex = (slice * dims[0] * dims[1]);
-    // get the current Slice data...
-    DataArrayPointerType tempData = dca->getDataContainer(dcName)->getAttributeMatrix(attrMatName)->getAttributeArrayAs<DataArrayType>(arrayName);
-    // Copy that into the output array...
-    if(!outputData->copyFromArray(tupleIndex, tempData, 0, tuplesPerSlice))
+    if(done == numSlices || stop)
     {
-      msg = QString("Error copying source image data into destination array.    Slice:%1    TupleIndex:%2    MaxTupleIndex:%3").arg(slice).arg(tupleIndex).arg(outputData->getSize());
-      filter->setErrorCondition(imageReader->getErrorCode(), msg);
-      return;
+      break;
+    }
+    if(done != reported)
+    {
+      filter->notifyStatusMessage(QString("Importing slice %1 of %2").arg(done + 1).arg(numSlices));
+      reported = done;
+    }
+    if(filter->getCancel())
+    {
+      stop = true;
+      break;
     }
+  }
 
-    slice++;
+  for(auto& worker : workers)
+  {
+    worker.join();
+  }
+#else
+  for(size_t slice = 0; slice < numSlices && !filter->getCancel(); slice++)
+  {
+    filter->notifyStatusMessage(QString("Importing slice %1 of %2").arg(slice + 1).arg(numSlices));
+    results[slice] = readSlice<TPixel>(fileList[static_cast<int>(slice)], slice, dims, componentType, *outputData);
+    if(results[slice].errorCode < 0)
+    {
+      break;
+    }
+  }
+#endif
 
-    // Check to see if the filter got canceled.
-    if(filter->getCancel())
+  for(const SliceResult& result : results)
+  {
+    if(result.errorCode < 0)
     {
+      filter->setErrorCondition(result.errorCode, result.message);
       return;
     }
   }
@@ -384,34 +546,34 @@ void ITKImportImageStack::execute()
   switch(component)
   {
   case itk::ImageIOBase::UCHAR:
-    readImageStack<uint8_t>(this, fileList);
+    readImageStack<uint8_t>(this, fileList, component);
     break;
   case itk::ImageIOBase::CHAR:
-    readImageStack<int8_t>(this, fileList);
+    readImageStack<int8_t>(this, fileList, component);
     break;
   case itk::ImageIOBase::USHORT:
-    readImageStack<uint16_t>(this, fileList);
+    readImageStack<uint16_t>(this, fileList, component);
     break;
   case itk::ImageIOBase::SHORT:
-    readImageStack<int16_t>(this, fileList);
+    readImageStack<int16_t>(this, fileList, component);
     break;
   case itk::ImageIOBase::UINT:
-    readImageStack<uint32_t>(this, fileList);
+    readImageStack<uint32_t>(this, fileList, component);
     break;
   case itk::ImageIOBase::INT:
-    readImageStack<int32_t>(this, fileList);
+    readImageStack<int32_t>(this, fileList, component);
     break;
   case itk::ImageIOBase::ULONG:
-    readImageStack<uint64_t>(this, fileList);
+    readImageStack<uint64_t>(this, fileList, component);
     break;
   case itk::ImageIOBase::LONG:
-    readImageStack<int64_t>(this, fileList);
+    readImageStack<int64_t>(this, fileList, component);
     break;
   case itk::ImageIOBase::FLOAT:
-    readImageStack<float>(this, fileList);
+    readImageStack<float>(this, fileList, component);
     break;
   case itk::ImageIOBase::DOUBLE:
-    readImageStack<double>(this, fileList);
+    readImageStack<double>(this, fileList, component);
     break;
   default:
     QString errorMessage = QString("Unsupported pixel component: %1.").arg(imageIO->GetComponentTypeAsString(component).c_str());
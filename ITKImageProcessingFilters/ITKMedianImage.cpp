@@ -22,6 +22,7 @@
 ITKMedianImage::ITKMedianImage()
 {
   m_Radius = CastStdToVec3<std::vector<unsigned int>, FloatVec3Type, float>(std::vector<unsigned int>(3, 1));
+  m_NumberOfStreamDivisions = 1;
 }
 
 // -----------------------------------------------------------------------------
@@ -37,6 +38,7 @@ void ITKMedianImage::setupFilterParameters()
   FilterParameterVectorType parameters;
 
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Radius", Radius, FilterParameter::Category::Parameter, ITKMedianImage));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Stream Divisions", NumberOfStreamDivisions, FilterParameter::Category::Parameter, ITKMedianImage));
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
@@ -61,6 +63,7 @@ void ITKMedianImage::readFilterParameters(AbstractFilterParametersReader* reader
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setRadius(reader->readFloatVec3("Radius", getRadius()));
+  setNumberOfStreamDivisions(reader->readValue("NumberOfStreamDivisions", getNumberOfStreamDivisions()));
 
   reader->closeFilterGroup();
 }
@@ -73,6 +76,10 @@ void ITKMedianImage::dataCheckImpl()
 {
   // Check consistency of parameters
   this->CheckVectorEntry<unsigned int, FloatVec3Type>(m_Radius, "Radius", true);
+  if(m_NumberOfStreamDivisions < 1)
+  {
+    setErrorCondition(-55572, "NumberOfStreamDivisions must be at least 1");
+  }
 
   ITKImageProcessingBase::dataCheckImpl<InputPixelType, OutputPixelType, Dimension>();
 }
@@ -100,7 +107,7 @@ void ITKMedianImage::filter()
   using FilterType = itk::MedianImageFilter<InputImageType, OutputImageType>;
   typename FilterType::Pointer filter = FilterType::New();
   filter->SetRadius(CastVec3ToITK<FloatVec3Type, typename FilterType::RadiusType, typename FilterType::RadiusType::SizeValueType>(m_Radius, FilterType::RadiusType::Dimension));
-  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, static_cast<unsigned int>(m_NumberOfStreamDivisions));
 }
 
 // -----------------------------------------------------------------------------
@@ -188,3 +195,15 @@ FloatVec3Type ITKMedianImage::getRadius() const
 {
   return m_Radius;
 }
+
+// -----------------------------------------------------------------------------
+void ITKMedianImage::setNumberOfStreamDivisions(int value)
+{
+  m_NumberOfStreamDivisions = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKMedianImage::getNumberOfStreamDivisions() const
+{
+  return m_NumberOfStreamDivisions;
+}
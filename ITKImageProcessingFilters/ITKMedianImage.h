@@ -19,6 +19,7 @@
 
 // Auto includes
 #include <SIMPLib/FilterParameters/FloatVec3FilterParameter.h>
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
 #include <itkMedianImageFilter.h>
 
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
@@ -36,6 +37,7 @@ class ITKImageProcessing_EXPORT ITKMedianImage : public ITKImageProcessingBase
   PYB11_SHARED_POINTERS(ITKMedianImage)
   PYB11_FILTER_NEW_MACRO(ITKMedianImage)
   PYB11_PROPERTY(FloatVec3Type Radius READ getRadius WRITE setRadius)
+  PYB11_PROPERTY(int NumberOfStreamDivisions READ getNumberOfStreamDivisions WRITE setNumberOfStreamDivisions)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -71,6 +73,17 @@ public:
   FloatVec3Type getRadius() const;
   Q_PROPERTY(FloatVec3Type Radius READ getRadius WRITE setRadius)
 
+  /**
+   * @brief Setter property for NumberOfStreamDivisions
+   */
+  void setNumberOfStreamDivisions(int value);
+  /**
+   * @brief Getter property for NumberOfStreamDivisions
+   * @return Value of NumberOfStreamDivisions
+   */
+  int getNumberOfStreamDivisions() const;
+  Q_PROPERTY(int NumberOfStreamDivisions READ getNumberOfStreamDivisions WRITE setNumberOfStreamDivisions)
+
   /**
    * @brief newFilterInstance Reimplemented from @see AbstractFilter class
    */
@@ -135,6 +148,7 @@ public:
 
 private:
   FloatVec3Type m_Radius = {};
+  int m_NumberOfStreamDivisions = {};
 };
 
 #ifdef __clang__
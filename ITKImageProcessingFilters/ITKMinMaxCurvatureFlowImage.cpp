@@ -102,13 +102,14 @@ void ITKMinMaxCurvatureFlowImage::filter()
 {
   typedef typename itk::NumericTraits<InputPixelType>::RealType FloatPixelType;
   typedef itk::Image<FloatPixelType, Dimension> FloatImageType;
-  typedef itk::MinMaxCurvatureFlowImageFilter<FloatImageType, FloatImageType> FilterType;
+  typedef itk::Image<InputPixelType, Dimension> InputImageType;
+  typedef itk::MinMaxCurvatureFlowImageFilter<InputImageType, FloatImageType> FilterType;
 
   typename FilterType::Pointer filter = FilterType::New();
   filter->SetTimeStep(static_cast<double>(m_TimeStep));
   filter->SetNumberOfIterations(static_cast<uint32_t>(m_NumberOfIterations));
   filter->SetStencilRadius(static_cast<int>(m_StencilRadius));
-  this->ITKImageProcessingBase::filterCastToFloat<InputPixelType, InputPixelType, Dimension, FilterType, FloatImageType>(filter);
+  this->ITKImageProcessingBase::filter<InputPixelType, InputPixelType, Dimension, FilterType>(filter);
 }
 
 // -----------------------------------------------------------------------------
@@ -35,11 +35,17 @@
 #include "ITKPCMTileRegistration.h"
 
 #include <algorithm>
+#include <limits>
+#include <list>
+#include <mutex>
 #include <type_traits>
 
+#include <QtCore/QCryptographicHash>
+
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
@@ -58,10 +64,13 @@
 #include "SIMPLib/ITK/itkTransformToDream3DTransformContainer.h"
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/MetaXmlUtils.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/DetermineStitching.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 
 #include "itkImageFileWriter.h"
+#include "itkMaxPhaseCorrelationOptimizer.h"
+#include "itkPhaseCorrelationImageRegistrationMethod.h"
 #include "itkRGBToLuminanceImageFilter.h"
 #include "itkStreamingImageFilter.h"
 #include "itkTileMergeImageFilter.h"
@@ -146,6 +155,105 @@
 
 itk::NumericTraits<float> nmfloat;
 
+namespace
+{
+/**
+ * @brief The LeastRecentlyUsedCache class is a small thread safe key/value store that drops the
+ * least recently used entries once the total cost of its entries exceeds maxCost.
+ */
+template <typename ValueType>
+class LeastRecentlyUsedCache
+{
+public:
+  explicit LeastRecentlyUsedCache(size_t maxCost)
+  : m_MaxCost(maxCost)
+  {
+  }
+
+  bool find(const QByteArray& key, ValueType& value)
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto iter = std::find_if(m_Entries.begin(), m_Entries.end(), [&key](const Entry& entry) { return entry.key == key; });
+    if(iter == m_Entries.end())
+    {
+      return false;
+    }
+    value = iter->value;
+    // Most recently used entries are kept at the front
+    m_Entries.splice(m_Entries.begin(), m_Entries, iter);
+    return true;
+  }
+
+  void insert(const QByteArray& key, const ValueType& value, size_t cost = 1)
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto iter = std::find_if(m_Entries.begin(), m_Entries.end(), [&key](const Entry& entry) { return entry.key == key; });
+    if(iter != m_Entries.end())
+    {
+      m_Cost -= iter->cost;
+      m_Entries.erase(iter);
+    }
+    m_Entries.push_front({key, value, cost});
+    m_Cost += cost;
+    // The newest entry is always kept, even when it is larger than maxCost by itself
+    while(m_Cost > m_MaxCost && m_Entries.size() > 1)
+    {
+      m_Cost -= m_Entries.back().cost;
+      m_Entries.pop_back();
+    }
+  }
+
+private:
+  struct Entry
+  {
+    QByteArray key;
+    ValueType value;
+    size_t cost;
+  };
+
+  std::list<Entry> m_Entries;
+  size_t m_Cost = 0;
+  const size_t m_MaxCost;
+  std::mutex m_Mutex;
+};
+
+/**
+ * @brief The RegistrationCache class keeps the forward FFTs of recently registered tiles and the
+ * offsets measured for recently registered tile pairs, so that re-running the filter only
+ * repeats the work for tiles that changed.  Both are keyed by the tile identities from
+ * ITKPCMTileRegistration::computeTileKey.
+ */
+class RegistrationCache
+{
+public:
+  using TileFFTCache = LeastRecentlyUsedCache<itk::DataObject::ConstPointer>;
+  using OverlapCache = LeastRecentlyUsedCache<std::array<double, 2>>;
+
+  static RegistrationCache& Instance()
+  {
+    static RegistrationCache cache;
+    return cache;
+  }
+
+  TileFFTCache& tileFFTs()
+  {
+    return m_TileFFTs;
+  }
+
+  OverlapCache& overlaps()
+  {
+    return m_Overlaps;
+  }
+
+private:
+  static constexpr size_t k_MaxFFTBytes = 512 * 1024 * 1024;
+  static constexpr size_t k_MaxOverlaps = 4096;
+
+  TileFFTCache m_TileFFTs = TileFFTCache(k_MaxFFTBytes);
+  OverlapCache m_Overlaps = OverlapCache(k_MaxOverlaps);
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -186,6 +294,7 @@ void ITKPCMTileRegistration::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_INT_VEC2_FP("Montage Row Start/End [Inclusive, Zero Based]", RowMontageLimits, FilterParameter::Category::Parameter, ITKPCMTileRegistration));
 
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Padding Digits for DataContainer Names", DataContainerPaddingDigits, FilterParameter::Category::Parameter, ITKPCMTileRegistration));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Reuse Cached Registrations", UseRegistrationCache, FilterParameter::Category::Parameter, ITKPCMTileRegistration));
 
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container Prefix", DataContainerPrefix, FilterParameter::Category::RequiredArray, ITKPCMTileRegistration));
 
@@ -372,92 +481,65 @@ typename MontageType::Pointer ITKPCMTileRegistration::createMontage(int peakMeth
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename PixelType, typename MontageType>
-typename MontageType::Pointer ITKPCMTileRegistration::createGrayscaleMontage(int peakMethodToUse)
+template <typename PixelType, typename ScalarImageType>
+std::vector<typename ScalarImageType::Pointer> ITKPCMTileRegistration::createGrayscaleTiles()
 {
   using ScalarPixelType = typename itk::NumericTraits<PixelType>::ValueType;
-  //	using PointType = itk::Point<double, Dimension>;
-  using ScalarImageType = itk::Image<ScalarPixelType, Dimension>;
 
-  typename MontageType::Pointer montage = createMontage<PixelType, MontageType>(peakMethodToUse);
-
-  // Set tile image data from DREAM3D structure into tile montage
-  for(int32_t row = m_MontageStart[1]; row <= m_MontageEnd[1]; row++)
+  std::vector<typename ScalarImageType::Pointer> tiles;
+  for(const DataContainer::Pointer& dc : m_DataContainers)
   {
-    typename MontageType::TileIndexType ind;
-    ind[1] = static_cast<::itk::SizeValueType>(row - m_MontageStart[1]);
-    for(int32_t col = m_MontageStart[0]; col <= m_MontageEnd[0]; col++)
-    {
-      ind[0] = static_cast<::itk::SizeValueType>(col - m_MontageStart[0]);
-
-      // Get our DataContainer Name using a Prefix and a rXXcYY format.
-      QString dcName = MontageImportHelper::GenerateDataContainerName(getDataContainerPrefix(), m_DataContainerPaddingDigits, row, col);
-      DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcName);
-
-      using InPlaceDream3DToImageFileType = itk::InPlaceDream3DDataToImageFilter<ScalarPixelType, Dimension>;
-      typename InPlaceDream3DToImageFileType::Pointer toITK = InPlaceDream3DToImageFileType::New();
-      toITK->SetInput(dc);
-      toITK->SetInPlace(true);
-      toITK->SetAttributeMatrixArrayName(getCommonAttributeMatrixName().toStdString());
-      toITK->SetDataArrayName(getCommonDataArrayName().toStdString());
-      toITK->Update();
-
-      typename ScalarImageType::Pointer image = toITK->GetOutput();
-
-      montage->SetInputTile(ind, image);
-    }
+    using InPlaceDream3DToImageFileType = itk::InPlaceDream3DDataToImageFilter<ScalarPixelType, Dimension>;
+    typename InPlaceDream3DToImageFileType::Pointer toITK = InPlaceDream3DToImageFileType::New();
+    toITK->SetInput(dc);
+    toITK->SetInPlace(true);
+    toITK->SetAttributeMatrixArrayName(getCommonAttributeMatrixName().toStdString());
+    toITK->SetDataArrayName(getCommonDataArrayName().toStdString());
+    toITK->Update();
+
+    tiles.push_back(toITK->GetOutput());
   }
 
-  return montage;
+  return tiles;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename PixelType, typename MontageType>
-typename MontageType::Pointer ITKPCMTileRegistration::createRGBMontage(int peakMethodToUse)
+template <typename PixelType, typename ScalarImageType>
+std::vector<typename ScalarImageType::Pointer> ITKPCMTileRegistration::createRGBTiles()
 {
-  using ScalarPixelType = typename itk::NumericTraits<PixelType>::ValueType;
-  //	using PointType = itk::Point<double, Dimension>;
-  using ScalarImageType = itk::Image<ScalarPixelType, Dimension>;
   using OriginalImageType = itk::Image<PixelType, Dimension>;
 
-  typename MontageType::Pointer montage = createMontage<PixelType, MontageType>(peakMethodToUse);
-
-  // Set tile image data from DREAM3D structure into tile montage
-  for(int32_t row = m_MontageStart[1]; row <= m_MontageEnd[1]; row++)
+  std::vector<typename ScalarImageType::Pointer> tiles;
+  for(const DataContainer::Pointer& dc : m_DataContainers)
   {
-    typename MontageType::TileIndexType ind;
-    ind[1] = static_cast<::itk::SizeValueType>(row - m_MontageStart[1]);
-    for(int32_t col = m_MontageStart[0]; col <= m_MontageEnd[0]; col++)
-    {
-      ind[0] = static_cast<::itk::SizeValueType>(col - m_MontageStart[0]);
-
-      // Get our DataContainer Name using a Prefix and a rXXcYY format.
-      QString dcName = MontageImportHelper::GenerateDataContainerName(getDataContainerPrefix(), m_DataContainerPaddingDigits, row, col);
-      DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcName);
-
-      using InPlaceDream3DToImageFileType = itk::InPlaceDream3DDataToImageFilter<PixelType, Dimension>;
-      typename InPlaceDream3DToImageFileType::Pointer toITK = InPlaceDream3DToImageFileType::New();
-
-      toITK->SetInput(dc);
-      toITK->SetInPlace(true);
-      toITK->SetAttributeMatrixArrayName(getCommonAttributeMatrixName().toStdString());
-      toITK->SetDataArrayName(getCommonDataArrayName().toStdString());
-      toITK->Update();
-
-      typename OriginalImageType::Pointer image = toITK->GetOutput();
-
-      using FilterType = itk::RGBToLuminanceImageFilter<OriginalImageType, ScalarImageType>;
-      typename FilterType::Pointer filter = FilterType::New();
-      filter->SetInput(image);
-      filter->Update();
-
-      montage->SetInputTile(ind, filter->GetOutput());
-    }
+    using InPlaceDream3DToImageFileType = itk::InPlaceDream3DDataToImageFilter<PixelType, Dimension>;
+    typename InPlaceDream3DToImageFileType::Pointer toITK = InPlaceDream3DToImageFileType::New();
+    toITK->SetInput(dc);
+    toITK->SetInPlace(true);
+    toITK->SetAttributeMatrixArrayName(getCommonAttributeMatrixName().toStdString());
+    toITK->SetDataArrayName(getCommonDataArrayName().toStdString());
+    toITK->Update();
+
+    typename OriginalImageType::Pointer image = toITK->GetOutput();
+
+    // Only the output information is generated here.  The luminance pixels are computed when the
+    // registration requests them, and only for the requested region, so no full scalar copy of
+    // every tile is made up front.  m_TileFilters keeps the filters alive until the registration
+    // ends, so the output buffer is released as soon as its consumer has run; otherwise every
+    // tile's luminance would stay in memory anyway.
+    using FilterType = itk::RGBToLuminanceImageFilter<OriginalImageType, ScalarImageType>;
+    typename FilterType::Pointer filter = FilterType::New();
+    filter->SetInput(image);
+    filter->ReleaseDataFlagOn();
+    filter->UpdateOutputInformation();
+    m_TileFilters.push_back(filter.GetPointer());
+
+    tiles.push_back(filter->GetOutput());
   }
 
-  return montage;
+  return tiles;
 }
 
 // -----------------------------------------------------------------------------
@@ -468,15 +550,8 @@ void ITKPCMTileRegistration::registerGrayscaleMontage(int peakMethodToUse, unsig
 {
   using ScalarPixelType = typename itk::NumericTraits<PixelType>::ValueType;
   using ScalarImageType = itk::Image<ScalarPixelType, Dimension>;
-  using MontageType = itk::TileMontage<ScalarImageType>;
-
-  typename MontageType::Pointer montage = createGrayscaleMontage<PixelType, MontageType>(peakMethodToUse);
-
-  // Execute the montage registration algorithm
-  executeMontageRegistration<MontageType>(montage);
 
-  // Store tile registration transforms in DREAM3D data containers
-  storeMontageTransforms<MontageType>(montage);
+  registerTiles<PixelType, ScalarImageType>(peakMethodToUse, createGrayscaleTiles<PixelType, ScalarImageType>());
 }
 
 // -----------------------------------------------------------------------------
@@ -487,15 +562,187 @@ void ITKPCMTileRegistration::registerRGBMontage(int peakMethodToUse, unsigned st
 {
   using ScalarPixelType = typename itk::NumericTraits<PixelType>::ValueType;
   using ScalarImageType = itk::Image<ScalarPixelType, Dimension>;
-  using MontageType = itk::TileMontage<ScalarImageType>;
 
-  typename MontageType::Pointer montage = createRGBMontage<PixelType, MontageType>(peakMethodToUse);
+  registerTiles<PixelType, ScalarImageType>(peakMethodToUse, createRGBTiles<PixelType, ScalarImageType>());
+}
 
-  // Execute the montage registration algorithm
-  executeMontageRegistration<MontageType>(montage);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename PixelType, typename ScalarImageType>
+void ITKPCMTileRegistration::registerTiles(int peakMethodToUse, const std::vector<typename ScalarImageType::Pointer>& tiles)
+{
+  TileOffsets offsets;
+  if(m_UseRegistrationCache)
+  {
+    offsets = registerTilePairs<ScalarImageType>(peakMethodToUse, tiles);
+  }
+  else
+  {
+    using MontageType = itk::TileMontage<ScalarImageType>;
+    typename MontageType::Pointer montage = createMontage<PixelType, MontageType>(peakMethodToUse);
+
+    // Tiles are stored in row major order, the same order as m_DataContainers
+    const auto colCount = static_cast<size_t>(m_MontageEnd[0] - m_MontageStart[0] + 1);
+    for(size_t i = 0; i < tiles.size(); i++)
+    {
+      typename MontageType::TileIndexType ind;
+      ind[0] = static_cast<::itk::SizeValueType>(i % colCount);
+      ind[1] = static_cast<::itk::SizeValueType>(i / colCount);
+      montage->SetInputTile(ind, tiles[i]);
+    }
+
+    // Execute the montage registration algorithm
+    executeMontageRegistration<MontageType>(montage);
+    if(!getCancel())
+    {
+      offsets = getMontageOffsets<MontageType>(montage);
+    }
+  }
+
+  m_TileFilters.clear();
+  if(getCancel())
+  {
+    return;
+  }
 
   // Store tile registration transforms in DREAM3D data containers
-  storeMontageTransforms<MontageType>(montage);
+  storeTileOffsets(offsets);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename ScalarImageType>
+ITKPCMTileRegistration::TileOffsets ITKPCMTileRegistration::registerTilePairs(int peakMethodToUse, const std::vector<typename ScalarImageType::Pointer>& tiles)
+{
+  using PCMType = itk::PhaseCorrelationImageRegistrationMethod<ScalarImageType, ScalarImageType>;
+  using OperatorType = typename PCMType::OperatorType;
+  using OptimizerType = itk::MaxPhaseCorrelationOptimizer<PCMType>;
+  using ComplexImageType = typename PCMType::ComplexImageType;
+  using PairwiseOffset = DetermineStitching::PairwiseOffset;
+
+#if(ITK_VERSION_MAJOR == 5) && (ITK_VERSION_MINOR >= 1)
+  using PaddingMethodEnum = typename PCMType::PaddingMethodEnum;
+  using PeakInterpolationType = typename OptimizerType::PeakInterpolationMethodEnum;
+#else
+  using PaddingMethodEnum = typename PCMType::PaddingMethod;
+  using PeakInterpolationType = typename OptimizerType::PeakInterpolationMethod;
+#endif
+  using PeakFinderUnderlying = typename std::underlying_type<PeakInterpolationType>::type;
+
+  // Same registration setup as createMontage
+  typename OptimizerType::Pointer optimizer = OptimizerType::New();
+  optimizer->SetPeakInterpolationMethod(static_cast<PeakInterpolationType>(static_cast<PeakFinderUnderlying>(peakMethodToUse)));
+  typename PCMType::Pointer pcm = PCMType::New();
+  pcm->SetOperator(OperatorType::New());
+  pcm->SetOptimizer(optimizer);
+  pcm->SetPaddingMethod(PaddingMethodEnum::MirrorWithExponentialDecay);
+
+  // Bump this if the registration setup above changes
+  const QByteArray settingsKey = QByteArray("PCM;MirrorWithExponentialDecay;") + QByteArray::number(peakMethodToUse) + ';';
+
+  notifyStatusMessage("Identifying the tiles");
+  const size_t numTiles = tiles.size();
+  std::vector<QByteArray> tileKeys(numTiles);
+  for(size_t i = 0; i < numTiles; i++)
+  {
+    tileKeys[i] = computeTileKey(m_DataContainers[i]);
+  }
+
+  // Every tile is registered against its left and top neighbors
+  const auto colCount = static_cast<size_t>(m_MontageEnd[0] - m_MontageStart[0] + 1);
+  std::vector<PairwiseOffset> pairs;
+  for(size_t i = 0; i < numTiles; i++)
+  {
+    if(i % colCount != 0)
+    {
+      pairs.emplace_back(i - 1, i, true);
+    }
+    if(i >= colCount)
+    {
+      pairs.emplace_back(i - colCount, i, false);
+    }
+  }
+
+  // The padded size of a tile's FFT depends on the geometry of the other tile in the pair, so the
+  // FFT key includes the partner's size and position relative to the tile
+  auto fftKey = [&](size_t tile, size_t partner, char role) {
+    QByteArray key = settingsKey + tileKeys[tile] + role;
+    const auto size = tiles[partner]->GetLargestPossibleRegion().GetSize();
+    const auto& origin = tiles[partner]->GetOrigin();
+    for(unsigned i = 0; i < Dimension; i++)
+    {
+      const double relativeOrigin = origin[i] - tiles[tile]->GetOrigin()[i];
+      key.append(reinterpret_cast<const char*>(&size[i]), static_cast<int>(sizeof(size[i])));
+      key.append(reinterpret_cast<const char*>(&relativeOrigin), static_cast<int>(sizeof(relativeOrigin)));
+    }
+    return key;
+  };
+  auto findFFT = [](const QByteArray& key) {
+    itk::DataObject::ConstPointer fft;
+    RegistrationCache::Instance().tileFFTs().find(key, fft);
+    return const_cast<ComplexImageType*>(dynamic_cast<const ComplexImageType*>(fft.GetPointer()));
+  };
+  auto storeFFT = [](const QByteArray& key, const ComplexImageType* fft) {
+    const size_t bytes = fft->GetBufferedRegion().GetNumberOfPixels() * sizeof(typename ComplexImageType::PixelType);
+    RegistrationCache::Instance().tileFFTs().insert(key, itk::DataObject::ConstPointer(fft), bytes);
+  };
+
+  notifyStatusMessage("Doing the tile registrations");
+  size_t reused = 0;
+  for(size_t p = 0; p < pairs.size(); p++)
+  {
+    if(getCancel())
+    {
+      return {};
+    }
+
+    PairwiseOffset& pair = pairs[p];
+    const QByteArray overlapKey = settingsKey + tileKeys[pair.first] + tileKeys[pair.second];
+    std::array<double, Dimension> offset = {0.0, 0.0};
+    if(RegistrationCache::Instance().overlaps().find(overlapKey, offset))
+    {
+      reused++;
+    }
+    else
+    {
+      const QByteArray fixedKey = fftKey(pair.first, pair.second, 'F');
+      const QByteArray movingKey = fftKey(pair.second, pair.first, 'M');
+
+      pcm->SetFixedImage(tiles[pair.first]);
+      pcm->SetMovingImage(tiles[pair.second]);
+      pcm->SetFixedImageFFT(findFFT(fixedKey));
+      pcm->SetMovingImageFFT(findFFT(movingKey));
+      pcm->Update();
+
+      storeFFT(fixedKey, pcm->GetFixedImageFFT());
+      storeFFT(movingKey, pcm->GetMovingImageFFT());
+
+      const auto& pcmOffset = pcm->GetOutput()->Get()->GetOffset();
+      for(unsigned i = 0; i < Dimension; i++)
+      {
+        offset[i] = pcmOffset[i];
+      }
+      RegistrationCache::Instance().overlaps().insert(overlapKey, offset);
+    }
+
+    pair.x = static_cast<float>(offset[0]);
+    pair.y = static_cast<float>(offset[1]);
+    pair.weight = 1.0f;
+
+    notifyStatusMessage(QObject::tr("Registering Tiles: %1 of %2 overlaps done, %3 reused from the cache").arg(p + 1).arg(pairs.size()).arg(reused));
+  }
+
+  // Same least squares fit of the pairwise offsets as TileMontage, with the first tile held in place
+  std::vector<float> origins = DetermineStitching::SolveGlobalOrigins(numTiles, pairs);
+  TileOffsets offsets(numTiles);
+  for(size_t i = 0; i < numTiles; i++)
+  {
+    offsets[i] = {origins[2 * i], origins[2 * i + 1]};
+  }
+  notifyStatusMessage("Finished the tile registrations");
+  return offsets;
 }
 
 // -----------------------------------------------------------------------------
@@ -519,11 +766,11 @@ void ITKPCMTileRegistration::executeMontageRegistration(typename MontageType::Po
 //
 // -----------------------------------------------------------------------------
 template <typename MontageType>
-void ITKPCMTileRegistration::storeMontageTransforms(typename MontageType::Pointer montage)
+ITKPCMTileRegistration::TileOffsets ITKPCMTileRegistration::getMontageOffsets(typename MontageType::Pointer montage) const
 {
   using TransformType = itk::TranslationTransform<double, Dimension>;
 
-  // Set tile image data from DREAM3D structure into tile montage
+  TileOffsets offsets;
   for(int32_t row = m_MontageStart[1]; row <= m_MontageEnd[1]; row++)
   {
     typename MontageType::TileIndexType ind;
@@ -533,7 +780,28 @@ void ITKPCMTileRegistration::storeMontageTransforms(typename MontageType::Pointe
       ind[0] = static_cast<::itk::SizeValueType>(col - m_MontageStart[0]);
 
       const TransformType* regTr = montage->GetOutputTransform(ind);
+      std::array<double, Dimension> offset;
+      for(unsigned i = 0; i < TransformType::SpaceDimension; i++)
+      {
+        offset[i] = regTr->GetOffset()[i];
+      }
+      offsets.push_back(offset);
+    }
+  }
+  return offsets;
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKPCMTileRegistration::storeTileOffsets(const TileOffsets& offsets)
+{
+  auto offsetIter = offsets.begin();
+  // Set tile image data from DREAM3D structure into tile montage
+  for(int32_t row = m_MontageStart[1]; row <= m_MontageEnd[1]; row++)
+  {
+    for(int32_t col = m_MontageStart[0]; col <= m_MontageEnd[0]; col++, ++offsetIter)
+    {
       // Get our DataContainer Name using a Prefix and a rXXcYY format.
       QString dcName = MontageImportHelper::GenerateDataContainerName(getDataContainerPrefix(), m_DataContainerPaddingDigits, row, col);
       DataContainer::Pointer imageDC = getDataContainerArray()->getDataContainer(dcName);
@@ -544,15 +812,12 @@ void ITKPCMTileRegistration::storeMontageTransforms(typename MontageType::Pointe
       AffineType::Pointer itkAffine = AffineType::New();
       AffineType::TranslationType t;
       t.Fill(0);
-      for(unsigned i = 0; i < TransformType::SpaceDimension; i++)
+      for(unsigned i = 0; i < Dimension; i++)
       {
-        t[i] = regTr->GetOffset()[i];
+        t[i] = (*offsetIter)[i];
       }
       itkAffine->SetTranslation(t);
 
-      TransformContainer::Pointer transformContainer = GetTransformContainerFromITKAffineTransform(itkAffine);
-      auto containerParameters = transformContainer->getParameters();
-      auto containerFixedParameters = transformContainer->getFixedParameters();
       using FilterType = itk::TransformToDream3DITransformContainer<double, 3>;
 
       FilterType::Pointer filter = FilterType::New();
@@ -566,6 +831,42 @@ void ITKPCMTileRegistration::storeMontageTransforms(typename MontageType::Pointe
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray ITKPCMTileRegistration::computeTileKey(const DataContainer::Pointer& dc) const
+{
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  auto addValue = [&hash](const auto& value) { hash.addData(reinterpret_cast<const char*>(&value), static_cast<int>(sizeof(value))); };
+
+  hash.addData(dc->getName().toUtf8());
+  ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+  for(size_t i = 0; i < 3; i++)
+  {
+    addValue(image->getDimensions()[i]);
+    addValue(image->getSpacing()[i]);
+    addValue(image->getOrigin()[i]);
+  }
+
+  IDataArray::Pointer da = dc->getAttributeMatrix(getCommonAttributeMatrixName())->getAttributeArray(getCommonDataArrayName());
+  hash.addData(da->getTypeAsString().toLatin1());
+  addValue(da->getNumberOfComponents());
+  addValue(da->getNumberOfTuples());
+
+  // Every byte of the tile is hashed, so a tile rewritten in place or re-imported with other values
+  // never matches a stale entry, while an identical re-import still reuses it
+  const char* bytes = reinterpret_cast<const char*>(da->getVoidPointer(0));
+  size_t remaining = da->getSize() * da->getTypeSize();
+  while(remaining > 0)
+  {
+    const size_t chunk = std::min<size_t>(remaining, static_cast<size_t>(std::numeric_limits<int>::max()));
+    hash.addData(bytes, static_cast<int>(chunk));
+    bytes += chunk;
+    remaining -= chunk;
+  }
+  return hash.result();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -769,3 +1070,15 @@ int32_t ITKPCMTileRegistration::getDataContainerPaddingDigits() const
 {
   return m_DataContainerPaddingDigits;
 }
+
+// -----------------------------------------------------------------------------
+void ITKPCMTileRegistration::setUseRegistrationCache(bool value)
+{
+  m_UseRegistrationCache = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ITKPCMTileRegistration::getUseRegistrationCache() const
+{
+  return m_UseRegistrationCache;
+}
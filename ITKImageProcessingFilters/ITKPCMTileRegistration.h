@@ -35,7 +35,11 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
+#include <vector>
+
+#include <QtCore/QByteArray>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
@@ -47,6 +51,7 @@
 
 #include "itkAffineTransform.h"
 #include "itkCompositeTransform.h"
+#include "itkProcessObject.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
@@ -72,6 +77,7 @@ class ITKImageProcessing_EXPORT ITKPCMTileRegistration : public AbstractFilter
   PYB11_PROPERTY(QString DataContainerPrefix READ getDataContainerPrefix WRITE setDataContainerPrefix)
   PYB11_PROPERTY(QString CommonAttributeMatrixName READ getCommonAttributeMatrixName WRITE setCommonAttributeMatrixName)
   PYB11_PROPERTY(QString CommonDataArrayName READ getCommonDataArrayName WRITE setCommonDataArrayName)
+  PYB11_PROPERTY(bool UseRegistrationCache READ getUseRegistrationCache WRITE setUseRegistrationCache)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -163,6 +169,17 @@ public:
   QString getCommonDataArrayName() const;
   Q_PROPERTY(QString CommonDataArrayName READ getCommonDataArrayName WRITE setCommonDataArrayName)
 
+  /**
+   * @brief Setter property for UseRegistrationCache
+   */
+  void setUseRegistrationCache(bool value);
+  /**
+   * @brief Getter property for UseRegistrationCache
+   * @return Value of UseRegistrationCache
+   */
+  bool getUseRegistrationCache() const;
+  Q_PROPERTY(bool UseRegistrationCache READ getUseRegistrationCache WRITE setUseRegistrationCache)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -260,6 +277,23 @@ protected:
    */
   typename TransformContainer::Pointer GetTransformContainerFromITKAffineTransform(const AffineType::Pointer& itkAffine);
 
+  using TileOffsets = std::vector<std::array<double, 2>>;
+
+  /**
+   * @brief Returns a key that identifies a tile for the registration cache.  The data container name,
+   * the geometry, the array type and every value of the tile are hashed.
+   * @param dc
+   * @return
+   */
+  QByteArray computeTileKey(const DataContainer::Pointer& dc) const;
+
+  /**
+   * @brief Stores the registered offset of each selected tile, in row major order, as the
+   * transform of its ImageGeom
+   * @param offsets
+   */
+  void storeTileOffsets(const TileOffsets& offsets);
+
 private:
   int32_t m_DataContainerPaddingDigits = 1;
   IntVec2Type m_ColumnMontageLimits = {0, 0};
@@ -269,9 +303,13 @@ private:
   QString m_DataContainerPrefix = {ITKImageProcessing::Montage::k_DataContainerPrefixDefaultName};
   QString m_CommonAttributeMatrixName = {ITKImageProcessing::Montage::k_TileAttributeMatrixDefaultName};
   QString m_CommonDataArrayName = {ITKImageProcessing::Montage::k_TileDataArrayDefaultName};
+  bool m_UseRegistrationCache = false;
 
   static constexpr unsigned Dimension = 2;
   std::vector<DataContainer::Pointer> m_DataContainers;
+  // Tile filters whose outputs are only generated when the montage asks for them.  An ITK output
+  // holds a weak reference to its source, so the filters are kept here until the registration ends.
+  std::vector<itk::ProcessObject::Pointer> m_TileFilters;
 
   /**
    * @brief createMontage
@@ -282,26 +320,48 @@ private:
   typename MontageType::Pointer createMontage(int peakMethodToUse = 0);
 
   /**
-   * @brief createGrayscaleMontage
-   * @param peakMethodToUse
-   * @param streamSubdivisions
+   * @brief Wraps the selected grayscale tiles, in row major order, as ITK images
+   * @return
    */
-  template <typename PixelType, typename MontageType>
-  typename MontageType::Pointer createGrayscaleMontage(int peakMethodToUse = 0);
+  template <typename PixelType, typename ScalarImageType>
+  std::vector<typename ScalarImageType::Pointer> createGrayscaleTiles();
 
   /**
-   * @brief createRGBMontage
-   * @param peakMethodToUse
-   * @param streamSubdivisions
+   * @brief Returns the luminance of the selected RGB tiles, in row major order.  The luminance
+   * filters are kept in m_TileFilters.
+   * @return
    */
-  template <typename PixelType, typename MontageType>
-  typename MontageType::Pointer createRGBMontage(int peakMethodToUse = 0);
+  template <typename PixelType, typename ScalarImageType>
+  std::vector<typename ScalarImageType::Pointer> createRGBTiles();
 
   /**
-   * @brief storeMontageTransforms
+   * @brief getMontageOffsets
+   * @param montage
+   * @return
    */
   template <typename MontageType>
-  void storeMontageTransforms(typename MontageType::Pointer montage);
+  TileOffsets getMontageOffsets(typename MontageType::Pointer montage) const;
+
+  /**
+   * @brief Registers the tiles and stores the resulting offsets.  The whole montage is registered
+   * by itk::TileMontage, or pair by pair through registerTilePairs when the registration cache
+   * is enabled.
+   * @param peakMethodToUse
+   * @param tiles
+   */
+  template <typename PixelType, typename ScalarImageType>
+  void registerTiles(int peakMethodToUse, const std::vector<typename ScalarImageType::Pointer>& tiles);
+
+  /**
+   * @brief Registers every tile against its left and top neighbors and fits the tile offsets to
+   * the pairwise offsets by least squares.  Tile FFTs and pairwise offsets are looked up in, and
+   * added to, the process wide registration cache.
+   * @param peakMethodToUse
+   * @param tiles
+   * @return
+   */
+  template <typename ScalarImageType>
+  TileOffsets registerTilePairs(int peakMethodToUse, const std::vector<typename ScalarImageType::Pointer>& tiles);
 
   /**
    * @brief executeMontageRegistration
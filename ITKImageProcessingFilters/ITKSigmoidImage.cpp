@@ -25,6 +25,7 @@ ITKSigmoidImage::ITKSigmoidImage()
   m_Beta = StaticCastScalar<double, double, double>(0);
   m_OutputMaximum = StaticCastScalar<double, double, double>(255);
   m_OutputMinimum = StaticCastScalar<double, double, double>(0);
+  m_NumberOfStreamDivisions = 1;
 }
 
 // -----------------------------------------------------------------------------
@@ -43,6 +44,7 @@ void ITKSigmoidImage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("Beta", Beta, FilterParameter::Category::Parameter, ITKSigmoidImage));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("OutputMaximum", OutputMaximum, FilterParameter::Category::Parameter, ITKSigmoidImage));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("OutputMinimum", OutputMinimum, FilterParameter::Category::Parameter, ITKSigmoidImage));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Stream Divisions", NumberOfStreamDivisions, FilterParameter::Category::Parameter, ITKSigmoidImage));
 
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
@@ -70,6 +72,7 @@ void ITKSigmoidImage::readFilterParameters(AbstractFilterParametersReader* reade
   setBeta(reader->readValue("Beta", getBeta()));
   setOutputMaximum(reader->readValue("OutputMaximum", getOutputMaximum()));
   setOutputMinimum(reader->readValue("OutputMinimum", getOutputMinimum()));
+  setNumberOfStreamDivisions(reader->readValue("NumberOfStreamDivisions", getNumberOfStreamDivisions()));
 
   reader->closeFilterGroup();
 }
@@ -81,6 +84,10 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
 void ITKSigmoidImage::dataCheckImpl()
 {
   // Check consistency of parameters
+  if(m_NumberOfStreamDivisions < 1)
+  {
+    setErrorCondition(-55571, "NumberOfStreamDivisions must be at least 1");
+  }
 
   ITKImageProcessingBase::dataCheckImpl<InputPixelType, OutputPixelType, Dimension>();
 }
@@ -111,7 +118,7 @@ void ITKSigmoidImage::filter()
   filter->SetBeta(static_cast<double>(m_Beta));
   filter->SetOutputMaximum(static_cast<double>(m_OutputMaximum));
   filter->SetOutputMinimum(static_cast<double>(m_OutputMinimum));
-  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, static_cast<unsigned int>(m_NumberOfStreamDivisions));
 }
 
 // -----------------------------------------------------------------------------
@@ -235,3 +242,15 @@ double ITKSigmoidImage::getOutputMinimum() const
 {
   return m_OutputMinimum;
 }
+
+// -----------------------------------------------------------------------------
+void ITKSigmoidImage::setNumberOfStreamDivisions(int value)
+{
+  m_NumberOfStreamDivisions = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKSigmoidImage::getNumberOfStreamDivisions() const
+{
+  return m_NumberOfStreamDivisions;
+}
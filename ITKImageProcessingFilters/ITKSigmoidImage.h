@@ -19,6 +19,7 @@
 
 // Auto includes
 #include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
 #include <itkSigmoidImageFilter.h>
 
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
@@ -39,6 +40,7 @@ class ITKImageProcessing_EXPORT ITKSigmoidImage : public ITKImageProcessingBase
   PYB11_PROPERTY(double Beta READ getBeta WRITE setBeta)
   PYB11_PROPERTY(double OutputMaximum READ getOutputMaximum WRITE setOutputMaximum)
   PYB11_PROPERTY(double OutputMinimum READ getOutputMinimum WRITE setOutputMinimum)
+  PYB11_PROPERTY(int NumberOfStreamDivisions READ getNumberOfStreamDivisions WRITE setNumberOfStreamDivisions)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -107,6 +109,17 @@ public:
   double getOutputMinimum() const;
   Q_PROPERTY(double OutputMinimum READ getOutputMinimum WRITE setOutputMinimum)
 
+  /**
+   * @brief Setter property for NumberOfStreamDivisions
+   */
+  void setNumberOfStreamDivisions(int value);
+  /**
+   * @brief Getter property for NumberOfStreamDivisions
+   * @return Value of NumberOfStreamDivisions
+   */
+  int getNumberOfStreamDivisions() const;
+  Q_PROPERTY(int NumberOfStreamDivisions READ getNumberOfStreamDivisions WRITE setNumberOfStreamDivisions)
+
   /**
    * @brief newFilterInstance Reimplemented from @see AbstractFilter class
    */
@@ -174,6 +187,7 @@ private:
   double m_Beta = {};
   double m_OutputMaximum = {};
   double m_OutputMinimum = {};
+  int m_NumberOfStreamDivisions = {};
 };
 
 #ifdef __clang__
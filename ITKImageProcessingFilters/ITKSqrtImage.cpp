@@ -19,7 +19,10 @@
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-ITKSqrtImage::ITKSqrtImage() = default;
+ITKSqrtImage::ITKSqrtImage()
+{
+  m_NumberOfStreamDivisions = 1;
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -33,6 +36,8 @@ void ITKSqrtImage::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
 
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Stream Divisions", NumberOfStreamDivisions, FilterParameter::Category::Parameter, ITKSqrtImage));
+
   std::vector<QString> linkedProps;
   linkedProps.push_back("NewCellArrayName");
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
@@ -55,6 +60,7 @@ void ITKSqrtImage::readFilterParameters(AbstractFilterParametersReader* reader,
   reader->openFilterGroup(this, index);
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setNumberOfStreamDivisions(reader->readValue("NumberOfStreamDivisions", getNumberOfStreamDivisions()));
 
   reader->closeFilterGroup();
 }
@@ -66,6 +72,10 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
 void ITKSqrtImage::dataCheckImpl()
 {
   // Check consistency of parameters
+  if(m_NumberOfStreamDivisions < 1)
+  {
+    setErrorCondition(-55570, "NumberOfStreamDivisions must be at least 1");
+  }
 
   ITKImageProcessingBase::dataCheckImpl<InputPixelType, OutputPixelType, Dimension>();
 }
@@ -92,7 +102,7 @@ void ITKSqrtImage::filter()
   // define filter
   typedef itk::SqrtImageFilter<InputImageType, OutputImageType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
-  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, static_cast<unsigned int>(m_NumberOfStreamDivisions));
 }
 
 // -----------------------------------------------------------------------------
@@ -168,3 +178,15 @@ QString ITKSqrtImage::ClassName()
 {
   return QString("ITKSqrtImage");
 }
+
+// -----------------------------------------------------------------------------
+void ITKSqrtImage::setNumberOfStreamDivisions(int value)
+{
+  m_NumberOfStreamDivisions = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKSqrtImage::getNumberOfStreamDivisions() const
+{
+  return m_NumberOfStreamDivisions;
+}
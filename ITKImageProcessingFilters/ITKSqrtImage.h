@@ -18,6 +18,7 @@
 #include "SIMPLib/SIMPLib.h"
 
 // Auto includes
+#include <SIMPLib/FilterParameters/IntFilterParameter.h>
 #include <itkSqrtImageFilter.h>
 
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
@@ -50,6 +51,17 @@ public:
 
   ~ITKSqrtImage() override;
 
+  /**
+   * @brief Setter property for NumberOfStreamDivisions
+   */
+  void setNumberOfStreamDivisions(int value);
+  /**
+   * @brief Getter property for NumberOfStreamDivisions
+   * @return Value of NumberOfStreamDivisions
+   */
+  int getNumberOfStreamDivisions() const;
+  Q_PROPERTY(int NumberOfStreamDivisions READ getNumberOfStreamDivisions WRITE setNumberOfStreamDivisions)
+
   /**
    * @brief newFilterInstance Reimplemented from @see AbstractFilter class
    */
@@ -113,6 +125,7 @@ public:
   ITKSqrtImage& operator=(ITKSqrtImage&&) = delete;      // Move Assignment Not Implemented
 
 private:
+  int m_NumberOfStreamDivisions = {};
 };
 
 #ifdef __clang__
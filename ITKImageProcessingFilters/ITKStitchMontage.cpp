@@ -34,6 +34,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ITKStitchMontage.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "SIMPLib/SIMPLibVersion.h"
@@ -54,7 +55,6 @@
 #include "SIMPLib/ITK/itkDream3DITransformContainerToTransform.h"
 #include "SIMPLib/ITK/itkDream3DTransformContainerToTransform.h"
 #include "SIMPLib/ITK/itkInPlaceDream3DDataToImageFilter.h"
-#include "SIMPLib/ITK/itkInPlaceImageToDream3DDataFilter.h"
 #include "SIMPLib/ITK/itkProgressObserver.hpp"
 #include "SIMPLib/ITK/itkTransformToDream3DITransformContainer.h"
 #include "SIMPLib/ITK/itkTransformToDream3DTransformContainer.h"
@@ -66,7 +66,7 @@
 #include "util/MontageImportHelper.h"
 
 #include "itkImageFileWriter.h"
-#include "itkStreamingImageFilter.h"
+#include "itkImageRegionSplitterSlowDimension.h"
 #include "itkTileMergeImageFilter.h"
 #include "itkTileMontage.h"
 #include "itkTxtTransformIOFactory.h"
@@ -214,6 +214,8 @@ void ITKStitchMontage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_STRING_FP("Montage Attribute Matrix Name", MontageAttributeMatrixName, FilterParameter::Category::CreatedArray, ITKStitchMontage));
   parameters.push_back(SIMPL_NEW_STRING_FP("Montage Data Array Name", MontageDataArrayName, FilterParameter::Category::CreatedArray, ITKStitchMontage));
 
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Stream Divisions", StreamDivisions, FilterParameter::Category::Parameter, ITKStitchMontage));
+
   setFilterParameters(parameters);
 }
 
@@ -264,6 +266,12 @@ void ITKStitchMontage::dataCheck()
     setErrorCondition(-11006, ss);
     return;
   }
+  if(m_StreamDivisions < 1)
+  {
+    QString ss = QObject::tr("Stream Divisions (%1) must be at least 1").arg(m_StreamDivisions);
+    setErrorCondition(-11015, ss);
+    return;
+  }
 
   // QTextStream dclistOut(&m_DataContainerList);
 
@@ -430,7 +438,8 @@ void ITKStitchMontage::dataCheck()
     return;
   }
 
-  IDataArray::Pointer da = tilePtr->createNewArray(montageArrayXSize * montageArrayYSize, std::vector<size_t>(1, 1), getMontageDataArrayName(), !getInPreflight());
+  // The array is only allocated during execute, once the size of the stitched image is known
+  IDataArray::Pointer da = tilePtr->createNewArray(montageArrayXSize * montageArrayYSize, std::vector<size_t>(1, 1), getMontageDataArrayName(), false);
   am->addOrReplaceAttributeArray(da);
 
   ss = QObject::tr("The number of elements of montage data array '%1' is projected to be %2.  This is assuming "
@@ -458,7 +467,7 @@ void ITKStitchMontage::execute()
   AttributeMatrix::Pointer am = dc->getAttributeMatrix(getCommonAttributeMatrixName());
   IDataArray::Pointer da = am->getAttributeArray(getCommonDataArrayName());
 
-  EXECUTE_STITCH_FUNCTION_TEMPLATE(this, stitchMontage, da);
+  EXECUTE_STITCH_FUNCTION_TEMPLATE(this, stitchMontage, da, 0, static_cast<unsigned>(m_StreamDivisions));
 
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage("Complete");
@@ -488,11 +497,8 @@ void ITKStitchMontage::stitchMontage(int peakMethodToUse, unsigned streamSubdivi
   // Initialize the resampler
   initializeResampler<PixelType, MontageType, Resampler>(resampler);
 
-  // Execute the stitching algorithm
+  // Execute the stitching algorithm, writing straight into the DREAM3D data structure
   executeStitching<PixelType, Resampler>(resampler, streamSubdivisions);
-
-  // Convert montaged image into DREAM3D data structure
-  convertMontageToD3D<PixelType, OriginalImageType>(resampler->GetOutput());
 }
 
 // -----------------------------------------------------------------------------
@@ -585,6 +591,21 @@ template <typename PixelType, typename Resampler>
 void ITKStitchMontage::executeStitching(typename Resampler::Pointer resampler, unsigned streamSubdivisions)
 {
   using OriginalImageType = itk::Image<PixelType, Dimension>;
+  using ScalarPixelType = typename itk::NumericTraits<PixelType>::ValueType;
+  using RegionType = typename OriginalImageType::RegionType;
+
+  OriginalImageType* output = resampler->GetOutput();
+  output->UpdateOutputInformation();
+  const RegionType largestRegion = output->GetLargestPossibleRegion();
+
+  const size_t numComponents = sizeof(PixelType) / sizeof(ScalarPixelType);
+  typename DataArray<ScalarPixelType>::Pointer montageArray = createMontageArray<ScalarPixelType>(output, numComponents);
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+  auto montagePixels = reinterpret_cast<PixelType*>(montageArray->getPointer(0));
+  const size_t montageWidth = largestRegion.GetSize(0);
 
   notifyStatusMessage("Resampling tiles into the stitched image");
 
@@ -593,35 +614,82 @@ void ITKStitchMontage::executeStitching(typename Resampler::Pointer resampler, u
   progressObs->SetMessagePrefix("Stitching Tiles Together");
   unsigned long progressObsTag = resampler->AddObserver(itk::ProgressEvent(), progressObs);
 
-  using Dream3DImageType = itk::Image<PixelType, Dimension>;
-  using StreamingFilterType = itk::StreamingImageFilter<OriginalImageType, Dream3DImageType>;
-  typename StreamingFilterType::Pointer streamingFilter = StreamingFilterType::New();
-  streamingFilter->SetInput(resampler->GetOutput());
-  streamingFilter->SetNumberOfStreamDivisions(streamSubdivisions);
+  // Split along the rows so that every division is a contiguous band of the montage array
+  itk::ImageRegionSplitterSlowDimension::Pointer splitter = itk::ImageRegionSplitterSlowDimension::New();
+  const unsigned numDivisions = splitter->GetNumberOfSplits(largestRegion, streamSubdivisions);
+  for(unsigned division = 0; division < numDivisions; division++)
+  {
+    if(getCancel())
+    {
+      break;
+    }
+    if(numDivisions > 1)
+    {
+      notifyStatusMessage(QObject::tr("Stitching division %1 of %2").arg(division + 1).arg(numDivisions));
+    }
+
+    RegionType streamRegion = largestRegion;
+    splitter->GetSplit(division, numDivisions, streamRegion);
+
+    output->SetRequestedRegion(streamRegion);
+    output->PropagateRequestedRegion();
+    output->UpdateOutputData();
 
-  streamingFilter->Update();
-  notifyStatusMessage("Finished resampling tiles");
+    const PixelType* buffer = output->GetBufferPointer();
+    const size_t regionWidth = streamRegion.GetSize(0);
+    typename RegionType::IndexType rowIndex = streamRegion.GetIndex();
+    const auto rowEnd = static_cast<typename RegionType::IndexValueType>(rowIndex[1] + streamRegion.GetSize(1));
+    for(; rowIndex[1] < rowEnd; rowIndex[1]++)
+    {
+      const PixelType* src = buffer + output->ComputeOffset(rowIndex);
+      size_t dstOffset = (rowIndex[1] - largestRegion.GetIndex(1)) * montageWidth + (rowIndex[0] - largestRegion.GetIndex(0));
+      std::copy(src, src + regionWidth, montagePixels + dstOffset);
+    }
+  }
 
+  // Only the last division is still held by the resampler
+  output->ReleaseData();
   resampler->RemoveObserver(progressObsTag);
+
+  if(!getCancel())
+  {
+    notifyStatusMessage("Finished resampling tiles");
+  }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename PixelType, typename OriginalImageType>
-void ITKStitchMontage::convertMontageToD3D(OriginalImageType* image)
+template <typename ScalarPixelType, typename OriginalImageType>
+typename DataArray<ScalarPixelType>::Pointer ITKStitchMontage::createMontageArray(const OriginalImageType* image, size_t numComponents)
 {
   DataArrayPath dataArrayPath(getMontageDataContainerName(), getMontageAttributeMatrixName(), getMontageDataArrayName());
   DataContainer::Pointer container = getDataContainerArray()->getDataContainer(dataArrayPath.getDataContainerName());
+  ImageGeom::Pointer montageGeom = container->getGeometryAs<ImageGeom>();
+  AttributeMatrix::Pointer am = container->getAttributeMatrix(dataArrayPath.getAttributeMatrixName());
+
+  const typename OriginalImageType::SizeType size = image->GetLargestPossibleRegion().GetSize();
+  const typename OriginalImageType::PointType origin = image->GetOrigin();
+  const typename OriginalImageType::SpacingType spacing = image->GetSpacing();
+
+  montageGeom->setDimensions(size[0], size[1], 1);
+  montageGeom->setOrigin(static_cast<float>(origin[0]), static_cast<float>(origin[1]), 0.0f);
+  montageGeom->setSpacing(static_cast<float>(spacing[0]), static_cast<float>(spacing[1]), montageGeom->getSpacing()[2]);
 
-  using ToDream3DType = itk::InPlaceImageToDream3DDataFilter<PixelType, Dimension>;
-  typename ToDream3DType::Pointer toDream3DFilter = ToDream3DType::New();
-  toDream3DFilter->SetInput(image);
-  toDream3DFilter->SetInPlace(true);
-  toDream3DFilter->SetAttributeMatrixArrayName(dataArrayPath.getAttributeMatrixName().toStdString());
-  toDream3DFilter->SetDataArrayName(dataArrayPath.getDataArrayName().toStdString());
-  toDream3DFilter->SetDataContainer(container);
-  toDream3DFilter->Update();
+  // Drop the placeholder array before allocating so that only one montage sized buffer ever exists
+  am->removeAttributeArray(dataArrayPath.getDataArrayName());
+  std::vector<size_t> tDims = {size[0], size[1], 1};
+  am->setTupleDimensions(tDims);
+
+  typename DataArray<ScalarPixelType>::Pointer montageArray = DataArray<ScalarPixelType>::CreateArray(tDims, std::vector<size_t>(1, numComponents), dataArrayPath.getDataArrayName(), true);
+  if(montageArray.get() == nullptr)
+  {
+    QString ss = QObject::tr("Unable to allocate the %1 x %2 montage data array").arg(size[0]).arg(size[1]);
+    setErrorCondition(-11016, ss);
+    return montageArray;
+  }
+  am->addOrReplaceAttributeArray(montageArray);
+  return montageArray;
 }
 
 // -----------------------------------------------------------------------------
@@ -816,6 +884,18 @@ QString ITKStitchMontage::getMontageDataArrayName() const
   return m_MontageDataArrayName;
 }
 
+// -----------------------------------------------------------------------------
+void ITKStitchMontage::setStreamDivisions(int value)
+{
+  m_StreamDivisions = value;
+}
+
+// -----------------------------------------------------------------------------
+int ITKStitchMontage::getStreamDivisions() const
+{
+  return m_StreamDivisions;
+}
+
 // -----------------------------------------------------------------------------
 MontageSelection ITKStitchMontage::getMontageSelection() const
 {
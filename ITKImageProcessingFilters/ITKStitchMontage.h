@@ -38,6 +38,7 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
@@ -74,6 +75,7 @@ class ITKImageProcessing_EXPORT ITKStitchMontage : public AbstractFilter
   PYB11_PROPERTY(QString MontageDataContainerName READ getMontageDataContainerName WRITE setMontageDataContainerName)
   PYB11_PROPERTY(QString MontageAttributeMatrixName READ getMontageAttributeMatrixName WRITE setMontageAttributeMatrixName)
   PYB11_PROPERTY(QString MontageDataArrayName READ getMontageDataArrayName WRITE setMontageDataArrayName)
+  PYB11_PROPERTY(int StreamDivisions READ getStreamDivisions WRITE setStreamDivisions)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -165,6 +167,17 @@ public:
   QString getMontageDataArrayName() const;
   Q_PROPERTY(QString MontageDataArrayName READ getMontageDataArrayName WRITE setMontageDataArrayName)
 
+  /**
+   * @brief Setter property for StreamDivisions
+   */
+  void setStreamDivisions(int value);
+  /**
+   * @brief Getter property for StreamDivisions
+   * @return Value of StreamDivisions
+   */
+  int getStreamDivisions() const;
+  Q_PROPERTY(int StreamDivisions READ getStreamDivisions WRITE setStreamDivisions)
+
   /**
    * @brief getMontageInformation
    * @return
@@ -260,6 +273,7 @@ private:
   QString m_MontageDataContainerName = {ITKImageProcessing::Montage::k_MontageDataContainerDefaultName};
   QString m_MontageAttributeMatrixName = {ITKImageProcessing::Montage::k_MontageAttributeMatrixDefaultName};
   QString m_MontageDataArrayName = {ITKImageProcessing::Montage::k_MontageDataArrayDefaultName};
+  int m_StreamDivisions = 1;
 
   // QString m_DataContainerList;
 
@@ -280,17 +294,23 @@ private:
   void initializeResampler(typename Resampler::Pointer resampler);
 
   /**
-   * @brief stitchMontageHelper
+   * @brief Resamples the tiles one stream division at a time, copying each division
+   * into the montage data array as soon as it has been generated.
    * @param resampler
+   * @param streamSubdivisions
    */
   template <typename PixelType, typename Resampler>
   void executeStitching(typename Resampler::Pointer resampler, unsigned streamSubdivisions);
 
   /**
-   * @brief convertMontageToD3D
+   * @brief Sizes the montage geometry and attribute matrix to the resampler's output
+   * and allocates the montage data array.
+   * @param image
+   * @param numComponents
+   * @return The montage data array
    */
-  template <typename PixelType, typename OriginalImageType>
-  void convertMontageToD3D(OriginalImageType* image);
+  template <typename ScalarPixelType, typename OriginalImageType>
+  typename DataArray<ScalarPixelType>::Pointer createMontageArray(const OriginalImageType* image, size_t numComponents);
 
 public:
   ITKStitchMontage(const ITKStitchMontage&) = delete;            // Copy Constructor Not Implemented
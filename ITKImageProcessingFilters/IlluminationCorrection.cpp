@@ -31,11 +31,16 @@
 
 #include "IlluminationCorrection.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <numeric>
 #include <set>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/task_group.h>
@@ -57,6 +62,7 @@
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/MontageSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/MultiDataContainerSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
@@ -65,6 +71,7 @@
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/RectGridGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageWriter.h"
@@ -96,17 +103,133 @@ const QString k_BackgroundAttributeMatrixLabel("Created Attribute Matrix (Correc
 const QString k_BackgroundAttributeArrayLabel("Created Image Array Name (Corrected)");
 const QString k_OutputProcessedImageLabel("Corrected Image Name");
 
+/**
+ * @brief Writes corrected images on dedicated writer threads so that image encoding and disk
+ * writes overlap with the correction of the remaining tiles. The queue is bounded; producers
+ * block while it is full.
+ */
+class CorrectedImageExportQueue
+{
+public:
+  CorrectedImageExportQueue(IlluminationCorrection* filter, size_t capacity, size_t writerCount)
+  : m_Filter(filter)
+  , m_Capacity(std::max<size_t>(capacity, 1))
+  {
+    for(size_t i = 0; i < std::max<size_t>(writerCount, 1); i++)
+    {
+      m_Threads.emplace_back(&CorrectedImageExportQueue::run, this);
+    }
+  }
+  ~CorrectedImageExportQueue()
+  {
+    finish();
+  }
+  CorrectedImageExportQueue(const CorrectedImageExportQueue&) = delete;            // Copy Constructor Not Implemented
+  CorrectedImageExportQueue(CorrectedImageExportQueue&&) = delete;                 // Move Constructor Not Implemented
+  CorrectedImageExportQueue& operator=(const CorrectedImageExportQueue&) = delete; // Copy Assignment Not Implemented
+  CorrectedImageExportQueue& operator=(CorrectedImageExportQueue&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Queues the corrected image of a DataContainer for writing
+   * @param dcName
+   */
+  void push(const QString& dcName)
+  {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_NotFull.wait(lock, [this] { return m_Pending.size() < m_Capacity; });
+    m_Pending.push_back(dcName);
+    m_NotEmpty.notify_one();
+  }
+
+  /**
+   * @brief Writes everything still queued, stops the writer threads and reports the first
+   * write error on the filter. Must be called from the thread that runs the filter.
+   */
+  void finish()
+  {
+    if(m_Threads.empty())
+    {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Done = true;
+    }
+    m_NotEmpty.notify_all();
+    for(std::thread& thread : m_Threads)
+    {
+      thread.join();
+    }
+    m_Threads.clear();
+
+    if(m_ErrorCode < 0)
+    {
+      m_Filter->setErrorCondition(m_ErrorCode, m_ErrorMessage);
+    }
+  }
+
+private:
+  IlluminationCorrection* m_Filter = nullptr;
+  size_t m_Capacity = 1;
+  std::deque<QString> m_Pending;
+  std::mutex m_Mutex;
+  std::condition_variable m_NotFull;
+  std::condition_variable m_NotEmpty;
+  bool m_Done = false;
+  std::vector<std::thread> m_Threads;
+  int32_t m_ErrorCode = 0;
+  QString m_ErrorMessage;
+
+  void run()
+  {
+    while(true)
+    {
+      QString dcName;
+      {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotEmpty.wait(lock, [this] { return m_Done || !m_Pending.empty(); });
+        if(m_Pending.empty())
+        {
+          return;
+        }
+        dcName = m_Pending.front();
+        m_Pending.pop_front();
+      }
+      m_NotFull.notify_one();
+      write(dcName);
+    }
+  }
+
+  void write(const QString& dcName)
+  {
+    ITKImageWriter::Pointer imageWriter = ITKImageWriter::New();
+    imageWriter->setDataContainerArray(m_Filter->getDataContainerArray());
+    QString outputPath = QString("%1/%2%3").arg(m_Filter->getOutputPath()).arg(dcName).arg(m_Filter->getFileExtension());
+    imageWriter->setFileName(outputPath);
+    DataArrayPath dap(dcName, m_Filter->getCellAttributeMatrixName(), m_Filter->getCorrectedImageDataArrayName());
+    imageWriter->setImageArrayPath(dap);
+    imageWriter->setPlane(0);
+
+    imageWriter->execute();
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if(imageWriter->getErrorCode() < 0 && m_ErrorCode == 0)
+    {
+      m_ErrorCode = imageWriter->getErrorCode();
+      m_ErrorMessage = QString("%1 Filter could not write image to path '%2'").arg(imageWriter->ClassName()).arg(outputPath);
+    }
+  }
+};
+
 template <typename OutArrayType, typename AccumType>
 class ProcessInputImagesImpl
 {
 public:
-  using AccumDataArrayType = DataArray<AccumType>;
-
-  ProcessInputImagesImpl(IlluminationCorrection* filter, QString dcName, AccumType average, const AccumDataArrayType& accumArray)
+  ProcessInputImagesImpl(IlluminationCorrection* filter, QString dcName, AccumType average, const AccumType* background, CorrectedImageExportQueue* exportQueue)
   : m_Filter(filter)
   , m_DcName(std::move(dcName))
   , m_Average(average)
-  , m_AccumArray(accumArray)
+  , m_Background(background)
+  , m_ExportQueue(exportQueue)
   {
   }
   ~ProcessInputImagesImpl() = default;
@@ -117,7 +240,10 @@ public:
 
   void operator()() const
   {
-    // std::cout << "Processing: " << m_DcName.toStdString() << std::endl;
+    if(m_Filter->getCancel())
+    {
+      return;
+    }
 
     using OutputDataArrayType = DataArray<OutArrayType>;
     using OutputDataArrayPointerType = typename OutputDataArrayType::Pointer;
@@ -127,55 +253,190 @@ public:
     OutputDataArrayPointerType imageDataArrayPtr = am->getAttributeArrayAs<OutputDataArrayType>(m_Filter->getImageDataArrayName());
     OutputDataArrayPointerType correctedDataArrayPtr = am->getAttributeArrayAs<OutputDataArrayType>(m_Filter->getCorrectedImageDataArrayName());
 
-    OutputDataArrayType& inputImage = *imageDataArrayPtr;
-    OutputDataArrayType& correctedImage = *correctedDataArrayPtr;
+    const OutArrayType* inputImage = imageDataArrayPtr->getPointer(0);
+    OutArrayType* correctedImage = correctedDataArrayPtr->getPointer(0);
+    const AccumType* background = m_Background;
+    const AccumType average = m_Average;
+    const AccumType maxValue = static_cast<AccumType>(std::numeric_limits<OutArrayType>::max());
 
-    size_t totalPoints = inputImage.getNumberOfTuples();
+    size_t totalPoints = imageDataArrayPtr->getNumberOfTuples();
 
+    // Dividing by 1 where the background is 0 keeps the loop free of branches
     for(size_t t = 0; t < totalPoints; t++)
     {
-      AccumType numerator = static_cast<AccumType>(inputImage[t]);
-      AccumType denominator = m_AccumArray[t];
+      AccumType temp = average * static_cast<AccumType>(inputImage[t]);
+      const AccumType denominator = background[t] != 0 ? background[t] : static_cast<AccumType>(1);
+      temp = temp / denominator;
+      temp = std::max(temp, static_cast<AccumType>(0));
+      temp = std::min(temp, maxValue);
+      correctedImage[t] = static_cast<OutArrayType>(temp);
+    }
 
-      AccumType temp = m_Average * numerator;
-      if(denominator != 0)
-      {
-        temp = temp / denominator;
-      }
-      if(temp < 0)
+    if(m_ExportQueue != nullptr)
+    {
+      m_ExportQueue->push(m_DcName);
+    }
+    m_Filter->notifyFeatureCompleted(m_DcName);
+  }
+
+private:
+  IlluminationCorrection* m_Filter = nullptr;
+  QString m_DcName;
+  AccumType m_Average;
+  const AccumType* m_Background = nullptr;
+  CorrectedImageExportQueue* m_ExportQueue = nullptr;
+};
+
+/**
+ * @brief Accumulates the thresholded tile values for a range of pixels and divides by the
+ * number of values that were accepted. Each range owns its pixels across every tile, so no
+ * per-thread copies of the accumulator are needed.
+ */
+template <typename InputType, typename AccumType>
+class AccumulateBackgroundImpl
+{
+public:
+  using ThresholdType = typename std::conditional<std::is_floating_point<InputType>::value, InputType, int32_t>::type;
+
+  AccumulateBackgroundImpl(const std::vector<const InputType*>& tiles, AccumType* accum, size_t* counter, int32_t lowThreshold, int32_t highThreshold)
+  : m_Tiles(tiles)
+  , m_Accum(accum)
+  , m_Counter(counter)
+  , m_LowThreshold(static_cast<ThresholdType>(lowThreshold))
+  , m_HighThreshold(static_cast<ThresholdType>(highThreshold))
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const size_t start = range.min();
+    const size_t end = range.max();
+    AccumType* accum = m_Accum;
+    size_t* counter = m_Counter;
+
+    for(const InputType* image : m_Tiles)
+    {
+      // Branch free so that the compiler can vectorize the masked add
+      for(size_t t = start; t < end; t++)
       {
-        temp = 0;
+        const ThresholdType value = image[t];
+        const bool inRange = value >= m_LowThreshold && value <= m_HighThreshold;
+        accum[t] += inRange ? static_cast<AccumType>(image[t]) : static_cast<AccumType>(0);
+        counter[t] += static_cast<size_t>(inRange);
       }
-      if(temp > std::numeric_limits<OutArrayType>::max())
+    }
+
+    // counts will be the number of images unless the threshold values do not include all the possible image values
+    // (i.e. for an 8 bit image, if we only include values from 0 to 100, not every image value will be counted)
+    for(size_t t = start; t < end; t++)
+    {
+      if(counter[t] > 0) // Guard against Divide by zero
       {
-        temp = std::numeric_limits<OutArrayType>::max();
+        accum[t] /= counter[t];
       }
-      correctedImage[t] = temp;
     }
-    if(m_Filter->getExportCorrectedImages())
+  }
+
+private:
+  const std::vector<const InputType*>& m_Tiles;
+  AccumType* m_Accum = nullptr;
+  size_t* m_Counter = nullptr;
+  ThresholdType m_LowThreshold;
+  ThresholdType m_HighThreshold;
+};
+
+/**
+ * @brief Computes a median or trimmed mean background over a range of pixels. The accepted tile
+ * values of a small block of pixels are gathered into a scratch buffer and the trimmed values are
+ * found with nth_element, so the result is exact and the scratch memory is only
+ * (number of tiles x block size) values per range.
+ */
+template <typename InputType, typename AccumType>
+class SelectBackgroundImpl
+{
+public:
+  using ThresholdType = typename AccumulateBackgroundImpl<InputType, AccumType>::ThresholdType;
+
+  static constexpr size_t k_BlockSize = 256;
+
+  SelectBackgroundImpl(const std::vector<const InputType*>& tiles, AccumType* accum, int32_t lowThreshold, int32_t highThreshold, bool median, float trimPercent)
+  : m_Tiles(tiles)
+  , m_Accum(accum)
+  , m_LowThreshold(static_cast<ThresholdType>(lowThreshold))
+  , m_HighThreshold(static_cast<ThresholdType>(highThreshold))
+  , m_Median(median)
+  , m_TrimFraction(static_cast<double>(trimPercent) / 100.0)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const size_t numTiles = m_Tiles.size();
+    std::vector<InputType> values(numTiles * k_BlockSize);
+    std::vector<size_t> counts(k_BlockSize);
+
+    for(size_t blockStart = range.min(); blockStart < range.max(); blockStart += k_BlockSize)
     {
-      ITKImageWriter::Pointer imageWriter = ITKImageWriter::New();
-      imageWriter->setDataContainerArray(m_Filter->getDataContainerArray());
-      QString outputPath = QString("%1/%2%3").arg(m_Filter->getOutputPath()).arg(m_DcName).arg(m_Filter->getFileExtension());
-      imageWriter->setFileName(outputPath);
-      DataArrayPath dap(m_DcName, m_Filter->getCellAttributeMatrixName(), m_Filter->getCorrectedImageDataArrayName());
-      imageWriter->setImageArrayPath(dap);
-      imageWriter->setPlane(0);
-
-      imageWriter->execute();
-      if(imageWriter->getErrorCode() < 0)
+      const size_t remaining = range.max() - blockStart;
+      const size_t blockSize = remaining < k_BlockSize ? remaining : k_BlockSize;
+      std::fill(counts.begin(), counts.end(), 0);
+
+      // Tile by tile so that every image is read contiguously
+      for(const InputType* image : m_Tiles)
+      {
+        const InputType* block = image + blockStart;
+        for(size_t p = 0; p < blockSize; p++)
+        {
+          const ThresholdType value = block[p];
+          if(value >= m_LowThreshold && value <= m_HighThreshold)
+          {
+            values[p * numTiles + counts[p]] = block[p];
+            counts[p]++;
+          }
+        }
+      }
+
+      for(size_t p = 0; p < blockSize; p++)
       {
-        m_Filter->setErrorCondition(imageWriter->getErrorCode(), QString("%1 Filter could not write image to path '%2'").arg(imageWriter->ClassName()).arg(outputPath));
+        m_Accum[blockStart + p] = estimate(values.data() + p * numTiles, counts[p]);
       }
     }
-    m_Filter->notifyFeatureCompleted(m_DcName);
   }
 
 private:
-  IlluminationCorrection* m_Filter = nullptr;
-  QString m_DcName;
-  AccumType m_Average;
-  const DataArray<AccumType>& m_AccumArray;
+  const std::vector<const InputType*>& m_Tiles;
+  AccumType* m_Accum = nullptr;
+  ThresholdType m_LowThreshold;
+  ThresholdType m_HighThreshold;
+  bool m_Median = true;
+  double m_TrimFraction = 0.0;
+
+  /**
+   * @brief Averages the values that are left after dropping the same number of values from each end.
+   * The median is the case where all but the middle one or two values are dropped.
+   */
+  AccumType estimate(InputType* first, size_t count) const
+  {
+    if(count == 0)
+    {
+      return static_cast<AccumType>(0);
+    }
+    size_t trim = (count - 1) / 2;
+    if(!m_Median)
+    {
+      trim = std::min(trim, static_cast<size_t>(static_cast<double>(count) * m_TrimFraction));
+    }
+    InputType* last = first + count;
+    std::nth_element(first, first + trim, last);
+    std::nth_element(first + trim, last - trim, last);
+
+    AccumType sum = static_cast<AccumType>(0);
+    for(InputType* value = first + trim; value != last - trim; ++value)
+    {
+      sum += static_cast<AccumType>(*value);
+    }
+    return sum / static_cast<AccumType>(count - 2 * trim);
+  }
 };
 
 /**
@@ -217,31 +478,27 @@ void calculateOutputValues(IlluminationCorrection* filter)
   filter->notifyStatusMessage(progressMessage);
 
   QStringList dcNames = filter->getMontageSelection().getDataContainerNamesCombOrder();
+  std::vector<const OutArrayType*> tiles;
+  tiles.reserve(static_cast<size_t>(dcNames.size()));
   for(const auto& dcName : dcNames)
   {
     DataArrayPath imageArrayPath(dcName, filter->getCellAttributeMatrixName(), filter->getImageDataArrayName());
     OutputDataArrayPointerType imageArrayPtr = dca->getAttributeMatrix(imageArrayPath)->getAttributeArrayAs<OutputDataArrayType>(imageArrayPath.getDataArrayName());
-    OutputDataArrayType& imageArray = *imageArrayPtr;
-
-    for(size_t t = 0; t < numTuples; t++)
-    {
-      if(imageArray[t] >= LowThreshold && imageArray[t] <= HighThreshold)
-      {
-        accumArray[t] += imageArray[t];
-        counter[t]++;
-      }
-    }
+    tiles.push_back(imageArrayPtr->getPointer(0));
   }
 
-  // average the background values by the number of counts (counts will be the number of images unless the threshold
-  // values do not include all the possible image values
-  // (i.e. for an 8 bit image, if we only include values from 0 to 100, not every image value will be counted)
-  for(size_t j = 0; j < numTuples; j++)
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  const auto estimator = static_cast<IlluminationCorrection::BackgroundEstimatorType>(filter->getBackgroundEstimator());
+  if(estimator == IlluminationCorrection::BackgroundEstimatorType::Mean)
   {
-    if(counter[j] > 0) // Guard against Divide by zero
-    {
-      accumArray[j] /= counter[j];
-    }
+    // Accumulate and average the background values
+    dataAlg.execute(AccumulateBackgroundImpl<OutArrayType, AccumType>(tiles, accumArray.getPointer(0), counter.getPointer(0), LowThreshold, HighThreshold));
+  }
+  else
+  {
+    bool median = (estimator == IlluminationCorrection::BackgroundEstimatorType::Median);
+    dataAlg.execute(SelectBackgroundImpl<OutArrayType, AccumType>(tiles, accumArray.getPointer(0), LowThreshold, HighThreshold, median, filter->getTrimPercent()));
   }
 
   // Median
@@ -289,34 +546,39 @@ void calculateOutputValues(IlluminationCorrection* filter)
     QString progressMessage = QString("Generating Corrected Images...");
     filter->notifyStatusMessage(progressMessage);
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-    // C++11 RIGHT HERE....
-    int32_t nthreads = static_cast<int32_t>(std::thread::hardware_concurrency()); // Returns ZERO if not defined on this platform
-    int32_t threadCount = 0;
-#endif
+    std::unique_ptr<CorrectedImageExportQueue> exportQueue;
+    if(filter->getExportCorrectedImages())
+    {
+      // Encoding and compressing an exported image is CPU bound and slower than correcting it,
+      // so one writer would fall behind the correction tasks. Half of the cores write images.
+      const size_t threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+      exportQueue.reset(new CorrectedImageExportQueue(filter, threadCount, std::max<size_t>(threadCount / 2, 1)));
+    }
 
+    const AccumType* background = newAccumArray.getPointer(0);
     QStringList dcNames = filter->getMontageSelection().getDataContainerNamesCombOrder();
+    filter->resetCompletedCorrections(static_cast<size_t>(dcNames.size()));
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    // Every tile is its own task, so idle threads steal work instead of waiting on the slowest tile of a batch
+    tbb::task_group g;
     for(const auto& dcName : dcNames)
     {
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-      g->run(ProcessInputImagesImpl<OutArrayType, AccumType>(filter, dcName, average, newAccumArray));
-      threadCount++;
-      if(threadCount == nthreads)
-      {
-        g->wait();
-        threadCount = 0;
-      }
+      g.run(ProcessInputImagesImpl<OutArrayType, AccumType>(filter, dcName, average, background, exportQueue.get()));
+    }
+    g.wait();
 #else
-      ProcessInputImagesImpl<OutArrayType, AccumType> impl(filter, dcName, average, accumArray);
+    for(const auto& dcName : dcNames)
+    {
+      ProcessInputImagesImpl<OutArrayType, AccumType> impl(filter, dcName, average, background, exportQueue.get());
       impl();
-#endif
     }
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    // This will spill over if the number of files to process does not divide evenly by the number of threads.
-    g->wait();
 #endif
 
+    if(exportQueue)
+    {
+      filter->notifyStatusMessage("Finishing the export of the corrected images...");
+      exportQueue->finish();
+    }
   } // Apply Correction
 }
 
@@ -379,6 +641,13 @@ void IlluminationCorrection::setupFilterParameters()
 
   std::vector<QString> linkedProps;
 
+  {
+    std::vector<QString> choices = {"Mean", "Median", "Trimmed Mean"};
+    linkedProps = {"TrimPercent"};
+    parameters.push_back(SIMPL_NEW_LINKED_CHOICES_FP("Background Estimator", BackgroundEstimator, FilterParameter::Category::Parameter, IlluminationCorrection, choices, linkedProps));
+    parameters.push_back(SIMPL_NEW_FLOAT_FP("Trim Percent (Each End)", TrimPercent, FilterParameter::Category::Parameter, IlluminationCorrection, 2));
+  }
+
   parameters.push_back(SeparatorFilterParameter::Create("Background Image Processing", FilterParameter::Category::Parameter));
   linkedProps.clear();
   linkedProps.push_back("MedianRadius");
@@ -565,6 +834,14 @@ void IlluminationCorrection::dataCheck()
   {
     setErrorCondition(-53030, "The lower threshold is greater than the upper threshold.");
   }
+  if(m_BackgroundEstimator < 0 || m_BackgroundEstimator > static_cast<int>(BackgroundEstimatorType::TrimmedMean))
+  {
+    setErrorCondition(-53031, "The Background Estimator must be Mean, Median or Trimmed Mean.");
+  }
+  if(m_BackgroundEstimator == static_cast<int>(BackgroundEstimatorType::TrimmedMean) && (m_TrimPercent < 0.0f || m_TrimPercent >= 50.0f))
+  {
+    setErrorCondition(-53032, QString("The Trim Percent (%1) must be at least 0 and less than 50.").arg(m_TrimPercent));
+  }
 
   // Create all the 'Corrected Input Images'
   if(getApplyCorrection())
@@ -779,14 +1056,35 @@ void IlluminationCorrection::calculateOutputValues(ArrayType arrayType, GeomType
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IlluminationCorrection::resetCompletedCorrections(size_t totalCorrections)
+{
+  m_CompletedCorrections = 0;
+  m_TotalCorrections = totalCorrections;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void IlluminationCorrection::notifyFeatureCompleted(const QString& dcName)
 {
-  QMutexLocker locker(&m_NotifyMessage);
-  QString ss = QObject::tr("%1 Correction Completed").arg(dcName);
+  size_t completed = ++m_CompletedCorrections;
+  // Intermediate messages are only progress, so a worker that finds another one already
+  // reporting skips its message instead of queuing up behind the lock. The last tile always
+  // waits for the lock so that the final count is never dropped.
+  if(completed == m_TotalCorrections)
+  {
+    m_NotifyMessage.lock();
+  }
+  else if(!m_NotifyMessage.tryLock())
+  {
+    return;
+  }
+  QString ss = QObject::tr("%1 Correction Completed (%2 of %3 tiles done)").arg(dcName).arg(completed).arg(m_TotalCorrections);
   notifyStatusMessage(ss);
+  m_NotifyMessage.unlock();
 }
 
 // -----------------------------------------------------------------------------
@@ -1083,6 +1381,30 @@ FloatVec3Type IlluminationCorrection::getMedianRadius() const
   return m_MedianRadius;
 }
 
+// -----------------------------------------------------------------------------
+void IlluminationCorrection::setBackgroundEstimator(int value)
+{
+  m_BackgroundEstimator = value;
+}
+
+// -----------------------------------------------------------------------------
+int IlluminationCorrection::getBackgroundEstimator() const
+{
+  return m_BackgroundEstimator;
+}
+
+// -----------------------------------------------------------------------------
+void IlluminationCorrection::setTrimPercent(float value)
+{
+  m_TrimPercent = value;
+}
+
+// -----------------------------------------------------------------------------
+float IlluminationCorrection::getTrimPercent() const
+{
+  return m_TrimPercent;
+}
+
 // -----------------------------------------------------------------------------
 MontageSelection IlluminationCorrection::getMontageSelection() const
 {
@@ -30,6 +30,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include <QtCore/QMutex>
@@ -78,6 +79,8 @@ class ITKImageProcessing_EXPORT IlluminationCorrection : public AbstractFilter
   PYB11_PROPERTY(bool ApplyCorrection READ getApplyCorrection WRITE setApplyCorrection)
   PYB11_PROPERTY(bool ApplyMedianFilter READ getApplyMedianFilter WRITE setApplyMedianFilter)
   PYB11_PROPERTY(FloatVec3Type MedianRadius READ getMedianRadius WRITE setMedianRadius)
+  PYB11_PROPERTY(int BackgroundEstimator READ getBackgroundEstimator WRITE setBackgroundEstimator)
+  PYB11_PROPERTY(float TrimPercent READ getTrimPercent WRITE setTrimPercent)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -91,6 +94,16 @@ public:
 
   static std::shared_ptr<IlluminationCorrection> New();
 
+  /**
+   * @brief How the background value of each pixel is estimated from the tiles
+   */
+  enum class BackgroundEstimatorType : int
+  {
+    Mean = 0,
+    Median = 1,
+    TrimmedMean = 2
+  };
+
   /**
    * @brief Returns the name of the class for IlluminationCorrection
    */
@@ -290,12 +303,40 @@ public:
   FloatVec3Type getMedianRadius() const;
   Q_PROPERTY(FloatVec3Type MedianRadius READ getMedianRadius WRITE setMedianRadius)
 
+  /**
+   * @brief Setter property for BackgroundEstimator
+   */
+  void setBackgroundEstimator(int value);
+  /**
+   * @brief Getter property for BackgroundEstimator
+   * @return Value of BackgroundEstimator
+   */
+  int getBackgroundEstimator() const;
+  Q_PROPERTY(int BackgroundEstimator READ getBackgroundEstimator WRITE setBackgroundEstimator)
+
+  /**
+   * @brief Setter property for TrimPercent
+   */
+  void setTrimPercent(float value);
+  /**
+   * @brief Getter property for TrimPercent
+   * @return Value of TrimPercent
+   */
+  float getTrimPercent() const;
+  Q_PROPERTY(float TrimPercent READ getTrimPercent WRITE setTrimPercent)
+
   /**
    * @brief notifyFeatureCompleted
    * @return
    */
   void notifyFeatureCompleted(const QString& dcName);
 
+  /**
+   * @brief Resets the count of corrected tiles reported by notifyFeatureCompleted
+   * @param totalCorrections Number of tiles that will be corrected
+   */
+  void resetCompletedCorrections(size_t totalCorrections);
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -472,8 +513,12 @@ private:
   bool m_ApplyCorrection = {};
   bool m_ApplyMedianFilter = {};
   FloatVec3Type m_MedianRadius = {};
+  int m_BackgroundEstimator = 0;
+  float m_TrimPercent = 10.0f;
 
   QMutex m_NotifyMessage;
+  std::atomic<size_t> m_CompletedCorrections = {0};
+  size_t m_TotalCorrections = 0;
 
 public:
   IlluminationCorrection(const IlluminationCorrection&) = delete;            // Copy Constructor Not Implemented
@@ -34,6 +34,7 @@
 #include <array>
 #include <cstring>
 #include <limits>
+#include <map>
 #include <set>
 
 #include <QtCore/QDir>
@@ -62,6 +63,7 @@
 #include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 #include "ITKImageProcessing/ZeissXml/ZeissTagMapping.h"
+#include "ITKImageProcessing/ZeissXml/ZeissXMLReader.h"
 #include "MetaXmlUtils.h"
 
 #define ZIF_PRINT_DBG_MSGS 0
@@ -88,9 +90,6 @@ class ImportAxioVisionV4MontagePrivate
   ImportAxioVisionV4Montage* const q_ptr;
   ImportAxioVisionV4MontagePrivate(ImportAxioVisionV4Montage* ptr);
 
-  ZeissTagsXmlSection::Pointer m_RootTagsSection;
-
-  QDomElement m_Root;
   QString m_InputFile_Cache;
   DataArrayPath m_DataContainerPath;
   QString m_CellAttributeMatrixName;
@@ -109,6 +108,9 @@ class ImportAxioVisionV4MontagePrivate
   int32_t m_MaxRow = 0;
   int32_t m_MaxCol = 0;
   std::vector<ImportAxioVisionV4Montage::BoundsType> m_BoundsCache;
+  AttributeMatrix::Pointer m_MetaData;
+  bool m_MetaDataAllocated = false;
+  QString m_MetaDataWarning;
 };
 
 // -----------------------------------------------------------------------------
@@ -116,7 +118,6 @@ class ImportAxioVisionV4MontagePrivate
 // -----------------------------------------------------------------------------
 ImportAxioVisionV4MontagePrivate::ImportAxioVisionV4MontagePrivate(ImportAxioVisionV4Montage* ptr)
 : q_ptr(ptr)
-, m_Root(QDomElement())
 , m_InputFile_Cache("")
 , m_TimeStamp_Cache(QDateTime())
 {
@@ -147,20 +148,6 @@ ImportAxioVisionV4Montage::ImportAxioVisionV4Montage()
 // -----------------------------------------------------------------------------
 ImportAxioVisionV4Montage::~ImportAxioVisionV4Montage() = default;
 
-// -----------------------------------------------------------------------------
-void ImportAxioVisionV4Montage::setRoot(const QDomElement& value)
-{
-  Q_D(ImportAxioVisionV4Montage);
-  d->m_Root = value;
-}
-
-// -----------------------------------------------------------------------------
-QDomElement ImportAxioVisionV4Montage::getRoot() const
-{
-  Q_D(const ImportAxioVisionV4Montage);
-  return d->m_Root;
-}
-
 // -----------------------------------------------------------------------------
 void ImportAxioVisionV4Montage::setInputFile_Cache(const QString& value)
 {
@@ -316,19 +303,8 @@ void ImportAxioVisionV4Montage::dataCheck()
     return;
   }
 
-  // Parse the XML file to get all the meta-data information and create all the
-  // data structure that is needed.
-  QFile xmlFile(getInputFile());
-
-  QString errorStr;
-  int errorLine = -1;
-  int errorColumn = -1;
-
   QDateTime timeStamp(fi.lastModified());
 
-  QDomDocument domDocument;
-  QDomElement root;
-
   // clang-format off
   if(m_InputFile ==  d_ptr->m_InputFile_Cache
     && m_DataContainerPath == d_ptr->m_DataContainerPath
@@ -344,12 +320,12 @@ void ImportAxioVisionV4Montage::dataCheck()
     && timeStamp == d_ptr->m_TimeStamp_Cache
     && d_ptr->m_ImportAllMetaData == m_ImportAllMetaData
     && d_ptr->m_MetaDataAttributeMatrixName == m_MetaDataAttributeMatrixName
+    && (!m_ImportAllMetaData || d_ptr->m_MetaDataAllocated || getInPreflight())
   )
   // clang-format on
   {
     // We are reading from the cache, so set the FileWasRead flag to false
     m_FileWasRead = false;
-    //    root = getRoot();
   }
   else
   {
@@ -357,24 +333,6 @@ void ImportAxioVisionV4Montage::dataCheck()
     // We are reading from the file, so set the FileWasRead flag to true
     m_FileWasRead = true;
 
-    if(!domDocument.setContent(&xmlFile, true, &errorStr, &errorLine, &errorColumn))
-    {
-      QString ss = QObject::tr("Parse error at line %1, column %2:\n%3").arg(errorLine).arg(errorColumn).arg(errorStr);
-      setErrorCondition(-71000, ss);
-      return;
-    }
-
-    root = domDocument.documentElement();
-    setRoot(root);
-    QDomElement tags = root.firstChildElement(ITKImageProcessingConstants::Xml::Tags);
-    if(tags.isNull())
-    {
-      QString ss = QObject::tr("Could not find the <ROOT><Tags> element. Aborting Parsing. Is the file a Zeiss _meta.xml file");
-      setErrorCondition(-71001, ss);
-      return;
-    }
-
-    d_ptr->m_Root = root;
     d_ptr->m_InputFile_Cache = m_InputFile;
     d_ptr->m_DataContainerPath = m_DataContainerPath;
     d_ptr->m_CellAttributeMatrixName = m_CellAttributeMatrixName;
@@ -391,7 +349,12 @@ void ImportAxioVisionV4Montage::dataCheck()
 
     setTimeStamp_Cache(timeStamp);
 
-    generateCache(root);
+    generateCache();
+  }
+
+  if(!d_ptr->m_MetaDataWarning.isEmpty())
+  {
+    setWarningCondition(-70604, d_ptr->m_MetaDataWarning);
   }
 
   if(m_MontageStart[0] > m_MontageEnd[0])
@@ -450,6 +413,11 @@ void ImportAxioVisionV4Montage::execute()
   }
   clearErrorCode();
   clearWarningCode();
+  // The meta data values that could not be parsed are still reported for the executed pipeline
+  if(!d_ptr->m_MetaDataWarning.isEmpty())
+  {
+    setWarningCondition(-70604, d_ptr->m_MetaDataWarning);
+  }
 
   readImages();
 
@@ -469,7 +437,6 @@ void ImportAxioVisionV4Montage::flushCache()
 {
   m_GeneratedFileList.clear();
   setTimeStamp_Cache(QDateTime());
-  setRoot(QDomElement());
 
   d_ptr->m_InputFile_Cache = "";
   d_ptr->m_DataContainerPath = DataArrayPath();
@@ -484,6 +451,9 @@ void ImportAxioVisionV4Montage::flushCache()
   d_ptr->m_BoundsCache.clear();
   d_ptr->m_ImportAllMetaData = false;
   d_ptr->m_MetaDataAttributeMatrixName = "";
+  d_ptr->m_MetaData = AttributeMatrix::NullPointer();
+  d_ptr->m_MetaDataAllocated = false;
+  d_ptr->m_MetaDataWarning = "";
   d_ptr->m_MaxCol = 0;
   d_ptr->m_MaxRow = 0;
 }
@@ -505,16 +475,87 @@ QString ImportAxioVisionV4Montage::getMontageInformation()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ImportAxioVisionV4Montage::generateCache(QDomElement& root)
+void ImportAxioVisionV4Montage::generateCache()
 {
-  // First parse the <ROOT><Tags> section to get the values of how many images we are going to have
-  QDomElement tags = root.firstChildElement(ITKImageProcessingConstants::Xml::Tags);
-  ZeissTagsXmlSection::Pointer rootTagsSection = MetaXmlUtils::ParseTagsSection(this, tags);
-  if(nullptr == rootTagsSection.get())
+  // Only the values needed for the bounds are kept from each <pXXX> element, so memory does not
+  // depend on how many tags every photo carries
+  struct PhotoInfo
+  {
+    QString PhotoTag;
+    BoundsType Bound;
+  };
+  std::map<int32_t, PhotoInfo> photos;
+
+  // All of the meta data goes into typed columns with one tuple per photo. The tiles get their row of it in generateDataStructure().
+  // Preflight only creates the columns without allocating them, the cache is read again for execute to fill in the values.
+  AttributeMatrix::Pointer metaDataAm;
+  QMap<QString, int> unparsedValues;
+  if(getImportAllMetaData())
+  {
+    metaDataAm = AttributeMatrix::New({0}, getMetaDataAttributeMatrixName(), AttributeMatrix::Type::Generic);
+  }
+
+  ZeissXMLReader::Pointer reader = ZeissXMLReader::New(getInputFile());
+  reader->setPhotoHandler([this, &photos, &metaDataAm, &unparsedValues, &reader](int32_t photoIndex, const QString& photoTag, const ZeissTagsXmlSection::Pointer& photoTagsSection) {
+    // Send a status update on the progress
+    QString msg = QString("%1: Caching meta data for %2").arg(getHumanLabel()).arg(photoTag);
+    notifyStatusMessage(msg);
+
+    // Get the Row Index (Zero Based)
+    int32_t rowIndex = MetaXmlUtils::GetInt32Entry(this, photoTagsSection.get(), Zeiss::MetaXML::ImageIndexVId);
+    if(getErrorCode() < 0)
+    {
+      return false;
+    }
+    // Get the Columnn Index (Zero Based)
+    int32_t colIndex = MetaXmlUtils::GetInt32Entry(this, photoTagsSection.get(), Zeiss::MetaXML::ImageIndexUId);
+    if(getErrorCode() < 0)
+    {
+      return false;
+    }
+    // Create the Image Geometry
+    ImageGeom::Pointer image = initializeImageGeom(photoTagsSection);
+    if(getErrorCode() < 0)
+    {
+      return false;
+    }
+
+    PhotoInfo& photo = photos[photoIndex];
+    photo.PhotoTag = photoTag;
+    photo.Bound.Dims = image->getDimensions();
+    photo.Bound.Origin = image->getOrigin();
+    photo.Bound.Col = colIndex;
+    photo.Bound.Row = rowIndex;
+
+    if(nullptr != metaDataAm)
+    {
+      // Size the columns once if the <ROOT><Tags> section came before the photos
+      ZeissTagsXmlSection::Pointer rootTagsSection = reader->getRootTagsSection();
+      if(!getInPreflight() && metaDataAm->getNumberOfTuples() == 0 && nullptr != rootTagsSection)
+      {
+        Int32ZeissMetaEntry::Pointer countPtr = ZeissMetaEntry::convert<Int32ZeissMetaEntry>(rootTagsSection->getEntry(Zeiss::MetaXML::ImageCountRawId));
+        if(nullptr != countPtr && countPtr->getValue() > photoIndex)
+        {
+          metaDataAm->resizeAttributeArrays({static_cast<size_t>(countPtr->getValue())});
+        }
+      }
+      addMetaData(metaDataAm, photoTagsSection, photoIndex, unparsedValues);
+    }
+    return true;
+  });
+
+  if(!reader->parse())
   {
+    if(reader->getErrorCode() < 0)
+    {
+      setErrorCondition(reader->getErrorCode(), reader->getErrorMessage());
+    }
     return;
   }
 
+  // The <ROOT><Tags> section has the values of how many images we are going to have
+  ZeissTagsXmlSection::Pointer rootTagsSection = reader->getRootTagsSection();
+
   int32_t imageCount = MetaXmlUtils::GetInt32Entry(this, rootTagsSection.get(), Zeiss::MetaXML::ImageCountRawId);
   if(getErrorCode() < 0)
   {
@@ -537,163 +578,104 @@ void ImportAxioVisionV4Montage::generateCache(QDomElement& root)
   StringZeissMetaEntry::Pointer imageNamePtr = std::dynamic_pointer_cast<StringZeissMetaEntry>(fileNamePtr);
   QString imageName = imageNamePtr->getValue();
 
-  // Figure out the max padding digits for both the imageCount (we need that to generate the proper xml tag) and
-  // the row/col values because we need to have a consistent numbering format for later filters.
-  int imageCountPadding = MetaXmlUtils::CalculatePaddingDigits(imageCount);
-  // int32_t rowCountPadding = MetaXmlUtils::CalculatePaddingDigits(m_RowCount);
-  // int32_t colCountPadding = MetaXmlUtils::CalculatePaddingDigits(m_ColumnCount);
-  // int charPaddingCount = std::max(rowCountPadding, colCountPadding);
+  //#######################################################################
+  // Initialize the Spacing and Length Units of the geometries from the <ROOT><Scaling> section
+  bool ok = false;
+  FloatVec3Type scaling = {1.0f, 1.0f, 1.0f};
+  scaling[0] = reader->getScalingValue("Factor_0").toFloat(&ok);
+  scaling[1] = reader->getScalingValue("Factor_1").toFloat(&ok);
+  int xUnits = reader->getScalingValue("Type_0").toInt(&ok);
+  // We are going to assume that the units in both the X and Y are the same. Why would they be different?
+  IGeometry::LengthUnit lengthUnit = ZeissUnitMapping::Instance()->convertToIGeometryLengthUnit(xUnits);
+
   FloatVec3Type minCoord = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
   FloatVec3Type minSpacing = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
 
-  std::vector<ImageGeom::Pointer> geometries(imageCount);
+  QFileInfo imageNameInfo(imageName);
+  QString inputDir = QFileInfo(getInputFile()).absoluteDir().path();
+
   std::vector<BoundsType> bounds(imageCount);
   // Loop over every image in the _meta.xml file
   for(int p = 0; p < imageCount; p++)
   {
-    // Generate the xml tag that is for this image
-    QString pTag;
-    QTextStream out(&pTag);
-    out << "p";
-    out.setFieldWidth(imageCountPadding);
-    out.setFieldAlignment(QTextStream::AlignRight);
-    out.setPadChar('0');
-    out << p;
-
-    // Send a status update on the progress
-    QString msg = QString("%1: Caching meta data for file %2 of %3").arg(getHumanLabel()).arg(p).arg(imageCount);
-    notifyStatusMessage(msg);
-
-    // Drill down into the XML document....
-    QDomElement photoEle = root.firstChildElement(pTag);
-    if(photoEle.isNull())
+    auto photoIter = photos.find(p);
+    if(photoIter == photos.end())
     {
-      QString ss = QObject::tr("Could not find the <ROOT><%1> element. Aborting Parsing. Is the file a Zeiss _meta.xml file").arg(pTag);
+      QString ss = QObject::tr("Could not find the <ROOT><p%1> element. Aborting Parsing. Is the file a Zeiss _meta.xml file").arg(p);
       setErrorCondition(-70002, ss);
       return;
     }
-    // Get the TAGS section
-    QDomElement tags = photoEle.firstChildElement(ITKImageProcessingConstants::Xml::Tags);
-    if(tags.isNull())
-    {
-      QString ss = QObject::tr("Could not find the <ROOT><%1><Tags> element. Aborting Parsing. Is the file a Zeiss _meta.xml file").arg(pTag);
-      setErrorCondition(-70003, ss);
-      return;
-    }
-    // Now Parse the TAGS section
-    ZeissTagsXmlSection::Pointer photoTagsSection = MetaXmlUtils::ParseTagsSection(this, tags);
-    if(nullptr == photoTagsSection.get())
-    {
-      QString ss = QObject::tr("Error Parsing the <ROOT><%1><Tags> element. Aborting Parsing. Is the file a Zeiss AxioVision _meta.xml file").arg(pTag);
-      setErrorCondition(-70004, ss);
-      return;
-    }
+    const PhotoInfo& photo = photoIter->second;
 
-    // Get the Row Index (Zero Based)
-    int32_t rowIndex = MetaXmlUtils::GetInt32Entry(this, photoTagsSection.get(), Zeiss::MetaXML::ImageIndexVId);
-    if(getErrorCode() < 0)
-    {
-      return;
-    }
-    // Get the Columnn Index (Zero Based)
-    int32_t colIndex = MetaXmlUtils::GetInt32Entry(this, photoTagsSection.get(), Zeiss::MetaXML::ImageIndexUId);
-    if(getErrorCode() < 0)
-    {
-      return;
-    }
-    // Create the Image Geometry
-    ImageGeom::Pointer image = initializeImageGeom(root, photoTagsSection);
-    geometries[p] = image;
+    BoundsType bound = photo.Bound;
+    bound.Spacing = scaling;
+    bound.LengthUnit = lengthUnit;
 
-    minSpacing = image->getSpacing();
-
-    FloatVec3Type origin = image->getOrigin();
-    minCoord[0] = std::min(origin[0], minCoord[0]);
-    minCoord[1] = std::min(origin[1], minCoord[1]);
+    minSpacing = bound.Spacing;
+    minCoord[0] = std::min(bound.Origin[0], minCoord[0]);
+    minCoord[1] = std::min(bound.Origin[1], minCoord[1]);
     minCoord[2] = 0.0f;
 
-    QFileInfo fi(imageName);
-    QString imagePath = fi.completeBaseName() + "_" + pTag + "." + fi.suffix();
-    fi = QFileInfo(getInputFile());
-    imagePath = fi.absoluteDir().path() + "/" + imagePath;
-    fi = QFileInfo(imagePath);
+    QString imagePath = inputDir + "/" + imageNameInfo.completeBaseName() + "_" + photo.PhotoTag + "." + imageNameInfo.suffix();
+    QFileInfo fi(imagePath);
     if(!fi.exists())
     {
       setErrorCondition(-224, QString("Montage Tile File does not exist.'%1'").arg(imagePath));
     }
     m_GeneratedFileList.push_back(imagePath);
-
-    BoundsType bound;
     bound.Filename = imagePath;
-    bound.Dims = image->getDimensions();
-    bound.Origin = image->getOrigin();
-    bound.Spacing = image->getSpacing();
-    bound.Col = colIndex;
-    bound.Row = rowIndex;
-    bound.LengthUnit = image->getUnits();
-
-    if(getImportAllMetaData())
-    {
-      std::vector<size_t> dims = {1};
-      AttributeMatrix::Pointer metaAm = AttributeMatrix::New(dims, getMetaDataAttributeMatrixName(), AttributeMatrix::Type::Generic);
-      ZeissTagsXmlSection::MetaDataType tagMap = photoTagsSection->getMetaDataMap();
-      for(const auto& value : tagMap)
-      {
-        IDataArray::Pointer dataArray = value->createDataArray(!getInPreflight());
-        metaAm->insertOrAssign(dataArray);
-      }
-      bound.MetaData = metaAm;
-    }
+
     d_ptr->m_MaxCol = std::max(bound.Col, d_ptr->m_MaxCol);
     d_ptr->m_MaxRow = std::max(bound.Row, d_ptr->m_MaxRow);
     bounds[p] = bound;
   }
 
-  // Get the meta information from disk for each image
-  for(auto& bound : bounds)
+  if(nullptr != metaDataAm)
   {
-    DataArrayPath dap(::k_DCName, ITKImageProcessing::Montage::k_AMName, ITKImageProcessing::Montage::k_AAName);
-    AbstractFilter::Pointer imageImportFilter = MontageImportHelper::CreateImageImportFilter(this, bound.Filename, dap);
-    imageImportFilter->preflight();
-    if(imageImportFilter->getErrorCode() < 0)
+    if(getInPreflight())
     {
-      setErrorCondition(imageImportFilter->getErrorCode(), "Error Preflighting Image Import Filter.");
-      continue;
+      // Resizing would allocate the columns, so preflight recreates them unallocated with one tuple per image
+      AttributeMatrix::Pointer sizedAm = AttributeMatrix::New({static_cast<size_t>(imageCount)}, metaDataAm->getName(), AttributeMatrix::Type::Generic);
+      for(const QString& columnName : metaDataAm->getAttributeArrayNames())
+      {
+        IDataArray::Pointer column = metaDataAm->getAttributeArray(columnName);
+        sizedAm->insertOrAssign(column->createNewArray(static_cast<size_t>(imageCount), column->getComponentDimensions(), columnName, false));
+      }
+      metaDataAm = sizedAm;
     }
-
-    DataContainerArray::Pointer importImageDca = imageImportFilter->getDataContainerArray();
+    else
     {
-      DataContainer::Pointer fromDca = importImageDca->getDataContainer(::k_DCName);
-      AttributeMatrix::Pointer fromCellAttrMat = fromDca->getAttributeMatrix(ITKImageProcessing::Montage::k_AMName);
-      IDataArray::Pointer fromImageData = fromCellAttrMat->getAttributeArray(ITKImageProcessing::Montage::k_AAName);
-      fromImageData->setName(getImageDataArrayName());
-      bound.ImageDataProxy = fromImageData;
+      metaDataAm->resizeAttributeArrays({static_cast<size_t>(imageCount)});
     }
+    addRootMetaData(metaDataAm, rootTagsSection);
+    d_ptr->m_MetaData = metaDataAm;
+    d_ptr->m_MetaDataAllocated = !getInPreflight();
 
-    if(getConvertToGrayScale())
+    if(!unparsedValues.isEmpty())
     {
-      DataArrayPath daPath(::k_DCName, ITKImageProcessing::Montage::k_AMName, ITKImageProcessing::Montage::k_AAName);
-      AbstractFilter::Pointer grayScaleFilter = MontageImportHelper::CreateColorToGrayScaleFilter(this, daPath, getColorWeights(), ITKImageProcessing::Montage::k_GrayScaleTempArrayName);
-      grayScaleFilter->setDataContainerArray(importImageDca);
-      grayScaleFilter->preflight();
-      if(grayScaleFilter->getErrorCode() < 0)
+      QStringList tags;
+      for(auto iter = unparsedValues.cbegin(); iter != unparsedValues.cend(); ++iter)
       {
-        setErrorCondition(grayScaleFilter->getErrorCode(), "Error Preflighting Color to GrayScale filter");
-        continue;
+        tags << QString("%1 (%2 of %3 images)").arg(iter.key()).arg(iter.value()).arg(imageCount);
       }
-
-      DataContainerArray::Pointer colorToGrayDca = grayScaleFilter->getDataContainerArray();
-      DataContainer::Pointer fromDca = colorToGrayDca->getDataContainer(::k_DCName);
-      AttributeMatrix::Pointer fromCellAttrMat = fromDca->getAttributeMatrix(ITKImageProcessing::Montage::k_AMName);
-      // Remove the RGB Attribute Array so we can rename the gray scale AttributeArray
-      IDataArray::Pointer rgbImageArray = fromCellAttrMat->removeAttributeArray(ITKImageProcessing::Montage::k_AAName);
-      QString grayScaleArrayName = ITKImageProcessing::Montage::k_GrayScaleTempArrayName + ITKImageProcessing::Montage::k_AAName;
-      IDataArray::Pointer fromGrayScaleData = fromCellAttrMat->removeAttributeArray(grayScaleArrayName);
-      fromGrayScaleData->setName(getImageDataArrayName());
-      bound.ImageDataProxy = fromGrayScaleData;
+      d_ptr->m_MetaDataWarning = QObject::tr("The values of these numeric meta data tags could not be converted to numbers and were stored as 0: %1").arg(tags.join(", "));
     }
   }
 
+  // Get the meta information for each image from the tile header index, reading only the tiles that changed
+  std::vector<QString> fileNames;
+  fileNames.reserve(bounds.size());
+  for(const auto& bound : bounds)
+  {
+    fileNames.push_back(bound.Filename);
+  }
+  std::vector<MontageImportHelper::TileHeader> headers =
+      MontageImportHelper::ReadTileHeaders(this, getInputFile(), fileNames, getImageDataArrayName(), getConvertToGrayScale(), getColorWeights());
+  for(size_t i = 0; i < bounds.size(); i++)
+  {
+    bounds[i].ImageDataProxy = headers[i].ImageDataProxy;
+  }
+
   QString montageInfo;
   QTextStream ss(&montageInfo);
   ss << "Tile Column(s): " << m_ColumnCount - 1 << "  Tile Row(s): " << m_RowCount - 1 << "  Image Count: " << imageCount;
@@ -751,8 +733,9 @@ void ImportAxioVisionV4Montage::generateDataStructure()
   int32_t colCountPadding = MetaXmlUtils::CalculatePaddingDigits(m_ColumnCount);
   int charPaddingCount = std::max(rowCountPadding, colCountPadding);
 
-  for(const auto& bound : bounds)
+  for(size_t i = 0; i < bounds.size(); i++)
   {
+    const BoundsType& bound = bounds[i];
     if(bound.Row < m_MontageStart[1] || bound.Row > m_MontageEnd[1] || bound.Col < m_MontageStart[0] || bound.Col > m_MontageEnd[0])
     {
       continue;
@@ -792,9 +775,9 @@ void ImportAxioVisionV4Montage::generateDataStructure()
     AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(bound.Dims.toContainer<StdVecSizeType>(), getCellAttributeMatrixName(), AttributeMatrix::Type::Cell);
     dc->addOrReplaceAttributeMatrix(cellAttrMat);
     cellAttrMat->addOrReplaceAttributeArray(bound.ImageDataProxy);
-    if(getImportAllMetaData())
+    if(getImportAllMetaData() && nullptr != d_ptr->m_MetaData)
     {
-      dc->addOrReplaceAttributeMatrix(bound.MetaData);
+      dc->addOrReplaceAttributeMatrix(createTileMetaData(d_ptr->m_MetaData, i));
     }
   }
   getDataContainerArray()->addOrReplaceMontage(gridMontage);
@@ -803,52 +786,110 @@ void ImportAxioVisionV4Montage::generateDataStructure()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ImportAxioVisionV4Montage::addMetaData(const AttributeMatrix::Pointer& metaAm, const ZeissTagsXmlSection::Pointer& photoTagsSection, int index)
+void ImportAxioVisionV4Montage::addMetaData(const AttributeMatrix::Pointer& metaAm, const ZeissTagsXmlSection::Pointer& photoTagsSection, int index, QMap<QString, int>& unparsedValues)
 {
-  ZeissTagMapping::Pointer tagMap = ZeissTagMapping::instance();
-
-  ZeissTagsXmlSection::MetaDataType tags = photoTagsSection->getMetaDataMap();
+  bool writeValues = !getInPreflight();
 
-  QMapIterator<int, AbstractZeissMetaData::Pointer> iter(tags);
-  while(iter.hasNext())
+  // Without a photo count yet the columns grow by doubling so that a large montage is not copied for every photo
+  size_t numTuples = metaAm->getNumberOfTuples();
+  if(writeValues && static_cast<size_t>(index) >= numTuples)
   {
-    iter.next();
-    StringZeissMetaEntry::Pointer zStrVal = std::dynamic_pointer_cast<StringZeissMetaEntry>(iter.value());
+    numTuples = std::max(static_cast<size_t>(index) + 1, numTuples * 2);
+    metaAm->resizeAttributeArrays({numTuples});
+  }
 
+  ZeissTagMapping::Pointer tagMap = ZeissTagMapping::instance();
+  ZeissTagsXmlSection::MetaDataType& tags = photoTagsSection->getMetaDataMap();
+  for(auto iter = tags.cbegin(); iter != tags.cend(); ++iter)
+  {
     QString tagName = tagMap->nameForId(iter.key());
+    if(tagName.isEmpty())
+    {
+      continue;
+    }
 
-    IDataArray::Pointer iDataArray = metaAm->getAttributeArray(tagName);
-    StringDataArray::Pointer strArray = std::dynamic_pointer_cast<StringDataArray>(iDataArray);
-    strArray->setValue(index, zStrVal->getValue());
-    // IDataArray::Pointer dataArray = iter.value()->createDataArray(!getInPreflight());
-    // metaData->insertOrAssign(dataArray);
+    IDataArray::Pointer column = metaAm->getAttributeArray(tagName);
+    if(nullptr == column)
+    {
+      ZeissMetaFactory::Pointer factory = tagMap->factoryForId(iter.key());
+      if(nullptr == factory)
+      {
+        continue;
+      }
+      column = factory->createDataArray(tagName, numTuples, writeValues);
+      if(nullptr == column)
+      {
+        continue;
+      }
+      metaAm->insertOrAssign(column);
+    }
+
+    // ZeissTagMapping keeps the text of a numeric tag that did not parse, which leaves its value at zero. An empty
+    // value is a tag that was not filled in rather than a value that failed to parse, so it is not reported.
+    auto* textEntry = dynamic_cast<StringZeissMetaEntry*>(iter.value().get());
+    if(nullptr != textEntry && nullptr == dynamic_cast<StringDataArray*>(column.get()))
+    {
+      if(!textEntry->getValue().isEmpty())
+      {
+        unparsedValues[tagName]++;
+      }
+      continue;
+    }
+    if(writeValues)
+    {
+      iter.value()->setDataArrayValue(column.get(), static_cast<size_t>(index));
+    }
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ImportAxioVisionV4Montage::addRootMetaData(const AttributeMatrix::Pointer& metaAm, const ZeissTagsXmlSection::Pointer& rootTagsSection, int index)
+void ImportAxioVisionV4Montage::addRootMetaData(const AttributeMatrix::Pointer& metaAm, const ZeissTagsXmlSection::Pointer& rootTagsSection)
 {
   ZeissTagMapping::Pointer tagMap = ZeissTagMapping::instance();
-  ZeissTagsXmlSection::MetaDataType tags = rootTagsSection->getMetaDataMap();
+  size_t numTuples = metaAm->getNumberOfTuples();
 
-  QMapIterator<int, AbstractZeissMetaData::Pointer> iter(tags);
-  while(iter.hasNext())
+  // The scale factors are only stored once for the whole montage, so every tile gets the same value
+  for(int32_t idTag : {Zeiss::MetaXML::ScaleFactorForXId, Zeiss::MetaXML::ScaleFactorForYId})
   {
-    iter.next();
-    StringZeissMetaEntry::Pointer zStrVal = std::dynamic_pointer_cast<StringZeissMetaEntry>(iter.value());
+    AbstractZeissMetaData::Pointer entry = rootTagsSection->getEntry(idTag);
+    if(nullptr == entry)
+    {
+      continue;
+    }
+    QString tagName = tagMap->nameForId(idTag);
+    IDataArray::Pointer column = tagMap->factoryForId(idTag)->createDataArray(tagName, numTuples, !getInPreflight());
+    if(nullptr == column)
+    {
+      continue;
+    }
+    for(size_t i = 0; i < numTuples && !getInPreflight(); i++)
+    {
+      entry->setDataArrayValue(column.get(), i);
+    }
+    metaAm->insertOrAssign(column);
+  }
+}
 
-    QString tagName = tagMap->nameForId(iter.key());
-    if(tagName == "ScaleFactorForX" || tagName == "ScaleFactorForY")
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer ImportAxioVisionV4Montage::createTileMetaData(const AttributeMatrix::Pointer& metaAm, size_t index)
+{
+  AttributeMatrix::Pointer tileMetaAm = AttributeMatrix::New({1}, metaAm->getName(), AttributeMatrix::Type::Generic);
+  QStringList columnNames = metaAm->getAttributeArrayNames();
+  for(const QString& columnName : columnNames)
+  {
+    IDataArray::Pointer column = metaAm->getAttributeArray(columnName);
+    IDataArray::Pointer tileArray = column->createNewArray(1, column->getComponentDimensions(), columnName, !getInPreflight());
+    if(!getInPreflight())
     {
-      IDataArray::Pointer iDataArray = metaAm->getAttributeArray(tagName);
-      StringDataArray::Pointer strArray = std::dynamic_pointer_cast<StringDataArray>(iDataArray);
-      strArray->setValue(index, zStrVal->getValue());
-      // IDataArray::Pointer dataArray = iter.value()->createDataArray(!getInPreflight());
-      // metaData->insertOrAssign(dataArray);
+      tileArray->copyFromArray(0, column, index, 1);
     }
+    tileMetaAm->insertOrAssign(tileArray);
   }
+  return tileMetaAm;
 }
 
 // -----------------------------------------------------------------------------
@@ -865,6 +906,7 @@ void ImportAxioVisionV4Montage::readImages()
   int32_t colCountPadding = MetaXmlUtils::CalculatePaddingDigits(m_ColumnCount);
   int charPaddingCount = std::max(rowCountPadding, colCountPadding);
 
+  std::vector<MontageImportHelper::TileImportInfo> tiles;
   for(const auto& bound : bounds)
   {
     if(bound.Row < m_MontageStart[1] || bound.Row > m_MontageEnd[1] || bound.Col < m_MontageStart[0] || bound.Col > m_MontageEnd[0])
@@ -872,10 +914,6 @@ void ImportAxioVisionV4Montage::readImages()
       continue;
     }
 
-    QString msg;
-    QTextStream out(&msg);
-    out << "Importing " << bound.Filename;
-    notifyStatusMessage(msg);
     // Create our DataContainer Name using a Prefix and a rXXcYY format.
     QString dcName = getDataContainerPath().getDataContainerName();
     QTextStream dcNameStream(&dcName);
@@ -894,71 +932,22 @@ void ImportAxioVisionV4Montage::readImages()
     // So is the Geometry
     ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
 
-    // Create the Image Geometry
-    SizeVec3Type dims = image->getDimensions();
-    // FloatVec3Type origin = image->getOrigin();
-    // FloatVec3Type spacing = image->getSpacing();
-
-    std::vector<size_t> tDims = {dims[0], dims[1], dims[2]};
     // The Cell AttributeMatrix is also already created at this point
-    AttributeMatrix::Pointer cellAttrMat = dc->getAttributeMatrix(getCellAttributeMatrixName());
-    // Instantiate the Image Import Filter to actually read the image into a data array
-    DataArrayPath dap(::k_DCName, ITKImageProcessing::Montage::k_AMName, getImageDataArrayName()); // This is just a temp path for the subfilter to use
-    AbstractFilter::Pointer imageImportFilter = MontageImportHelper::CreateImageImportFilter(this, bound.Filename, dap);
-    if(nullptr == imageImportFilter.get())
-    {
-      continue;
-    }
-    // This same filter was used to preflight so as long as nothing changes on disk this really should work....
-    imageImportFilter->execute();
-    if(imageImportFilter->getErrorCode() < 0)
-    {
-      setErrorCondition(imageImportFilter->getErrorCode(), "Error Executing Image Import Filter.");
-      continue;
-    }
-    // Now transfer the image data from the actual image data read from disk into our existing Attribute Matrix
-    DataContainerArray::Pointer importImageDca = imageImportFilter->getDataContainerArray();
-    DataContainer::Pointer fromDc = importImageDca->getDataContainer(::k_DCName);
-    AttributeMatrix::Pointer fromCellAttrMat = fromDc->getAttributeMatrix(ITKImageProcessing::Montage::k_AMName);
-    // IDataArray::Pointer fromImageData = fromCellAttrMat->getAttributeArray(getImageDataArrayName());
-
-    if(getConvertToGrayScale())
-    {
-      AbstractFilter::Pointer grayScaleFilter = MontageImportHelper::CreateColorToGrayScaleFilter(this, dap, getColorWeights(), ITKImageProcessing::Montage::k_GrayScaleTempArrayName);
-      grayScaleFilter->setDataContainerArray(importImageDca); // Use the Data COntainer array that was use for the import. It is setup and ready to go
-      connect(grayScaleFilter.get(), SIGNAL(messageGenerated(AbstractMessage::Pointer)), this, SIGNAL(messageGenerated(AbstractMessage::Pointer)));
-      grayScaleFilter->execute();
-      if(grayScaleFilter->getErrorCode() < 0)
-      {
-        setErrorCondition(grayScaleFilter->getErrorCode(), "Error Executing Color to GrayScale filter");
-        continue;
-      }
-
-      DataContainerArray::Pointer c2gDca = grayScaleFilter->getDataContainerArray();
-      DataContainer::Pointer c2gDc = c2gDca->getDataContainer(::k_DCName);
-      AttributeMatrix::Pointer c2gAttrMat = c2gDc->getAttributeMatrix(ITKImageProcessing::Montage::k_AMName);
-
-      QString grayScaleArrayName = ITKImageProcessing::Montage::k_GrayScaleTempArrayName + getImageDataArrayName();
-      // IDataArray::Pointer fromGrayScaleData = fromCellAttrMat->getAttributeArray(grayScaleArrayName);
-
-      IDataArray::Pointer rgbImageArray = c2gAttrMat->removeAttributeArray(ITKImageProcessing::Montage::k_AAName);
-      IDataArray::Pointer gray = c2gAttrMat->removeAttributeArray(grayScaleArrayName);
-      gray->setName(getImageDataArrayName());
-      cellAttrMat->addOrReplaceAttributeArray(gray);
-    }
-    else
-    {
-      // Copy the IDataArray (which contains the image data) from the temp data container array into our persistent data structure
-      IDataArray::Pointer gray = fromCellAttrMat->removeAttributeArray(getImageDataArrayName());
-      cellAttrMat->addOrReplaceAttributeArray(gray);
-    }
+    MontageImportHelper::TileImportInfo tile;
+    tile.FileName = bound.Filename;
+    tile.CellAttributeMatrix = dc->getAttributeMatrix(getCellAttributeMatrixName());
+    tile.EstimatedBytes = MontageImportHelper::EstimateTileBytes(image->getDimensions(), bound.ImageDataProxy, getConvertToGrayScale());
+    tiles.push_back(tile);
   }
+
+  notifyStatusMessage(QString("Importing %1 images").arg(tiles.size()));
+  MontageImportHelper::ReadTiles(this, tiles, getImageDataArrayName(), getConvertToGrayScale(), getColorWeights());
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-ImageGeom::Pointer ImportAxioVisionV4Montage::initializeImageGeom(const QDomElement& root, const ZeissTagsXmlSection::Pointer& photoTagsSection)
+ImageGeom::Pointer ImportAxioVisionV4Montage::initializeImageGeom(const ZeissTagsXmlSection::Pointer& photoTagsSection)
 {
 
   ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
@@ -966,17 +955,8 @@ ImageGeom::Pointer ImportAxioVisionV4Montage::initializeImageGeom(const QDomElem
   //#######################################################################
   // Parse out the Pixel Dimensions of the image.
   SizeVec3Type dims;
-  AbstractZeissMetaData::Pointer ptr = photoTagsSection->getEntry(Zeiss::MetaXML::ImageWidthPixelId);
-  Int32ZeissMetaEntry::Pointer int32Entry = ZeissMetaEntry::convert<Int32ZeissMetaEntry>(ptr);
-  Q_ASSERT_X(int32Entry.get() != nullptr, "Could not Cast to Int32ZeissMetaEntry", "");
-
-  dims[0] = int32Entry->getValue();
-
-  ptr = photoTagsSection->getEntry(Zeiss::MetaXML::ImageHeightPixelId);
-  int32Entry = ZeissMetaEntry::convert<Int32ZeissMetaEntry>(ptr);
-  Q_ASSERT_X(int32Entry.get() != nullptr, "Could not Cast to Int32ZeissMetaEntry", "");
-
-  dims[1] = int32Entry->getValue();
+  dims[0] = MetaXmlUtils::GetInt32Entry(this, photoTagsSection.get(), Zeiss::MetaXML::ImageWidthPixelId);
+  dims[1] = MetaXmlUtils::GetInt32Entry(this, photoTagsSection.get(), Zeiss::MetaXML::ImageHeightPixelId);
   dims[2] = 1;
   image->setDimensions(dims);
 
@@ -987,23 +967,6 @@ ImageGeom::Pointer ImportAxioVisionV4Montage::initializeImageGeom(const QDomElem
   FloatVec3Type origin = {stageXPos, stageYPos, 0.0f};
   image->setOrigin(origin);
 
-  //#######################################################################
-  // Initialize the Spacing of the geometry
-  bool ok = false;
-  FloatVec3Type scaling = {1.0f, 1.0f, 1.0f};
-  QDomElement scalingDom = root.firstChildElement(ITKImageProcessingConstants::Xml::Scaling).firstChildElement("Factor_0");
-  scaling[0] = scalingDom.text().toFloat(&ok);
-  scalingDom = root.firstChildElement(ITKImageProcessingConstants::Xml::Scaling).firstChildElement("Factor_1");
-  scaling[1] = scalingDom.text().toFloat(&ok);
-  image->setSpacing(scaling);
-
-  //#######################################################################
-  // Initialize the Length Units of the geometry
-  QDomElement unitsDom = root.firstChildElement(ITKImageProcessingConstants::Xml::Scaling).firstChildElement("Type_0");
-  int xUnits = unitsDom.text().toInt(&ok);
-  // We are going to assume that the units in both the X and Y are the same. Why would they be different?
-  IGeometry::LengthUnit lengthUnit = ZeissUnitMapping::Instance()->convertToIGeometryLengthUnit(xUnits);
-  image->setUnits(lengthUnit);
   image->setName("AxioVision V4 Geometry");
 
   return image;
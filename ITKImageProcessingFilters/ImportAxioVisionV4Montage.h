@@ -34,10 +34,9 @@
 #include <memory>
 
 #include <QtCore/QDateTime>
+#include <QtCore/QMap>
 #include <QtCore/QString>
 
-#include <QtXml/QDomElement>
-
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLArray.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -101,7 +100,6 @@ public:
     int32_t Row;
     int32_t Col;
     IDataArray::Pointer ImageDataProxy;
-    AttributeMatrix::Pointer MetaData;
     IGeometry::LengthUnit LengthUnit;
   };
 
@@ -384,16 +382,6 @@ public:
   QStringList getGeneratedFileList() const;
   Q_PROPERTY(QStringList GeneratedFileList READ getGeneratedFileList)
 
-  /**
-   * @brief Setter property for Root
-   */
-  void setRoot(const QDomElement& value);
-  /**
-   * @brief Getter property for Root
-   * @return Value of Root
-   */
-  QDomElement getRoot() const;
-
   /**
    * @brief Setter property for InputFile_Cache
    */
@@ -443,11 +431,9 @@ protected:
   void flushCache();
 
   /**
-   * @brief readMetaXml
-   * @param device
-   * @return
+   * @brief Reads the _meta.xml file in a single streaming pass and fills the bounds cache
    */
-  void generateCache(QDomElement& root);
+  void generateCache();
 
   /**
    * @brief readImages
@@ -460,28 +446,39 @@ protected:
   void generateDataStructure();
 
   /**
-   * @brief getImageScaling
-   * @param scalingTagsSection
+   * @brief Creates the geometry of a single tile from its <pXXX><Tags> section. The spacing and units
+   * come from the <ROOT><Scaling> section and are set once the whole file has been read.
+   * @param photoTagsSection
    * @return
    */
-  ImageGeom::Pointer initializeImageGeom(const QDomElement& root, const ZeissTagsXmlSection::Pointer& photoTagsSection);
+  ImageGeom::Pointer initializeImageGeom(const ZeissTagsXmlSection::Pointer& photoTagsSection);
 
   /**
-   * @brief generateMetaDataAttributeMatrix
+   * @brief Writes the tags of one <pXXX> section into tuple 'index' of the meta data columns. A column is
+   * created through the tag's ZeissMetaFactory the first time the tag is seen, so numeric tags are stored
+   * as numbers instead of strings. During preflight the columns are created unallocated and no values are written.
+   * @param metaAm
    * @param photoTagsSection
-   * @param imageCount
-   * @return
+   * @param index
+   * @param unparsedValues Counts, per tag name, the numeric values that could not be parsed and were left at 0
    */
-  void addMetaData(const AttributeMatrix::Pointer& metaAm, const ZeissTagsXmlSection::Pointer& photoTagsSection, int index);
+  void addMetaData(const AttributeMatrix::Pointer& metaAm, const ZeissTagsXmlSection::Pointer& photoTagsSection, int index, QMap<QString, int>& unparsedValues);
 
   /**
-   * @brief generateMetaDataAttributeMatrix -root data
+   * @brief Adds the ScaleFactorForX/Y columns from the <ROOT><Tags> section, repeated for every tile.
+   * @param metaAm
    * @param rootTagsSection
-   * @param imageCount
-   * @return
    */
+  void addRootMetaData(const AttributeMatrix::Pointer& metaAm, const ZeissTagsXmlSection::Pointer& rootTagsSection);
 
-  void addRootMetaData(const AttributeMatrix::Pointer& metaAm, const ZeissTagsXmlSection::Pointer& rootTagsSection, int index);
+  /**
+   * @brief Creates the single tuple meta data AttributeMatrix of one tile from the cached columns. The values
+   * are only copied when not in preflight.
+   * @param metaAm
+   * @param index
+   * @return
+   */
+  AttributeMatrix::Pointer createTileMetaData(const AttributeMatrix::Pointer& metaAm, size_t index);
 
 private:
   QString m_MontageName = QString("AxioVision Montage");
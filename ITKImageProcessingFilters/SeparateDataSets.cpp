@@ -31,6 +31,7 @@
 #include "SeparateDataSets.h"
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
@@ -45,6 +46,46 @@ enum createdPathID : RenameDataPath::DataID_t
   DataContainerID = 1
 };
 
+namespace
+{
+/**
+ * @brief Returns the float column 'name' of the meta data AttributeMatrix. Older meta data stored every
+ * tag as a string, so a StringDataArray is parsed once into a float column.
+ */
+FloatArrayType::Pointer GetFloatColumn(AbstractFilter* filter, const AttributeMatrix::Pointer& metaDataAM, const QString& name, int32_t conversionErrorCode)
+{
+  IDataArray::Pointer column = metaDataAM->getAttributeArray(name);
+  FloatArrayType::Pointer floatColumn = std::dynamic_pointer_cast<FloatArrayType>(column);
+  if(nullptr != floatColumn)
+  {
+    return floatColumn;
+  }
+
+  StringDataArray::Pointer stringColumn = std::dynamic_pointer_cast<StringDataArray>(column);
+  if(nullptr == stringColumn)
+  {
+    QString ss = QObject::tr("The meta data Attribute Matrix '%1' does not contain a float or string array named '%2'.").arg(metaDataAM->getName()).arg(name);
+    filter->setErrorCondition(-90006, ss);
+    return FloatArrayType::NullPointer();
+  }
+
+  size_t numTuples = stringColumn->getNumberOfTuples();
+  floatColumn = FloatArrayType::CreateArray(numTuples, name, true);
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    bool ok = false;
+    floatColumn->setValue(i, stringColumn->getValue(i).toFloat(&ok));
+    if(!ok)
+    {
+      QString ss = QObject::tr("The filter could not convert the string values in array '%1' to floating point values.").arg(name);
+      filter->setErrorCondition(conversionErrorCode, ss);
+      return FloatArrayType::NullPointer();
+    }
+  }
+  return floatColumn;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -143,67 +184,41 @@ void SeparateDataSets::execute()
     return;
   }
 
-  StringDataArray::Pointer stagePositionXPtr = origMetaDataAM->getPrereqArray<StringDataArray>(this, "StagePositionX", err, cDims);
+  FloatArrayType::Pointer stagePositionXPtr = GetFloatColumn(this, origMetaDataAM, "StagePositionX", -90002);
   if(getErrorCode() < 0)
   {
     return;
   }
 
-  StringDataArray::Pointer stagePositionYPtr = origMetaDataAM->getPrereqArray<StringDataArray>(this, "StagePositionY", err, cDims);
+  FloatArrayType::Pointer stagePositionYPtr = GetFloatColumn(this, origMetaDataAM, "StagePositionY", -90003);
   if(getErrorCode() < 0)
   {
     return;
   }
 
-  StringDataArray::Pointer scaleFactorForXPtr = origMetaDataAM->getPrereqArray<StringDataArray>(this, "ScaleFactorForX", err, cDims);
+  FloatArrayType::Pointer scaleFactorForXPtr = GetFloatColumn(this, origMetaDataAM, "ScaleFactorForX", -90004);
   if(getErrorCode() < 0)
   {
     return;
   }
 
-  StringDataArray::Pointer scaleFactorForYPtr = origMetaDataAM->getPrereqArray<StringDataArray>(this, "ScaleFactorForY", err, cDims);
+  FloatArrayType::Pointer scaleFactorForYPtr = GetFloatColumn(this, origMetaDataAM, "ScaleFactorForY", -90005);
   if(getErrorCode() < 0)
   {
     return;
   }
 
+  QStringList metaDataArrayNames = origMetaDataAM->getAttributeArrayNames();
+
   for(int i = 0; i < attrArrayNamesPtr->getNumberOfTuples(); i++)
   {
     QString dataSetName = attrArrayNamesPtr->getValue(i);
     IDataArray::Pointer origDataSetPtr = origDataSetAM->getAttributeArray(dataSetName);
 
-    bool ok = false;
-    float stagePositionX = stagePositionXPtr->getValue(i).toFloat(&ok);
-    if(!ok)
-    {
-      QString ss = QObject::tr("The filter could not convert the string values in array '%1' to floating point values.").arg(stagePositionXPtr->getName());
-      setErrorCondition(-90002, ss);
-      return;
-    }
-
-    float stagePositionY = stagePositionYPtr->getValue(i).toFloat(&ok);
-    if(!ok)
-    {
-      QString ss = QObject::tr("The filter could not convert the string values in array '%1' to floating point values.").arg(stagePositionYPtr->getName());
-      setErrorCondition(-90003, ss);
-      return;
-    }
-
-    float scaleFactorForX = scaleFactorForXPtr->getValue(i).toFloat(&ok);
-    if(!ok)
-    {
-      QString ss = QObject::tr("The filter could not convert the string values in array '%1' to floating point values.").arg(scaleFactorForXPtr->getName());
-      setErrorCondition(-90004, ss);
-      return;
-    }
-
-    float scaleFactorForY = scaleFactorForYPtr->getValue(i).toFloat(&ok);
-    if(!ok)
-    {
-      QString ss = QObject::tr("The filter could not convert the string values in array '%1' to floating point values.").arg(scaleFactorForYPtr->getName());
-      setErrorCondition(-90005, ss);
-      return;
-    }
+    float stagePositionX = stagePositionXPtr->getValue(i);
+    float stagePositionY = stagePositionYPtr->getValue(i);
+    float scaleFactorForX = scaleFactorForXPtr->getValue(i);
+    float scaleFactorForY = scaleFactorForYPtr->getValue(i);
 
     // Create the new data container for this data set
     DataContainerShPtr origDCPtr = getDataContainerArray()->getDataContainer(getDatasetAMPath());
@@ -231,20 +246,18 @@ void SeparateDataSets::execute()
       newDataSetAM->insertOrAssign(newDataSetPtr);
     }
 
-    // Copy the meta data attribute matrix
-    AttributeMatrix::Pointer newMetaDataAM = origMetaDataAM->deepCopy(getInPreflight());
-
-    // Loop through the meta data arrays in the new meta data attribute matrix.  Make the tuple that refers to the current data set as the only tuple.
-    QStringList newMetaDataArrayNames = newMetaDataAM->getAttributeArrayNames();
-    for(int j = 0; j < newMetaDataArrayNames.size(); j++)
+    // The meta data of this data set is its own tuple of every meta data column, copied without duplicating the whole matrix
+    AttributeMatrix::Pointer newMetaDataAM = AttributeMatrix::New(std::vector<size_t>(1, 1), origMetaDataAM->getName(), origMetaDataAM->getType());
+    for(const QString& metaDataArrayName : metaDataArrayNames)
     {
-      QString metaDataArrayName = newMetaDataArrayNames[j];
-      IDataArray::Pointer newMetaDataPtr = newMetaDataAM->getAttributeArray(metaDataArrayName);
-
-      newMetaDataPtr->copyTuple(i, 0);
-      newMetaDataPtr->resizeTuples(1);
+      IDataArray::Pointer origMetaDataPtr = origMetaDataAM->getAttributeArray(metaDataArrayName);
+      IDataArray::Pointer newMetaDataPtr = origMetaDataPtr->createNewArray(1, origMetaDataPtr->getComponentDimensions(), metaDataArrayName, !getInPreflight());
+      if(!getInPreflight())
+      {
+        newMetaDataPtr->copyFromArray(0, origMetaDataPtr, i, 1);
+      }
+      newMetaDataAM->insertOrAssign(newMetaDataPtr);
     }
-    newMetaDataAM->setTupleDimensions(std::vector<size_t>(1, 1));
 
     newDCPtr->addOrReplaceAttributeMatrix(newMetaDataAM);
     newDCPtr->addOrReplaceAttributeMatrix(newDataSetAM);
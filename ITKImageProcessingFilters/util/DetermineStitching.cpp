@@ -31,6 +31,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "DetermineStitching.h"
 
+#include <algorithm>
+
 #include "itkImage.h"
 
 #include "SIMPLib/ITK/itkBridge.h"
@@ -195,3 +197,129 @@ std::vector<size_t> DetermineStitching::ReturnProperIndex(int InputMode, int xDi
 
   return newIndices;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> DetermineStitching::SolveGlobalOrigins(size_t numTiles, const std::vector<PairwiseOffset>& pairs)
+{
+  std::vector<float> origins(2 * numTiles, 0.0f);
+  if(numTiles < 2)
+  {
+    return origins;
+  }
+
+  // A poor or failed correlation still has to keep the tile connected to its neighbors,
+  // so every pair carries at least a small weight.
+  const double minWeight = 1.0e-3;
+  std::vector<double> weights(pairs.size());
+  for(size_t e = 0; e < pairs.size(); e++)
+  {
+    weights[e] = std::max<double>(pairs[e].weight, minWeight);
+  }
+
+  // Walk the tiles in comb order averaging the positions implied by the tiles to the left
+  // and above.  This was the original stitching method and serves as the starting guess.
+  std::vector<std::vector<size_t>> incoming(numTiles);
+  for(size_t e = 0; e < pairs.size(); e++)
+  {
+    incoming[pairs[e].second].push_back(e);
+  }
+
+  std::vector<double> position(numTiles, 0.0);
+  std::vector<double> displacement(pairs.size());
+  std::vector<double> rhs(numTiles);
+  std::vector<double> residual(numTiles);
+  std::vector<double> direction(numTiles);
+  std::vector<double> product(numTiles);
+
+  // Applies the weighted graph Laplacian with the first tile held fixed at the origin
+  auto applyLaplacian = [&](const std::vector<double>& in, std::vector<double>& out) {
+    std::fill(out.begin(), out.end(), 0.0);
+    for(size_t e = 0; e < pairs.size(); e++)
+    {
+      const double diff = weights[e] * (in[pairs[e].second] - in[pairs[e].first]);
+      out[pairs[e].second] += diff;
+      out[pairs[e].first] -= diff;
+    }
+    out[0] = 0.0;
+  };
+
+  for(size_t axis = 0; axis < 2; axis++)
+  {
+    for(size_t e = 0; e < pairs.size(); e++)
+    {
+      displacement[e] = (axis == 0) ? pairs[e].x : pairs[e].y;
+    }
+
+    position[0] = 0.0;
+    for(size_t i = 1; i < numTiles; i++)
+    {
+      double sum = 0.0;
+      for(size_t e : incoming[i])
+      {
+        sum += position[pairs[e].first] + displacement[e];
+      }
+      position[i] = incoming[i].empty() ? 0.0 : sum / incoming[i].size();
+    }
+
+    // Weighted least squares over every pair: minimize sum(w * (p_second - p_first - d)^2).
+    // The normal equations are a graph Laplacian, which is solved with conjugate gradients.
+    std::fill(rhs.begin(), rhs.end(), 0.0);
+    for(size_t e = 0; e < pairs.size(); e++)
+    {
+      rhs[pairs[e].second] += weights[e] * displacement[e];
+      rhs[pairs[e].first] -= weights[e] * displacement[e];
+    }
+    rhs[0] = 0.0;
+
+    applyLaplacian(position, product);
+    double rhsNorm = 0.0;
+    double rr = 0.0;
+    for(size_t i = 0; i < numTiles; i++)
+    {
+      residual[i] = rhs[i] - product[i];
+      direction[i] = residual[i];
+      rr += residual[i] * residual[i];
+      rhsNorm += rhs[i] * rhs[i];
+    }
+
+    const double tolerance = 1.0e-12 * std::max(rhsNorm, 1.0);
+    for(size_t iter = 0; iter < 4 * numTiles && rr > tolerance; iter++)
+    {
+      applyLaplacian(direction, product);
+      double pAp = 0.0;
+      for(size_t i = 0; i < numTiles; i++)
+      {
+        pAp += direction[i] * product[i];
+      }
+      if(pAp <= 0.0)
+      {
+        break;
+      }
+
+      const double alpha = rr / pAp;
+      double rrNew = 0.0;
+      for(size_t i = 0; i < numTiles; i++)
+      {
+        position[i] += alpha * direction[i];
+        residual[i] -= alpha * product[i];
+        rrNew += residual[i] * residual[i];
+      }
+
+      const double beta = rrNew / rr;
+      for(size_t i = 0; i < numTiles; i++)
+      {
+        direction[i] = residual[i] + beta * direction[i];
+      }
+      rr = rrNew;
+    }
+
+    for(size_t i = 0; i < numTiles; i++)
+    {
+      origins[2 * i + axis] = static_cast<float>(position[i]);
+    }
+  }
+
+  return origins;
+}
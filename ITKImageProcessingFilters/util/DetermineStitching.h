@@ -52,6 +52,7 @@
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/ITK/itkBridge.h"
 #include "SIMPLib/ITK/itkSupportConstants.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 
 #include "itkChangeInformationImageFilter.h"
 #include "itkImageFileWriter.h"
@@ -69,6 +70,27 @@ class DetermineStitching
 public:
   virtual ~DetermineStitching();
 
+  /**
+   * @brief The PairwiseOffset struct holds the measured offset from the first tile to the
+   * second tile, in comb order, and the cross correlation peak that produced it.
+   */
+  struct PairwiseOffset
+  {
+    size_t first = 0;
+    size_t second = 0;
+    bool fromLeft = true;
+    float x = 0.0f;
+    float y = 0.0f;
+    float weight = 0.0f;
+
+    PairwiseOffset(size_t firstTile, size_t secondTile, bool isLeft)
+    : first(firstTile)
+    , second(secondTile)
+    , fromLeft(isLeft)
+    {
+    }
+  };
+
   /**
    * @brief FindGlobalOrigins
    * @param xTileCount
@@ -86,243 +108,140 @@ public:
                                                    const std::vector<typename DataArray<T>::Pointer>& dataArrayList, const SizeVec3Type& udims, const FloatVec3Type& sampleOrigin,
                                                    const FloatVec3Type& spacing, const std::vector<QString>& dataContainerNames)
   {
-    // The assumption is that we are working on a 2D image where the XY dims are in the 0 and 1 index of the udims variable
-    size_t totalPoints = udims[0] * udims[1];
-
     std::vector<size_t> cDims(1, 2); // a dimension for the xvalues and one for the y values
     std::vector<size_t> tDims(1);
 
     int numTiles = xTileCount * yTileCount;
     tDims[0] = numTiles;
 
-    FloatArrayType::Pointer xyStitchedGlobalListPtr = FloatArrayType::CreateArray(tDims, cDims, "xyGlobalList", true);
     FloatArrayType::Pointer xyStitchedGlobalListPtr_orig = FloatArrayType::CreateArray(tDims, cDims, "xyGlobalList_orig", true);
+    xyStitchedGlobalListPtr_orig->initializeWithZeros();
 
-    int32_t numXtiles = xTileCount;
+    size_t numXtiles = static_cast<size_t>(xTileCount);
 
-    // Make sure the combIndexList is large enough to store every value
-    std::vector<size_t> combIndexList(numTiles);
+    // The tiles are always stitched in comb order regardless of how they were collected
+    std::vector<size_t> combIndexList = ReturnProperIndex(importMode, xTileCount, yTileCount);
 
-    combIndexList = ReturnProperIndex(importMode, xTileCount, yTileCount);
-
-    using PixelType = T;
-    using ImageType = itk::Image<PixelType, ImageDimension>;
-    using ImportFilterType = itk::ImportImageFilter<PixelType, ImageDimension>;
+    // Every tile is matched to the tile on its left and the tile above it when they exist.
+    // Each of those pairs is independent of the others, so all of them are cross correlated at once.
+    std::vector<PairwiseOffset> pairs;
+    for(size_t i = 1; i < combIndexList.size(); i++)
+    {
+      if(i % numXtiles != 0)
+      {
+        pairs.push_back({i - 1, i, true});
+      }
+      if(i >= numXtiles)
+      {
+        pairs.push_back({i - numXtiles, i, false});
+      }
+    }
 
-    ImageType* currentImage = nullptr;
-    ImageType* leftImage = nullptr;
-    ImageType* aboveImage = nullptr;
+    filter->notifyStatusMessage(QString("Cross correlating %1 tile pairs").arg(pairs.size()));
 
-    typename ImportFilterType::Pointer importFilter;
-    typename ImportFilterType::Pointer importFilter2;
+    ParallelTaskAlgorithm taskAlg;
+    for(PairwiseOffset& pair : pairs)
+    {
+      PairwiseOffset* pairPtr = &pair;
+      taskAlg.execute([&, pairPtr] {
+        if(filter->getCancel())
+        {
+          return;
+        }
+#if WRITE_DEBUG_IMAGES
+        qDebug() << (pairPtr->fromLeft ? "LEFT" : "TOP") << ": DataContainer: " << dataContainerNames[combIndexList[pairPtr->second]] << ", " << dataContainerNames[combIndexList[pairPtr->first]];
+#endif
+        CorrelatePair<T, ImageDimension>(*pairPtr, overlapPer, udims, sampleOrigin, spacing, dataArrayList[combIndexList[pairPtr->first]], dataArrayList[combIndexList[pairPtr->second]]);
+      });
+    }
+    taskAlg.wait();
 
-    std::vector<float> cropSpecsIm1Im2(12, 0);
-    std::vector<float> newXYOrigin(2, 0);
-    std::vector<float> newXYOrigin2(2, 0);
+    if(filter->getCancel())
+    {
+      return xyStitchedGlobalListPtr_orig;
+    }
 
-    // set the stitched global coordinates of the first tile to the top left corner
-    xyStitchedGlobalListPtr->setValue(0, 0);
-    xyStitchedGlobalListPtr->setValue(1, 0);
-    xyStitchedGlobalListPtr_orig->setValue(0, 0);
-    xyStitchedGlobalListPtr_orig->setValue(1, 0);
+    filter->notifyStatusMessage("Solving for global tile origins");
+    std::vector<float> xyStitchedGlobalList = SolveGlobalOrigins(combIndexList.size(), pairs);
 
-    // helper variables to store previous stitched global values
-    float previousXleft = 0;
-    float previousYleft = 0;
+    // Put the values found in from going in the comb order into another data array which represents the original order the images came in as
+    for(size_t i = 0; i < combIndexList.size(); i++)
+    {
+      xyStitchedGlobalListPtr_orig->setValue(2 * combIndexList[i], xyStitchedGlobalList[2 * i]);
+      xyStitchedGlobalListPtr_orig->setValue(2 * combIndexList[i] + 1, xyStitchedGlobalList[2 * i + 1]);
+    }
 
-    float previousXtop = 0;
-    float previousYtop = 0;
+    return xyStitchedGlobalListPtr_orig;
+  }
 
-    float newXfromleft = 0;
-    float newYfromleft = 0;
+  /**
+   * @brief Cross correlates the overlapping windows of the two tiles in the pair and stores
+   * the offset of the second tile relative to the first along with the correlation peak.
+   * @param pair
+   * @param overlapPer
+   * @param udims
+   * @param sampleOrigin
+   * @param spacing
+   * @param firstData
+   * @param secondData
+   */
+  template <typename T, unsigned int ImageDimension>
+  static void CorrelatePair(PairwiseOffset& pair, float overlapPer, const SizeVec3Type& udims, const FloatVec3Type& sampleOrigin, const FloatVec3Type& spacing,
+                            const typename DataArray<T>::Pointer& firstData, const typename DataArray<T>::Pointer& secondData)
+  {
+    using ItkBridgeType = ItkBridge<T>;
+    using ImportFilterType = itk::ImportImageFilter<T, ImageDimension>;
 
-    float newXfromtop = 0;
-    float newYfromtop = 0;
+    // The assumption is that we are working on a 2D image where the XY dims are in the 0 and 1 index of the udims variable
+    size_t totalPoints = udims[0] * udims[1];
 
-    using ItkBridgeType = ItkBridge<T>;
+    typename ImportFilterType::Pointer importFilter = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<T>(totalPoints, udims, sampleOrigin, spacing, secondData);
+    typename ImportFilterType::Pointer importFilter2 = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<T>(totalPoints, udims, sampleOrigin, spacing, firstData);
 
     // IMPORTANT:
-    // This method is set up a bit weird so hopefully this will help
     // cropSpecIm1Im2 is a rather important variable so it's good to understand what each value means
     // The first 6 values in the array are the crop origin that we'll be looking at (starts at the top left)
     // The last 6 values in the array are the crop dimensions (size) that we'll look at (goes down to bottom right)
     // The CropAndCrossCorrelate method crops the images and compares them with each other looking for a spike in similar values (a simplified explanation)
-    // The loop compares 2 images at once, so if you have a 3 x 3 image, the loop will only go through 8 times. You'll compare the second image with the first image
-    //		first thing so the first if statement will only trigger twice before triggering the second if statement
-
-    for(size_t i = 1; i < combIndexList.size(); i++)
+    std::vector<float> cropSpecsIm1Im2(12, 0);
+    if(pair.fromLeft)
     {
-      if(filter->getCancel())
-      {
-        break;
-      }
-
-      filter->notifyStatusMessage(QString("Refining Origin For Image %1").arg(i));
-      if(i < numXtiles) // if the image is in the top row of images, we need only the image to the left
-      {
-#if WRITE_DEBUG_IMAGES
-        qDebug() << "LEFT: DataContainer: " << dataContainerNames[combIndexList[i]] << ", " << dataContainerNames[combIndexList[i - 1]];
-        qDebug() << "\t" << combIndexList[i] << "\t" << combIndexList[i - 1];
-#endif
-        importFilter = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i]]);
-        currentImage = importFilter->GetOutput();
-        importFilter2 = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i - 1]]);
-        leftImage = importFilter2->GetOutput();
-
-        // Determine the windows to be cross correlated depending on the rough overlap as found from the global coordinates
-        cropSpecsIm1Im2[0] =
-            udims[0] -
-            (udims[0] * (overlapPer / 100)); // Width of the image * the percentage (say 20%) = the size of the crop we're looking at. Subtract that from the width of the image and you have the origin
-        cropSpecsIm1Im2[1] = 0;              // left image Y Origin
-        cropSpecsIm1Im2[2] = 0;              // left image Z Origin
-        cropSpecsIm1Im2[3] = 0;              // current image X Origin
-        cropSpecsIm1Im2[4] = 0;              // current image Y Origin
-        cropSpecsIm1Im2[5] = 0;              // current image Z Origin
-
-        cropSpecsIm1Im2[6] = udims[0] * (overlapPer / 100); // left image X Size
-        cropSpecsIm1Im2[7] = udims[1];                      // left image Y Size
-        cropSpecsIm1Im2[8] = 1;                             // left image Z Size
-        cropSpecsIm1Im2[9] = udims[0] * (overlapPer / 100); // current image X Size
-        cropSpecsIm1Im2[10] = udims[1];                     // current image Y Size
-        cropSpecsIm1Im2[11] = 1;                            // current image Z Size
-
-        // Cross correlate the image windows and return the local shifts between the two images
-        newXYOrigin = CropAndCrossCorrelate(cropSpecsIm1Im2, currentImage, leftImage);
-
-        previousXleft = xyStitchedGlobalListPtr->getValue(2 * (i - 1));
-        previousYleft = xyStitchedGlobalListPtr->getValue(2 * (i - 1) + 1);
-
-        newXfromleft = previousXleft + cropSpecsIm1Im2[0] + newXYOrigin[0];
-        newYfromleft = previousYleft + newXYOrigin[1];
-
-        xyStitchedGlobalListPtr->setValue(2 * i, newXfromleft);
-        xyStitchedGlobalListPtr->setValue(2 * i + 1, newYfromleft);
-      }
-      else if(i % numXtiles == 0) // if the image is in the first (left most) column of images, we only need the top image
-      {
-#if WRITE_DEBUG_IMAGES
-        qDebug() << "TOP: DataContainer: " << dataContainerNames[combIndexList[i]] << ", " << dataContainerNames[combIndexList[i - numXtiles]];
-        qDebug() << "\t" << combIndexList[i] << "\t" << combIndexList[i - numXtiles];
-#endif
-        importFilter = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i]]);
-        currentImage = importFilter->GetOutput();
-        importFilter2 = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i - numXtiles]]);
-        aboveImage = importFilter2->GetOutput();
-
-        // Determine the windows to be cross correlated depending on the rough overlap as found from the global coordinates
-        cropSpecsIm1Im2[0] = 0; // top image X Origin
-        cropSpecsIm1Im2[1] =
-            udims[1] - (udims[1] * (overlapPer / 100)); // yGlobCoordsList[combIndexList[i]] - xyStitchedGlobalListPtr->getValue(2*(i-numXtiles)+1) - yGlobCoordsList[0]; //top image Y Origin
-        cropSpecsIm1Im2[2] = 0;                         // top image Z Origin
-        cropSpecsIm1Im2[3] = 0;                         // current image X Origin
-        cropSpecsIm1Im2[4] = 0;                         // current image Y Origin
-        cropSpecsIm1Im2[5] = 0;                         // current image Z Origin
-
-        cropSpecsIm1Im2[6] = udims[0];                       // top image X Size
-        cropSpecsIm1Im2[7] = udims[1] * (overlapPer / 100);  // top image Y Size
-        cropSpecsIm1Im2[8] = 1;                              // top image Z Size
-        cropSpecsIm1Im2[9] = udims[0];                       // current image X Size
-        cropSpecsIm1Im2[10] = udims[1] * (overlapPer / 100); // current image Y Size
-        cropSpecsIm1Im2[11] = 1;                             // current image Z Size
-
-        // Cross correlate the image windows and return the local shifts between the two images
-        newXYOrigin = CropAndCrossCorrelate(cropSpecsIm1Im2, currentImage, aboveImage);
-
-        previousXtop = xyStitchedGlobalListPtr->getValue(2 * (i - numXtiles));
-        previousYtop = xyStitchedGlobalListPtr->getValue(2 * (i - numXtiles) + 1);
-
-        // Add the local shifts to the preivous global value to get the current stitched global shift
-        newXfromtop = previousXtop + newXYOrigin[0];
-        newYfromtop = previousYtop + newXYOrigin[1] + cropSpecsIm1Im2[1];
-
-        xyStitchedGlobalListPtr->setValue(2 * i, newXfromtop);
-        xyStitchedGlobalListPtr->setValue(2 * i + 1, newYfromtop);
-      }
-      else // for all other images, we need to match to the top and the left
-      {
-#if WRITE_DEBUG_IMAGES
-        qDebug() << "TOP/LEFT: DataContainer: " << dataContainerNames[combIndexList[i]] << ", " << dataContainerNames[combIndexList[i - numXtiles]];
-        qDebug() << "\t" << combIndexList[i] << "\t" << combIndexList[i - numXtiles];
-#endif
-        /// TOP IMAGE FIRST
-        importFilter = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i]]);
-        currentImage = importFilter->GetOutput();
-        importFilter2 = ItkBridgeType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i - numXtiles]]);
-        aboveImage = importFilter2->GetOutput();
-
-        // Determine the windows to be cross correlated depending on the rough overlap as found from the global coordinates
-        cropSpecsIm1Im2[0] = 0; // top image X Origin
-        cropSpecsIm1Im2[1] =
-            udims[1] - (udims[1] * (overlapPer / 100)); // yGlobCoordsList[combIndexList[i]] - xyStitchedGlobalListPtr->getValue(2*(i-numXtiles)+1) - yGlobCoordsList[0]; //top image Y Origin
-        cropSpecsIm1Im2[2] = 0;                         // top image Z Origin
-        cropSpecsIm1Im2[3] = 0;                         // current image X Origin
-        cropSpecsIm1Im2[4] = 0;                         // current image Y Origin
-        cropSpecsIm1Im2[5] = 0;                         // current image Z Origin
-
-        cropSpecsIm1Im2[6] = udims[0];                       // top image X Size
-        cropSpecsIm1Im2[7] = udims[1] * (overlapPer / 100);  // top image Y Size
-        cropSpecsIm1Im2[8] = 1;                              // top image Z Size
-        cropSpecsIm1Im2[9] = udims[0];                       // current image X Size
-        cropSpecsIm1Im2[10] = udims[1] * (overlapPer / 100); // current image Y Size
-        cropSpecsIm1Im2[11] = 1;                             // current image Z Size
-
-        // Cross correlate the image windows and return the local shifts between the two images
-        newXYOrigin2 = CropAndCrossCorrelate(cropSpecsIm1Im2, currentImage, aboveImage);
-
-        previousXtop = xyStitchedGlobalListPtr->getValue(2 * (i - numXtiles));
-        previousYtop = xyStitchedGlobalListPtr->getValue(2 * (i - numXtiles) + 1);
-
-        // Add the local shifts to the preivous global value to get the current stitched global shift
-        newXfromtop = previousXtop + newXYOrigin2[0];
-        newYfromtop = previousYtop + newXYOrigin2[1] + cropSpecsIm1Im2[1];
-
-#if WRITE_DEBUG_IMAGES
-        qDebug() << "TOP/LEFT: DataContainer: " << dataContainerNames[combIndexList[i]] << ", " << dataContainerNames[combIndexList[i - 1]];
-        qDebug() << "\t" << combIndexList[i] << "\t" << combIndexList[i - 1];
-#endif
-        // BOTTOM IMAGE NEXT
-        importFilter = ITKUtilitiesType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i]]);
-        currentImage = importFilter->GetOutput();
-        importFilter2 = ITKUtilitiesType::template Dream3DtoITKImportFilterDataArray<PixelType>(totalPoints, udims, sampleOrigin, spacing, dataArrayList[combIndexList[i - 1]]);
-        leftImage = importFilter2->GetOutput();
-
-        cropSpecsIm1Im2[0] = udims[0] - (udims[0] * (overlapPer / 100)); // xGlobCoordsList[combIndexList[i]] - xyStitchedGlobalListPtr->getValue(2*(i-1)) - xGlobCoordsList[0]; //left image X Origin
-        cropSpecsIm1Im2[1] = 0;                                          // left image Y Origin
-        cropSpecsIm1Im2[2] = 0;                                          // left image Z Origin
-        cropSpecsIm1Im2[3] = 0;                                          // current image X Origin
-        cropSpecsIm1Im2[4] = 0;                                          // current image Y Origin
-        cropSpecsIm1Im2[5] = 0;                                          // current image Z Origin
-
-        cropSpecsIm1Im2[6] = udims[0] * (overlapPer / 100); // left image X Size
-        cropSpecsIm1Im2[7] = udims[1];                      // left image Y Size
-        cropSpecsIm1Im2[8] = 1;                             // left image Z Size
-        cropSpecsIm1Im2[9] = udims[0] * (overlapPer / 100); // current image X Size
-        cropSpecsIm1Im2[10] = udims[1];                     // current image Y Size
-        cropSpecsIm1Im2[11] = 1;                            // current image Z Size
-
-        // Cross correlate the image windows and return the local shifts between the two images
-        newXYOrigin = CropAndCrossCorrelate(cropSpecsIm1Im2, currentImage, leftImage);
-
-        previousXleft = xyStitchedGlobalListPtr->getValue(2 * (i - 1));
-        previousYleft = xyStitchedGlobalListPtr->getValue(2 * (i - 1) + 1);
-
-        // Add the local shifts to the preivous global value to get the current stitched global shift
-        newXfromleft = previousXleft + cropSpecsIm1Im2[0] + newXYOrigin[0];
-        newYfromleft = previousYleft + newXYOrigin[1];
-
-        // AVERAGE the two new locations
-        xyStitchedGlobalListPtr->setValue(2 * i, (newXfromtop + newXfromleft) / 2.0);
-        xyStitchedGlobalListPtr->setValue(2 * i + 1, (newYfromtop + newYfromleft) / 2.0);
-      }
-
-      // Put the values found in from going in the comb order into another data array which represents the original order the images came in as
-      xyStitchedGlobalListPtr_orig->setValue(2 * combIndexList[i], xyStitchedGlobalListPtr->getValue(2 * i));
-      xyStitchedGlobalListPtr_orig->setValue(2 * combIndexList[i] + 1, xyStitchedGlobalListPtr->getValue(2 * i + 1));
+      // Width of the image * the percentage (say 20%) = the size of the crop we're looking at. Subtract that from the width of the image and you have the origin
+      cropSpecsIm1Im2[0] = udims[0] - (udims[0] * (overlapPer / 100)); // left image X Origin
+      cropSpecsIm1Im2[6] = udims[0] * (overlapPer / 100);              // left image X Size
+      cropSpecsIm1Im2[7] = udims[1];                                   // left image Y Size
+      cropSpecsIm1Im2[9] = udims[0] * (overlapPer / 100);              // current image X Size
+      cropSpecsIm1Im2[10] = udims[1];                                  // current image Y Size
     }
+    else
+    {
+      cropSpecsIm1Im2[1] = udims[1] - (udims[1] * (overlapPer / 100)); // top image Y Origin
+      cropSpecsIm1Im2[6] = udims[0];                                   // top image X Size
+      cropSpecsIm1Im2[7] = udims[1] * (overlapPer / 100);              // top image Y Size
+      cropSpecsIm1Im2[9] = udims[0];                                   // current image X Size
+      cropSpecsIm1Im2[10] = udims[1] * (overlapPer / 100);             // current image Y Size
+    }
+    cropSpecsIm1Im2[8] = 1;  // first image Z Size
+    cropSpecsIm1Im2[11] = 1; // current image Z Size
 
-    return xyStitchedGlobalListPtr_orig;
+    // Cross correlate the image windows and return the local shifts between the two images
+    std::vector<float> newXYOrigin = CropAndCrossCorrelate(cropSpecsIm1Im2, importFilter->GetOutput(), importFilter2->GetOutput());
+
+    pair.x = cropSpecsIm1Im2[0] + newXYOrigin[0];
+    pair.y = cropSpecsIm1Im2[1] + newXYOrigin[1];
+    pair.weight = newXYOrigin[2];
   }
 
+  /**
+   * @brief Finds the tile origins, in comb order, that best agree with all of the pairwise
+   * offsets.  Each offset is weighted by its cross correlation peak and the first tile is
+   * fixed at (0, 0).  The result is stored as interleaved X and Y values.
+   * @param numTiles
+   * @param pairs
+   * @return
+   */
+  static std::vector<float> SolveGlobalOrigins(size_t numTiles, const std::vector<PairwiseOffset>& pairs);
+
   /**
    * @brief ReturnIndexForCombOrder
    * @param xTileList
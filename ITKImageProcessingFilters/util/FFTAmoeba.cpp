@@ -15,6 +15,8 @@
 #include <vnl/vnl_least_squares_function.h>
 #include <vnl/vnl_math.h>
 
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+
 #include "ITKImageProcessing/ITKImageProcessingFilters/CalcDewarpParameters.h"
 
 bool fft_amoeba::default_verbose = false;
@@ -29,6 +31,7 @@ fft_amoeba::fft_amoeba(vnl_cost_function& f)
   F_tolerance = 1e-4;
   relative_diameter = 0.05;
   zero_term_delta = 0.00025;
+  concurrent_evaluation = false;
 }
 
 struct fft_amoebaFit : public fft_amoeba
@@ -61,6 +64,24 @@ struct fft_amoebaFit : public fft_amoeba
     return fptr->f(x);
   }
 
+  //: Evaluate the function at each corner, concurrently if requested.
+  //  Does not change cnt.
+  void evaluate(const std::vector<fft_amoeba_SimplexCorner*>& corners)
+  {
+    ParallelTaskAlgorithm taskAlg;
+    taskAlg.setParallelizationEnabled(concurrent_evaluation);
+    for(fft_amoeba_SimplexCorner* corner : corners)
+    {
+      taskAlg.execute([this, corner] { corner->fv = f(corner->v); });
+    }
+    taskAlg.wait();
+  }
+
+  static vnl_vector<double> a_plus_bl(const vnl_vector<double>& vbar, const vnl_vector<double>& v, double lambda)
+  {
+    return (1 - lambda) * vbar + lambda * v;
+  }
+
   void set_corner(fft_amoeba_SimplexCorner* s, const vnl_vector<double>& v)
   {
     s->v = v;
@@ -69,7 +90,7 @@ struct fft_amoebaFit : public fft_amoeba
   }
   void set_corner_a_plus_bl(fft_amoeba_SimplexCorner* s, const vnl_vector<double>& vbar, const vnl_vector<double>& v, double lambda)
   {
-    s->v = (1 - lambda) * vbar + lambda * v;
+    s->v = a_plus_bl(vbar, v, lambda);
     s->fv = f(s->v);
     cnt++;
   }
@@ -162,8 +183,9 @@ void fft_amoebaFit::set_up_simplex_relative(std::vector<fft_amoeba_SimplexCorner
 {
   int n = x.size();
 
+  std::vector<fft_amoeba_SimplexCorner*> corners(n + 1);
   simplex[0].v = x;
-  simplex[0].fv = f(x);
+  corners[0] = &simplex[0];
 
   // Following improvement suggested by L.Pfeffer at Stanford
   const double usual_delta = relative_diameter; // 5 percent deltas for non-zero terms
@@ -180,8 +202,9 @@ void fft_amoebaFit::set_up_simplex_relative(std::vector<fft_amoeba_SimplexCorner
     else
       s->v[j] = zero_term_delta;
 
-    s->fv = f(s->v);
+    corners[j + 1] = s;
   }
+  evaluate(corners);
 }
 
 //: Initialise the simplex given one corner, x and displacements of others
@@ -189,8 +212,9 @@ void fft_amoebaFit::set_up_simplex_absolute(std::vector<fft_amoeba_SimplexCorner
 {
   int n = x.size();
 
+  std::vector<fft_amoeba_SimplexCorner*> corners(n + 1);
   simplex[0].v = x;
-  simplex[0].fv = f(x);
+  corners[0] = &simplex[0];
 
   for(int j = 0; j < n; ++j)
   {
@@ -200,8 +224,9 @@ void fft_amoebaFit::set_up_simplex_absolute(std::vector<fft_amoeba_SimplexCorner
     // perturb s->v(j)
     s->v[j] = s->v[j] + dx[j];
 
-    s->fv = f(s->v);
+    corners[j + 1] = s;
   }
+  evaluate(corners);
 }
 
 //: FMINS Minimize a function of several variables.
@@ -270,6 +295,7 @@ void fft_amoebaFit::amoeba(vnl_vector<double>& x, std::vector<fft_amoeba_Simplex
   fft_amoeba_SimplexCorner expand(n);
   fft_amoeba_SimplexCorner contract(n);
   fft_amoeba_SimplexCorner shrink(n);
+  fft_amoeba_SimplexCorner contractReflect(n);
   fft_amoeba_SimplexCorner* next;
 
   vnl_vector<double> vbar(n);
@@ -288,7 +314,22 @@ void fft_amoebaFit::amoeba(vnl_vector<double>& x, std::vector<fft_amoeba_Simplex
       vbar[k] /= n;
     }
 
-    set_corner_a_plus_bl(&reflect, vbar, simplex[n].v, -1);
+    if(concurrent_evaluation)
+    {
+      // Every candidate this step could need is evaluated up front.  Only the ones the
+      // serial algorithm would have evaluated count against maxiter, so both modes take
+      // exactly the same path through the search.
+      reflect.v = a_plus_bl(vbar, simplex[n].v, -1);
+      expand.v = a_plus_bl(vbar, reflect.v, 2);
+      contract.v = a_plus_bl(vbar, simplex[n].v, 0.5);
+      contractReflect.v = a_plus_bl(vbar, reflect.v, 0.5);
+      evaluate({&reflect, &expand, &contract, &contractReflect});
+      cnt++;
+    }
+    else
+    {
+      set_corner_a_plus_bl(&reflect, vbar, simplex[n].v, -1);
+    }
 
     next = &reflect;
     const char* how = "reflect ";
@@ -298,7 +339,10 @@ void fft_amoebaFit::amoeba(vnl_vector<double>& x, std::vector<fft_amoeba_Simplex
       if(reflect.fv < simplex[0].fv)
       {
         // Reflection actually the best, try expanding
-        set_corner_a_plus_bl(&expand, vbar, reflect.v, 2);
+        if(concurrent_evaluation)
+          cnt++;
+        else
+          set_corner_a_plus_bl(&expand, vbar, reflect.v, 2);
 
         if(expand.fv < simplex[0].fv)
         {
@@ -310,6 +354,13 @@ void fft_amoebaFit::amoeba(vnl_vector<double>& x, std::vector<fft_amoeba_Simplex
     else
     {
       // Reflection *is* totally crap...
+      if(concurrent_evaluation)
+      {
+        if(reflect.fv < simplex[n].fv)
+          contract = contractReflect;
+        cnt++;
+      }
+      else
       {
         fft_amoeba_SimplexCorner* tmp = &simplex[n];
         if(reflect.fv < tmp->fv)
@@ -327,10 +378,16 @@ void fft_amoebaFit::amoeba(vnl_vector<double>& x, std::vector<fft_amoeba_Simplex
       else
       {
         // The contraction point was only average, shrink the entire simplex.
+        std::vector<fft_amoeba_SimplexCorner*> corners(n);
         for(int j = 1; j < n; ++j)
-
-          set_corner_a_plus_bl(&simplex[j], simplex[0].v, simplex[j].v, 0.5);
-        set_corner_a_plus_bl(&shrink, simplex[0].v, simplex[n].v, 0.5);
+        {
+          simplex[j].v = a_plus_bl(simplex[0].v, simplex[j].v, 0.5);
+          corners[j - 1] = &simplex[j];
+        }
+        shrink.v = a_plus_bl(simplex[0].v, simplex[n].v, 0.5);
+        corners[n - 1] = &shrink;
+        evaluate(corners);
+        cnt += n;
 
         next = &shrink;
         how = "shrink  ";
@@ -397,6 +454,7 @@ void fft_amoeba::minimize(vnl_vector<double>& x, const vnl_vector<double>& dx)
   m_Fit->amoeba(x, dx);
   num_evaluations_ = m_Fit->num_evaluations_;
   end_error_ = m_Fit->end_error_;
+  frac_range = m_Fit->frac_range;
   delete m_Fit;
   m_Fit = nullptr;
 }
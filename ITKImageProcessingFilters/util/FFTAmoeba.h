@@ -82,10 +82,21 @@ public:
   {
     zero_term_delta = d;
   }
+
+  //: Evaluate independent simplex corners concurrently.
+  //  The initial simplex and shrink steps are evaluated together, and the
+  //  reflect, expand and contract candidates of each step are evaluated
+  //  speculatively.  The cost function must be safe to call from several
+  //  threads at once.
+  void set_concurrent_evaluation(bool b)
+  {
+    concurrent_evaluation = b;
+  }
   //: Scaling used to select starting vertices relative to initial x0.
   //  I.e. the i'th vertex has x[i] = x0[i]*(1+relative_diameter)
   double relative_diameter;
   double zero_term_delta;
+  bool concurrent_evaluation;
   //: Construct and supply function to be minimized
   fft_amoeba(vnl_cost_function& f);
 
@@ -18,10 +18,53 @@
 
 #include "FFTAmoebaOptimizer.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include <vnl/vnl_cost_function.h>
+
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 
 namespace itk
 {
+namespace
+{
+/**
+ * @brief Applies the same scaling and negation as SingleValuedVnlCostFunctionAdaptor, without
+ * caching the last position or invoking events, so it can be called from several threads.
+ */
+class ConcurrentCostFunction : public vnl_cost_function
+{
+public:
+  ConcurrentCostFunction(const SingleValuedCostFunction* costFunction, unsigned int numberOfParameters, const Optimizer::ScalesType* scales, bool negate)
+  : vnl_cost_function(numberOfParameters)
+  , m_CostFunction(costFunction)
+  , m_Scales(scales)
+  , m_Negate(negate)
+  {
+  }
+
+  ~ConcurrentCostFunction() override = default;
+
+  double f(const vnl_vector<double>& x) override
+  {
+    SingleValuedCostFunction::ParametersType parameters(x.size());
+    for(unsigned int i = 0; i < x.size(); i++)
+    {
+      parameters[i] = (m_Scales != nullptr) ? x[i] / (*m_Scales)[i] : x[i];
+    }
+    const double value = m_CostFunction->GetValue(parameters);
+    return m_Negate ? -value : value;
+  }
+
+private:
+  const SingleValuedCostFunction* m_CostFunction;
+  const Optimizer::ScalesType* m_Scales;
+  bool m_Negate;
+};
+} // namespace
 
 FFTAmoebaOptimizer::FFTAmoebaOptimizer()
 : m_InitialSimplexDelta(1)
@@ -51,6 +94,8 @@ void FFTAmoebaOptimizer::PrintSelf(std::ostream& os, Indent indent) const
   os << indent << "FractionalTolerance: " << this->m_FractionalTolerance << std::endl;
   os << indent << "AutomaticInitialSimplex: " << (this->m_AutomaticInitialSimplex ? "On" : "Off") << std::endl;
   os << indent << "InitialSimplexDelta: " << this->m_InitialSimplexDelta << std::endl;
+  os << indent << "NumberOfParallelRestarts: " << this->m_NumberOfParallelRestarts << std::endl;
+  os << indent << "ConcurrentEvaluation: " << (this->m_ConcurrentEvaluation ? "On" : "Off") << std::endl;
 }
 
 FFTAmoebaOptimizer::MeasureType FFTAmoebaOptimizer::GetValue() const
@@ -135,21 +180,33 @@ void FFTAmoebaOptimizer::StartOptimization()
 
   // configure the vnl optimizer
   CostFunctionAdaptorType* adaptor = GetNonConstCostFunctionAdaptor();
+  if(GetMaximize())
+  {
+    adaptor->NegateCostFunctionOn();
+  }
+
+  // Restarts that run side by side share the cost function, so they need the
+  // thread safe wrapper as well
+  const unsigned int numRestarts = m_OptimizeWithRestarts ? std::max(m_NumberOfParallelRestarts, 1u) : 1u;
+  const bool concurrent = m_ConcurrentEvaluation || numRestarts > 1;
+  vnl_cost_function* vnlCostFunction = adaptor;
+  if(concurrent)
+  {
+    m_ConcurrentCostFunction = std::make_unique<ConcurrentCostFunction>(adaptor->GetCostFunction(), n, m_ScalesInitialized ? &scales : nullptr, GetMaximize());
+    vnlCostFunction = m_ConcurrentCostFunction.get();
+  }
+
   // get rid of previous instance of the internal optimizer and create a
   // new one
   delete m_VnlOptimizer;
-  m_VnlOptimizer = new fft_amoeba(*adaptor);
+  m_VnlOptimizer = new fft_amoeba(*vnlCostFunction);
   m_VnlOptimizer->set_max_iterations(static_cast<int>(m_MaximumNumberOfIterations));
   m_VnlOptimizer->set_f_tolerance(m_FractionalTolerance);
+  m_VnlOptimizer->set_concurrent_evaluation(m_ConcurrentEvaluation);
 
   m_StopConditionDescription.str("");
   m_StopConditionDescription << this->GetNameOfClass() << ": Running";
 
-  if(GetMaximize())
-  {
-    adaptor->NegateCostFunctionOn();
-  }
-
   this->SetCurrentPosition(initialPosition);
 
   ParametersType parameters(initialPosition);
@@ -196,43 +253,88 @@ void FFTAmoebaOptimizer::StartOptimization()
 
   this->m_VnlOptimizer->minimize(parameters, delta);
   bestPosition = parameters;
-  double bestValue = adaptor->f(bestPosition);
+  double bestValue = m_VnlOptimizer->get_end_error();
   // multiple restart heuristic
   if(this->m_OptimizeWithRestarts)
   {
-    double currentValue;
     auto totalEvaluations = static_cast<unsigned int>(m_VnlOptimizer->get_num_evaluations());
     bool converged = false;
     unsigned int i = 1;
     while(!converged && (totalEvaluations < m_MaximumNumberOfIterations) && !m_Cancel)
     {
-      this->m_VnlOptimizer->set_max_iterations(static_cast<int>(this->m_MaximumNumberOfIterations - totalEvaluations));
-      parameters = bestPosition;
+      const int remainingIterations = static_cast<int>(this->m_MaximumNumberOfIterations - totalEvaluations);
+      this->m_VnlOptimizer->set_max_iterations(remainingIterations);
       delta = delta * (1.0 / pow(2.0, static_cast<double>(i)) * (rand() > RAND_MAX / 2 ? 1 : -1));
-      m_VnlOptimizer->minimize(parameters, delta);
-      totalEvaluations += static_cast<unsigned int>(m_VnlOptimizer->get_num_evaluations());
-      currentValue = adaptor->f(parameters);
-      // be consistent with the underlying vnl amoeba implementation
-      double maxAbs = 0.0;
-      for(unsigned j = 0; j < n; j++)
+
+      // The first restart is the classic one. The others flip random edges of the
+      // simplex so that each explores a different neighborhood of the best position.
+      std::vector<InternalParametersType> restartPositions(numRestarts, bestPosition);
+      std::vector<InternalParametersType> restartDeltas(numRestarts, delta);
+      for(unsigned int k = 1; k < numRestarts; k++)
       {
-        if(maxAbs < fabs(bestPosition[j] - parameters[j]))
+        for(unsigned int j = 0; j < n; j++)
         {
-          maxAbs = fabs(bestPosition[j] - parameters[j]);
+          if(rand() > RAND_MAX / 2)
+          {
+            restartDeltas[k][j] = -restartDeltas[k][j];
+          }
         }
       }
-      converged = this->m_VnlOptimizer->get_fractional_range() < this->m_FractionalTolerance;
+
+      {
+        std::lock_guard<std::mutex> lock(m_RestartMutex);
+        m_RestartOptimizers.clear();
+        for(unsigned int k = 1; k < numRestarts; k++)
+        {
+          auto restartOptimizer = std::make_unique<fft_amoeba>(*vnlCostFunction);
+          restartOptimizer->set_max_iterations(remainingIterations);
+          restartOptimizer->set_f_tolerance(m_FractionalTolerance);
+          restartOptimizer->set_concurrent_evaluation(m_ConcurrentEvaluation);
+          m_RestartOptimizers.push_back(std::move(restartOptimizer));
+        }
+      }
+
+      // Only the first restart reports progress to the filter, and it runs on this thread
+      ParallelTaskAlgorithm taskAlg;
+      for(unsigned int k = 1; k < numRestarts; k++)
+      {
+        fft_amoeba* restartOptimizer = m_RestartOptimizers[k - 1].get();
+        taskAlg.execute([restartOptimizer, &restartPositions, &restartDeltas, k] { restartOptimizer->minimize(restartPositions[k], restartDeltas[k]); });
+      }
+      m_VnlOptimizer->minimize(restartPositions[0], restartDeltas[0]);
+      taskAlg.wait();
+
+      // The round lasts as long as its longest restart
+      fft_amoeba* roundBest = m_VnlOptimizer;
+      unsigned int bestRestart = 0;
+      int roundEvaluations = m_VnlOptimizer->get_num_evaluations();
+      for(unsigned int k = 1; k < numRestarts; k++)
+      {
+        fft_amoeba* restartOptimizer = m_RestartOptimizers[k - 1].get();
+        roundEvaluations = std::max(roundEvaluations, restartOptimizer->get_num_evaluations());
+        if(restartOptimizer->get_end_error() < roundBest->get_end_error())
+        {
+          roundBest = restartOptimizer;
+          bestRestart = k;
+        }
+      }
+      totalEvaluations += static_cast<unsigned int>(roundEvaluations);
+      converged = roundBest->get_fractional_range() < this->m_FractionalTolerance;
 
       // this comparison is valid both for min and max because the
       // adaptor is set to always return the function value
       // corresponding to minimization
+      const double currentValue = roundBest->get_end_error();
       if(currentValue < bestValue)
       {
         bestValue = currentValue;
-        bestPosition = parameters;
+        bestPosition = restartPositions[bestRestart];
       }
       i++;
     }
+
+    std::lock_guard<std::mutex> lock(m_RestartMutex);
+    m_RestartOptimizers.clear();
   }
   // get the results, we scale the parameters down if scales are defined
   if(m_ScalesInitialized)
@@ -268,6 +370,12 @@ void FFTAmoebaOptimizer::Cancel()
 {
   m_Cancel = true;
   m_VnlOptimizer->cancel();
+
+  std::lock_guard<std::mutex> lock(m_RestartMutex);
+  for(const auto& restartOptimizer : m_RestartOptimizers)
+  {
+    restartOptimizer->cancel();
+  }
 }
 
 void FFTAmoebaOptimizer::SetSIMPLFilter(AbstractFilter* filter)
@@ -17,6 +17,10 @@
  *=========================================================================*/
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <itkConfigure.h>
 #define SIMPL_ITK_VERSION_CHECK (ITK_VERSION_MAJOR == 4)
 #if SIMPL_ITK_VERSION_CHECK
@@ -138,6 +142,23 @@ public:
   itkBooleanMacro(OptimizeWithRestarts);
   itkGetConstMacro(OptimizeWithRestarts, bool);
 
+  /** Set/Get the number of restarts run side by side in each round of the
+   * restart heuristic. Every restart starts from the best solution so far;
+   * all but the first flip the sign of random simplex edges. The best result
+   * of the round seeds the next one. Default is 1.
+   */
+  itkSetMacro(NumberOfParallelRestarts, unsigned int);
+  itkGetConstMacro(NumberOfParallelRestarts, unsigned int);
+
+  /** Set/Get whether independent simplex corners are evaluated concurrently.
+   * The cost function's GetValue() must be safe to call from several threads.
+   * The cost function is then called directly rather than through the vnl
+   * adaptor, so no FunctionEvaluationIterationEvent is invoked. Default is off.
+   */
+  itkSetMacro(ConcurrentEvaluation, bool);
+  itkBooleanMacro(ConcurrentEvaluation);
+  itkGetConstMacro(ConcurrentEvaluation, bool);
+
   /** Set/Get the deltas that are used to define the initial simplex
    * when AutomaticInitialSimplex is off. */
   void SetInitialSimplexDelta(ParametersType initialSimplexDelta, bool automaticInitialSimplex = false);
@@ -182,7 +203,12 @@ private:
   bool m_AutomaticInitialSimplex;
   ParametersType m_InitialSimplexDelta;
   bool m_OptimizeWithRestarts;
+  unsigned int m_NumberOfParallelRestarts = 1;
+  bool m_ConcurrentEvaluation = false;
   fft_amoeba* m_VnlOptimizer;
+  std::unique_ptr<vnl_cost_function> m_ConcurrentCostFunction;
+  std::vector<std::unique_ptr<fft_amoeba>> m_RestartOptimizers;
+  std::mutex m_RestartMutex;
   bool m_Cancel = false;
   AbstractFilter* m_SIMPLFilter = nullptr;
 
@@ -33,7 +33,13 @@
 #include "FFTConvolutionCostFunction.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <vector>
+
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
 
 #include "itkExtractImageFilter.h"
 
@@ -71,13 +77,21 @@ public:
    * @brief Constructor
    * @param image
    * @param width
+   * @param height
    * @param dataArray
+   * @param factor
+   * @param sourceX
+   * @param sourceY
    */
-  FFTImageInitializer(const InputImage::Pointer& image, size_t width, const DataArrayType::Pointer& dataArray)
+  FFTImageInitializer(const InputImage::Pointer& image, size_t width, size_t height, const DataArrayType::Pointer& dataArray, size_t factor = 1, size_t sourceX = 0, size_t sourceY = 0)
   : m_Image(image)
   , m_Width(width)
+  , m_Height(height)
   , m_DataArray(dataArray)
   , m_Comps(dataArray->getNumberOfComponents())
+  , m_Factor(factor)
+  , m_SourceX(sourceX)
+  , m_SourceY(sourceY)
   {
     auto index = image->GetRequestedRegion().GetIndex();
     m_ImageIndex[0] = index[0];
@@ -91,12 +105,35 @@ public:
    */
   void setPixel(size_t pxlWidthIdx, size_t pxlHeightIdx) const
   {
-    // Get the pixel index from the current pxlWidthIdx and pxlHeightIdx
-    size_t pxlIdx = ((pxlWidthIdx) + (pxlHeightIdx)*m_Width) * m_Comps;
     PixelCoord idx;
     idx[0] = pxlWidthIdx + m_ImageIndex[0];
     idx[1] = pxlHeightIdx + m_ImageIndex[1];
-    m_Image->SetPixel(idx, m_DataArray->getValue(pxlIdx));
+
+    if(m_Factor == 1)
+    {
+      // Get the pixel index from the current pxlWidthIdx and pxlHeightIdx
+      size_t pxlIdx = ((pxlWidthIdx) + (pxlHeightIdx)*m_Width) * m_Comps;
+      m_Image->SetPixel(idx, m_DataArray->getValue(pxlIdx));
+      return;
+    }
+
+    // Average the block of source pixels covered by this downsampled pixel.  Downsampled
+    // indices are relative to the first block, which starts at (m_SourceX, m_SourceY).
+    const size_t xBegin = m_SourceX + pxlWidthIdx * m_Factor;
+    const size_t yBegin = m_SourceY + pxlHeightIdx * m_Factor;
+    const size_t xEnd = std::min(xBegin + m_Factor, m_Width);
+    const size_t yEnd = std::min(yBegin + m_Factor, m_Height);
+    size_t sum = 0;
+    size_t count = 0;
+    for(size_t y = yBegin; y < yEnd; y++)
+    {
+      for(size_t x = xBegin; x < xEnd; x++)
+      {
+        sum += m_DataArray->getValue((x + y * m_Width) * m_Comps);
+        count++;
+      }
+    }
+    m_Image->SetPixel(idx, static_cast<PixelValue_T>(count > 0 ? (sum + count / 2) / count : 0));
   }
 
   /**
@@ -117,16 +154,20 @@ public:
 private:
   InputImage::Pointer m_Image;
   size_t m_Width;
-  // size_t m_Height;
+  size_t m_Height;
   PixelCoord m_ImageIndex;
   DataArrayType::Pointer m_DataArray;
   size_t m_Comps;
+  size_t m_Factor;
+  size_t m_SourceX;
+  size_t m_SourceY;
 };
 
 /**
- * @brief The FFTImageOverlapGenerator class is used for generating itk::Images
- * for the specified overlap region from a given itk::Image, offsets, and
- * dewarp parameters.
+ * @brief The FFTImageOverlapGenerator class is used for generating the pair of
+ * itk::Images for the specified overlap region from the two given itk::Images,
+ * offsets, and dewarp parameters. Both images share the same overlap region and
+ * offset, so the dewarped index is only calculated once per pixel.
  */
 class FFTImageOverlapGenerator
 {
@@ -138,19 +179,26 @@ class FFTImageOverlapGenerator
 public:
   /**
    * @brief Constructor
-   * @param baseImg
-   * @param image
+   * @param firstBaseImg
+   * @param secondBaseImg
+   * @param firstImage
+   * @param secondImage
    * @param offset
    * @param imageDim_x
    * @param imageDim_y
    * @param parameters
+   * @param regionBounds
+   * @param boundsMutex
    */
-  FFTImageOverlapGenerator(const InputImage::Pointer& baseImg, const InputImage::Pointer& image, const PixelCoord& offset, size_t imageDim_x, size_t imageDim_y, const ParametersType& parameters,
-                           RegionBounds& regionBounds)
-  : m_BaseImg(baseImg)
-  , m_Image(image)
+  FFTImageOverlapGenerator(const InputImage::Pointer& firstBaseImg, const InputImage::Pointer& secondBaseImg, const InputImage::Pointer& firstImage, const InputImage::Pointer& secondImage,
+                           const PixelCoord& offset, size_t imageDim_x, size_t imageDim_y, const ParametersType& parameters, RegionBounds& regionBounds, MutexType& boundsMutex)
+  : m_FirstBaseImg(firstBaseImg)
+  , m_SecondBaseImg(secondBaseImg)
+  , m_FirstImage(firstImage)
+  , m_SecondImage(secondImage)
   , m_Parameters(parameters)
   , m_Bounds(regionBounds)
+  , m_BoundsMutex(boundsMutex)
   {
     double x_trans = (imageDim_x - 1) / 2.0;
     double y_trans = (imageDim_y - 1) / 2.0;
@@ -158,48 +206,61 @@ public:
   }
 
   /**
-   * @brief Updates the RegionBounds based on the provided invalid index.
+   * @brief Updates the range's RegionBounds based on the provided invalid index.
    * @param index
+   * @param bounds
    */
-  void updateRegionBounds(const PixelCoord& index) const
+  void updateRegionBounds(const PixelCoord& index, RegionBounds& bounds) const
   {
-    static MutexType mutex;
-
-    auto origin = m_Image->GetOrigin();
-    auto size = m_Image->GetRequestedRegion().GetSize();
+    auto origin = m_FirstImage->GetOrigin();
+    auto size = m_FirstImage->GetRequestedRegion().GetSize();
 
     const int64_t distTop = index[1] - origin[1];
     const int64_t distBot = origin[1] + size[1] - index[1];
     const int64_t distLeft = index[0] - origin[0];
     const int64_t distRight = origin[0] + size[0] - index[0];
 
-    ScopedLockType scopedLock(mutex);
     if(distTop <= distBot && distTop <= distLeft && distTop <= distRight)
     {
-      m_Bounds.topBound = std::max(m_Bounds.topBound, static_cast<int64_t>(index[1]));
+      bounds.topBound = std::max(bounds.topBound, static_cast<int64_t>(index[1]));
     }
     else if(distBot <= distTop && distBot <= distLeft && distBot <= distRight)
     {
-      m_Bounds.bottomBound = std::min(m_Bounds.bottomBound, static_cast<int64_t>(index[1]));
+      bounds.bottomBound = std::min(bounds.bottomBound, static_cast<int64_t>(index[1]));
     }
     else if(distLeft <= distTop && distLeft <= distBot && distLeft <= distRight)
     {
-      m_Bounds.leftBound = std::max(m_Bounds.leftBound, static_cast<int64_t>(index[0]));
+      bounds.leftBound = std::max(bounds.leftBound, static_cast<int64_t>(index[0]));
     }
     else if(distRight <= distTop && distRight <= distBot && distRight <= distLeft)
     {
-      m_Bounds.rightBound = std::min(m_Bounds.rightBound, static_cast<int64_t>(index[0]));
+      bounds.rightBound = std::min(bounds.rightBound, static_cast<int64_t>(index[0]));
     }
   }
 
+  /**
+   * @brief Tightens the shared RegionBounds with the bounds found by one range.  This is the only
+   * place the shared bounds are locked, once per range instead of once per invalid pixel.
+   * @param bounds
+   */
+  void mergeRegionBounds(const RegionBounds& bounds) const
+  {
+    ScopedLockType scopedLock(m_BoundsMutex);
+    m_Bounds.topBound = std::max(m_Bounds.topBound, bounds.topBound);
+    m_Bounds.bottomBound = std::min(m_Bounds.bottomBound, bounds.bottomBound);
+    m_Bounds.leftBound = std::max(m_Bounds.leftBound, bounds.leftBound);
+    m_Bounds.rightBound = std::min(m_Bounds.rightBound, bounds.rightBound);
+  }
+
   /**
    * @brief Checks and returns if the base image contains the given PixelCoord.
+   * @param baseImg
    * @param index
    * @return
    */
-  bool baseImageContainsIndex(const PixelCoord& index) const
+  bool baseImageContainsIndex(const InputImage::Pointer& baseImg, const PixelCoord& index) const
   {
-    const InputImage::RegionType baseRegion = m_BaseImg->GetRequestedRegion();
+    const InputImage::RegionType baseRegion = baseImg->GetRequestedRegion();
     const PixelCoord baseIndex = baseRegion.GetIndex();
     const auto baseSize = baseRegion.GetSize();
 
@@ -220,16 +281,26 @@ public:
   }
 
   /**
-   * @brief Calculate the old pixel position from the given x and y values.
-   * @param x
-   * @param y
-   * @return
+   * @brief Copies the base image value at oldIndex into the overlap image at newIndex, or zero if
+   * the base image does not contain oldIndex.
+   * @param baseImg
+   * @param image
+   * @param oldIndex
+   * @param newIndex
+   * @param bounds
    */
-  PixelCoord calculateOldPixelIndex(size_t x, size_t y) const
+  void copyPixel(const InputImage::Pointer& baseImg, const InputImage::Pointer& image, const PixelCoord& oldIndex, const PixelCoord& newIndex, RegionBounds& bounds) const
   {
-    FFTDewarpHelper::PixelIndex index = FFTDewarpHelper::pixelIndex(x, y);
-    FFTDewarpHelper::PixelIndex oldPixel = FFTDewarpHelper::getOldIndex(index, m_Offset, m_Parameters);
-    return PixelCoord{oldPixel[0], oldPixel[1]};
+    PixelValue_T pixel{0};
+    if(baseImageContainsIndex(baseImg, oldIndex))
+    {
+      pixel = baseImg->GetPixel(oldIndex);
+    }
+    else
+    {
+      updateRegionBounds(newIndex, bounds);
+    }
+    image->SetPixel(newIndex, pixel);
   }
 
   /**
@@ -238,41 +309,46 @@ public:
    */
   void operator()(const SIMPLRange2D& range) const
   {
+    const int64_t minCol = static_cast<int64_t>(range.minCol());
+    const int64_t maxCol = static_cast<int64_t>(range.maxCol());
+    std::vector<int64_t> oldX(range.maxCol() - range.minCol());
+    std::vector<int64_t> oldY(oldX.size());
+    RegionBounds bounds;
+    bounds.leftBound = std::numeric_limits<int64_t>::lowest();
+    bounds.topBound = std::numeric_limits<int64_t>::lowest();
     for(size_t y = range.minRow(); y < range.maxRow(); y++)
     {
-      for(size_t x = range.minCol(); x < range.maxCol(); x++)
+      FFTDewarpHelper::getOldIndexRow(static_cast<int64_t>(y), minCol, maxCol, m_Offset, m_Parameters, oldX.data(), oldY.data());
+      for(int64_t x = minCol; x < maxCol; x++)
       {
-        PixelCoord newIndex{static_cast<int64_t>(x), static_cast<int64_t>(y)};
-        PixelValue_T pixel{0};
-        const PixelCoord oldIndex = calculateOldPixelIndex(x, y);
-        if(baseImageContainsIndex(oldIndex))
-        {
-          pixel = m_BaseImg->GetPixel(oldIndex);
-        }
-        else
-        {
-          updateRegionBounds(newIndex);
-        }
-        m_Image->SetPixel(newIndex, pixel);
+        PixelCoord newIndex{x, static_cast<int64_t>(y)};
+        const PixelCoord oldIndex{oldX[x - minCol], oldY[x - minCol]};
+        copyPixel(m_FirstBaseImg, m_FirstImage, oldIndex, newIndex, bounds);
+        copyPixel(m_SecondBaseImg, m_SecondImage, oldIndex, newIndex, bounds);
       }
     }
+    mergeRegionBounds(bounds);
   }
 
 private:
-  InputImage::Pointer m_BaseImg;
-  InputImage::Pointer m_Image;
+  InputImage::Pointer m_FirstBaseImg;
+  InputImage::Pointer m_SecondBaseImg;
+  InputImage::Pointer m_FirstImage;
+  InputImage::Pointer m_SecondImage;
   FFTDewarpHelper::PixelIndex m_Offset;
   ParametersType m_Parameters;
   RegionBounds& m_Bounds;
+  MutexType& m_BoundsMutex;
 };
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void FFTConvolutionCostFunction::Initialize(const GridMontageShPtr& montage, const DataContainerArrayShPtr& dca, const QString& amName, const QString& daName)
+void FFTConvolutionCostFunction::Initialize(const GridMontageShPtr& montage, const DataContainerArrayShPtr& dca, const QString& amName, const QString& daName, size_t downsampleFactor)
 {
   std::ignore = dca;
   m_Montage = montage;
+  m_DownsampleFactor = std::max(downsampleFactor, static_cast<size_t>(1));
 
   m_ImageGrid.clear();
 
@@ -292,6 +368,10 @@ void FFTConvolutionCostFunction::Initialize(const GridMontageShPtr& montage, con
   }
   taskAlg.wait();
 
+  // The dewarp polynomial is centered on the downsampled tiles
+  m_ImageDim_x = std::floor(m_ImageDim_x / m_DownsampleFactor);
+  m_ImageDim_y = std::floor(m_ImageDim_y / m_DownsampleFactor);
+
   CropMap cropMap;
   for(const auto& image : m_ImageGrid)
   {
@@ -299,6 +379,10 @@ void FFTConvolutionCostFunction::Initialize(const GridMontageShPtr& montage, con
   }
 
   m_Overlaps = createOverlapPairs(cropMap);
+
+  // Buffers sized for the previous overlaps can not be reused
+  std::lock_guard<std::mutex> lock(m_WorkspaceMutex);
+  m_FreeWorkspaces.clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -348,8 +432,8 @@ void FFTConvolutionCostFunction::initializeDataContainer(const GridMontageShPtr&
   SizeVec3Type dims = imageGeom->getDimensions();
   const size_t geomWidth = dims.getX();
   const size_t geomHeight = dims.getY();
-  size_t xOrigin = imageGeom->getOrigin().getX() / spacing.getX();
-  size_t yOrigin = imageGeom->getOrigin().getY() / spacing.getY();
+  double xOrigin = imageGeom->getOrigin().getX() / spacing.getX();
+  double yOrigin = imageGeom->getOrigin().getY() / spacing.getY();
   size_t offsetX = 0;
   size_t offsetY = 0;
   size_t tileHeight = std::min(geomHeight, static_cast<size_t>(std::floor(m_ImageDim_y)));
@@ -363,26 +447,46 @@ void FFTConvolutionCostFunction::initializeDataContainer(const GridMontageShPtr&
   if(row == 0 && montage->getRowCount() > 2)
   {
     offsetY = geomHeight;
-    const size_t yPrime = yOrigin + geomHeight;
+    const double yPrime = yOrigin + geomHeight;
     yOrigin = yPrime - tileHeight;
     offsetY -= tileHeight;
   }
   if(column == 0 && montage->getColumnCount() > 2)
   {
     offsetX = geomWidth;
-    const size_t xPrime = xOrigin + geomWidth;
+    const double xPrime = xOrigin + geomWidth;
     xOrigin = xPrime - tileWidth;
     offsetX -= tileWidth;
   }
 
+  PixelCoord imageOrigin;
+  imageOrigin[0] = static_cast<PixelCoord::IndexValueType>(xOrigin);
+  imageOrigin[1] = static_cast<PixelCoord::IndexValueType>(yOrigin);
+  size_t sourceX = 0;
+  size_t sourceY = 0;
+
+  if(m_DownsampleFactor > 1)
+  {
+    // Every tile is downsampled on the same grid of blocks across the montage, so overlapping
+    // tiles average exactly the same pixels.  The origins stay in full resolution pixels until
+    // the first whole block inside the tile is found, and only that block's index is stored.
+    const double factor = static_cast<double>(m_DownsampleFactor);
+    const double xBlock = std::ceil(xOrigin / factor);
+    const double yBlock = std::ceil(yOrigin / factor);
+    sourceX = offsetX + static_cast<size_t>(std::llround(xBlock * factor - xOrigin));
+    sourceY = offsetY + static_cast<size_t>(std::llround(yBlock * factor - yOrigin));
+    tileWidth = static_cast<size_t>(std::max(std::floor((xOrigin + tileWidth) / factor) - xBlock, 0.0));
+    tileHeight = static_cast<size_t>(std::max(std::floor((yOrigin + tileHeight) / factor) - yBlock, 0.0));
+    imageOrigin[0] = static_cast<PixelCoord::IndexValueType>(xBlock);
+    imageOrigin[1] = static_cast<PixelCoord::IndexValueType>(yBlock);
+    offsetX = 0;
+    offsetY = 0;
+  }
+
   InputImage::SizeType imageSize;
   imageSize[0] = tileWidth;
   imageSize[1] = tileHeight;
 
-  PixelCoord imageOrigin;
-  imageOrigin[0] = xOrigin;
-  imageOrigin[1] = yOrigin;
-
   InputImage::Pointer itkImage = InputImage::New();
   itkImage->SetRegions(InputImage::RegionType(imageOrigin, imageSize));
   itkImage->Allocate();
@@ -392,7 +496,7 @@ void FFTConvolutionCostFunction::initializeDataContainer(const GridMontageShPtr&
   // NOTE Could this be parallelized?
   ParallelData2DAlgorithm dataAlg;
   dataAlg.setRange(offsetY, offsetX, tileHeight, tileWidth);
-  dataAlg.execute(FFTImageInitializer(itkImage, geomWidth, da));
+  dataAlg.execute(FFTImageInitializer(itkImage, geomWidth, geomHeight, da, m_DownsampleFactor, sourceX, sourceY));
 
   GridKey imageKey = std::make_pair(column, row); // Flipped this to {x,y}
   ScopedLockType scopedLock(mutex);
@@ -455,20 +559,80 @@ uint32_t FFTConvolutionCostFunction::GetNumberOfParameters() const
 // -----------------------------------------------------------------------------
 FFTConvolutionCostFunction::MeasureType FFTConvolutionCostFunction::GetValue(const ParametersType& parameters) const
 {
+  std::unique_ptr<Workspace> workspace = acquireWorkspace();
+
   ParallelTaskAlgorithm taskAlg;
-  MeasureType residual = 0.0;
-  // Find the FFT Convolution and accumulate the maximum value from each overlap
-  for(const auto& overlap : m_Overlaps) // Parallelize this
+  std::vector<MeasureType> maxValues(m_Overlaps.size(), 0.0);
+  // Find the FFT Convolution and the maximum value from each overlap
+  for(size_t i = 0; i < m_Overlaps.size(); i++)
   {
-    taskAlg.execute(std::bind(&FFTConvolutionCostFunction::findFFTConvolutionAndMaxValue, this, overlap, parameters, std::ref(residual)));
+    taskAlg.execute(std::bind(&FFTConvolutionCostFunction::findFFTConvolutionAndMaxValue, this, std::cref(m_Overlaps[i]), std::cref(parameters), std::ref((*workspace)[i]), std::ref(maxValues[i])));
   }
   taskAlg.wait();
 
+  releaseWorkspace(std::move(workspace));
+
+  // Summing in overlap order keeps the result independent of task scheduling
+  MeasureType residual = 0.0;
+  for(const MeasureType maxValue : maxValues)
+  {
+    residual += maxValue;
+  }
+
   // The value to maximize is the square of the sum of the maximum value of the fft convolution
   MeasureType result = residual * residual;
   return result;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::unique_ptr<FFTConvolutionCostFunction::Workspace> FFTConvolutionCostFunction::acquireWorkspace() const
+{
+  {
+    std::lock_guard<std::mutex> lock(m_WorkspaceMutex);
+    if(!m_FreeWorkspaces.empty())
+    {
+      std::unique_ptr<Workspace> workspace = std::move(m_FreeWorkspaces.back());
+      m_FreeWorkspaces.pop_back();
+      return workspace;
+    }
+  }
+
+  // Allocate the overlap buffers once. They are refilled on every evaluation.
+  std::unique_ptr<Workspace> workspace = std::make_unique<Workspace>(m_Overlaps.size());
+  for(size_t i = 0; i < m_Overlaps.size(); i++)
+  {
+    const InputImage::RegionType& region = m_Overlaps[i].second;
+    OverlapWorkspace& overlapWorkspace = (*workspace)[i];
+
+    overlapWorkspace.firstImage = InputImage::New();
+    overlapWorkspace.firstImage->SetRegions(region);
+    overlapWorkspace.firstImage->Allocate();
+
+    overlapWorkspace.secondImage = InputImage::New();
+    overlapWorkspace.secondImage->SetRegions(region);
+    overlapWorkspace.secondImage->Allocate();
+
+    overlapWorkspace.filter = ConvolutionFilter::New();
+    overlapWorkspace.filter->SetInput(overlapWorkspace.firstImage);
+    overlapWorkspace.filter->SetKernelImage(overlapWorkspace.secondImage);
+  }
+  return workspace;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FFTConvolutionCostFunction::releaseWorkspace(std::unique_ptr<Workspace> workspace) const
+{
+  std::lock_guard<std::mutex> lock(m_WorkspaceMutex);
+  if(workspace->size() == m_Overlaps.size())
+  {
+    m_FreeWorkspaces.push_back(std::move(workspace));
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -554,11 +718,11 @@ FFTConvolutionCostFunction::InputImage::RegionType FFTConvolutionCostFunction::c
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-FFTConvolutionCostFunction::ImagePair FFTConvolutionCostFunction::createOverlapImages(const OverlapPair& overlap, const ParametersType& parameters) const
+FFTConvolutionCostFunction::ImagePair FFTConvolutionCostFunction::createOverlapImages(const OverlapPair& overlap, const ParametersType& parameters, OverlapWorkspace& workspace) const
 {
-  // First image calculation
   InputImage::RegionType region = overlap.second;
   const InputImage::Pointer firstBaseImg = m_ImageGrid.at(overlap.first.first);
+  const InputImage::Pointer secondBaseImg = m_ImageGrid.at(overlap.first.second);
 
   // Create RegionBounds
   RegionBounds bounds;
@@ -567,25 +731,21 @@ FFTConvolutionCostFunction::ImagePair FFTConvolutionCostFunction::createOverlapI
   bounds.leftBound = region.GetIndex()[0];
   bounds.rightBound = region.GetIndex()[0] + region.GetSize()[0];
 
-  InputImage::Pointer firstOverlapImg = InputImage::New();
-  firstOverlapImg->SetRegions({region.GetIndex(), region.GetSize()});
-  firstOverlapImg->Allocate();
+  // The previous evaluation cropped the requested regions
+  InputImage::Pointer firstOverlapImg = workspace.firstImage;
+  InputImage::Pointer secondOverlapImg = workspace.secondImage;
+  firstOverlapImg->SetRequestedRegionToLargestPossibleRegion();
+  secondOverlapImg->SetRequestedRegionToLargestPossibleRegion();
 
   auto index = region.GetIndex();
+  MutexType boundsMutex;
   ParallelData2DAlgorithm dataAlg;
   dataAlg.setRange(index[1], index[0], index[1] + region.GetSize()[1], index[0] + region.GetSize()[0]);
-  dataAlg.execute(FFTImageOverlapGenerator(firstBaseImg, firstOverlapImg, index, m_ImageDim_x, m_ImageDim_y, parameters, bounds));
+  dataAlg.execute(FFTImageOverlapGenerator(firstBaseImg, secondBaseImg, firstOverlapImg, secondOverlapImg, index, m_ImageDim_x, m_ImageDim_y, parameters, bounds, boundsMutex));
 
-  // Second image calculation
-  const InputImage::Pointer secondBaseImg = m_ImageGrid.at(overlap.first.second);
-
-  InputImage::Pointer secondOverlapImg = InputImage::New();
-  secondOverlapImg->SetRegions({region.GetIndex(), region.GetSize()});
-  secondOverlapImg->Allocate();
-
-  index = region.GetIndex();
-  dataAlg.setRange(index[1], index[0], index[1] + region.GetSize()[1], index[0] + region.GetSize()[0]);
-  dataAlg.execute(FFTImageOverlapGenerator(secondBaseImg, secondOverlapImg, index, m_ImageDim_x, m_ImageDim_y, parameters, bounds));
+  // The pixels were written directly into the buffers, so the pipeline has to be told they changed
+  firstOverlapImg->Modified();
+  secondOverlapImg->Modified();
 
   // Crop images
   ImagePair imgPair = std::make_pair(firstOverlapImg, secondOverlapImg);
@@ -613,10 +773,45 @@ FFTConvolutionCostFunction::ImagePair FFTConvolutionCostFunction::cropOverlapIma
 }
 
 // -----------------------------------------------------------------------------
-double maxFromArray(double* ptr, size_t count)
+double maxFromArray(const double* ptr, size_t count)
 {
   double max = std::numeric_limits<int64_t>::lowest();
-  for(size_t i = 0; i < count; i++)
+  size_t i = 0;
+#ifdef __AVX__
+  // _mm256_max_pd returns its second operand when either is NaN, so NaNs are skipped like the scalar comparison does
+  __m256d maxes = _mm256_set1_pd(max);
+  for(; i + 4 <= count; i += 4)
+  {
+    maxes = _mm256_max_pd(_mm256_loadu_pd(ptr + i), maxes);
+  }
+  alignas(32) double lanes[4];
+  _mm256_store_pd(lanes, maxes);
+  for(double lane : lanes)
+  {
+    if(lane > max)
+    {
+      max = lane;
+    }
+  }
+#else
+  // Independent running maxima let the compiler keep several comparisons in flight
+  double maxes[4] = {max, max, max, max};
+  for(; i + 4 <= count; i += 4)
+  {
+    for(size_t lane = 0; lane < 4; lane++)
+    {
+      maxes[lane] = (ptr[i + lane] > maxes[lane]) ? ptr[i + lane] : maxes[lane];
+    }
+  }
+  for(double lane : maxes)
+  {
+    if(lane > max)
+    {
+      max = lane;
+    }
+  }
+#endif
+  for(; i < count; i++)
   {
     if(ptr[i] > max)
     {
@@ -629,15 +824,11 @@ double maxFromArray(double* ptr, size_t count)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void FFTConvolutionCostFunction::findFFTConvolutionAndMaxValue(const OverlapPair& overlap, const ParametersType& parameters, MeasureType& residual) const
+void FFTConvolutionCostFunction::findFFTConvolutionAndMaxValue(const OverlapPair& overlap, const ParametersType& parameters, OverlapWorkspace& workspace, MeasureType& maxValue) const
 {
-  static MutexType mutex;
+  createOverlapImages(overlap, parameters, workspace);
 
-  ImagePair overlapImgs = createOverlapImages(overlap, parameters);
-
-  ConvolutionFilter::Pointer filter = ConvolutionFilter::New();
-  filter->SetInput(overlapImgs.first);
-  filter->SetKernelImage(overlapImgs.second);
+  ConvolutionFilter::Pointer filter = workspace.filter;
   filter->Update();
   OutputImage::Pointer fftConvolve = filter->GetOutput();
 
@@ -647,10 +838,7 @@ void FFTConvolutionCostFunction::findFFTConvolutionAndMaxValue(const OverlapPair
   auto pixelContainer = fftConvolve->GetPixelContainer();
   OutputValue_T* bufferPtr = pixelContainer->GetBufferPointer();
   itk::SizeValueType bufferSize = pixelContainer->Size();
-  MeasureType maxValue = maxFromArray(bufferPtr, bufferSize);
-
-  ScopedLockType lock(mutex);
-  residual += maxValue;
+  maxValue = maxFromArray(bufferPtr, bufferSize);
 }
 
 // -----------------------------------------------------------------------------
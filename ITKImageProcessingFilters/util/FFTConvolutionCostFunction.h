@@ -32,6 +32,10 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -100,6 +104,18 @@ public:
 
   using CropMap = std::map<GridKey, RegionBounds>;
 
+  /**
+   * @brief The OverlapWorkspace struct holds the overlap buffers and the convolution filter for a
+   * single overlap. They are allocated once and reused by every call to GetValue.
+   */
+  struct OverlapWorkspace
+  {
+    InputImage::Pointer firstImage;
+    InputImage::Pointer secondImage;
+    ConvolutionFilter::Pointer filter;
+  };
+  using Workspace = std::vector<OverlapWorkspace>;
+
   // The m_overlaps is a vector of pairs, with the first index being the
   // grid location of an overlap region (i.e. 'Row 0, Column: 1; Row: 1, Column: 1')
   // and the second index being the ITK RegionTypes that define the overlap regions
@@ -121,13 +137,16 @@ public:
   itkNewMacro(FFTConvolutionCostFunction);
 
   /**
-   * @brief Initializes the cost function based on a given set of values.
+   * @brief Initializes the cost function based on a given set of values.  With a downsampleFactor
+   * greater than 1, each tile is box filtered down by that factor and the parameters passed to
+   * GetValue are interpreted in downsampled pixels.
    * @param montage
    * @param dca
    * @param amName
    * @param daName
+   * @param downsampleFactor
    */
-  void Initialize(const GridMontageShPtr& montage, const DataContainerArrayShPtr& dca, const QString& amName, const QString& daName);
+  void Initialize(const GridMontageShPtr& montage, const DataContainerArrayShPtr& dca, const QString& amName, const QString& daName, size_t downsampleFactor = 1);
 
   /**
    * @brief Override for itk::SingleValuedCostFunction::GetDerivative that throws an exception.
@@ -156,13 +175,13 @@ public:
   ImageGrid getImageGrid() const;
 
   /**
-   * @brief Returns the target tile width.
+   * @brief Returns the target tile width in downsampled pixels.
    * @return
    */
   double getImageDimX() const;
 
   /**
-   * @brief Returns the target tile height.
+   * @brief Returns the target tile height in downsampled pixels.
    * @return
    */
   double getImageDimY() const;
@@ -207,12 +226,13 @@ private:
   InputImage::RegionType createBottomRegionPairs(const RegionBounds& top, const RegionBounds& bottom) const;
 
   /**
-   * @brief Creates and returns a pair of images containing the overlap section based on the given parameters.
+   * @brief Fills the workspace images with the overlap section based on the given parameters and returns them.
    * @param overlap
    * @param parameters
+   * @param workspace
    * @return
    */
-  ImagePair createOverlapImages(const OverlapPair& overlap, const ParametersType& parameters) const;
+  ImagePair createOverlapImages(const OverlapPair& overlap, const ParametersType& parameters, OverlapWorkspace& workspace) const;
 
   /**
    * @brief crops the ImagePair regions to match the RegionBounds provided.
@@ -222,12 +242,25 @@ private:
   ImagePair cropOverlapImages(const ImagePair& imagePair, const RegionBounds& bounds) const;
 
   /**
-   * @brief This method is called by GetValue to find the FFT Convolution and accumulate the maximum value from each overlap.
+   * @brief This method is called by GetValue to find the FFT Convolution and the maximum value of a single overlap.
    * @param overlap
    * @param parameters
-   * @param residual
+   * @param workspace
+   * @param maxValue
+   */
+  void findFFTConvolutionAndMaxValue(const OverlapPair& overlap, const ParametersType& parameters, OverlapWorkspace& workspace, MeasureType& maxValue) const;
+
+  /**
+   * @brief Returns a Workspace with one OverlapWorkspace per overlap that is not in use by another GetValue call.
+   * @return
+   */
+  std::unique_ptr<Workspace> acquireWorkspace() const;
+
+  /**
+   * @brief Returns the Workspace to the pool so that the next GetValue call can reuse its buffers.
+   * @param workspace
    */
-  void findFFTConvolutionAndMaxValue(const OverlapPair& overlap, const ParametersType& parameters, MeasureType& residual) const;
+  void releaseWorkspace(std::unique_ptr<Workspace> workspace) const;
 
   /**
    * @brief Calculates the ImageDim_x and ImageDim_y values for a montage.
@@ -252,7 +285,10 @@ private:
   ImageGrid m_ImageGrid;
   double m_ImageDim_x;
   double m_ImageDim_y;
+  size_t m_DownsampleFactor = 1;
   OverlapPairs m_Overlaps;
+  mutable std::vector<std::unique_ptr<Workspace>> m_FreeWorkspaces;
+  mutable std::mutex m_WorkspaceMutex;
 };
 
 #if SIMPL_ITK_VERSION_CHECK
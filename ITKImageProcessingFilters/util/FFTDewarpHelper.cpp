@@ -32,6 +32,12 @@
 
 #include "FFTDewarpHelper.h"
 
+#include <cmath>
+
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
 // ----------------------------------------------------------------------------
 FFTDewarpHelper::PixelIndex FFTDewarpHelper::pixelIndex(int64_t x, int64_t y)
 {
@@ -97,3 +103,93 @@ int64_t FFTDewarpHelper::py(PixelIndex newIndex, PixelIndex offset, const Parame
 
   return static_cast<int64_t>(std::floor(oldYPrime + offset[1]));
 }
+
+// ----------------------------------------------------------------------------
+void FFTDewarpHelper::getOldIndexRow(int64_t y, int64_t xBegin, int64_t xEnd, PixelIndex offset, const ParametersType& parameters, int64_t* oldX, int64_t* oldY)
+{
+  const double* p = parameters.data_block();
+  const double newYPrime = y - offset[1];
+  const double offsetX = offset[0];
+  const double offsetY = offset[1];
+
+  // The y-only terms are the same for the whole row.  Each term is still summed in the
+  // same order as px and py so that the floored results match exactly.
+  const double xTermY = p[1] * newYPrime;
+  const double xTermYY = p[3] * newYPrime * newYPrime;
+  const double yTermY = p[8] * newYPrime;
+  const double yTermYY = p[10] * newYPrime * newYPrime;
+
+  int64_t x = xBegin;
+  size_t i = 0;
+#ifdef __AVX__
+  const __m256d vYPrime = _mm256_set1_pd(newYPrime);
+  const __m256d vXTermY = _mm256_set1_pd(xTermY);
+  const __m256d vXTermYY = _mm256_set1_pd(xTermYY);
+  const __m256d vYTermY = _mm256_set1_pd(yTermY);
+  const __m256d vYTermYY = _mm256_set1_pd(yTermYY);
+  const __m256d vOffsetX = _mm256_set1_pd(offsetX);
+  const __m256d vOffsetY = _mm256_set1_pd(offsetY);
+  const __m256d vStep = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+
+  alignas(32) double bufX[4];
+  alignas(32) double bufY[4];
+  for(; x + 4 <= xEnd; x += 4, i += 4)
+  {
+    const double firstXPrime = x - offset[0];
+    const __m256d u = _mm256_add_pd(_mm256_set1_pd(firstXPrime), vStep);
+
+    __m256d sx = _mm256_setzero_pd();
+    sx = _mm256_add_pd(sx, _mm256_mul_pd(_mm256_set1_pd(p[0]), u));
+    sx = _mm256_add_pd(sx, vXTermY);
+    sx = _mm256_add_pd(sx, _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(p[2]), u), u));
+    sx = _mm256_add_pd(sx, vXTermYY);
+    sx = _mm256_add_pd(sx, _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(p[4]), u), vYPrime));
+    sx = _mm256_add_pd(sx, _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(p[5]), u), u), vYPrime));
+    sx = _mm256_add_pd(sx, _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(p[6]), u), vYPrime), vYPrime));
+
+    __m256d sy = _mm256_setzero_pd();
+    sy = _mm256_add_pd(sy, _mm256_mul_pd(_mm256_set1_pd(p[7]), u));
+    sy = _mm256_add_pd(sy, vYTermY);
+    sy = _mm256_add_pd(sy, _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(p[9]), u), u));
+    sy = _mm256_add_pd(sy, vYTermYY);
+    sy = _mm256_add_pd(sy, _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(p[11]), u), vYPrime));
+    sy = _mm256_add_pd(sy, _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(p[12]), u), u), vYPrime));
+    sy = _mm256_add_pd(sy, _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(p[13]), u), vYPrime), vYPrime));
+
+    // AVX has no double -> int64 conversion, so only the floor is done in the lanes
+    _mm256_store_pd(bufX, _mm256_floor_pd(_mm256_add_pd(sx, vOffsetX)));
+    _mm256_store_pd(bufY, _mm256_floor_pd(_mm256_add_pd(sy, vOffsetY)));
+    for(size_t lane = 0; lane < 4; lane++)
+    {
+      oldX[i + lane] = static_cast<int64_t>(bufX[lane]);
+      oldY[i + lane] = static_cast<int64_t>(bufY[lane]);
+    }
+  }
+#endif
+
+  for(; x < xEnd; x++, i++)
+  {
+    const double newXPrime = x - offset[0];
+
+    double oldXPrime = 0.0;
+    oldXPrime += p[0] * newXPrime;
+    oldXPrime += xTermY;
+    oldXPrime += p[2] * newXPrime * newXPrime;
+    oldXPrime += xTermYY;
+    oldXPrime += p[4] * newXPrime * newYPrime;
+    oldXPrime += p[5] * newXPrime * newXPrime * newYPrime;
+    oldXPrime += p[6] * newXPrime * newYPrime * newYPrime;
+
+    double oldYPrime = 0.0;
+    oldYPrime += p[7] * newXPrime;
+    oldYPrime += yTermY;
+    oldYPrime += p[9] * newXPrime * newXPrime;
+    oldYPrime += yTermYY;
+    oldYPrime += p[11] * newXPrime * newYPrime;
+    oldYPrime += p[12] * newXPrime * newXPrime * newYPrime;
+    oldYPrime += p[13] * newXPrime * newYPrime * newYPrime;
+
+    oldX[i] = static_cast<int64_t>(std::floor(oldXPrime + offsetX));
+    oldY[i] = static_cast<int64_t>(std::floor(oldYPrime + offsetY));
+  }
+}
@@ -45,6 +45,8 @@
 
 #include <itkSingleValuedCostFunction.h>
 
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
 namespace FFTDewarpHelper
 {
 using PixelIndex = std::array<int64_t, 2>;
@@ -56,9 +58,9 @@ using ParametersType = itk::SingleValuedCostFunction::ParametersType;
  * @param y
  * @return
  */
-PixelIndex pixelIndex(int64_t x, int64_t y);
-PixelIndex pixelIndex(size_t x, size_t y);
-PixelIndex pixelIndex(double x, double y);
+ITKImageProcessing_EXPORT PixelIndex pixelIndex(int64_t x, int64_t y);
+ITKImageProcessing_EXPORT PixelIndex pixelIndex(size_t x, size_t y);
+ITKImageProcessing_EXPORT PixelIndex pixelIndex(double x, double y);
 
 /**
  * @brief Returns the number of parameters for either X or Y
@@ -82,9 +84,26 @@ constexpr uint32_t getReqParameterSize()
  * @brief Returns the old pixel index from which to extract the value for the given parameters.
  * @param
  */
-PixelIndex getOldIndex(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
-int64_t px(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
-int64_t py(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
+ITKImageProcessing_EXPORT PixelIndex getOldIndex(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
+ITKImageProcessing_EXPORT int64_t px(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
+ITKImageProcessing_EXPORT int64_t py(PixelIndex newIndex, PixelIndex offset, const ParametersType& parameters);
+
+/**
+ * @brief Calculates the old X and Y indices for the contiguous run of pixels [xBegin, xEnd)
+ * in row y and writes them to oldX and oldY, which must hold at least xEnd - xBegin values.
+ * Terms that only depend on y are evaluated once per row and the remaining terms are
+ * evaluated four pixels at a time when the plugin is built with ITKImageProcessing_ENABLE_AVX.
+ * The results are identical
+ * to calling px and py for each pixel in the row.
+ * @param y
+ * @param xBegin
+ * @param xEnd
+ * @param offset
+ * @param parameters
+ * @param oldX
+ * @param oldY
+ */
+ITKImageProcessing_EXPORT void getOldIndexRow(int64_t y, int64_t xBegin, int64_t xEnd, PixelIndex offset, const ParametersType& parameters, int64_t* oldX, int64_t* oldY);
 } // namespace FFTDewarpHelper
 
 #if SIMPL_ITK_VERSION_CHECK
@@ -32,12 +32,122 @@
 
 #include "MontageImportHelper.h"
 
+#include <algorithm>
+#include <thread>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include <tbb/task_group.h>
+#endif
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QObject>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
 
+#include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 
+#include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/MetaXmlUtils.h"
 
+namespace
+{
+const QString k_TempDCName("TileImport");
+
+const int k_TileHeaderIndexVersion = 1;
+const QString k_IndexVersionKey("Version");
+const QString k_IndexTilesKey("Tiles");
+const QString k_IndexSizeKey("Size");
+const QString k_IndexModifiedKey("Modified");
+const QString k_IndexDimsKey("Dims");
+const QString k_IndexTypeKey("Type");
+const QString k_IndexComponentDimsKey("ComponentDims");
+
+/**
+ * @brief Creates an unallocated DataArray of the type named by typeName, as returned by
+ * IDataArray::getTypeAsString().
+ */
+IDataArray::Pointer CreateProxyArray(const QString& typeName, size_t numTuples, const std::vector<size_t>& cDims, const QString& name)
+{
+  if(typeName == "int8_t")
+  {
+    return Int8ArrayType::CreateArray(numTuples, cDims, name, false);
+  }
+  if(typeName == "uint8_t")
+  {
+    return UInt8ArrayType::CreateArray(numTuples, cDims, name, false);
+  }
+  if(typeName == "int16_t")
+  {
+    return Int16ArrayType::CreateArray(numTuples, cDims, name, false);
+  }
+  if(typeName == "uint16_t")
+  {
+    return UInt16ArrayType::CreateArray(numTuples, cDims, name, false);
+  }
+  if(typeName == "int32_t")
+  {
+    return Int32ArrayType::CreateArray(numTuples, cDims, name, false);
+  }
+  if(typeName == "uint32_t")
+  {
+    return UInt32ArrayType::CreateArray(numTuples, cDims, name, false);
+  }
+  if(typeName == "int64_t")
+  {
+    return Int64ArrayType::CreateArray(numTuples, cDims, name, false);
+  }
+  if(typeName == "uint64_t")
+  {
+    return UInt64ArrayType::CreateArray(numTuples, cDims, name, false);
+  }
+  if(typeName == "float")
+  {
+    return FloatArrayType::CreateArray(numTuples, cDims, name, false);
+  }
+  if(typeName == "double")
+  {
+    return DoubleArrayType::CreateArray(numTuples, cDims, name, false);
+  }
+  return IDataArray::Pointer();
+}
+
+// -----------------------------------------------------------------------------
+QJsonArray ToJsonArray(const std::vector<size_t>& values)
+{
+  QJsonArray array;
+  for(const auto& value : values)
+  {
+    array.append(static_cast<double>(value));
+  }
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<size_t> FromJsonArray(const QJsonArray& array)
+{
+  std::vector<size_t> values;
+  values.reserve(static_cast<size_t>(array.size()));
+  for(const auto& value : array)
+  {
+    values.push_back(static_cast<size_t>(value.toDouble()));
+  }
+  return values;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -56,7 +166,10 @@ ITKImageReader::Pointer MontageImportHelper::CreateImageImportFilter(AbstractFil
   ITKImageReader::Pointer imageReader = ITKImageReader::New();
 
   // Connect up the Error/Warning/Progress object so the filter can report those things
-  QObject::connect(imageReader.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), filter, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)));
+  if(nullptr != filter)
+  {
+    QObject::connect(imageReader.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), filter, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)));
+  }
   DataContainerArrayShPtr dca = DataContainerArray::New();
 
   imageReader->setDataContainerArray(dca); // AbstractFilter implements this so no problem
@@ -77,9 +190,11 @@ ConvertColorToGrayScale::Pointer MontageImportHelper::CreateColorToGrayScaleFilt
   ConvertColorToGrayScale::Pointer rgbToGray = ConvertColorToGrayScale::New();
 
   // Connect up the Error/Warning/Progress object so the filter can report those things
-  QObject::connect(rgbToGray.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), filter, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)));
-
-  rgbToGray->setDataContainerArray(filter->getDataContainerArray());
+  if(nullptr != filter)
+  {
+    QObject::connect(rgbToGray.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), filter, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)));
+    rgbToGray->setDataContainerArray(filter->getDataContainerArray());
+  }
   rgbToGray->setConversionAlgorithm(0);
   rgbToGray->setColorWeights(colorWeights);
   std::vector<DataArrayPath> inputDataArrayVector = {daPath};
@@ -91,6 +206,416 @@ ConvertColorToGrayScale::Pointer MontageImportHelper::CreateColorToGrayScaleFilt
   return rgbToGray;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t MontageImportHelper::EstimateTileBytes(const SizeVec3Type& dims, const IDataArray::Pointer& imageDataProxy, bool convertToGrayScale)
+{
+  size_t numPixels = dims[0] * dims[1] * dims[2];
+  size_t pixelBytes = 1;
+  if(nullptr != imageDataProxy)
+  {
+    pixelBytes = imageDataProxy->getNumberOfComponents() * static_cast<size_t>(imageDataProxy->getTypeSize());
+  }
+  // The proxy already describes the gray scale result, so add room for the color image it is made from
+  if(convertToGrayScale)
+  {
+    pixelBytes *= 4;
+  }
+  return numPixels * pixelBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MontageImportHelper::ReadTiles(AbstractFilter* filter, const std::vector<TileImportInfo>& tiles, const QString& imageDataArrayName, bool convertToGrayScale,
+                                    const FloatVec3Type& colorWeights, int32_t maxWorkers, size_t memoryLimit)
+{
+  if(maxWorkers <= 0)
+  {
+    maxWorkers = static_cast<int32_t>(std::thread::hardware_concurrency()); // Returns ZERO if not defined on this platform
+  }
+#ifndef SIMPL_USE_PARALLEL_ALGORITHMS
+  maxWorkers = 1;
+#endif
+  maxWorkers = std::max(maxWorkers, 1);
+
+  std::vector<TileImportResult> results(tiles.size());
+
+  // Move the decoded data into the montage from this thread so the DataContainerArray is
+  // only modified in one place and errors are reported in tile order
+  auto placeTile = [&](size_t i) {
+    TileImportResult& result = results[i];
+    filter->notifyStatusMessage(QString("Imported %1").arg(tiles[i].FileName));
+    if(result.ErrorCode < 0)
+    {
+      filter->setErrorCondition(result.ErrorCode, result.ErrorMessage);
+      return;
+    }
+    tiles[i].CellAttributeMatrix->addOrReplaceAttributeArray(result.ImageData);
+    result.ImageData.reset();
+  };
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  // The tiles are decoded on dedicated threads instead of TBB tasks. This thread waits on them, and
+  // that must not depend on TBB having a free worker (a single core, a global_control limit of 1 or
+  // ReadTiles being called from inside a TBB task would otherwise leave the queued tiles unstarted).
+  std::mutex mutex;
+  std::condition_variable tileFinished;
+  std::condition_variable budgetFreed;
+  std::vector<bool> finished(tiles.size(), false);
+  size_t nextTile = 0;
+  int32_t running = 0;
+  size_t runningBytes = 0;
+  bool stop = false;
+
+  auto decodeTiles = [&]() {
+    while(true)
+    {
+      // Tiles are claimed in order. The next tile starts as soon as enough of the memory budget is
+      // free, and always when nothing else is being decoded so that a single tile larger than
+      // memoryLimit can still be read.
+      size_t i = 0;
+      size_t bytes = 0;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        budgetFreed.wait(lock, [&] { return stop || nextTile >= tiles.size() || running == 0 || runningBytes + tiles[nextTile].EstimatedBytes <= memoryLimit; });
+        if(stop || nextTile >= tiles.size())
+        {
+          return;
+        }
+        i = nextTile++;
+        bytes = tiles[i].EstimatedBytes;
+        running++;
+        runningBytes += bytes;
+      }
+
+      TileImportResult result;
+      try
+      {
+        result = ReadTile(tiles[i].FileName, imageDataArrayName, convertToGrayScale, colorWeights);
+      } catch(std::exception& err)
+      {
+        result.ErrorCode = -2011;
+        result.ErrorMessage = QString("Error reading '%1': %2").arg(tiles[i].FileName).arg(err.what());
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        results[i] = std::move(result);
+        finished[i] = true;
+        running--;
+        runningBytes -= bytes;
+      }
+      budgetFreed.notify_all();
+      tileFinished.notify_one();
+    }
+  };
+
+  const size_t numWorkers = std::min(static_cast<size_t>(maxWorkers), tiles.size());
+  std::vector<std::thread> workers;
+  workers.reserve(numWorkers);
+  for(size_t w = 0; w < numWorkers; w++)
+  {
+    workers.emplace_back(decodeTiles);
+  }
+
+  for(size_t nextToPlace = 0; nextToPlace < tiles.size();)
+  {
+    bool ready = false;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      ready = tileFinished.wait_for(lock, std::chrono::milliseconds(100), [&] { return finished[nextToPlace]; });
+    }
+    if(ready)
+    {
+      placeTile(nextToPlace);
+      nextToPlace++;
+    }
+    else if(filter->getCancel())
+    {
+      // Tiles that are already being decoded finish, no new ones are started
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+      }
+      budgetFreed.notify_all();
+      break;
+    }
+  }
+
+  for(auto& worker : workers)
+  {
+    worker.join();
+  }
+#else
+  for(size_t i = 0; i < tiles.size() && !filter->getCancel(); i++)
+  {
+    results[i] = ReadTile(tiles[i].FileName, imageDataArrayName, convertToGrayScale, colorWeights);
+    placeTile(i);
+  }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MontageImportHelper::TileImportResult MontageImportHelper::ReadTile(const QString& fileName, const QString& imageDataArrayName, bool convertToGrayScale, const FloatVec3Type& colorWeights)
+{
+  TileImportResult result;
+
+  // The sub filters run on worker threads, so they are not connected to the calling filter.
+  // Their errors are returned instead and reported by ReadTiles.
+  DataArrayPath dap(::k_TempDCName, ITKImageProcessing::Montage::k_AMName, imageDataArrayName);
+  ITKImageReader::Pointer imageImportFilter = CreateImageImportFilter(nullptr, fileName, dap);
+  imageImportFilter->execute();
+  if(imageImportFilter->getErrorCode() < 0)
+  {
+    result.ErrorCode = imageImportFilter->getErrorCode();
+    result.ErrorMessage = QString("Error Executing Image Import Filter on '%1'.").arg(fileName);
+    return result;
+  }
+
+  DataContainerArray::Pointer importImageDca = imageImportFilter->getDataContainerArray();
+  AttributeMatrix::Pointer fromCellAttrMat = importImageDca->getDataContainer(::k_TempDCName)->getAttributeMatrix(ITKImageProcessing::Montage::k_AMName);
+
+  if(convertToGrayScale)
+  {
+    ConvertColorToGrayScale::Pointer grayScaleFilter = CreateColorToGrayScaleFilter(nullptr, dap, colorWeights, ITKImageProcessing::Montage::k_GrayScaleTempArrayName);
+    grayScaleFilter->setDataContainerArray(importImageDca); // Use the Data Container array that was used for the import. It is setup and ready to go
+    grayScaleFilter->execute();
+    if(grayScaleFilter->getErrorCode() < 0)
+    {
+      result.ErrorCode = grayScaleFilter->getErrorCode();
+      result.ErrorMessage = QString("Error Executing Color to GrayScale filter on '%1'.").arg(fileName);
+      return result;
+    }
+
+    QString grayScaleArrayName = ITKImageProcessing::Montage::k_GrayScaleTempArrayName + imageDataArrayName;
+    result.ImageData = fromCellAttrMat->removeAttributeArray(grayScaleArrayName);
+    result.ImageData->setName(imageDataArrayName);
+  }
+  else
+  {
+    // Take the IDataArray (which contains the image data) out of the temp data container array
+    result.ImageData = fromCellAttrMat->removeAttributeArray(imageDataArrayName);
+  }
+
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString MontageImportHelper::TileHeaderIndexFilePath(const QString& configFile)
+{
+  // The index lives in the user's cache directory, named after the absolute path of the
+  // configuration file, so that preflight never writes into the data set's folder
+  QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  if(cacheDir.isEmpty())
+  {
+    cacheDir = QDir::tempPath();
+  }
+  QByteArray configPath = QFileInfo(configFile).absoluteFilePath().toUtf8();
+  QString indexName = QCryptographicHash::hash(configPath, QCryptographicHash::Sha1).toHex();
+  return cacheDir + "/TileHeaderIndex/" + indexName + ".json";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<MontageImportHelper::TileHeader> MontageImportHelper::ReadTileHeaders(AbstractFilter* filter, const QString& configFile, const std::vector<QString>& fileNames,
+                                                                                  const QString& imageDataArrayName, bool convertToGrayScale, const FloatVec3Type& colorWeights)
+{
+  // Tiles are keyed relative to the configuration file
+  QDir configDir = QFileInfo(configFile).absoluteDir();
+  QString indexFilePath = TileHeaderIndexFilePath(configFile);
+
+  QJsonObject tileIndex;
+  {
+    QFile indexFile(indexFilePath);
+    if(indexFile.open(QIODevice::ReadOnly))
+    {
+      QJsonObject root = QJsonDocument::fromJson(indexFile.readAll()).object();
+      if(root.value(k_IndexVersionKey).toInt() == k_TileHeaderIndexVersion)
+      {
+        tileIndex = root.value(k_IndexTilesKey).toObject();
+      }
+    }
+  }
+
+  std::vector<TileHeaderProbe> probes(fileNames.size());
+  std::vector<QString> keys(fileNames.size());
+  std::vector<QFileInfo> fileInfos(fileNames.size());
+  std::vector<size_t> misses;
+  for(size_t i = 0; i < fileNames.size(); i++)
+  {
+    fileInfos[i] = QFileInfo(fileNames[i]);
+    keys[i] = configDir.relativeFilePath(fileInfos[i].absoluteFilePath());
+
+    QJsonObject entry = tileIndex.value(keys[i]).toObject();
+    bool upToDate = fileInfos[i].exists() && !entry.isEmpty();
+    upToDate = upToDate && entry.value(k_IndexSizeKey).toDouble() == static_cast<double>(fileInfos[i].size());
+    upToDate = upToDate && entry.value(k_IndexModifiedKey).toDouble() == static_cast<double>(fileInfos[i].lastModified().toMSecsSinceEpoch());
+    std::vector<size_t> dims = FromJsonArray(entry.value(k_IndexDimsKey).toArray());
+    if(!upToDate || dims.size() != 3)
+    {
+      misses.push_back(i);
+      continue;
+    }
+    probes[i].Dims = SizeVec3Type(dims[0], dims[1], dims[2]);
+    probes[i].TypeName = entry.value(k_IndexTypeKey).toString();
+    probes[i].ComponentDims = FromJsonArray(entry.value(k_IndexComponentDimsKey).toArray());
+  }
+
+  if(!misses.empty())
+  {
+    filter->notifyStatusMessage(QString("Reading the headers of %1 of %2 tiles").arg(misses.size()).arg(fileNames.size()));
+  }
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_group g;
+  for(const auto& i : misses)
+  {
+    g.run([&probes, &fileNames, i] { probes[i] = ProbeTileHeader(fileNames[i]); });
+  }
+  g.wait();
+#else
+  for(const auto& i : misses)
+  {
+    probes[i] = ProbeTileHeader(fileNames[i]);
+  }
+#endif
+
+  bool indexChanged = false;
+  for(const auto& i : misses)
+  {
+    const TileHeaderProbe& probe = probes[i];
+    if(probe.ErrorCode < 0)
+    {
+      continue;
+    }
+    QJsonObject entry;
+    entry[k_IndexSizeKey] = static_cast<double>(fileInfos[i].size());
+    entry[k_IndexModifiedKey] = static_cast<double>(fileInfos[i].lastModified().toMSecsSinceEpoch());
+    entry[k_IndexDimsKey] = ToJsonArray(probe.Dims.toContainer<std::vector<size_t>>());
+    entry[k_IndexTypeKey] = probe.TypeName;
+    entry[k_IndexComponentDimsKey] = ToJsonArray(probe.ComponentDims);
+    tileIndex[keys[i]] = entry;
+    indexChanged = true;
+  }
+
+  // The index is only an optimization, so a location that can not be written is not an error
+  if(indexChanged && QDir().mkpath(QFileInfo(indexFilePath).absolutePath()))
+  {
+    QJsonObject root;
+    root[k_IndexVersionKey] = k_TileHeaderIndexVersion;
+    root[k_IndexTilesKey] = tileIndex;
+    QSaveFile indexFile(indexFilePath);
+    if(indexFile.open(QIODevice::WriteOnly))
+    {
+      indexFile.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+      indexFile.commit();
+    }
+  }
+
+  std::vector<TileHeader> headers(fileNames.size());
+  for(size_t i = 0; i < fileNames.size(); i++)
+  {
+    const TileHeaderProbe& probe = probes[i];
+    if(probe.ErrorCode < 0)
+    {
+      filter->setErrorCondition(probe.ErrorCode, probe.ErrorMessage);
+      continue;
+    }
+    TileImportResult proxy = CreateImageDataProxy(probe, imageDataArrayName, convertToGrayScale, colorWeights);
+    if(proxy.ErrorCode < 0)
+    {
+      filter->setErrorCondition(proxy.ErrorCode, proxy.ErrorMessage);
+      continue;
+    }
+    headers[i].Dims = probe.Dims;
+    headers[i].ImageDataProxy = proxy.ImageData;
+  }
+  return headers;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MontageImportHelper::TileHeaderProbe MontageImportHelper::ProbeTileHeader(const QString& fileName)
+{
+  TileHeaderProbe probe;
+
+  // Runs on worker threads, so the reader is not connected to any filter
+  DataArrayPath dap(::k_TempDCName, ITKImageProcessing::Montage::k_AMName, ITKImageProcessing::Montage::k_AAName);
+  ITKImageReader::Pointer imageImportFilter = CreateImageImportFilter(nullptr, fileName, dap);
+  imageImportFilter->preflight();
+  if(imageImportFilter->getErrorCode() < 0)
+  {
+    probe.ErrorCode = imageImportFilter->getErrorCode();
+    probe.ErrorMessage = QString("Error Preflighting Image Import Filter on '%1'.").arg(fileName);
+    return probe;
+  }
+
+  DataContainer::Pointer fromDc = imageImportFilter->getDataContainerArray()->getDataContainer(::k_TempDCName);
+  IDataArray::Pointer fromImageData = fromDc->getAttributeMatrix(ITKImageProcessing::Montage::k_AMName)->getAttributeArray(ITKImageProcessing::Montage::k_AAName);
+  probe.Dims = fromDc->getGeometryAs<ImageGeom>()->getDimensions();
+  probe.TypeName = fromImageData->getTypeAsString();
+  probe.ComponentDims = fromImageData->getComponentDimensions();
+  return probe;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MontageImportHelper::TileImportResult MontageImportHelper::CreateImageDataProxy(const TileHeaderProbe& probe, const QString& imageDataArrayName, bool convertToGrayScale,
+                                                                                const FloatVec3Type& colorWeights)
+{
+  TileImportResult result;
+
+  size_t numTuples = probe.Dims[0] * probe.Dims[1] * probe.Dims[2];
+  IDataArray::Pointer proxy = CreateProxyArray(probe.TypeName, numTuples, probe.ComponentDims, ITKImageProcessing::Montage::k_AAName);
+  if(nullptr == proxy)
+  {
+    result.ErrorCode = -2010;
+    result.ErrorMessage = QString("The tile image data type '%1' is not supported.").arg(probe.TypeName);
+    return result;
+  }
+  if(!convertToGrayScale)
+  {
+    proxy->setName(imageDataArrayName);
+    result.ImageData = proxy;
+    return result;
+  }
+
+  // Rebuild what the image reader would have created so that the gray scale filter can preflight on it
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New(::k_TempDCName);
+  ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  imageGeom->setDimensions(probe.Dims);
+  dc->setGeometry(imageGeom);
+  AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(probe.Dims.toContainer<std::vector<size_t>>(), ITKImageProcessing::Montage::k_AMName, AttributeMatrix::Type::Cell);
+  cellAttrMat->addOrReplaceAttributeArray(proxy);
+  dc->insertOrAssign(cellAttrMat);
+  dca->insertOrAssign(dc);
+
+  DataArrayPath daPath(::k_TempDCName, ITKImageProcessing::Montage::k_AMName, ITKImageProcessing::Montage::k_AAName);
+  ConvertColorToGrayScale::Pointer grayScaleFilter = CreateColorToGrayScaleFilter(nullptr, daPath, colorWeights, ITKImageProcessing::Montage::k_GrayScaleTempArrayName);
+  grayScaleFilter->setDataContainerArray(dca);
+  grayScaleFilter->preflight();
+  if(grayScaleFilter->getErrorCode() < 0)
+  {
+    result.ErrorCode = grayScaleFilter->getErrorCode();
+    result.ErrorMessage = "Error Preflighting Color to GrayScale filter";
+    return result;
+  }
+
+  QString grayScaleArrayName = ITKImageProcessing::Montage::k_GrayScaleTempArrayName + ITKImageProcessing::Montage::k_AAName;
+  result.ImageData = cellAttrMat->removeAttributeArray(grayScaleArrayName);
+  result.ImageData->setName(imageDataArrayName);
+  return result;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
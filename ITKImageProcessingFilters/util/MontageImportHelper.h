@@ -31,7 +31,10 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <vector>
+
 #include "SIMPLib/CoreFilters/ConvertColorToGrayScale.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageReader.h"
 #include "ITKImageProcessing/ITKImageProcessingPlugin.h"
@@ -40,9 +43,37 @@ class ITKImageProcessing_EXPORT MontageImportHelper
 {
 
 public:
+  /**
+   * @brief The TileImportInfo struct describes one tile to read with ReadTiles: the image
+   * file, the AttributeMatrix that receives its data, and an estimate of the memory needed
+   * to decode it.
+   */
+  struct TileImportInfo
+  {
+    QString FileName;
+    AttributeMatrix::Pointer CellAttributeMatrix;
+    size_t EstimatedBytes = 0;
+  };
+
+  /**
+   * @brief The TileHeader struct describes the image data of one tile file without its pixels.
+   * ImageDataProxy is an unallocated array with the tile's type, component dimensions and
+   * tuple count, or nullptr if the tile could not be read.
+   */
+  struct TileHeader
+  {
+    SizeVec3Type Dims = {0, 0, 0};
+    IDataArray::Pointer ImageDataProxy;
+  };
+
+  /**
+   * @brief Default limit on the estimated memory held by tiles that are being decoded at once.
+   */
+  static constexpr size_t k_DefaultTileMemoryLimit = 2048ULL * 1024ULL * 1024ULL;
+
   /**
    * @brief CreateImageImportFilter
-   * @param filter
+   * @param filter The filter to forward messages to or nullptr to not forward them
    * @param imageFileName
    * @param daPath
    * @return
@@ -50,8 +81,63 @@ public:
   static ITKImageReader::Pointer CreateImageImportFilter(AbstractFilter* filter, const QString& imageFileName, const DataArrayPath& daPath);
 
   /**
-   * @brief CreateColorToGrayScaleFilter
+   * @brief Returns an estimate of the memory needed to decode a tile whose image data looks
+   * like the given proxy array.
+   * @param dims
+   * @param imageDataProxy
+   * @param convertToGrayScale
+   * @return
+   */
+  static size_t EstimateTileBytes(const SizeVec3Type& dims, const IDataArray::Pointer& imageDataProxy, bool convertToGrayScale);
+
+  /**
+   * @brief Reads every tile into its AttributeMatrix, as imageDataArrayName, decoding several
+   * tiles at once on threads owned by this call, so it does not depend on free TBB workers.  A new tile starts as soon as one finishes, as long as at most maxWorkers
+   * tiles (0 uses the number of cores) and at most memoryLimit estimated bytes are being
+   * decoded.  Decoded arrays are placed and any errors are reported in the order of the tiles.
+   *
+   * The importers do not expose maxWorkers or memoryLimit as filter parameters.  Both only bound
+   * the temporary memory of tiles that are being decoded, not the size of the imported montage,
+   * and their best values depend on the machine rather than the data, so storing them in a
+   * pipeline file would carry one machine's settings to another.
+   * @param filter
+   * @param tiles
+   * @param imageDataArrayName
+   * @param convertToGrayScale
+   * @param colorWeights
+   * @param maxWorkers
+   * @param memoryLimit
+   */
+  static void ReadTiles(AbstractFilter* filter, const std::vector<TileImportInfo>& tiles, const QString& imageDataArrayName, bool convertToGrayScale, const FloatVec3Type& colorWeights,
+                        int32_t maxWorkers = 0, size_t memoryLimit = k_DefaultTileMemoryLimit);
+  /**
+   * @brief Returns the dimensions and image data proxy of every tile file. The headers are kept
+   * in an index in the user's cache directory (see TileHeaderIndexFilePath), keyed on each
+   * tile's path, size and modification time. Only tiles that are missing from the
+   * index or have changed are opened, and those are probed in parallel. Errors are reported on
+   * the filter in tile order and leave the ImageDataProxy of that tile empty.
    * @param filter
+   * @param configFile
+   * @param fileNames
+   * @param imageDataArrayName
+   * @param convertToGrayScale
+   * @param colorWeights
+   * @return
+   */
+  static std::vector<TileHeader> ReadTileHeaders(AbstractFilter* filter, const QString& configFile, const std::vector<QString>& fileNames, const QString& imageDataArrayName,
+                                                 bool convertToGrayScale, const FloatVec3Type& colorWeights);
+
+  /**
+   * @brief Returns the path of the tile header index that belongs to a montage configuration file.
+   * The index is kept in the user's cache directory, never next to the data.
+   * @param configFile
+   * @return
+   */
+  static QString TileHeaderIndexFilePath(const QString& configFile);
+
+  /**
+   * @brief CreateColorToGrayScaleFilter
+   * @param filter The filter to forward messages to or nullptr to not forward them
    * @param daPath
    * @param colorWeights
    * @param outputArrayName
@@ -91,6 +177,58 @@ protected:
   MontageImportHelper();
   ~MontageImportHelper();
 
+  /**
+   * @brief The TileImportResult struct holds the decoded image data for one tile or the
+   * error that stopped it from being read.
+   */
+  struct TileImportResult
+  {
+    IDataArray::Pointer ImageData;
+    int32_t ErrorCode = 0;
+    QString ErrorMessage;
+  };
+
+  /**
+   * @brief Reads a single image file into its own DataContainerArray and returns its image data.
+   * @param fileName
+   * @param imageDataArrayName
+   * @param convertToGrayScale
+   * @param colorWeights
+   * @return
+   */
+  static TileImportResult ReadTile(const QString& fileName, const QString& imageDataArrayName, bool convertToGrayScale, const FloatVec3Type& colorWeights);
+
+  /**
+   * @brief The TileHeaderProbe struct holds the header of one tile file as it is stored in the
+   * tile header index, before any gray scale conversion.
+   */
+  struct TileHeaderProbe
+  {
+    SizeVec3Type Dims = {0, 0, 0};
+    QString TypeName;
+    std::vector<size_t> ComponentDims;
+    int32_t ErrorCode = 0;
+    QString ErrorMessage;
+  };
+
+  /**
+   * @brief Preflights an image reader on a single file to learn its header.
+   * @param fileName
+   * @return
+   */
+  static TileHeaderProbe ProbeTileHeader(const QString& fileName);
+
+  /**
+   * @brief Creates the image data proxy that an image reader, and optionally the color to gray
+   * scale conversion, would produce for a tile with the given header.
+   * @param probe
+   * @param imageDataArrayName
+   * @param convertToGrayScale
+   * @param colorWeights
+   * @return
+   */
+  static TileImportResult CreateImageDataProxy(const TileHeaderProbe& probe, const QString& imageDataArrayName, bool convertToGrayScale, const FloatVec3Type& colorWeights);
+
 public:
   MontageImportHelper(const MontageImportHelper&) = delete;            // Copy Constructor Not Implemented
   MontageImportHelper(MontageImportHelper&&) = delete;                 // Move Constructor Not Implemented
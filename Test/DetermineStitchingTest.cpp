@@ -0,0 +1,220 @@
+#pragma once
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/DetermineStitching.h"
+#include "ITKImageProcessing/Test/ITKImageProcessingTestFileLocations.h"
+#include "ITKImageProcessing/Test/UnitTestSupport.hpp"
+
+class DetermineStitchingTest
+{
+public:
+  DetermineStitchingTest() = default;
+  ~DetermineStitchingTest() = default;
+  DetermineStitchingTest(const DetermineStitchingTest&) = delete;            // Copy Constructor
+  DetermineStitchingTest(DetermineStitchingTest&&) = delete;                 // Move Constructor
+  DetermineStitchingTest& operator=(const DetermineStitchingTest&) = delete; // Copy Assignment
+  DetermineStitchingTest& operator=(DetermineStitchingTest&&) = delete;      // Move Assignment
+
+  using PairwiseOffset = DetermineStitching::PairwiseOffset;
+
+  static constexpr size_t k_Cols = 3;
+  static constexpr size_t k_Rows = 3;
+  static constexpr float k_Tolerance = 1.0e-3f;
+
+  // -----------------------------------------------------------------------------
+  static PairwiseOffset makePair(size_t first, size_t second, bool fromLeft, float x, float y, float weight)
+  {
+    PairwiseOffset pair(first, second, fromLeft);
+    pair.x = x;
+    pair.y = y;
+    pair.weight = weight;
+    return pair;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Tile positions on a 3x3 grid stepped by roughly 90 pixels, with a few pixels of
+   * stage error so the solution is not a regular grid. Tile 0 sits at the origin.
+   */
+  static std::vector<std::array<float, 2>> gridPositions()
+  {
+    std::vector<std::array<float, 2>> positions(k_Cols * k_Rows);
+    for(size_t i = 0; i < positions.size(); i++)
+    {
+      const size_t col = i % k_Cols;
+      const size_t row = i / k_Cols;
+      positions[i] = {90.0f * col + static_cast<float>(i % 4), 88.0f * row - static_cast<float>(i % 3)};
+    }
+    return positions;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Builds the left and top pairs of the grid from the given positions, in the same order
+   * as DetermineStitching::FindGlobalOrigins
+   */
+  static std::vector<PairwiseOffset> gridPairs(const std::vector<std::array<float, 2>>& positions, float weight)
+  {
+    std::vector<PairwiseOffset> pairs;
+    for(size_t i = 1; i < positions.size(); i++)
+    {
+      if(i % k_Cols != 0)
+      {
+        pairs.push_back(makePair(i - 1, i, true, positions[i][0] - positions[i - 1][0], positions[i][1] - positions[i - 1][1], weight));
+      }
+      if(i >= k_Cols)
+      {
+        pairs.push_back(makePair(i - k_Cols, i, false, positions[i][0] - positions[i - k_Cols][0], positions[i][1] - positions[i - k_Cols][1], weight));
+      }
+    }
+    return pairs;
+  }
+
+  // -----------------------------------------------------------------------------
+  void requireOrigin(const std::vector<float>& origins, size_t tile, float x, float y)
+  {
+    DREAM3D_REQUIRED(std::abs(origins[2 * tile] - x), <=, k_Tolerance)
+    DREAM3D_REQUIRED(std::abs(origins[2 * tile + 1] - y), <=, k_Tolerance)
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestExactSolve()
+  {
+    const std::vector<std::array<float, 2>> positions = gridPositions();
+
+    // Consistent offsets are reproduced exactly, whatever the weights are
+    for(float weight : {1.0f, 0.25f})
+    {
+      std::vector<PairwiseOffset> pairs = gridPairs(positions, weight);
+      std::vector<float> origins = DetermineStitching::SolveGlobalOrigins(positions.size(), pairs);
+      DREAM3D_REQUIRE_EQUAL(origins.size(), 2 * positions.size())
+      for(size_t i = 0; i < positions.size(); i++)
+      {
+        requireOrigin(origins, i, positions[i][0], positions[i][1]);
+      }
+    }
+
+    // Unequal weights do not matter either when every pair agrees
+    std::vector<PairwiseOffset> pairs = gridPairs(positions, 1.0f);
+    for(size_t e = 0; e < pairs.size(); e++)
+    {
+      pairs[e].weight = 0.1f + 0.2f * static_cast<float>(e % 5);
+    }
+    std::vector<float> origins = DetermineStitching::SolveGlobalOrigins(positions.size(), pairs);
+    for(size_t i = 0; i < positions.size(); i++)
+    {
+      requireOrigin(origins, i, positions[i][0], positions[i][1]);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestWeightedDisagreement()
+  {
+    // Three tiles where the direct measurement 0 -> 2 disagrees with the path 0 -> 1 -> 2.
+    // Minimizing (p1 - 10)^2 + (p2 - p1 - 10)^2 + 2 (p2 - 26)^2 gives p1 = 12.4 and p2 = 24.8.
+    // Along y the same pairs carry -5, -5 and -13, which gives p1 = -6.2 and p2 = -12.4.
+    std::vector<PairwiseOffset> pairs;
+    pairs.push_back(makePair(0, 1, true, 10.0f, -5.0f, 1.0f));
+    pairs.push_back(makePair(1, 2, true, 10.0f, -5.0f, 1.0f));
+    pairs.push_back(makePair(0, 2, false, 26.0f, -13.0f, 2.0f));
+    std::vector<float> origins = DetermineStitching::SolveGlobalOrigins(3, pairs);
+    requireOrigin(origins, 0, 0.0f, 0.0f);
+    requireOrigin(origins, 1, 12.4f, -6.2f);
+    requireOrigin(origins, 2, 24.8f, -12.4f);
+
+    // A heavily weighted pair wins over a weak one measuring the same tiles
+    pairs.clear();
+    pairs.push_back(makePair(0, 1, true, 100.0f, 2.0f, 0.9f));
+    pairs.push_back(makePair(0, 1, true, 110.0f, 12.0f, 0.1f));
+    origins = DetermineStitching::SolveGlobalOrigins(2, pairs);
+    requireOrigin(origins, 1, 101.0f, 3.0f);
+
+    // A failed correlation with no weight still places the tile it connects
+    pairs.clear();
+    pairs.push_back(makePair(0, 1, true, 50.0f, 1.0f, 1.0f));
+    pairs.push_back(makePair(1, 2, true, 48.0f, -2.0f, 0.0f));
+    origins = DetermineStitching::SolveGlobalOrigins(3, pairs);
+    requireOrigin(origins, 1, 50.0f, 1.0f);
+    requireOrigin(origins, 2, 98.0f, -1.0f);
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestFixedFirstTile()
+  {
+    // The offsets only fix the positions up to a common shift; tile 0 removes that freedom
+    const std::vector<std::array<float, 2>> positions = gridPositions();
+    std::vector<std::array<float, 2>> shifted = positions;
+    for(auto& position : shifted)
+    {
+      position[0] += 37.0f;
+      position[1] -= 21.0f;
+    }
+    std::vector<float> origins = DetermineStitching::SolveGlobalOrigins(shifted.size(), gridPairs(shifted, 1.0f));
+    DREAM3D_REQUIRE_EQUAL(origins[0], 0.0f)
+    DREAM3D_REQUIRE_EQUAL(origins[1], 0.0f)
+    for(size_t i = 1; i < positions.size(); i++)
+    {
+      requireOrigin(origins, i, positions[i][0], positions[i][1]);
+    }
+
+    // Disagreeing pairs that involve tile 0 move the other tiles, never tile 0
+    std::vector<PairwiseOffset> pairs = gridPairs(positions, 1.0f);
+    pairs[0].x += 6.0f;
+    pairs[1].y -= 4.0f;
+    origins = DetermineStitching::SolveGlobalOrigins(positions.size(), pairs);
+    DREAM3D_REQUIRE_EQUAL(origins[0], 0.0f)
+    DREAM3D_REQUIRE_EQUAL(origins[1], 0.0f)
+
+    // A single tile is left at the origin
+    origins = DetermineStitching::SolveGlobalOrigins(1, {});
+    DREAM3D_REQUIRE_EQUAL(origins.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(origins[0], 0.0f)
+    DREAM3D_REQUIRE_EQUAL(origins[1], 0.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- DetermineStitchingTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestExactSolve())
+    DREAM3D_REGISTER_TEST(TestWeightedDisagreement())
+    DREAM3D_REGISTER_TEST(TestFixedFirstTile())
+  }
+};
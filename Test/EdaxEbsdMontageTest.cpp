@@ -61,6 +61,7 @@
 #include "ITKImageProcessing/ITKImageProcessingFilters/CalcDewarpParameters.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageReader.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/util/FFTConvolutionCostFunction.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/FFTDewarpHelper.h"
 #include "ITKImageProcessing/Test/ITKImageProcessingTestFileLocations.h"
 #include "ITKImageProcessing/Test/UnitTestSupport.hpp"
 
@@ -155,6 +156,12 @@ public:
 
   // -----------------------------------------------------------------------------
   void executeCalcDewarp(const DataContainerArray::Pointer& dca)
+  {
+    executeCalcDewarp(dca, k_DewarpTransformContainerName, 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  uint executeCalcDewarp(const DataContainerArray::Pointer& dca, const QString& transformDCName, int pyramidLevels)
   {
     Observer obs;
 
@@ -169,7 +176,8 @@ public:
     dewarp->setYFactors(k_YFactors);
     dewarp->setAttributeMatrixName(k_ScanData);
     dewarp->setIPFColorsArrayName(k_ImageName);
-    dewarp->setTransformDCName(k_DewarpTransformContainerName);
+    dewarp->setPyramidLevels(pyramidLevels);
+    dewarp->setTransformDCName(transformDCName);
     dewarp->setTransformMatrixName(k_TransformMatrix);
     dewarp->setTransformArrayName(k_TransformArray);
     QObject::connect(dewarp.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), &obs, SLOT(processPipelineMessage(const AbstractMessage::Pointer&)));
@@ -177,10 +185,17 @@ public:
     dewarp->execute();
     int32_t err = dewarp->getErrorCode();
     DREAM3D_REQUIRED(err, >=, 0)
+    return dewarp->getIterations();
   }
 
   // -----------------------------------------------------------------------------
   void executeApplyDewarp(const DataContainerArray::Pointer& dca)
+  {
+    executeApplyDewarp(dca, k_TransformPath, k_TransformPrefix, false);
+  }
+
+  // -----------------------------------------------------------------------------
+  void executeApplyDewarp(const DataContainerArray::Pointer& dca, const DataArrayPath& transformPath, const QString& transformPrefix, bool storeLookupTables)
   {
     Observer obs;
 
@@ -189,8 +204,9 @@ public:
     apply->setMontageName(k_MontageName);
     apply->setAttributeMatrixName(k_ScanData);
     apply->setMaskName(k_MaskName);
-    apply->setTransformPath(k_TransformPath);
-    apply->setTransformPrefix(k_TransformPrefix);
+    apply->setTransformPath(transformPath);
+    apply->setTransformPrefix(transformPrefix);
+    apply->setStoreLookupTables(storeLookupTables);
 
     QObject::connect(apply.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), &obs, SLOT(processPipelineMessage(const AbstractMessage::Pointer&)));
 
@@ -270,20 +286,7 @@ public:
     DREAM3D_REQUIRE_VALID_POINTER(dca.get())
 
     // Manually Create a "Grid Montage"
-    GridMontage::Pointer gridMontage = GridMontage::New(k_MontageName, k_Rows, k_Cols);
-    GridTileIndex gridIndex = gridMontage->getTileIndex(0, 0);
-    gridMontage->setDataContainer(gridIndex, dca->getDataContainer(std::get<1>(k_InputRGBImages[0])));
-
-    gridIndex = gridMontage->getTileIndex(0, 1);
-    gridMontage->setDataContainer(gridIndex, dca->getDataContainer(std::get<1>(k_InputRGBImages[1])));
-
-    gridIndex = gridMontage->getTileIndex(1, 0);
-    gridMontage->setDataContainer(gridIndex, dca->getDataContainer(std::get<1>(k_InputRGBImages[2])));
-
-    gridIndex = gridMontage->getTileIndex(1, 1);
-    gridMontage->setDataContainer(gridIndex, dca->getDataContainer(std::get<1>(k_InputRGBImages[3])));
-
-    dca->addOrReplaceMontage(gridMontage);
+    addGridMontage(dca);
 
     // Write out the .dream3d file for debugging in ParaView
     DataContainerWriter::Pointer writer = DataContainerWriter::New();
@@ -311,11 +314,148 @@ public:
     DREAM3D_REQUIRED(err, >=, 0)
   }
 
+  // -----------------------------------------------------------------------------
+  void addGridMontage(const DataContainerArray::Pointer& dca)
+  {
+    GridMontage::Pointer gridMontage = GridMontage::New(k_MontageName, k_Rows, k_Cols);
+    GridTileIndex gridIndex = gridMontage->getTileIndex(0, 0);
+    gridMontage->setDataContainer(gridIndex, dca->getDataContainer(std::get<1>(k_InputRGBImages[0])));
+
+    gridIndex = gridMontage->getTileIndex(0, 1);
+    gridMontage->setDataContainer(gridIndex, dca->getDataContainer(std::get<1>(k_InputRGBImages[1])));
+
+    gridIndex = gridMontage->getTileIndex(1, 0);
+    gridMontage->setDataContainer(gridIndex, dca->getDataContainer(std::get<1>(k_InputRGBImages[2])));
+
+    gridIndex = gridMontage->getTileIndex(1, 1);
+    gridMontage->setDataContainer(gridIndex, dca->getDataContainer(std::get<1>(k_InputRGBImages[3])));
+
+    dca->addOrReplaceMontage(gridMontage);
+  }
+
+  // -----------------------------------------------------------------------------
+  void setTransform(const DataContainerArray::Pointer& dca, const FloatVec7Type& xFactors, const FloatVec7Type& yFactors)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(k_DewarpTransformContainerName);
+    if(nullptr == dc)
+    {
+      dc = DataContainer::New(k_DewarpTransformContainerName);
+      dc->createAndAddAttributeMatrix({1}, k_TransformMatrix, AttributeMatrix::Type::Generic);
+      dca->addOrReplaceDataContainer(dc);
+    }
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix(k_TransformMatrix);
+    DoubleArrayType::Pointer transform = DoubleArrayType::CreateArray(1, std::vector<size_t>(1, 14), k_TransformArray, true);
+    for(size_t i = 0; i < 7; i++)
+    {
+      transform->setComponent(0, i, xFactors[i]);
+      transform->setComponent(0, i + 7, yFactors[i]);
+    }
+    am->insertOrAssign(transform);
+  }
+
+  // -----------------------------------------------------------------------------
+  bool sameColors(const DataContainerArray::Pointer& dca, const QString& tileName, const QString& prefix1, const QString& prefix2)
+  {
+    UInt8ArrayType::Pointer arr1 = getColorArray(dca, DataArrayPath(prefix1 + tileName, k_ScanData, k_ImageName));
+    UInt8ArrayType::Pointer arr2 = getColorArray(dca, DataArrayPath(prefix2 + tileName, k_ScanData, k_ImageName));
+    return arr1->getSize() == arr2->getSize() && std::equal(arr1->data(), arr1->data() + arr1->getSize(), arr2->data());
+  }
+
+  // -----------------------------------------------------------------------------
+  void testStoredLookupTables()
+  {
+    DataContainerArray::Pointer dca = ImportImages();
+    DREAM3D_REQUIRE_VALID_POINTER(dca.get())
+    addGridMontage(dca);
+
+    setTransform(dca, k_XFactors, k_YFactors);
+    executeApplyDewarp(dca, k_TransformPath, "Stored_", true);
+
+    // The stored tables were calculated for the old transform and must not be reused for the new one
+    FloatVec7Type xFactors = k_XFactors;
+    xFactors[0] = 1.05f;
+    xFactors[2] = 5.0E-5f;
+    setTransform(dca, xFactors, k_YFactors);
+    executeApplyDewarp(dca, k_TransformPath, "Changed_", true);
+    executeApplyDewarp(dca, k_TransformPath, "Reused_", true);
+    executeApplyDewarp(dca, k_TransformPath, "Reference_", false);
+
+    bool transformChanged = false;
+    for(const auto& file : k_InputRGBImages)
+    {
+      const QString tileName = std::get<1>(file);
+      DREAM3D_REQUIRE_EQUAL(sameColors(dca, tileName, "Changed_", "Reference_"), true)
+      DREAM3D_REQUIRE_EQUAL(sameColors(dca, tileName, "Reused_", "Reference_"), true)
+      transformChanged = transformChanged || !sameColors(dca, tileName, "Stored_", "Reference_");
+    }
+    DREAM3D_REQUIRE_EQUAL(transformChanged, true)
+  }
+
+  // -----------------------------------------------------------------------------
+  void testPyramidLevels()
+  {
+    DataContainerArray::Pointer dca = ImportImages();
+    DREAM3D_REQUIRE_VALID_POINTER(dca.get())
+    addGridMontage(dca);
+
+    const QString pyramidContainerName = QString("Pyramid Dewarp Data");
+    executeCalcDewarp(dca, k_DewarpTransformContainerName, 0);
+    const uint pyramidIterations = executeCalcDewarp(dca, pyramidContainerName, 2);
+    // Every one of the three levels runs at least one iteration
+    DREAM3D_REQUIRED(pyramidIterations, >=, 3)
+
+    executeApplyDewarp(dca, k_TransformPath, "Full_", false);
+    executeApplyDewarp(dca, DataArrayPath(pyramidContainerName, k_TransformMatrix, k_TransformArray), "Pyramid_", false);
+
+    // Starting from the downsampled fits must converge to the same dewarp as the full resolution fit
+    for(const auto& file : k_InputRGBImages)
+    {
+      const QString tileName = std::get<1>(file);
+      UInt8ArrayType::Pointer fullArray = getColorArray(dca, DataArrayPath("Full_" + tileName, k_ScanData, k_ImageName));
+      UInt8ArrayType::Pointer pyramidArray = getColorArray(dca, DataArrayPath("Pyramid_" + tileName, k_ScanData, k_ImageName));
+      size_t comp = getMeanSquares(fullArray, pyramidArray);
+      DREAM3D_REQUIRED(comp, <, 500000000)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  void testOldIndexRow()
+  {
+    FFTDewarpHelper::ParametersType parameters(FFTDewarpHelper::getReqParameterSize());
+    for(size_t i = 0; i < FFTDewarpHelper::getReqPartialParameterSize(); i++)
+    {
+      parameters[i] = k_XFactors[i];
+      parameters[i + FFTDewarpHelper::getReqPartialParameterSize()] = k_YFactors[i];
+    }
+    const FFTDewarpHelper::PixelIndex offset = FFTDewarpHelper::pixelIndex(int64_t(262), int64_t(251));
+
+    // Odd row starts and widths exercise both the four pixel blocks and the remainder loop
+    const std::vector<std::pair<int64_t, int64_t>> spans = {{0, 524}, {3, 524}, {1, 6}, {261, 263}, {517, 523}};
+    std::vector<int64_t> oldX(524);
+    std::vector<int64_t> oldY(524);
+    for(int64_t y = 0; y < 503; y += 7)
+    {
+      for(const auto& span : spans)
+      {
+        FFTDewarpHelper::getOldIndexRow(y, span.first, span.second, offset, parameters, oldX.data(), oldY.data());
+        for(int64_t x = span.first; x < span.second; x++)
+        {
+          const FFTDewarpHelper::PixelIndex newIndex = FFTDewarpHelper::pixelIndex(x, y);
+          DREAM3D_REQUIRE_EQUAL(oldX[x - span.first], FFTDewarpHelper::px(newIndex, offset, parameters))
+          DREAM3D_REQUIRE_EQUAL(oldY[x - span.first], FFTDewarpHelper::py(newIndex, offset, parameters))
+        }
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   void operator()()
   {
     std::cout << "---------------- EdaxEbsdMontageTest ---------------------" << std::endl;
     int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(testOldIndexRow())
+    DREAM3D_REGISTER_TEST(testStoredLookupTables())
+    DREAM3D_REGISTER_TEST(testPyramidLevels())
     DREAM3D_REGISTER_TEST(executeTest())
   }
 
@@ -5,6 +5,9 @@
 // -----------------------------------------------------------------------------
 
 #include "ITKTestBase.h"
+
+#include <itkGradientAnisotropicDiffusionImageFilter.h>
+
 // Auto includes
 #include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
 
@@ -104,6 +107,48 @@ public:
     return 0;
   }
 
+  int TestITKGradientAnisotropicDiffusionImageuint8Test()
+  {
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    QString outputName = "TestAttributeArrayName_Output";
+    DataArrayPath output_path("TestContainer", "TestAttributeMatrixName", outputName);
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->CreateTestImage<uint8_t>(containerArray, input_path, {32, 32, 8});
+    QString filtName = "ITKGradientAnisotropicDiffusionImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(outputName);
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0);
+    // The filter reads the uint8 input directly. The result must be identical to casting the input
+    // to double before filtering, which is how the filter used to run.
+    typedef itk::Image<double, 3> RealImageType;
+    typedef itk::GradientAnisotropicDiffusionImageFilter<RealImageType, RealImageType> RealFilterType;
+    RealFilterType::Pointer realFilter = RealFilterType::New();
+    realFilter->SetTimeStep(0.125);
+    realFilter->SetConductanceParameter(3.0);
+    realFilter->SetConductanceScalingUpdateInterval(1);
+    realFilter->SetNumberOfIterations(5);
+    DataContainer::Pointer container = containerArray->getDataContainer(input_path.getDataContainerName());
+    QString md5Output;
+    QString md5Reference;
+    DREAM3D_REQUIRE_EQUAL(this->GetMD5FromDataContainer<uint8_t, 3>(container, output_path, md5Output), 0);
+    DREAM3D_REQUIRE_EQUAL(this->GetMD5FromCastToRealPipeline<uint8_t>(container, input_path, realFilter.GetPointer(), md5Reference), 0);
+    DREAM3D_REQUIRE_EQUAL(md5Output, md5Reference);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -115,6 +160,7 @@ public:
 
     DREAM3D_REGISTER_TEST(TestITKGradientAnisotropicDiffusionImagedefaultsTest());
     DREAM3D_REGISTER_TEST(TestITKGradientAnisotropicDiffusionImagelongerTest());
+    DREAM3D_REGISTER_TEST(TestITKGradientAnisotropicDiffusionImageuint8Test());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -0,0 +1,179 @@
+#pragma once
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <itkImage.h>
+#include <itkShiftScaleImageFilter.h>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageProcessingBase.h"
+#include "ITKImageProcessing/Test/ITKImageProcessingTestFileLocations.h"
+#include "ITKImageProcessing/Test/UnitTestSupport.hpp"
+
+namespace
+{
+/**
+ * @brief Runs (value + 3) * 2 as two chained ITK stages. The first stage produces a float image so
+ * the chain has an intermediate buffer of a different type than either end.
+ */
+class ShiftThenScaleChain : public ITKImageProcessingBase
+{
+public:
+  using UInt8ImageType = itk::Image<uint8_t, 3>;
+  using FloatImageType = itk::Image<float, 3>;
+  using ShiftFilterType = itk::ShiftScaleImageFilter<UInt8ImageType, FloatImageType>;
+  using ScaleFilterType = itk::ShiftScaleImageFilter<FloatImageType, UInt8ImageType>;
+
+  ShiftThenScaleChain() = default;
+  ~ShiftThenScaleChain() override = default;
+
+  ShiftFilterType::Pointer m_Shift = ShiftFilterType::New();
+  ScaleFilterType::Pointer m_Scale = ScaleFilterType::New();
+
+protected:
+  void dataCheck() override
+  {
+    clearErrorCode();
+    clearWarningCode();
+    dataCheckImpl<uint8_t, uint8_t, 3>();
+  }
+
+  void filterInternal() override
+  {
+    m_Shift->SetShift(3.0);
+    m_Shift->SetScale(1.0);
+    m_Scale->SetShift(0.0);
+    m_Scale->SetScale(2.0);
+    filterChain<uint8_t, uint8_t, 3>(m_Shift.GetPointer(), m_Scale.GetPointer());
+  }
+};
+} // namespace
+
+class ITKImageFilterChainTest
+{
+public:
+  ITKImageFilterChainTest() = default;
+  ~ITKImageFilterChainTest() = default;
+  ITKImageFilterChainTest(const ITKImageFilterChainTest&) = delete;            // Copy Constructor
+  ITKImageFilterChainTest(ITKImageFilterChainTest&&) = delete;                 // Move Constructor
+  ITKImageFilterChainTest& operator=(const ITKImageFilterChainTest&) = delete; // Copy Assignment
+  ITKImageFilterChainTest& operator=(ITKImageFilterChainTest&&) = delete;      // Move Assignment
+
+  const DataArrayPath k_ImageArrayPath = DataArrayPath("Volume", "Cell Data", "ImageData");
+  const QString k_OutputArrayName = "Chained";
+
+  // -----------------------------------------------------------------------------
+  static uint8_t voxelValue(size_t x, size_t y, size_t z)
+  {
+    return static_cast<uint8_t>(x + 7 * y + 30 * z);
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createVolume(const SizeVec3Type& dims)
+  {
+    DataContainer::Pointer dc = DataContainer::New(k_ImageArrayPath.getDataContainerName());
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(dims);
+    dc->setGeometry(image);
+
+    std::vector<size_t> tupleDims = {dims[0], dims[1], dims[2]};
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tupleDims, k_ImageArrayPath.getAttributeMatrixName(), AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAm);
+    UInt8ArrayType::Pointer data = UInt8ArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 1), k_ImageArrayPath.getDataArrayName(), true);
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          data->setValue((z * dims[1] + y) * dims[0] + x, voxelValue(x, y, z));
+        }
+      }
+    }
+    cellAm->insertOrAssign(data);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    dca->addOrReplaceDataContainer(dc);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestChainOutputAndRelease()
+  {
+    const SizeVec3Type dims = {9, 6, 4};
+    ShiftThenScaleChain filter;
+    filter.setDataContainerArray(createVolume(dims));
+    filter.setSelectedCellArrayPath(k_ImageArrayPath);
+    filter.setNewCellArrayName(k_OutputArrayName);
+    filter.execute();
+    DREAM3D_REQUIRED(filter.getErrorCode(), >=, 0)
+
+    // Only the last stage is materialized in the DataContainer, and it holds the chained result
+    AttributeMatrix::Pointer cellAm = filter.getDataContainerArray()->getDataContainer(k_ImageArrayPath.getDataContainerName())->getAttributeMatrix(k_ImageArrayPath.getAttributeMatrixName());
+    DREAM3D_REQUIRE_EQUAL(cellAm->getAttributeArrayNames().size(), 2)
+    UInt8ArrayType::Pointer output = cellAm->getAttributeArrayAs<UInt8ArrayType>(k_OutputArrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(output.get())
+    DREAM3D_REQUIRE_EQUAL(output->getNumberOfTuples(), dims[0] * dims[1] * dims[2])
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          const uint8_t expected = static_cast<uint8_t>((voxelValue(x, y, z) + 3) * 2);
+          DREAM3D_REQUIRE_EQUAL(output->getValue((z * dims[1] + y) * dims[0] + x), expected)
+        }
+      }
+    }
+
+    // The intermediate float image was released once the last stage had consumed it
+    DREAM3D_REQUIRE_EQUAL(filter.m_Shift->GetReleaseDataFlag(), true)
+    DREAM3D_REQUIRE_EQUAL(filter.m_Shift->GetOutput()->GetBufferPointer() == nullptr, true)
+    DREAM3D_REQUIRE_EQUAL(filter.m_Scale->GetReleaseDataFlag(), false)
+
+    // The input array is untouched
+    UInt8ArrayType::Pointer input = cellAm->getAttributeArrayAs<UInt8ArrayType>(k_ImageArrayPath.getDataArrayName());
+    DREAM3D_REQUIRE_EQUAL(input->getValue(dims[0] + 2), voxelValue(2, 1, 0))
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- ITKImageFilterChainTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestChainOutputAndRelease())
+  }
+};
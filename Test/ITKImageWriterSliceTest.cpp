@@ -0,0 +1,263 @@
+#pragma once
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+
+#include <itkImage.h>
+#include <itkImageFileReader.h>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/global_control.h>
+#endif
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageWriter.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImportImageStack.h"
+#include "ITKImageProcessing/Test/ITKImageProcessingTestFileLocations.h"
+#include "ITKImageProcessing/Test/UnitTestSupport.hpp"
+
+class ITKImageWriterSliceTest
+{
+public:
+  ITKImageWriterSliceTest() = default;
+  ~ITKImageWriterSliceTest() = default;
+  ITKImageWriterSliceTest(const ITKImageWriterSliceTest&) = delete;            // Copy Constructor
+  ITKImageWriterSliceTest(ITKImageWriterSliceTest&&) = delete;                 // Move Constructor
+  ITKImageWriterSliceTest& operator=(const ITKImageWriterSliceTest&) = delete; // Copy Assignment
+  ITKImageWriterSliceTest& operator=(ITKImageWriterSliceTest&&) = delete;      // Move Assignment
+
+  const QString k_OutputDir = UnitTest::TestTempDir + "/ITKImageWriterSliceTest";
+  const DataArrayPath k_ImageArrayPath = DataArrayPath("Volume", "Cell Data", "ImageData");
+
+  using ImageType = itk::Image<uint8_t, 2>;
+
+  // -----------------------------------------------------------------------------
+  static uint8_t voxelValue(size_t x, size_t y, size_t z)
+  {
+    return static_cast<uint8_t>(x + 10 * y + 50 * z);
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createVolume(const SizeVec3Type& dims)
+  {
+    DataContainer::Pointer dc = DataContainer::New(k_ImageArrayPath.getDataContainerName());
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(dims);
+    dc->setGeometry(image);
+
+    std::vector<size_t> tupleDims = {dims[0], dims[1], dims[2]};
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tupleDims, k_ImageArrayPath.getAttributeMatrixName(), AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAm);
+    UInt8ArrayType::Pointer data = UInt8ArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 1), k_ImageArrayPath.getDataArrayName(), true);
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          data->setValue((z * dims[1] + y) * dims[0] + x, voxelValue(x, y, z));
+        }
+      }
+    }
+    cellAm->insertOrAssign(data);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    dca->addOrReplaceDataContainer(dc);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  void writeVolume(const SizeVec3Type& dims, int plane, const QString& fileName)
+  {
+    ITKImageWriter::Pointer filter = ITKImageWriter::New();
+    filter->setDataContainerArray(createVolume(dims));
+    filter->setImageArrayPath(k_ImageArrayPath);
+    filter->setPlane(plane);
+    filter->setFileName(fileName);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  ImageType::Pointer readSlice(const QString& fileName)
+  {
+    DREAM3D_REQUIRE_EQUAL(QFileInfo(fileName).exists(), true)
+    using ReaderType = itk::ImageFileReader<ImageType>;
+    ReaderType::Pointer reader = ReaderType::New();
+    reader->SetFileName(fileName.toStdString());
+    reader->Update();
+    return reader->GetOutput();
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestPlanes()
+  {
+    QDir(k_OutputDir).removeRecursively();
+    QDir().mkpath(k_OutputDir);
+
+    // More slices than a single writer thread handles, in every direction
+    const SizeVec3Type dims = {11, 9, 7};
+    const std::vector<int> planes = {ITKImageWriter::XYPlane, ITKImageWriter::XZPlane, ITKImageWriter::YZPlane};
+    const std::vector<QString> planeNames = {"XY", "XZ", "YZ"};
+    for(size_t p = 0; p < planes.size(); p++)
+    {
+      const int plane = planes[p];
+      const QString basePath = k_OutputDir + "/" + planeNames[p];
+      writeVolume(dims, plane, basePath + ".tif");
+
+      const size_t numSlices = (plane == ITKImageWriter::XYPlane) ? dims[2] : (plane == ITKImageWriter::XZPlane) ? dims[1] : dims[0];
+      const size_t width = (plane == ITKImageWriter::YZPlane) ? dims[1] : dims[0];
+      const size_t height = (plane == ITKImageWriter::XYPlane) ? dims[1] : dims[2];
+      for(size_t slice = 0; slice < numSlices; slice++)
+      {
+        ImageType::Pointer image = readSlice(QString("%1_%2.tif").arg(basePath).arg(slice));
+        ImageType::SizeType size = image->GetLargestPossibleRegion().GetSize();
+        DREAM3D_REQUIRE_EQUAL(size[0], width)
+        DREAM3D_REQUIRE_EQUAL(size[1], height)
+        for(size_t j = 0; j < height; j++)
+        {
+          for(size_t i = 0; i < width; i++)
+          {
+            ImageType::IndexType index = {{static_cast<ImageType::IndexValueType>(i), static_cast<ImageType::IndexValueType>(j)}};
+            uint8_t expected = 0;
+            if(plane == ITKImageWriter::XYPlane)
+            {
+              expected = voxelValue(i, j, slice);
+            }
+            else if(plane == ITKImageWriter::XZPlane)
+            {
+              expected = voxelValue(i, slice, j);
+            }
+            else
+            {
+              expected = voxelValue(slice, i, j);
+            }
+            DREAM3D_REQUIRE_EQUAL(image->GetPixel(index), expected)
+          }
+        }
+      }
+      // No slice past the end of the volume
+      DREAM3D_REQUIRE_EQUAL(QFileInfo(QString("%1_%2.tif").arg(basePath).arg(numSlices)).exists(), false)
+    }
+
+    QDir(k_OutputDir).removeRecursively();
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestSingleSlice()
+  {
+    QDir(k_OutputDir).removeRecursively();
+    QDir().mkpath(k_OutputDir);
+
+    // A single slice is written on the calling thread under the exact file name
+    const SizeVec3Type dims = {6, 5, 1};
+    const QString fileName = k_OutputDir + "/Single.tif";
+    writeVolume(dims, ITKImageWriter::XYPlane, fileName);
+
+    ImageType::Pointer image = readSlice(fileName);
+    ImageType::SizeType size = image->GetLargestPossibleRegion().GetSize();
+    DREAM3D_REQUIRE_EQUAL(size[0], dims[0])
+    DREAM3D_REQUIRE_EQUAL(size[1], dims[1])
+    ImageType::IndexType index = {{5, 4}};
+    DREAM3D_REQUIRE_EQUAL(image->GetPixel(index), voxelValue(5, 4, 0))
+    DREAM3D_REQUIRE_EQUAL(QFileInfo(k_OutputDir + "/Single_0.tif").exists(), false)
+
+    QDir(k_OutputDir).removeRecursively();
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestImportStackWithOneTbbThread()
+  {
+    QDir(k_OutputDir).removeRecursively();
+    QDir().mkpath(k_OutputDir);
+
+    const SizeVec3Type dims = {11, 9, 7};
+    writeVolume(dims, ITKImageWriter::XYPlane, k_OutputDir + "/Stack.tif");
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    // The slices must still be read when TBB may not run any task besides the calling thread
+    tbb::global_control singleThread(tbb::global_control::max_allowed_parallelism, 1);
+#endif
+
+    StackFileListInfo fileListInfo;
+    fileListInfo.InputPath = k_OutputDir;
+    fileListInfo.StartIndex = 0;
+    fileListInfo.EndIndex = static_cast<int32_t>(dims[2]) - 1;
+    fileListInfo.IncrementIndex = 1;
+    fileListInfo.FileExtension = "tif";
+    fileListInfo.FilePrefix = "Stack_";
+    fileListInfo.FileSuffix = "";
+    fileListInfo.PaddingDigits = 0;
+    fileListInfo.Ordering = 0;
+
+    ITKImportImageStack::Pointer reader = ITKImportImageStack::New();
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->setDataContainerName(DataArrayPath("Stack", "", ""));
+    reader->setCellAttributeMatrixName("Cell Data");
+    reader->setImageDataArrayName("ImageData");
+    reader->setInputFileListInfo(fileListInfo);
+    reader->execute();
+    DREAM3D_REQUIRED(reader->getErrorCode(), >=, 0)
+
+    UInt8ArrayType::Pointer data = reader->getDataContainerArray()->getDataContainer("Stack")->getAttributeMatrix("Cell Data")->getAttributeArrayAs<UInt8ArrayType>("ImageData");
+    DREAM3D_REQUIRE_VALID_POINTER(data.get())
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), dims[0] * dims[1] * dims[2])
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          DREAM3D_REQUIRE_EQUAL(data->getValue((z * dims[1] + y) * dims[0] + x), voxelValue(x, y, z))
+        }
+      }
+    }
+
+    QDir(k_OutputDir).removeRecursively();
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- ITKImageWriterSliceTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestPlanes())
+    DREAM3D_REGISTER_TEST(TestSingleSlice())
+    DREAM3D_REGISTER_TEST(TestImportStackWithOneTbbThread())
+  }
+};
@@ -0,0 +1,320 @@
+#pragma once
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/TransformContainer.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKPCMTileRegistration.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
+#include "ITKImageProcessing/Test/ITKImageProcessingTestFileLocations.h"
+#include "ITKImageProcessing/Test/UnitTestSupport.hpp"
+
+namespace
+{
+/**
+ * @brief Exposes ITKPCMTileRegistration::computeTileKey to the test
+ */
+class TileKeyProbe : public ITKPCMTileRegistration
+{
+public:
+  using ITKPCMTileRegistration::computeTileKey;
+};
+} // namespace
+
+class ITKPCMTileRegistrationTest
+{
+public:
+  ITKPCMTileRegistrationTest() = default;
+  ~ITKPCMTileRegistrationTest() = default;
+  ITKPCMTileRegistrationTest(const ITKPCMTileRegistrationTest&) = delete;            // Copy Constructor
+  ITKPCMTileRegistrationTest(ITKPCMTileRegistrationTest&&) = delete;                 // Move Constructor
+  ITKPCMTileRegistrationTest& operator=(const ITKPCMTileRegistrationTest&) = delete; // Copy Assignment
+  ITKPCMTileRegistrationTest& operator=(ITKPCMTileRegistrationTest&&) = delete;      // Move Assignment
+
+  const QString k_DataContainerPrefix = QString("Tile_");
+  const QString k_AttributeMatrixName = QString("Cell Data");
+  const QString k_DataArrayName = QString("Image Data");
+
+  static constexpr int32_t k_Rows = 2;
+  static constexpr int32_t k_Cols = 2;
+  static constexpr size_t k_TileSize = 96;
+  static constexpr size_t k_TileStep = 72;
+  static constexpr size_t k_SceneSize = 320;
+
+  using TileOffsets = std::vector<std::array<double, 2>>;
+
+  // -----------------------------------------------------------------------------
+  std::vector<uint8_t> createScene()
+  {
+    // Random gaussian blobs give a single clear correlation peak for every overlap
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<double> position(0.0, static_cast<double>(k_SceneSize));
+    std::vector<double> scene(k_SceneSize * k_SceneSize, 20.0);
+    for(int blob = 0; blob < 400; blob++)
+    {
+      const double cx = position(generator);
+      const double cy = position(generator);
+      for(size_t y = 0; y < k_SceneSize; y++)
+      {
+        for(size_t x = 0; x < k_SceneSize; x++)
+        {
+          const double r2 = (x - cx) * (x - cx) + (y - cy) * (y - cy);
+          if(r2 < 100.0)
+          {
+            scene[y * k_SceneSize + x] += 120.0 * std::exp(-r2 / 8.0);
+          }
+        }
+      }
+    }
+
+    std::vector<uint8_t> values(scene.size());
+    std::transform(scene.begin(), scene.end(), values.begin(), [](double value) { return static_cast<uint8_t>(std::min(value, 255.0)); });
+    return values;
+  }
+
+  // -----------------------------------------------------------------------------
+  QString tileName(int32_t row, int32_t col) const
+  {
+    return MontageImportHelper::GenerateDataContainerName(k_DataContainerPrefix, 1, row, col);
+  }
+
+  // -----------------------------------------------------------------------------
+  void cutTile(const std::vector<uint8_t>& scene, const UInt8ArrayType::Pointer& data, size_t sceneX, size_t sceneY)
+  {
+    for(size_t y = 0; y < k_TileSize; y++)
+    {
+      for(size_t x = 0; x < k_TileSize; x++)
+      {
+        data->setValue(y * k_TileSize + x, scene[(sceneY + y) * k_SceneSize + sceneX + x]);
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createTiles(const std::vector<uint8_t>& scene)
+  {
+    // Each tile is cut a few pixels away from the position its origin claims
+    const std::array<std::array<size_t, 2>, k_Rows * k_Cols> errors = {{{4, 6}, {9, 3}, {2, 10}, {7, 8}}};
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    std::vector<size_t> dims = {k_TileSize, k_TileSize, 1};
+    for(int32_t row = 0; row < k_Rows; row++)
+    {
+      for(int32_t col = 0; col < k_Cols; col++)
+      {
+        DataContainer::Pointer dc = DataContainer::New(tileName(row, col));
+        ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+        image->setDimensions(dims.data());
+        image->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+        image->setOrigin(FloatVec3Type(static_cast<float>(col * k_TileStep), static_cast<float>(row * k_TileStep), 0.0f));
+        dc->setGeometry(image);
+
+        AttributeMatrix::Pointer am = dc->createAndAddAttributeMatrix(dims, k_AttributeMatrixName, AttributeMatrix::Type::Cell);
+        UInt8ArrayType::Pointer data = UInt8ArrayType::CreateArray(k_TileSize * k_TileSize, k_DataArrayName, true);
+        const std::array<size_t, 2>& error = errors[row * k_Cols + col];
+        cutTile(scene, data, col * k_TileStep + error[0], row * k_TileStep + error[1]);
+        am->insertOrAssign(data);
+
+        dca->addOrReplaceDataContainer(dc);
+      }
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  TileOffsets registerTiles(const DataContainerArray::Pointer& dca, const IntVec2Type& columns, const IntVec2Type& rows, bool useCache)
+  {
+    ITKPCMTileRegistration::Pointer filter = ITKPCMTileRegistration::New();
+    filter->setDataContainerArray(dca);
+    filter->setColumnMontageLimits(columns);
+    filter->setRowMontageLimits(rows);
+    filter->setDataContainerPaddingDigits(1);
+    filter->setDataContainerPrefix(k_DataContainerPrefix);
+    filter->setCommonAttributeMatrixName(k_AttributeMatrixName);
+    filter->setCommonDataArrayName(k_DataArrayName);
+    filter->setUseRegistrationCache(useCache);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    TileOffsets offsets;
+    for(int32_t row = rows[0]; row <= rows[1]; row++)
+    {
+      for(int32_t col = columns[0]; col <= columns[1]; col++)
+      {
+        ImageGeom::Pointer image = dca->getDataContainer(tileName(row, col))->getGeometryAs<ImageGeom>();
+        TransformContainer::Pointer transform = std::dynamic_pointer_cast<TransformContainer>(image->getTransformContainer());
+        DREAM3D_REQUIRE_VALID_POINTER(transform.get())
+        // 3D affine parameters are the 3x3 matrix followed by the translation
+        const auto parameters = transform->getParameters();
+        DREAM3D_REQUIRE_EQUAL(parameters.size(), 12)
+        offsets.push_back({parameters[9], parameters[10]});
+      }
+    }
+    return offsets;
+  }
+
+  // -----------------------------------------------------------------------------
+  void requireClose(const TileOffsets& lhs, const TileOffsets& rhs, double tolerance)
+  {
+    DREAM3D_REQUIRE_EQUAL(lhs.size(), rhs.size())
+    for(size_t i = 0; i < lhs.size(); i++)
+    {
+      for(size_t d = 0; d < 2; d++)
+      {
+        DREAM3D_REQUIRED(std::abs(lhs[i][d] - rhs[i][d]), <=, tolerance)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestCachedMatchesMontage()
+  {
+    DataContainerArray::Pointer dca = createTiles(createScene());
+
+    TileOffsets montageOffsets = registerTiles(dca, IntVec2Type(0, k_Cols - 1), IntVec2Type(0, k_Rows - 1), false);
+    TileOffsets cachedOffsets = registerTiles(dca, IntVec2Type(0, k_Cols - 1), IntVec2Type(0, k_Rows - 1), true);
+    requireClose(montageOffsets, cachedOffsets, 1.0);
+
+    // The tiles are misplaced by several pixels, so a registration that did nothing would not pass
+    bool moved = false;
+    for(const auto& offset : cachedOffsets)
+    {
+      moved = moved || std::abs(offset[0]) > 1.5 || std::abs(offset[1]) > 1.5;
+    }
+    DREAM3D_REQUIRE_EQUAL(moved, true)
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestCacheFollowsTileChanges()
+  {
+    const std::vector<uint8_t> scene = createScene();
+    DataContainerArray::Pointer dca = createTiles(scene);
+    const IntVec2Type columns(0, k_Cols - 1);
+    const IntVec2Type rows(0, k_Rows - 1);
+
+    TileOffsets first = registerTiles(dca, columns, rows, true);
+    TileOffsets second = registerTiles(dca, columns, rows, true);
+    requireClose(first, second, 0.0);
+
+    // Rewrite one tile in place, shifted by 6 pixels.  The array keeps its buffer, so only the
+    // values tell the cache that the tile changed.
+    const size_t changedTile = 1;
+    UInt8ArrayType::Pointer data = dca->getDataContainer(tileName(0, 1))->getAttributeMatrix(k_AttributeMatrixName)->getAttributeArrayAs<UInt8ArrayType>(k_DataArrayName);
+    cutTile(scene, data, k_TileStep + 9 + 6, 3);
+
+    TileOffsets changed = registerTiles(dca, columns, rows, true);
+    TileOffsets montageOffsets = registerTiles(dca, columns, rows, false);
+    requireClose(changed, montageOffsets, 1.0);
+    DREAM3D_REQUIRED(std::abs(changed[changedTile][0] - first[changedTile][0]), >, 3.0)
+
+    // A smaller selection reuses the overlaps it shares with the full montage
+    TileOffsets column = registerTiles(dca, IntVec2Type(0, 0), rows, true);
+    TileOffsets columnMontage = registerTiles(dca, IntVec2Type(0, 0), rows, false);
+    requireClose(column, columnMontage, 1.0);
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestTileKeyCoversEveryValue()
+  {
+    DataContainerArray::Pointer dca = createTiles(createScene());
+    DataContainer::Pointer dc = dca->getDataContainer(tileName(0, 0));
+    UInt8ArrayType::Pointer data = dc->getAttributeMatrix(k_AttributeMatrixName)->getAttributeArrayAs<UInt8ArrayType>(k_DataArrayName);
+
+    TileKeyProbe probe;
+    probe.setCommonAttributeMatrixName(k_AttributeMatrixName);
+    probe.setCommonDataArrayName(k_DataArrayName);
+    const QByteArray original = probe.computeTileKey(dc);
+
+    // Changing any single value in place, wherever it is, gives a new key
+    const std::array<size_t, 4> indices = {1, 4097, k_TileSize * k_TileSize / 2 + 1, k_TileSize * k_TileSize - 1};
+    for(size_t index : indices)
+    {
+      const uint8_t value = data->getValue(index);
+      data->setValue(index, static_cast<uint8_t>(value + 1));
+      DREAM3D_REQUIRE(probe.computeTileKey(dc) != original)
+      data->setValue(index, value);
+      DREAM3D_REQUIRE(probe.computeTileKey(dc) == original)
+    }
+
+    // The same values in a new buffer keep the key, so a re-imported tile reuses the cache
+    UInt8ArrayType::Pointer copy = std::dynamic_pointer_cast<UInt8ArrayType>(data->deepCopy());
+    dc->getAttributeMatrix(k_AttributeMatrixName)->insertOrAssign(copy);
+    DREAM3D_REQUIRE(probe.computeTileKey(dc) == original)
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestCacheFollowsSparseInPlaceEdits()
+  {
+    const std::vector<uint8_t> scene = createScene();
+    DataContainerArray::Pointer dca = createTiles(scene);
+    const IntVec2Type columns(0, k_Cols - 1);
+    const IntVec2Type rows(0, k_Rows - 1);
+    registerTiles(dca, columns, rows, true);
+
+    // Rewrite only the odd indexed values of one tile with the scene shifted by 6 pixels.  The even
+    // indexed values, and the buffer, are untouched.
+    UInt8ArrayType::Pointer data = dca->getDataContainer(tileName(0, 1))->getAttributeMatrix(k_AttributeMatrixName)->getAttributeArrayAs<UInt8ArrayType>(k_DataArrayName);
+    for(size_t y = 0; y < k_TileSize; y++)
+    {
+      for(size_t x = 1; x < k_TileSize; x += 2)
+      {
+        data->setValue(y * k_TileSize + x, scene[(3 + y) * k_SceneSize + k_TileStep + 9 + 6 + x]);
+      }
+    }
+
+    // The cached path registers the edited tile again and agrees with the uncached path
+    TileOffsets cached = registerTiles(dca, columns, rows, true);
+    TileOffsets uncached = registerTiles(dca, columns, rows, false);
+    requireClose(cached, uncached, 1.0);
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- ITKPCMTileRegistrationTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestCachedMatchesMontage())
+    DREAM3D_REGISTER_TEST(TestCacheFollowsTileChanges())
+    DREAM3D_REGISTER_TEST(TestTileKeyCoversEveryValue())
+    DREAM3D_REGISTER_TEST(TestCacheFollowsSparseInPlaceEdits())
+  }
+};
@@ -48,6 +48,70 @@ public:
     return 0;
   }
 
+  int TestITKSqrtImagestreamedTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/Ramp-Zero-One-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    QString outputName = "TestAttributeArrayName_Output";
+    DataArrayPath output_path("TestContainer", "TestAttributeMatrixName", outputName);
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKSqrtImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(outputName);
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(4);
+    propWasSet = filter->setProperty("NumberOfStreamDivisions", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0);
+    WriteImage("ITKSqrtImagestreamed.nrrd", containerArray, output_path);
+    QString baseline_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Baseline/BasicFilters_SqrtImageFilter_defaults.nrrd");
+    DataArrayPath baseline_path("BContainer", "BAttributeMatrixName", "BAttributeArrayName");
+    this->ReadImage(baseline_filename, containerArray, baseline_path);
+    int res = this->CompareImages(containerArray, output_path, baseline_path, 0.01);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
+  int TestITKSqrtImageinvalidStreamDivisionsTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/Ramp-Zero-One-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("ITKSqrtImage");
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(QString("TestAttributeArrayName_Output"));
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(0);
+    propWasSet = filter->setProperty("NumberOfStreamDivisions", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->preflight();
+    DREAM3D_REQUIRED(filter->getErrorCode(), ==, -55570);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -58,6 +122,8 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKSqrtImage"));
 
     DREAM3D_REGISTER_TEST(TestITKSqrtImagedefaultsTest());
+    DREAM3D_REGISTER_TEST(TestITKSqrtImagestreamedTest());
+    DREAM3D_REGISTER_TEST(TestITKSqrtImageinvalidStreamDivisionsTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -0,0 +1,206 @@
+#pragma once
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cstdlib>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Utilities/MontageSelection.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKStitchMontage.h"
+#include "ITKImageProcessing/Test/ITKImageProcessingTestFileLocations.h"
+#include "ITKImageProcessing/Test/UnitTestSupport.hpp"
+
+class ITKStitchMontageTest
+{
+public:
+  ITKStitchMontageTest() = default;
+  ~ITKStitchMontageTest() = default;
+  ITKStitchMontageTest(const ITKStitchMontageTest&) = delete;            // Copy Constructor
+  ITKStitchMontageTest(ITKStitchMontageTest&&) = delete;                 // Move Constructor
+  ITKStitchMontageTest& operator=(const ITKStitchMontageTest&) = delete; // Copy Assignment
+  ITKStitchMontageTest& operator=(ITKStitchMontageTest&&) = delete;      // Move Assignment
+
+  const QString k_AttributeMatrixName = QString("Cell Data");
+  const QString k_DataArrayName = QString("Image Data");
+
+  static constexpr int32_t k_Rows = 2;
+  static constexpr int32_t k_Cols = 3;
+  static constexpr size_t k_TileWidth = 40;
+  static constexpr size_t k_TileHeight = 30;
+  static constexpr size_t k_StepX = 32;
+  static constexpr size_t k_StepY = 24;
+  static constexpr size_t k_MontageWidth = k_StepX * (k_Cols - 1) + k_TileWidth;
+  static constexpr size_t k_MontageHeight = k_StepY * (k_Rows - 1) + k_TileHeight;
+
+  // -----------------------------------------------------------------------------
+  static uint8_t sceneValue(size_t x, size_t y)
+  {
+    return static_cast<uint8_t>((3 * x + 7 * y) % 251);
+  }
+
+  // -----------------------------------------------------------------------------
+  MontageSelection createSelection()
+  {
+    MontageSelection selection;
+    selection.setPrefix("Tile_");
+    selection.setSuffix("");
+    selection.setPadding(1);
+    selection.setRowStart(0);
+    selection.setRowEnd(k_Rows - 1);
+    selection.setColStart(0);
+    selection.setColEnd(k_Cols - 1);
+    return selection;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Cuts overlapping tiles out of one scene, each placed at its true position by its origin
+   */
+  DataContainerArray::Pointer createTiles(const MontageSelection& selection)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    std::vector<size_t> dims = {k_TileWidth, k_TileHeight, 1};
+    for(int32_t row = 0; row < k_Rows; row++)
+    {
+      for(int32_t col = 0; col < k_Cols; col++)
+      {
+        const size_t originX = col * k_StepX;
+        const size_t originY = row * k_StepY;
+        DataContainer::Pointer dc = DataContainer::New(selection.getDataContainerName(row, col));
+        ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+        image->setDimensions(dims.data());
+        image->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+        image->setOrigin(FloatVec3Type(static_cast<float>(originX), static_cast<float>(originY), 0.0f));
+        dc->setGeometry(image);
+
+        AttributeMatrix::Pointer am = dc->createAndAddAttributeMatrix(dims, k_AttributeMatrixName, AttributeMatrix::Type::Cell);
+        UInt8ArrayType::Pointer data = UInt8ArrayType::CreateArray(k_TileWidth * k_TileHeight, k_DataArrayName, true);
+        for(size_t y = 0; y < k_TileHeight; y++)
+        {
+          for(size_t x = 0; x < k_TileWidth; x++)
+          {
+            data->setValue(y * k_TileWidth + x, sceneValue(originX + x, originY + y));
+          }
+        }
+        am->insertOrAssign(data);
+        dca->addOrReplaceDataContainer(dc);
+      }
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  ITKStitchMontage::Pointer createFilter(const DataContainerArray::Pointer& dca, const MontageSelection& selection, const QString& montageName, int streamDivisions)
+  {
+    ITKStitchMontage::Pointer filter = ITKStitchMontage::New();
+    filter->setDataContainerArray(dca);
+    filter->setMontageSelection(selection);
+    filter->setCommonAttributeMatrixName(k_AttributeMatrixName);
+    filter->setCommonDataArrayName(k_DataArrayName);
+    filter->setMontageDataContainerName(montageName);
+    filter->setMontageAttributeMatrixName(k_AttributeMatrixName);
+    filter->setMontageDataArrayName(k_DataArrayName);
+    filter->setStreamDivisions(streamDivisions);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  UInt8ArrayType::Pointer stitch(const DataContainerArray::Pointer& dca, const MontageSelection& selection, int streamDivisions)
+  {
+    const QString montageName = QString("Montage_%1").arg(streamDivisions);
+    ITKStitchMontage::Pointer filter = createFilter(dca, selection, montageName, streamDivisions);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    DataContainer::Pointer montage = dca->getDataContainer(montageName);
+    ImageGeom::Pointer geom = montage->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_EQUAL(geom->getDimensions()[0], k_MontageWidth)
+    DREAM3D_REQUIRE_EQUAL(geom->getDimensions()[1], k_MontageHeight)
+
+    UInt8ArrayType::Pointer stitched = montage->getAttributeMatrix(k_AttributeMatrixName)->getAttributeArrayAs<UInt8ArrayType>(k_DataArrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(stitched.get())
+    DREAM3D_REQUIRE_EQUAL(stitched->getNumberOfTuples(), k_MontageWidth * k_MontageHeight)
+    return stitched;
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestStreamedMatchesWhole()
+  {
+    const MontageSelection selection = createSelection();
+    DataContainerArray::Pointer dca = createTiles(selection);
+
+    UInt8ArrayType::Pointer whole = stitch(dca, selection, 1);
+
+    // The tiles agree wherever they overlap, so the stitched image is the scene
+    for(size_t y = 0; y < k_MontageHeight; y++)
+    {
+      for(size_t x = 0; x < k_MontageWidth; x++)
+      {
+        const int difference = static_cast<int>(whole->getValue(y * k_MontageWidth + x)) - static_cast<int>(sceneValue(x, y));
+        DREAM3D_REQUIRED(std::abs(difference), <=, 1)
+      }
+    }
+
+    // Bands of rows, including more divisions than there are rows, give the same image
+    for(int streamDivisions : {2, 5, static_cast<int>(k_MontageHeight) + 10})
+    {
+      UInt8ArrayType::Pointer streamed = stitch(dca, selection, streamDivisions);
+      for(size_t i = 0; i < whole->getNumberOfTuples(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(streamed->getValue(i), whole->getValue(i))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestInvalidStreamDivisions()
+  {
+    const MontageSelection selection = createSelection();
+    ITKStitchMontage::Pointer filter = createFilter(createTiles(selection), selection, "Montage", 0);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -11015)
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- ITKStitchMontageTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestStreamedMatchesWhole())
+    DREAM3D_REGISTER_TEST(TestInvalidStreamDivisions())
+  }
+};
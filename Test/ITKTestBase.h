@@ -19,8 +19,11 @@
 
 #include "ITKImageProcessingTestFileLocations.h"
 
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/ITK/itkInPlaceDream3DDataToImageFilter.h"
 
+#include <itkCastImageFilter.h>
+
 // Testing
 #include <itkTestingHashImageFilter.h>
 
@@ -407,6 +410,66 @@ public:
     }
   }
 
+  /**
+   * @brief Creates a scalar 3D image of PixelType holding a gradient with a checker pattern on top of it
+   */
+  template <typename PixelType>
+  void CreateTestImage(DataContainerArray::Pointer containerArray, const DataArrayPath& path, std::vector<size_t> dims)
+  {
+    DataContainer::Pointer container = DataContainer::New(path.getDataContainerName());
+    ImageGeom::Pointer imageGeometry = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    imageGeometry->setDimensions(dims.data());
+    container->setGeometry(imageGeometry);
+    AttributeMatrix::Pointer matrix = container->createAndAddAttributeMatrix(dims, path.getAttributeMatrixName(), AttributeMatrix::Type::Cell);
+    typename DataArray<PixelType>::Pointer data = DataArray<PixelType>::CreateArray(dims, std::vector<size_t>(1, 1), path.getDataArrayName(), true);
+    size_t index = 0;
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          data->setValue(index++, static_cast<PixelType>((x * 3 + y * 2 + z * 5) % 200 + ((x / 4 + y / 4) % 2) * 40));
+        }
+      }
+    }
+    matrix->insertOrAssign(data);
+    containerArray->addOrReplaceDataContainer(container);
+  }
+
+  /**
+   * @brief Runs realFilter between two casts, input to the filter's image type and back to PixelType,
+   * the way the wrappers of real valued filters used to run them. Computes the MD5 of the result.
+   */
+  template <typename PixelType, typename RealFilterType>
+  int GetMD5FromCastToRealPipeline(DataContainer::Pointer container, const DataArrayPath& path, RealFilterType* realFilter, QString& md5)
+  {
+    try
+    {
+      typedef itk::Image<PixelType, 3> ImageType;
+      typedef itk::InPlaceDream3DDataToImageFilter<PixelType, 3> ToITKType;
+      typedef itk::CastImageFilter<ImageType, typename RealFilterType::InputImageType> ToRealType;
+      typedef itk::CastImageFilter<typename RealFilterType::OutputImageType, ImageType> FromRealType;
+      typename ToITKType::Pointer toITK = ToITKType::New();
+      toITK->SetInput(container);
+      toITK->SetAttributeMatrixArrayName(path.getAttributeMatrixName().toStdString());
+      toITK->SetDataArrayName(path.getDataArrayName().toStdString());
+      toITK->SetInPlace(true);
+      typename ToRealType::Pointer toReal = ToRealType::New();
+      toReal->SetInput(toITK->GetOutput());
+      realFilter->SetInput(toReal->GetOutput());
+      typename FromRealType::Pointer fromReal = FromRealType::New();
+      fromReal->SetInput(realFilter->GetOutput());
+      fromReal->Update();
+      return GetMD5FromITKImage<ImageType>(fromReal->GetOutput(), md5);
+    } catch(itk::ExceptionObject& e)
+    {
+      std::cerr << "Problems running the reference pipeline" << std::endl;
+      std::cerr << e.GetDescription() << std::endl;
+      return 1;
+    }
+  }
+
   template <typename PixelType, unsigned int Dimensions>
   int GetMD5FromDataContainer(std::vector<size_t> cDims, DataContainer::Pointer container, const DataArrayPath& path, QString& md5)
   {
@@ -0,0 +1,219 @@
+#pragma once
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Utilities/MontageSelection.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/IlluminationCorrection.h"
+#include "ITKImageProcessing/Test/ITKImageProcessingTestFileLocations.h"
+#include "ITKImageProcessing/Test/UnitTestSupport.hpp"
+
+class IlluminationCorrectionTest
+{
+public:
+  IlluminationCorrectionTest() = default;
+  ~IlluminationCorrectionTest() = default;
+  IlluminationCorrectionTest(const IlluminationCorrectionTest&) = delete;            // Copy Constructor
+  IlluminationCorrectionTest(IlluminationCorrectionTest&&) = delete;                 // Move Constructor
+  IlluminationCorrectionTest& operator=(const IlluminationCorrectionTest&) = delete; // Copy Assignment
+  IlluminationCorrectionTest& operator=(IlluminationCorrectionTest&&) = delete;      // Move Assignment
+
+  using Estimator = IlluminationCorrection::BackgroundEstimatorType;
+
+  const QString k_AttributeMatrixName = QString("Cell Data");
+  const QString k_DataArrayName = QString("Image Data");
+
+  static constexpr size_t k_TileWidth = 4;
+  static constexpr size_t k_TileHeight = 2;
+  static constexpr float k_Tolerance = 1.0e-4f;
+
+  // -----------------------------------------------------------------------------
+  MontageSelection createSelection(size_t numTiles)
+  {
+    MontageSelection selection;
+    selection.setPrefix("Tile_");
+    selection.setSuffix("");
+    selection.setPadding(1);
+    selection.setRowStart(0);
+    selection.setRowEnd(0);
+    selection.setColStart(0);
+    selection.setColEnd(static_cast<int>(numTiles) - 1);
+    return selection;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Creates one float tile per level. Pixel p of every tile holds its level plus p, and the
+   * levels are rotated from pixel to pixel so the tiles are never visited in sorted order.
+   */
+  DataContainerArray::Pointer createTiles(const MontageSelection& selection, const std::vector<float>& levels)
+  {
+    const QStringList dcNames = selection.getDataContainerNamesCombOrder();
+    DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(dcNames.size()), levels.size())
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    std::vector<size_t> dims = {k_TileWidth, k_TileHeight, 1};
+    const size_t numPixels = k_TileWidth * k_TileHeight;
+    for(int t = 0; t < dcNames.size(); t++)
+    {
+      DataContainer::Pointer dc = DataContainer::New(dcNames[t]);
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(dims.data());
+      image->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+      image->setOrigin(FloatVec3Type(static_cast<float>(t * k_TileWidth), 0.0f, 0.0f));
+      dc->setGeometry(image);
+
+      AttributeMatrix::Pointer am = dc->createAndAddAttributeMatrix(dims, k_AttributeMatrixName, AttributeMatrix::Type::Cell);
+      FloatArrayType::Pointer data = FloatArrayType::CreateArray(numPixels, k_DataArrayName, true);
+      for(size_t p = 0; p < numPixels; p++)
+      {
+        data->setValue(p, levels[(static_cast<size_t>(t) + p) % levels.size()] + static_cast<float>(p));
+      }
+      am->insertOrAssign(data);
+      dca->addOrReplaceDataContainer(dc);
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  IlluminationCorrection::Pointer createFilter(const std::vector<float>& levels, Estimator estimator, float trimPercent)
+  {
+    MontageSelection selection = createSelection(levels.size());
+    IlluminationCorrection::Pointer filter = IlluminationCorrection::New();
+    filter->setDataContainerArray(createTiles(selection, levels));
+    filter->setMontageSelection(selection);
+    filter->setCellAttributeMatrixName(k_AttributeMatrixName);
+    filter->setImageDataArrayName(k_DataArrayName);
+    filter->setLowThreshold(0);
+    filter->setHighThreshold(65535);
+    filter->setApplyMedianFilter(false);
+    filter->setApplyCorrection(false);
+    filter->setExportCorrectedImages(false);
+    filter->setBackgroundEstimator(static_cast<int>(estimator));
+    filter->setTrimPercent(trimPercent);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  /**
+   * @brief Runs the filter and requires every background pixel p to be expected + p
+   */
+  void requireBackground(const std::vector<float>& levels, Estimator estimator, float trimPercent, float expected)
+  {
+    IlluminationCorrection::Pointer filter = createFilter(levels, estimator, trimPercent);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    DataArrayPath backgroundPath = filter->getBackgroundImageArrayPath();
+    FloatArrayType::Pointer background = filter->getDataContainerArray()->getAttributeMatrix(backgroundPath)->getAttributeArrayAs<FloatArrayType>(backgroundPath.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(background.get())
+    DREAM3D_REQUIRE_EQUAL(background->getNumberOfTuples(), k_TileWidth * k_TileHeight)
+    for(size_t p = 0; p < background->getNumberOfTuples(); p++)
+    {
+      DREAM3D_REQUIRED(std::abs(background->getValue(p) - (expected + static_cast<float>(p))), <=, k_Tolerance)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestOddTileCount()
+  {
+    // Five tiles, one of which is a bright outlier
+    const std::vector<float> levels = {15.0f, 200.0f, 10.0f, 20.0f, 12.0f};
+
+    requireBackground(levels, Estimator::Mean, 10.0f, 257.0f / 5.0f);
+    requireBackground(levels, Estimator::Median, 10.0f, 15.0f);
+    // 20% of 5 drops one value from each end: {12, 15, 20}
+    requireBackground(levels, Estimator::TrimmedMean, 20.0f, 47.0f / 3.0f);
+    // Nothing is trimmed below one value per end, so this is the plain mean
+    requireBackground(levels, Estimator::TrimmedMean, 10.0f, 257.0f / 5.0f);
+    requireBackground(levels, Estimator::TrimmedMean, 0.0f, 257.0f / 5.0f);
+    // Trimming is capped at the median
+    requireBackground(levels, Estimator::TrimmedMean, 45.0f, 15.0f);
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestEvenTileCount()
+  {
+    const std::vector<float> levels = {200.0f, 12.0f, 10.0f, 15.0f};
+
+    requireBackground(levels, Estimator::Mean, 10.0f, 237.0f / 4.0f);
+    // The median of an even count averages the two middle values
+    requireBackground(levels, Estimator::Median, 10.0f, 13.5f);
+    requireBackground(levels, Estimator::TrimmedMean, 25.0f, 13.5f);
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestInvalidParameters()
+  {
+    const std::vector<float> levels = {10.0f, 12.0f, 15.0f};
+
+    IlluminationCorrection::Pointer filter = createFilter(levels, Estimator::Mean, 10.0f);
+    filter->setBackgroundEstimator(3);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -53031)
+
+    filter = createFilter(levels, Estimator::Mean, 10.0f);
+    filter->setBackgroundEstimator(-1);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -53031)
+
+    filter = createFilter(levels, Estimator::TrimmedMean, -1.0f);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -53032)
+
+    filter = createFilter(levels, Estimator::TrimmedMean, 50.0f);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -53032)
+
+    // The trim percent is only checked for the trimmed mean
+    filter = createFilter(levels, Estimator::Median, 75.0f);
+    filter->preflight();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- IlluminationCorrectionTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestOddTileCount())
+    DREAM3D_REGISTER_TEST(TestEvenTileCount())
+    DREAM3D_REGISTER_TEST(TestInvalidParameters())
+  }
+};
@@ -0,0 +1,242 @@
+#pragma once
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTextStream>
+
+#include <itkImage.h>
+#include <itkImageFileWriter.h>
+#include <itkTIFFImageIO.h>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/global_control.h>
+#endif
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ImportZenInfoMontage.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/util/MontageImportHelper.h"
+#include "ITKImageProcessing/Test/ITKImageProcessingTestFileLocations.h"
+#include "ITKImageProcessing/Test/UnitTestSupport.hpp"
+
+class MontageTileHeaderIndexTest
+{
+public:
+  MontageTileHeaderIndexTest() = default;
+  ~MontageTileHeaderIndexTest() = default;
+  MontageTileHeaderIndexTest(const MontageTileHeaderIndexTest&) = delete;            // Copy Constructor
+  MontageTileHeaderIndexTest(MontageTileHeaderIndexTest&&) = delete;                 // Move Constructor
+  MontageTileHeaderIndexTest& operator=(const MontageTileHeaderIndexTest&) = delete; // Copy Assignment
+  MontageTileHeaderIndexTest& operator=(MontageTileHeaderIndexTest&&) = delete;      // Move Assignment
+
+  const QString k_DataDir = UnitTest::TestTempDir + "/MontageTileHeaderIndexTest";
+  const QString k_ZenFile = k_DataDir + "/ZenInfo.xml";
+  const QString k_DataContainerName = QString("Zen");
+  const QString k_ImageDataArrayName = QString("ImageData");
+
+  static constexpr int32_t k_Rows = 2;
+  static constexpr int32_t k_Cols = 3;
+  static constexpr size_t k_TileWidth = 16;
+  static constexpr size_t k_TileHeight = 12;
+
+  // -----------------------------------------------------------------------------
+  QString tileFileName(int32_t row, int32_t col) const
+  {
+    return QString("tile_r%1c%2.tif").arg(row).arg(col);
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename PixelType>
+  void writeTile(const QString& filePath)
+  {
+    using ImageType = itk::Image<PixelType, 2>;
+    typename ImageType::Pointer image = ImageType::New();
+    typename ImageType::SizeType size = {{k_TileWidth, k_TileHeight}};
+    image->SetRegions(size);
+    image->Allocate();
+    image->FillBuffer(static_cast<PixelType>(7));
+
+    using WriterType = itk::ImageFileWriter<ImageType>;
+    typename WriterType::Pointer writer = WriterType::New();
+    writer->SetFileName(filePath.toStdString());
+    writer->SetInput(image);
+    writer->SetImageIO(itk::TIFFImageIO::New());
+    writer->Update();
+  }
+
+  // -----------------------------------------------------------------------------
+  void writeZenMontage()
+  {
+    QDir(k_DataDir).removeRecursively();
+    QDir().mkpath(k_DataDir);
+
+    QFile zenFile(k_ZenFile);
+    DREAM3D_REQUIRE_EQUAL(zenFile.open(QIODevice::WriteOnly | QIODevice::Text), true)
+    QTextStream out(&zenFile);
+    out << "<ExportDocument>\n";
+    for(int32_t row = 0; row < k_Rows; row++)
+    {
+      for(int32_t col = 0; col < k_Cols; col++)
+      {
+        writeTile<uint8_t>(k_DataDir + "/" + tileFileName(row, col));
+        // Tiles are spaced further apart than the importer's default tolerance
+        out << "  <Image>\n";
+        out << "    <Filename>" << tileFileName(row, col) << "</Filename>\n";
+        out << "    <Bounds StartX=\"" << col * 500 << "\" SizeX=\"" << k_TileWidth << "\" StartY=\"" << row * 500 << "\" SizeY=\"" << k_TileHeight
+            << "\" StartC=\"0\" StartS=\"0\" StartB=\"0\" StartM=\"0\" />\n";
+        out << "  </Image>\n";
+      }
+    }
+    out << "</ExportDocument>\n";
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer preflightZenMontage(const IntVec2Type& columns, const IntVec2Type& rows)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    ImportZenInfoMontage::Pointer filter = ImportZenInfoMontage::New();
+    filter->setDataContainerArray(dca);
+    filter->setInputFile(k_ZenFile);
+    filter->setDataContainerPath(DataArrayPath(k_DataContainerName, "", ""));
+    filter->setCellAttributeMatrixName("Cell Data");
+    filter->setImageDataArrayName(k_ImageDataArrayName);
+    filter->setColumnMontageLimits(columns);
+    filter->setRowMontageLimits(rows);
+    filter->preflight();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(filter->getColumnCount(), k_Cols)
+    DREAM3D_REQUIRE_EQUAL(filter->getRowCount(), k_Rows)
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  QString tileArrayType(const DataContainerArray::Pointer& dca, int32_t row, int32_t col)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(QString("%1r%2c%3").arg(k_DataContainerName).arg(row).arg(col));
+    DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+    IDataArray::Pointer data = dc->getAttributeMatrix("Cell Data")->getAttributeArray(k_ImageDataArrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(data.get())
+    return data->getTypeAsString();
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestZenMontageLimits()
+  {
+    writeZenMontage();
+
+    // The last row and column must be accepted; they used to fail with -400/-401
+    preflightZenMontage(IntVec2Type(0, k_Cols - 1), IntVec2Type(0, k_Rows - 1));
+    preflightZenMontage(IntVec2Type(k_Cols - 1, k_Cols - 1), IntVec2Type(k_Rows - 1, k_Rows - 1));
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestHeaderIndexLocation()
+  {
+    writeZenMontage();
+    const QString indexFilePath = MontageImportHelper::TileHeaderIndexFilePath(k_ZenFile);
+    QFile::remove(indexFilePath);
+
+    DataContainerArray::Pointer dca = preflightZenMontage(IntVec2Type(0, k_Cols - 1), IntVec2Type(0, k_Rows - 1));
+    DREAM3D_REQUIRE_EQUAL(tileArrayType(dca, 1, 2), QString("uint8_t"))
+
+    // Preflight must not write anything into the data set's folder
+    DREAM3D_REQUIRE_EQUAL(QFileInfo(indexFilePath).exists(), true)
+    DREAM3D_REQUIRE_EQUAL(QFileInfo(indexFilePath).absolutePath().startsWith(QFileInfo(k_DataDir).absoluteFilePath()), false)
+    DREAM3D_REQUIRE_EQUAL(QDir(k_DataDir).entryList(QDir::Files).size(), k_Rows * k_Cols + 1)
+
+    // A tile that changed on disk is read again instead of being taken from the index
+    writeTile<uint16_t>(k_DataDir + "/" + tileFileName(1, 2));
+    dca = preflightZenMontage(IntVec2Type(0, k_Cols - 1), IntVec2Type(0, k_Rows - 1));
+    DREAM3D_REQUIRE_EQUAL(tileArrayType(dca, 1, 2), QString("uint16_t"))
+    DREAM3D_REQUIRE_EQUAL(tileArrayType(dca, 0, 0), QString("uint8_t"))
+
+    QFile::remove(indexFilePath);
+    QDir(k_DataDir).removeRecursively();
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestImportWithOneTbbThread()
+  {
+    writeZenMontage();
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    // The tiles must still be read when TBB may not run any task besides the calling thread
+    tbb::global_control singleThread(tbb::global_control::max_allowed_parallelism, 1);
+#endif
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    ImportZenInfoMontage::Pointer filter = ImportZenInfoMontage::New();
+    filter->setDataContainerArray(dca);
+    filter->setInputFile(k_ZenFile);
+    filter->setDataContainerPath(DataArrayPath(k_DataContainerName, "", ""));
+    filter->setCellAttributeMatrixName("Cell Data");
+    filter->setImageDataArrayName(k_ImageDataArrayName);
+    filter->setColumnMontageLimits(IntVec2Type(0, k_Cols - 1));
+    filter->setRowMontageLimits(IntVec2Type(0, k_Rows - 1));
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    for(int32_t row = 0; row < k_Rows; row++)
+    {
+      for(int32_t col = 0; col < k_Cols; col++)
+      {
+        DataContainer::Pointer dc = dca->getDataContainer(QString("%1r%2c%3").arg(k_DataContainerName).arg(row).arg(col));
+        DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+        UInt8ArrayType::Pointer data = dc->getAttributeMatrix("Cell Data")->getAttributeArrayAs<UInt8ArrayType>(k_ImageDataArrayName);
+        DREAM3D_REQUIRE_VALID_POINTER(data.get())
+        DREAM3D_REQUIRE_EQUAL(data->isAllocated(), true)
+        DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), k_TileWidth * k_TileHeight)
+        DREAM3D_REQUIRE_EQUAL(data->getValue(0), 7)
+        DREAM3D_REQUIRE_EQUAL(data->getValue(k_TileWidth * k_TileHeight - 1), 7)
+      }
+    }
+
+    QFile::remove(MontageImportHelper::TileHeaderIndexFilePath(k_ZenFile));
+    QDir(k_DataDir).removeRecursively();
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "---------------- MontageTileHeaderIndexTest ---------------------" << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestZenMontageLimits())
+    DREAM3D_REGISTER_TEST(TestHeaderIndexLocation())
+    DREAM3D_REGISTER_TEST(TestImportWithOneTbbThread())
+  }
+};
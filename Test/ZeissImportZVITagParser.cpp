@@ -147,167 +147,12 @@ void makeHeaderFile(const QString filename)
   hOut.close();
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-QStringList GenerateZeissInitIdNameMap()
-{
-  QString contents;
-  {
-    // Read the Source File
-    QFileInfo fi(getZVITagsFile());
-    QFile source(getZVITagsFile());
-    source.open(QFile::ReadOnly);
-    contents = source.readAll();
-    source.close();
-  }
-  QStringList outLines;
-  QStringList strLines;
-  QStringList list = contents.split(QRegExp("\\n"));
-  QStringListIterator sourceLines(list);
-
-  while(sourceLines.hasNext())
-  {
-    QString line = sourceLines.next();
-
-    int spaceIdx = line.indexOf(' ', 0);
-    QString tagId = line.left(spaceIdx);
-    QString value = line.mid(spaceIdx + 1);
-    value = cleanupValue(value);
-
-    QString out = QString("  _idNameMap[Zeiss::MetaXML::%1Id] = Zeiss::MetaXML::%1;\n").arg(value);
-    outLines.append(out);
-  }
-
-  outLines.append("\n");
-
-  return outLines + strLines;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-QStringList GenerateZeissInitNameIdMap()
-{
-  QString contents;
-  {
-    // Read the Source File
-    QFileInfo fi(getZVITagsFile());
-    QFile source(getZVITagsFile());
-    source.open(QFile::ReadOnly);
-    contents = source.readAll();
-    source.close();
-  }
-  QStringList outLines;
-  QStringList strLines;
-  QStringList list = contents.split(QRegExp("\\n"));
-  QStringListIterator sourceLines(list);
-
-  while(sourceLines.hasNext())
-  {
-    QString line = sourceLines.next();
-
-    int spaceIdx = line.indexOf(' ', 0);
-    QString tagId = line.left(spaceIdx);
-    QString value = line.mid(spaceIdx + 1);
-    value = cleanupValue(value);
-
-    QString out = QString("  _nameIdMap[Zeiss::MetaXML::%1] = Zeiss::MetaXML::%1Id;\n").arg(value);
-    outLines.append(out);
-  }
-
-  outLines.append("\n");
-
-  return outLines + strLines;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-QStringList GenerateZeissInitFactoryMap()
-{
-  QString contents;
-  {
-    // Read the Source File
-    QFileInfo fi(getZVITagsFile());
-    QFile source(getZVITagsFile());
-    source.open(QFile::ReadOnly);
-    contents = source.readAll();
-    source.close();
-  }
-  QStringList outLines;
-  QStringList strLines;
-  QStringList list = contents.split(QRegExp("\\n"));
-  QStringListIterator sourceLines(list);
-
-  while(sourceLines.hasNext())
-  {
-    QString line = sourceLines.next();
-
-    int spaceIdx = line.indexOf(' ', 0);
-    QString tagId = line.left(spaceIdx);
-    QString value = line.mid(spaceIdx + 1);
-    value = cleanupValue(value);
-
-    QString out = QString("  _idFactoryMap[Zeiss::MetaXML::%1Id] = StringZeissMetaFactory::NewZeissMetaFactory();\n").arg(value);
-    outLines.append(out);
-  }
-
-  outLines.append("\n");
-
-  return outLines + strLines;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void makeCPPFile(const QString filename)
-{
-  QFileInfo fi2(filename);
-
-  QFile hOut(filename);
-
-  hOut.open(QFile::WriteOnly);
-
-  QTextStream stream(&hOut);
-
-  QStringList outLines = GenerateZeissInitIdNameMap();
-
-  stream << "/** THIS FILE WAS AUTO-GENERATED FROM THE ZVI_TAGS.TXT FILE WHICH WAS MANUALLY GENERATED FROM\n";
-  stream << "* THE ZVI DOCUMENTATION FILE THAT IS DOWNLOADED FROM CARL ZEISS UNDER LICENSE.\n";
-  stream << "*/\n\n";
-  stream << "// -----------------------------------------------------------------------------\n";
-  stream << "//\n";
-  stream << "// -----------------------------------------------------------------------------\n";
-  stream << "void ZeissTagMapping::initIdNameMap()\n{\n";
-  stream << outLines.join("");
-  stream << "}\n\n";
-
-  outLines = GenerateZeissInitNameIdMap();
-  stream << "// -----------------------------------------------------------------------------\n";
-  stream << "//\n";
-  stream << "// -----------------------------------------------------------------------------\n";
-  stream << "void ZeissTagMapping::initNameIdMap()\n{\n";
-  stream << outLines.join("");
-  stream << "}\n\n";
-
-  outLines = GenerateZeissInitFactoryMap();
-  stream << "// -----------------------------------------------------------------------------\n";
-  stream << "//\n";
-  stream << "// -----------------------------------------------------------------------------\n";
-  stream << "void ZeissTagMapping::initFactoryMap()\n{\n";
-  stream << outLines.join("");
-  stream << "}\n\n";
-
-  hOut.close();
-}
-
 int main(int argc, char* argv[])
 {
 
   makeHeaderFile(ITKImageProcessingConstants::Tools::ZeissTagMappingConstantsFile);
 
-  makeCPPFile(ITKImageProcessingConstants::Tools::ZeissInitIdNameMapFile);
+  // The id/name/type lookup tables in ZeissXml/ZeissTagMapping_Table.h are generated by Utilities/GenerateZeissTagTable.py
 
   return 0;
 }
@@ -0,0 +1,419 @@
+#!/usr/bin/env python
+""" Generates ZeissXml/ZeissTagMapping_Table.h from ZVI_Tags.txt
+
+Every line of ZVI_Tags.txt is "<id> <Human Readable Name>". The name is turned into the
+same identifier that ZeissTagMappingConstants.h uses, the <ROOT><Scaling> entries are
+appended and the result is written as constexpr arrays together with minimal perfect
+hash tables for the id -> tag and name -> tag lookups.
+
+Usage:
+
+./GenerateZeissTagTable.py -i ../ZVI_Tags.txt -o ../ZeissXml/ZeissTagMapping_Table.h
+"""
+import argparse
+import re
+import sys
+
+# Names that do not follow the generic rules in sanitize_name()
+NAME_OVERRIDES = {
+    1026: 'Eight_bitAcquisition',
+}
+
+# Entries of the <ROOT><Scaling> section. They are not part of the ZVI documentation so
+# they get ids past the end of the documented range.
+SCALING_TAGS = [
+    (20000, 'Factor_0'), (20001, 'Type_0'), (20002, 'Unit_0'), (20003, 'Origin_0'), (20004, 'Angle_0'),
+    (20005, 'Factor_1'), (20006, 'Type_1'), (20007, 'Unit_1'), (20008, 'Origin_1'), (20009, 'Angle_1'),
+    (20010, 'Factor_2'), (20011, 'Type_2'), (20012, 'Unit_2'), (20013, 'Origin_2'), (20014, 'Angle_2'),
+]
+
+# Tags whose values are parsed as numbers, by name. Everything else (names, dates, times, file
+# paths, free text and the device settings that hold a name) is kept as a string. On/off flags,
+# modes, positions of turrets and filter wheels, counts, indices and pixel sizes are integers;
+# anything measured in a physical unit or that may carry a fraction is a float.
+INT32_TAGS = [
+    'ImageOverExposure', 'ImageWidthPixel', 'ImageHeightPixel', 'ImageCountRaw', 'PixelType', 'NumberRawImages',
+    'ImageSize', 'CompressionFactorForSave', 'DocumentSaveFlags', 'AcquisitionBitDepth', 'Z_Stacksinglerepresentative',
+    'ScaleUnitforX', 'ScaleUnitforY', 'ScaleUnitforZ',
+    'Eight_bitAcquisition', 'CameraBitDepth', 'CameraTriggerSignalType', 'CameraTriggerEnable', 'GrabberTimeout',
+    'MultiChannelEnabled', 'MultichannelColour', 'FileAttributes',
+    'ReflectedLightShutter', 'CondenserFrontLens', 'LightPath', 'HalogenLampOn', 'HalogenLampMode', 'LightManagerisEnabled',
+    'MicroscopeIllumination', 'ExternalShutter1', 'ExternalShutter2', 'ExternalShutter3', 'ParfocalCorrection',
+    'ExternalShutter4', 'ExternalShutter5', 'ExternalShutter6', 'ObjectiveTurretPosition', 'ObjectiveContrastMethod',
+    'ObjectiveImmersionType', 'ReflectorPosition', 'TransmittedLightFilter1Position', 'TransmittedLightFilter2Position',
+    'ExcitationFilterPosition', 'LampMirrorPositionERSETZTDURCH241', 'ExternalFilterWheel1Position',
+    'ExternalFilterWheel2Position', 'ExternalFilterWheel3Position', 'ExternalFilterWheel4Position', 'LightmanagerMode',
+    'HalogenLampCalibration', 'Focuscalibrated', 'FocusPower', 'Stagecalibrated', 'StagePower', 'LampMirrorPosition',
+    'MicroscopeType', 'ExternalShutter', 'ObjectiveImmersionStop', 'ReflectedLightFilter1Position',
+    'ReflectedLightFilter2Position', 'TransmittedLightShutter', 'TransmittedLightVirtualFilterPosition',
+    'ReflectedLightVirtualFilterPosition', 'ReflectedLightHalogenLampMode', 'ContrastmanagerMode', 'DazzleProtectionActive',
+    'LightzoomCoupled', 'TransmittedLightHalogenLampMode', 'ReflectedColdlightMode', 'TransmittedColdlightMode',
+    'InfinityspacePortchangerPosition', 'TwoTvVisCamChangerPosition', 'TwoTvCamerasChangerPosition', 'OcularShutter',
+    'MicroscopePort', 'StageJoystickEnabled', 'ContrastmanagerContrastMethod', 'CamerasChangerBeamSplitterType',
+    'RearportSliderPosition', 'RearportSource', 'BeamsplitterTypeInfinitySpace', 'FluorescenceAttenuatorPosition',
+    'CameraFramestartLeft', 'CameraFramestartTop', 'CameraFrameWidth', 'CameraFrameHeight', 'CameraBinning',
+    'CameraFrameFull', 'DataFormatUseScaling', 'CameraFrameImageOrientation', 'VideoMonochromeSignalType',
+    'VideoColorSignalType', 'MeteorChannelInput', 'MeteorChannelSync', 'WhiteBalanceEnabled',
+    'MeteorCameraType', 'CameraExposureTimeAutoCalculate', 'MeteorGainAutomatic', 'CameraExposureTimeCalculationControl',
+    'AxioCamFadingCorrectionEnable', 'CameraLiveImage', 'CameraLiveEnabled', 'CameraLiveSpeed', 'CameraImageWidth',
+    'CameraImageHeight', 'CameraImagePixelType', 'CameraLiveImageWidth', 'CameraLiveImageHeight',
+    'CameraLiveImagePixelType', 'CameraLiveBinning',
+    'ImageIndexU', 'ImageIndexV', 'ImageIndexZ', 'ImageIndexC', 'ImageIndexT', 'ImageTileIndex', 'ImageacquisitionIndex',
+    'ImageCountTiles', 'ImageCountA', 'ImageIndexS', 'ImageIndexRaw', 'ImageCountZ', 'ImageCountC', 'ImageCountT',
+    'ImageCountU', 'ImageCountV', 'ImageCountS', 'LayerDrawFlags', 'PvCamClockingMode',
+    'AutofocusStatusReport', 'AutofocusCurrentCalibrationItem',
+    'Type_0', 'Type_1', 'Type_2',
+    'CameraFrameFullWidth', 'CameraFrameFullHeight', 'AxioCamShutterSignal', 'AxioCamShutterControl',
+    'AxioCamBlackRefIsCalculated', 'AxioCamBlackReference', 'CameraShadingCorrection', 'AxioCamEnhanceColor',
+    'AxioCamNIRMode', 'CameraWhiteBalanceAutoCalculate', 'AxioCamNIRModeAvailable', 'AxioCamFadingCorrectionAvailable',
+    'AxioCamEnhanceColorAvailable', 'MeteorVideoNorm', 'MeteorAdjustWhiteReference', 'MeteorBlackReference',
+    'MeteorChannelInputCountMono', 'MeteorChannelInputCountRGB', 'MeteorEnableVCR', 'AxioCamSelector', 'AxioCamType',
+    'AxioCamResolution', 'AxioCamColourModel', 'AxioCamMicroScanning', 'AmplificationIndex', 'BeamLocation',
+    'ComponentType', 'ControllerType', 'ApotomeCamCalibrationMode', 'ApoTomeGridPosition', 'ApotomeCamScannerPosition',
+    'ApoTomeProcessingMode', 'ApotomeCamLiveCombineMode', 'ApotomeCamFilterHarmonics', 'ApoTomeAutoShutterUsed',
+    'ApotomeCamStatus', 'ApotomeCamNormalize', 'DeepviewCamSupervisorMode', 'DeepViewProcessing', 'DeepviewCamStatus',
+    'CameraShadingIsCalculated', 'CameraShadingAutoCalculate', 'CameraTriggerAvailable', 'CameraShutterAvailable',
+    'AxioCamShutterMicroScanningEnable', 'ApotomeCamLiveFocus', 'DeviceInitStatus', 'DeviceErrorStatus',
+    'ApotomeCamSliderInGridPosition', 'OrcaNIRModeUsed', 'OrcaBinning', 'OrcaBitDepth', 'ApoTomeAveragingCount',
+    'ApotomeCamLivePhase', 'DualAxioCamAlgorithmType', 'AxioCamHSBufferNumber', 'AxioCamAnalogGainEnable',
+    'AxioCamAnalogGainAvailable', 'ApotomeCamImageFormat', 'CameraShadingCount', 'CameraImageRawSize',
+    'ApotomeCamBurstMode', 'CameraLutEnable', 'CameraColorCorrection', 'CameraColorProcessingEnable',
+    'CameraShutterSignalPort', 'ApotomeCamCamCalibMode', 'ApotomeCamAdminCalibMode', 'ApotomeCamIsAdmin',
+    'CameraShutterLiveEnable',
+]
+
+INT64_TAGS = [
+    'FileSize',
+]
+
+FLOAT_TAGS = [
+    'BlackValue', 'Whitevalue', 'GammaValue',
+    'ScaleFactorForX', 'ScaleWidth', 'ScaleFactorForY', 'ScaleHeight', 'ScaleFactorForZ', 'ScaleDepth',
+    'MonoReferenceLow', 'MonoReferenceHigh', 'RedReferenceLow', 'RedReferenceHigh', 'GreenReferenceLow',
+    'GreenReferenceHigh', 'BlueReferenceLow', 'BlueReferenceHigh', 'MultichannelWeight',
+    'Optovar', 'TransmittedLightFieldstopAperture', 'ReflectedLightAperture', 'CondenserN_A_', 'HalogenLampVoltage',
+    'FluorescenceLampLevel', 'FluorescenceLampIntensity', 'FocusPosition', 'StagePositionX', 'StagePositionY',
+    'ObjectiveMagnification', 'ObjectiveN_A_', 'CondenserNAGoSpeed', 'TransmittedLightFieldstopGoSpeed',
+    'OptovarGoSpeed', 'FocusBasicPosition', 'FocusBacklash', 'FocusMeasurementOrigin', 'FocusMeasurementDistance',
+    'FocusSpeed', 'FocusGoSpeed', 'FocusDistance', 'FocusInitPosition', 'StageXBacklash', 'StageYBacklash',
+    'StageSpeedX', 'StageSpeedY', 'StageSpeed', 'StageGoSpeedX', 'StageGoSpeedY', 'StageStepDistanceX',
+    'StageStepDistanceY', 'StageInitialisationPositionX', 'StageInitialisationPositionY', 'MicroscopeMagnification',
+    'ReflectorMagnification', 'FocusDepth', 'ObjectiveWorkingDistance', 'ReflectedLightApertureGoSpeed',
+    'FocusStartSpeed', 'FocusAcceleration', 'ReflectedLightFieldstop', 'ReflectedLightFieldstopGoSpeed',
+    'TransmittedLightAttenuator', 'ReflectedLightAttenuator', 'TransmittedLightAttenuatorGoSpeed',
+    'ReflectedLightAttenuatorGoSpeed', 'ReflectedLightHalogenLampVoltage', 'ReflectedLightHalogenLampColourTemperature',
+    'Zoom', 'ZoomGoSpeed', 'LightZoom', 'LightZoomGoSpeed', 'TransmittedLightHalogenLampVoltage',
+    'TransmittedLightHalogenLampColourTemperature', 'ReflectedColdlightIntensity', 'ReflectedColdlightColourTemperature',
+    'TransmittedColdlightIntensity', 'TransmittedColdlightColourTemperature', 'LightWaveLength', 'OcularMagnification',
+    'CameraAdapterMagnification', 'OcularTotalMagnification', 'FieldofView',
+    'CameraFramePixelDistance', 'CameraWhiteBalanceRed', 'CameraWhiteBalanceGreen', 'CameraWhiteBalanceBlue',
+    'CameraFrameScalingFactor', 'ExposureTime_ms_', 'MeteorGainValue', 'MeteorAdjustHue', 'MeteorAdjustSaturation',
+    'MeteorAdjustRedLow', 'MeteorAdjustGreenLow', 'MeteorBlueLow', 'MeteorAdjustRedHigh', 'MeteorAdjustGreenHigh',
+    'MeteorBlueHigh', 'CameraLiveMaximumSpeed', 'CameraLiveGainValue', 'CameraLiveExposureTimeValue',
+    'CameraLiveScalingFactor', 'OriginalStagePositionX', 'OriginalStagePositionY',
+    'AutofocusPosition', 'AutofocusPositionOffset', 'AutofocusEmptyFieldThreshold',
+    'Factor_0', 'Origin_0', 'Angle_0', 'Factor_1', 'Origin_1', 'Angle_1', 'Factor_2', 'Origin_2', 'Angle_2',
+    'AxioCamDelayTime', 'CameraShutterCloseDelay', 'MeteorBrightness', 'MeteorContrast',
+    'CameraWhiteBalanceCalculationRedPaint', 'CameraWhiteBalanceCalculationBluePaint', 'CameraWhiteBalanceSetRed',
+    'CameraWhiteBalanceSetGreen', 'CameraWhiteBalanceSetBlue', 'CameraWhiteBalanceSetTargetRed',
+    'CameraWhiteBalanceSetTargetGreen', 'CameraWhiteBalanceSetTargetBlue', 'ApoTomeFullPhaseShift',
+    'ApotomeFilterStrength', 'ApoTomeGratingPeriod', 'OrcaAnalogGain', 'OrcaAnalogOffset', 'DeepViewDoF', 'DeepViewEDoF',
+    'RoperCamGain', 'RoperCamPixelClock', 'RoperCamTemperature', 'ApotomeCamDecay', 'ApotomeCamEpsilon',
+    'AxioCamHSFrameTime', 'ApotomeGratingPeriodMeasured', 'AxioCamSaturation', 'CameraAnalogGain',
+    'CameraWhiteBalanceTargetPosX', 'CameraWhiteBalanceTargetPosY', 'AxioCamICSaturation', 'ApotomeCamCamCalibValue',
+]
+
+
+def tag_types():
+    """ name -> ValueType enumerator for every numeric tag """
+    types = {}
+    for names, value_type in ((INT32_TAGS, 'Int32'), (INT64_TAGS, 'Int64'), (FLOAT_TAGS, 'Float')):
+        for name in names:
+            if name in types:
+                sys.exit('Tag %s is listed as both %s and %s' % (name, types[name], value_type))
+            types[name] = value_type
+    return types
+
+
+MASK32 = 0xFFFFFFFF
+
+
+def sanitize_name(name):
+    """ 'Image Width (Pixel)' -> 'ImageWidthPixel', 'Exposure Time [ms]' -> 'ExposureTime_ms_' """
+    name = name.replace(' ', '')
+    name = re.sub(r'[()!]', '', name)
+    return re.sub(r'[^A-Za-z0-9_]', '_', name)
+
+
+def hash_name(name, seed):
+    """ FNV-1a. Must match ZeissTagTable::HashName() """
+    h = (2166136261 ^ seed) & MASK32
+    for c in name.encode('ascii'):
+        h ^= c
+        h = (h * 16777619) & MASK32
+    return h
+
+
+def hash_id(tag_id, seed):
+    """ Murmur3 finalizer. Must match ZeissTagTable::HashId() """
+    h = ((tag_id & MASK32) ^ ((seed * 0x9E3779B9) & MASK32)) & MASK32
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & MASK32
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK32
+    h ^= h >> 16
+    return h
+
+
+def build_perfect_hash(keys, hash_fn):
+    """ Hash and displace: returns the displacement table and the key stored in every slot """
+    size = len(keys)
+    buckets = [[] for _ in range(size)]
+    for key in keys:
+        buckets[hash_fn(key, 0) % size].append(key)
+
+    displacements = [0] * size
+    slots = [None] * size
+    order = sorted(range(size), key=lambda b: len(buckets[b]), reverse=True)
+    for b in order:
+        bucket = buckets[b]
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        while True:
+            candidate = [hash_fn(key, seed) % size for key in bucket]
+            if len(set(candidate)) == len(candidate) and all(slots[s] is None for s in candidate):
+                break
+            seed += 1
+        displacements[b] = seed
+        for key, s in zip(bucket, candidate):
+            slots[s] = key
+
+    # Buckets with a single key go straight into a free slot, stored as -(slot + 1)
+    free = [s for s in range(size) if slots[s] is None]
+    for b in order:
+        bucket = buckets[b]
+        if len(bucket) != 1:
+            continue
+        s = free.pop()
+        displacements[b] = -(s + 1)
+        slots[s] = bucket[0]
+
+    return displacements, slots
+
+
+def lookup(displacements, slots, key, hash_fn):
+    size = len(slots)
+    d = displacements[hash_fn(key, 0) % size]
+    s = -d - 1 if d < 0 else hash_fn(key, d) % size
+    return slots[s]
+
+
+def read_tags(path):
+    tags = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line:
+                continue
+            tag_id, name = line.split(None, 1)
+            tag_id = int(tag_id)
+            tags.append((tag_id, NAME_OVERRIDES.get(tag_id, sanitize_name(name))))
+    return tags + SCALING_TAGS
+
+
+def format_array(values, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(v) for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generates the constexpr Zeiss tag table')
+    parser.add_argument('-i', '--input', required=True, help='Path to ZVI_Tags.txt')
+    parser.add_argument('-o', '--output', required=True, help='Path to ZeissTagMapping_Table.h')
+    args = parser.parse_args()
+
+    tags = read_tags(args.input)
+
+    # A name may only appear once. An id that appears twice keeps every name, and the id
+    # resolves to the last one, the same way the old QMap based table behaved.
+    names = [name for _, name in tags]
+    types = tag_types()
+    unknown = sorted(set(types) - set(names))
+    if unknown:
+        sys.exit('Typed tags that are not in the tag list: %s' % ', '.join(unknown))
+    duplicates = set(n for n in names if names.count(n) > 1)
+    if duplicates:
+        sys.exit('Duplicate tag names: %s' % ', '.join(sorted(duplicates)))
+
+    entries = sorted(enumerate(tags), key=lambda e: (e[1][0], e[0]))
+    entries = [tag for _, tag in entries]
+    entry_index = {name: i for i, (_, name) in enumerate(entries)}
+    id_index = {}
+    for i, (tag_id, _) in enumerate(entries):
+        id_index[tag_id] = i
+
+    name_disp, name_slots = build_perfect_hash([name for _, name in entries], hash_name)
+    id_disp, id_slots = build_perfect_hash(sorted(id_index), hash_id)
+
+    for tag_id, name in entries:
+        assert lookup(name_disp, name_slots, name, hash_name) == name
+    for tag_id in id_index:
+        assert lookup(id_disp, id_slots, tag_id, hash_id) == tag_id
+
+    out = []
+    out.append(HEADER)
+    out.append('constexpr size_t k_TagCount = %d;' % len(entries))
+    out.append('constexpr size_t k_IdCount = %d;' % len(id_index))
+    out.append('constexpr size_t k_MaxNameLength = %d;' % max(len(name) for _, name in entries))
+    out.append('')
+    out.append('// Sorted by id')
+    out.append('constexpr std::array<TagEntry, k_TagCount> k_Tags = {{')
+    for tag_id, name in entries:
+        out.append('    {%d, "%s", ValueType::%s},' % (tag_id, name, types.get(name, 'String')))
+    out.append('}};')
+    out.append('')
+    out.append('constexpr std::array<int32_t, k_TagCount> k_NameDisplacements = {{')
+    out.append(format_array(name_disp, 16))
+    out.append('}};')
+    out.append('')
+    out.append('constexpr std::array<uint16_t, k_TagCount> k_NameSlots = {{')
+    out.append(format_array([entry_index[n] for n in name_slots], 16))
+    out.append('}};')
+    out.append('')
+    out.append('constexpr std::array<int32_t, k_IdCount> k_IdDisplacements = {{')
+    out.append(format_array(id_disp, 16))
+    out.append('}};')
+    out.append('')
+    out.append('constexpr std::array<uint16_t, k_IdCount> k_IdSlots = {{')
+    out.append(format_array([id_index[i] for i in id_slots], 16))
+    out.append('}};')
+    out.append(FOOTER)
+
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out))
+
+
+HEADER = '''/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+/** THIS FILE WAS AUTO-GENERATED FROM THE ZVI_TAGS.TXT FILE BY Utilities/GenerateZeissTagTable.py.
+ * DO NOT EDIT BY HAND, RERUN THE SCRIPT INSTEAD.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace ZeissTagTable
+{
+
+enum class ValueType : uint8_t
+{
+  String,
+  Int32,
+  Int64,
+  Float
+};
+
+struct TagEntry
+{
+  int32_t Id;
+  std::string_view Name;
+  ValueType Type;
+};
+
+/**
+ * @brief FNV-1a hash of a tag name. GenerateZeissTagTable.py uses the same function to build the tables.
+ */
+constexpr uint32_t HashName(std::string_view name, uint32_t seed)
+{
+  uint32_t hash = 2166136261u ^ seed;
+  for(char c : name)
+  {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * @brief Murmur3 finalizer of a tag id. GenerateZeissTagTable.py uses the same function to build the tables.
+ */
+constexpr uint32_t HashId(int32_t id, uint32_t seed)
+{
+  uint32_t hash = static_cast<uint32_t>(id) ^ (seed * 0x9E3779B9u);
+  hash ^= hash >> 16;
+  hash *= 0x85EBCA6Bu;
+  hash ^= hash >> 13;
+  hash *= 0xC2B2AE35u;
+  hash ^= hash >> 16;
+  return hash;
+}
+'''
+
+FOOTER = '''
+/**
+ * @brief Returns the entry for a tag id or nullptr if the id is unknown. An unknown id lands on an
+ * arbitrary slot, so the id stored in that slot is always compared.
+ */
+constexpr const TagEntry* FindById(int32_t id)
+{
+  int32_t displacement = k_IdDisplacements[HashId(id, 0) % k_IdCount];
+  size_t slot = displacement < 0 ? static_cast<size_t>(-displacement - 1) : HashId(id, static_cast<uint32_t>(displacement)) % k_IdCount;
+  const TagEntry& entry = k_Tags[k_IdSlots[slot]];
+  return entry.Id == id ? &entry : nullptr;
+}
+
+/**
+ * @brief Returns the entry for a tag name or nullptr if the name is unknown.
+ */
+constexpr const TagEntry* FindByName(std::string_view name)
+{
+  int32_t displacement = k_NameDisplacements[HashName(name, 0) % k_TagCount];
+  size_t slot = displacement < 0 ? static_cast<size_t>(-displacement - 1) : HashName(name, static_cast<uint32_t>(displacement)) % k_TagCount;
+  const TagEntry& entry = k_Tags[k_NameSlots[slot]];
+  return entry.Name == name ? &entry : nullptr;
+}
+
+static_assert(FindById(515) != nullptr && FindById(515)->Name == "ImageWidthPixel", "Zeiss id lookup is broken");
+static_assert(FindByName("StagePositionX") != nullptr && FindByName("StagePositionX")->Id == 2073, "Zeiss name lookup is broken");
+static_assert(FindById(-1) == nullptr && FindByName("NotAZeissTag") == nullptr, "Zeiss lookups must reject unknown keys");
+
+} // namespace ZeissTagTable
+'''
+
+if __name__ == '__main__':
+    main()
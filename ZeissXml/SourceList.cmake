@@ -5,6 +5,7 @@ set(ZeissXml_SRCS
    ${${PLUGIN_NAME}_SOURCE_DIR}/ZeissXml/ZeissMetaFactory.cpp
    ${${PLUGIN_NAME}_SOURCE_DIR}/ZeissXml/ZeissTagMapping.cpp
    ${${PLUGIN_NAME}_SOURCE_DIR}/ZeissXml/ZeissTagsXmlSection.cpp
+   ${${PLUGIN_NAME}_SOURCE_DIR}/ZeissXml/ZeissXmlReader.cpp
 )
 
 
@@ -13,7 +14,9 @@ set(ZeissXml_HDRS
    ${${PLUGIN_NAME}_SOURCE_DIR}/ZeissXml/ZeissMetaFactory.h
    ${${PLUGIN_NAME}_SOURCE_DIR}/ZeissXml/ZeissTagMapping.h
    ${${PLUGIN_NAME}_SOURCE_DIR}/ZeissXml/ZeissTagsXmlSection.h
+   ${${PLUGIN_NAME}_SOURCE_DIR}/ZeissXml/ZeissXMLReader.h
    ${${PLUGIN_NAME}_SOURCE_DIR}/ZeissXml/ZeissTagMappingConstants.h
+   ${${PLUGIN_NAME}_SOURCE_DIR}/ZeissXml/ZeissTagMapping_Table.h
 )
 
 
@@ -170,6 +170,16 @@
     }                                                                                                                                                                                                  \
     return array;                                                                                                                                                                                      \
   }                                                                                                                                                                                                    \
+  bool ClassName::setDataArrayValue(IDataArray* dataArray, size_t tupleIndex) const                                                                                                                    \
+  {                                                                                                                                                                                                    \
+    auto* array = dynamic_cast<DataArray<Type>*>(dataArray);                                                                                                                                           \
+    if(nullptr == array || tupleIndex >= array->getNumberOfTuples())                                                                                                                                   \
+    {                                                                                                                                                                                                  \
+      return false;                                                                                                                                                                                    \
+    }                                                                                                                                                                                                  \
+    array->setValue(tupleIndex, m_Value);                                                                                                                                                              \
+    return true;                                                                                                                                                                                       \
+  }                                                                                                                                                                                                    \
   void ClassName::printValue(std::ostream& out) const                                                                                                                                                  \
   {                                                                                                                                                                                                    \
     out << m_Value;                                                                                                                                                                                    \
@@ -226,6 +236,18 @@ IDataArray::Pointer StringZeissMetaEntry::createDataArray(bool allocate) const
   }
   return array;
 }
+
+bool StringZeissMetaEntry::setDataArrayValue(IDataArray* dataArray, size_t tupleIndex) const
+{
+  auto* array = dynamic_cast<StringDataArray*>(dataArray);
+  if(nullptr == array || tupleIndex >= array->getNumberOfTuples())
+  {
+    return false;
+  }
+  array->setValue(tupleIndex, m_Value);
+  return true;
+}
+
 bool StringZeissMetaEntry::setValue(const QString& value)
 {
   m_Value = value;
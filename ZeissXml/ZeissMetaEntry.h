@@ -120,6 +120,14 @@ public:
 
   virtual IDataArrayShPtrType createDataArray(bool allocate = true) const = 0;
 
+  /**
+   * @brief Writes the value into one tuple of a column created by the ZeissMetaFactory for this tag.
+   * @param dataArray
+   * @param tupleIndex
+   * @return false if the array is not of the matching type or the index is out of range
+   */
+  virtual bool setDataArrayValue(IDataArray* dataArray, size_t tupleIndex) const = 0;
+
 protected:
   AbstractZeissMetaData();
 
@@ -176,6 +184,7 @@ public:
   QString toString() const override;
 
   IDataArrayShPtrType createDataArray(bool allocate = true) const override;
+  bool setDataArrayValue(IDataArray* dataArray, size_t tupleIndex) const override;
 
 protected:
 private:
@@ -229,6 +238,7 @@ public:
   QString toString() const override;
 
   IDataArrayShPtrType createDataArray(bool allocate = true) const override;
+  bool setDataArrayValue(IDataArray* dataArray, size_t tupleIndex) const override;
 
 protected:
 private:
@@ -283,6 +293,7 @@ public:
   QString toString() const override;
 
   IDataArrayShPtrType createDataArray(bool allocate = true) const override;
+  bool setDataArrayValue(IDataArray* dataArray, size_t tupleIndex) const override;
 
 protected:
 private:
@@ -344,6 +355,7 @@ public:
   QString toString() const override;
 
   IDataArrayShPtrType createDataArray(bool allocate = true) const override;
+  bool setDataArrayValue(IDataArray* dataArray, size_t tupleIndex) const override;
 
 protected:
   StringZeissMetaEntry()
@@ -375,12 +387,24 @@ namespace ZeissMetaEntry
 template <typename DestMetaData>
 typename DestMetaData::Pointer convert(AbstractZeissMetaData::Pointer src)
 {
+  // Tags that are typed in the ZeissTagMapping factory map already hold the parsed value
+  typename DestMetaData::Pointer destPtr = std::dynamic_pointer_cast<DestMetaData>(src);
+  if(nullptr != destPtr)
+  {
+    return destPtr;
+  }
 
   StringZeissMetaEntry::Pointer srcPtr = std::dynamic_pointer_cast<StringZeissMetaEntry>(src);
-  Q_ASSERT_X(srcPtr.get() != nullptr, "Could not Cast to StringZeissMetaEntry", "");
+  if(nullptr == srcPtr)
+  {
+    return DestMetaData::NullPointer();
+  }
 
-  typename DestMetaData::Pointer destPtr = DestMetaData::New();
-  destPtr->setValue(srcPtr->getValue());
+  destPtr = DestMetaData::New();
+  if(!destPtr->setValue(srcPtr->getValue()))
+  {
+    return DestMetaData::NullPointer();
+  }
   return destPtr;
 }
 
@@ -30,30 +30,67 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ZeissMetaFactory.h"
 
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
+
+namespace
+{
+template <typename T>
+IDataArrayShPtrType CreateNumericColumn(const QString& name, size_t numTuples, bool allocate)
+{
+  typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(numTuples, name, allocate);
+  if(allocate && nullptr != array)
+  {
+    array->initializeWithZeros();
+  }
+  return array;
+}
+} // namespace
+
 AbstractZeissMetaData::Pointer Int32ZeissMetaFactory::createMetaEntry()
 {
   AbstractZeissMetaData::Pointer ptr = Int32ZeissMetaEntry::New();
   return ptr;
 }
 
+IDataArrayShPtrType Int32ZeissMetaFactory::createDataArray(const QString& name, size_t numTuples, bool allocate) const
+{
+  return CreateNumericColumn<int32_t>(name, numTuples, allocate);
+}
+
 AbstractZeissMetaData::Pointer Int64ZeissMetaFactory::createMetaEntry()
 {
   AbstractZeissMetaData::Pointer ptr = Int64ZeissMetaEntry::New();
   return ptr;
 }
 
+IDataArrayShPtrType Int64ZeissMetaFactory::createDataArray(const QString& name, size_t numTuples, bool allocate) const
+{
+  return CreateNumericColumn<int64_t>(name, numTuples, allocate);
+}
+
 AbstractZeissMetaData::Pointer FloatZeissMetaFactory::createMetaEntry()
 {
   AbstractZeissMetaData::Pointer ptr = FloatZeissMetaEntry::New();
   return ptr;
 }
 
+IDataArrayShPtrType FloatZeissMetaFactory::createDataArray(const QString& name, size_t numTuples, bool allocate) const
+{
+  return CreateNumericColumn<float>(name, numTuples, allocate);
+}
+
 AbstractZeissMetaData::Pointer StringZeissMetaFactory::createMetaEntry()
 {
   AbstractZeissMetaData::Pointer ptr = StringZeissMetaEntry::New();
   return ptr;
 }
 
+IDataArrayShPtrType StringZeissMetaFactory::createDataArray(const QString& name, size_t numTuples, bool allocate) const
+{
+  return StringDataArray::CreateArray(numTuples, name, allocate);
+}
+
 // -----------------------------------------------------------------------------
 ZeissMetaFactory::Pointer ZeissMetaFactory::NullPointer()
 {
@@ -55,6 +55,16 @@ public:
 
   virtual AbstractZeissMetaData::Pointer createMetaEntry() = 0;
 
+  /**
+   * @brief Creates a column for entries of this type, one tuple per tile. Numeric columns are zero filled
+   * and string columns hold empty strings until AbstractZeissMetaData::setDataArrayValue() is called.
+   * @param name
+   * @param numTuples
+   * @param allocate
+   * @return
+   */
+  virtual IDataArrayShPtrType createDataArray(const QString& name, size_t numTuples, bool allocate) const = 0;
+
 protected:
   ZeissMetaFactory() = default;
 
@@ -87,6 +97,7 @@ public:
   }
 
   AbstractZeissMetaData::Pointer createMetaEntry() override;
+  IDataArrayShPtrType createDataArray(const QString& name, size_t numTuples, bool allocate) const override;
 
 protected:
   Int32ZeissMetaFactory() = default;
@@ -119,6 +130,7 @@ public:
     return sharedPtr;
   }
   AbstractZeissMetaData::Pointer createMetaEntry() override;
+  IDataArrayShPtrType createDataArray(const QString& name, size_t numTuples, bool allocate) const override;
 
 protected:
   Int64ZeissMetaFactory() = default;
@@ -151,6 +163,7 @@ public:
     return sharedPtr;
   }
   AbstractZeissMetaData::Pointer createMetaEntry() override;
+  IDataArrayShPtrType createDataArray(const QString& name, size_t numTuples, bool allocate) const override;
 
 protected:
   FloatZeissMetaFactory() = default;
@@ -183,6 +196,7 @@ public:
     return sharedPtr;
   }
   AbstractZeissMetaData::Pointer createMetaEntry() override;
+  IDataArrayShPtrType createDataArray(const QString& name, size_t numTuples, bool allocate) const override;
 
 protected:
   StringZeissMetaFactory() = default;
@@ -30,18 +30,30 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include "ZeissTagMapping.h"
+
+#include <array>
+
 #include "ITKImageProcessing/ZeissXml/ZeissMetaEntry.h"
 #include "ITKImageProcessing/ZeissXml/ZeissMetaFactory.h"
+#include "ITKImageProcessing/ZeissXml/ZeissTagMapping_Table.h"
 
+namespace
+{
 // -----------------------------------------------------------------------------
-//
+// Every tag of a given value type shares one factory, indexed by ZeissTagTable::ValueType
 // -----------------------------------------------------------------------------
-ZeissTagMapping::ZeissTagMapping()
+ZeissMetaFactory::Pointer FactoryForType(ZeissTagTable::ValueType type)
 {
-  initIdNameMap();
-  initNameIdMap();
-  initFactoryMap();
+  static const std::array<ZeissMetaFactory::Pointer, 4> k_Factories = {StringZeissMetaFactory::NewZeissMetaFactory(), Int32ZeissMetaFactory::NewZeissMetaFactory(),
+                                                                       Int64ZeissMetaFactory::NewZeissMetaFactory(), FloatZeissMetaFactory::NewZeissMetaFactory()};
+  return k_Factories[static_cast<size_t>(type)];
 }
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ZeissTagMapping::ZeissTagMapping() = default;
 
 // -----------------------------------------------------------------------------
 //
@@ -65,47 +77,62 @@ ZeissTagMapping::Pointer ZeissTagMapping::instance()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QString ZeissTagMapping::nameForId(int idTag)
+QString ZeissTagMapping::nameForId(int idTag) const
 {
-  QMap<int, QString>::iterator i = _idNameMap.find(idTag);
-  if(i != _idNameMap.end())
+  const ZeissTagTable::TagEntry* entry = ZeissTagTable::FindById(idTag);
+  if(nullptr == entry)
   {
-    return i.value();
+    return QString("");
   }
-  return QString("");
+  return QString::fromLatin1(entry->Name.data(), static_cast<int>(entry->Name.size()));
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int ZeissTagMapping::idForName(const QString& name)
+int ZeissTagMapping::idForName(const QString& name) const
 {
-  ZeissNameIdMap::iterator i = _nameIdMap.find(name);
-  if(i != _nameIdMap.end())
+  // Tag names are short ASCII identifiers, so the name is narrowed into a stack buffer instead of a QByteArray
+  if(name.size() > static_cast<int>(ZeissTagTable::k_MaxNameLength))
   {
-    return i.value();
+    return -1;
   }
-  return -1;
+  std::array<char, ZeissTagTable::k_MaxNameLength> buffer = {};
+  for(int i = 0; i < name.size(); i++)
+  {
+    ushort c = name.at(i).unicode();
+    if(c > 127)
+    {
+      return -1;
+    }
+    buffer[i] = static_cast<char>(c);
+  }
+
+  const ZeissTagTable::TagEntry* entry = ZeissTagTable::FindByName(std::string_view(buffer.data(), static_cast<size_t>(name.size())));
+  if(nullptr == entry)
+  {
+    return -1;
+  }
+  return entry->Id;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-ZeissMetaFactory::Pointer ZeissTagMapping::factoryForId(int idTag)
+ZeissMetaFactory::Pointer ZeissTagMapping::factoryForId(int idTag) const
 {
-  ZeissFactoryMap::iterator i = _idFactoryMap.find(idTag);
-  if(i != _idFactoryMap.end())
+  const ZeissTagTable::TagEntry* entry = ZeissTagTable::FindById(idTag);
+  if(nullptr == entry)
   {
-    return i.value();
+    return ZeissMetaFactory::NullPointer();
   }
-
-  return ZeissMetaFactory::NullPointer();
+  return FactoryForType(entry->Type);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-AbstractZeissMetaData::Pointer ZeissTagMapping::metaDataForTagName(const QString& name)
+AbstractZeissMetaData::Pointer ZeissTagMapping::metaDataForTagName(const QString& name) const
 {
   int idTag = idForName(name);
   if(idTag < 0)
@@ -113,7 +140,7 @@ AbstractZeissMetaData::Pointer ZeissTagMapping::metaDataForTagName(const QString
     return AbstractZeissMetaData::NullPointer();
   }
 
-  ZeissMetaFactory::Pointer f = _idFactoryMap[idTag];
+  ZeissMetaFactory::Pointer f = factoryForId(idTag);
   if(nullptr != f.get())
   {
     AbstractZeissMetaData::Pointer ptr = f->createMetaEntry();
@@ -126,21 +153,23 @@ AbstractZeissMetaData::Pointer ZeissTagMapping::metaDataForTagName(const QString
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-AbstractZeissMetaData::Pointer ZeissTagMapping::metaDataForId(int idTag, const QString& value)
+AbstractZeissMetaData::Pointer ZeissTagMapping::metaDataForId(int idTag, const QString& value) const
 {
-  ZeissMetaFactory::Pointer f = _idFactoryMap[idTag];
+  ZeissMetaFactory::Pointer f = factoryForId(idTag);
   if(nullptr != f.get())
   {
     AbstractZeissMetaData::Pointer ptr = f->createMetaEntry();
     ptr->setZeissIdTag(idTag);
-    ptr->setValue(value);
+    if(!ptr->setValue(value))
+    {
+      // Keep the original text of a numeric tag that does not parse so the caller can report it
+      ptr = StringZeissMetaEntry::New(idTag, value);
+    }
     return ptr;
   }
   return AbstractZeissMetaData::NullPointer();
 }
 
-#include "ZeissTagMapping_InitMaps.cpp"
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
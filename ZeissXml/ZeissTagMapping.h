@@ -41,16 +41,16 @@
 
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
-using ZeissIdNameMap = QMap<int, QString>;
-using ZeissNameIdMap = QMap<QString, int>;
-using ZeissFactoryMap = QMap<int, ZeissMetaFactory::Pointer>;
-
 /**
  * @class ZeissTagMapping ZeissTagMapping.h R3D/Common/ZeissTagMapping.h
  * @brief This class is used to map values from the Zeiss XML file to and from
  * human readable values. It also creates factories for each of the tags found in the
  * Zeiss XML file. For each value there is a const QString and an integer value
  * that uniquely identifies the tag.
+ *
+ * The tags live in constexpr tables that are generated from ZVI_Tags.txt (see
+ * ZeissTagMapping_Table.h), so creating the instance costs nothing and every lookup
+ * is a perfect hash probe.
  * @author Michael A. Jackson for BlueQuartz Software
  * @date Jul 29, 2009
  * @version 1.0
@@ -69,30 +69,25 @@ public:
 
   static ZeissTagMapping::Pointer instance();
 
-  QString nameForId(int idtag);
+  /**
+   * @brief Returns the tag name for an id or an empty string if the id is unknown
+   */
+  QString nameForId(int idtag) const;
 
-  int idForName(const QString& name);
+  /**
+   * @brief Returns the id of a tag name or -1 if the name is unknown
+   */
+  int idForName(const QString& name) const;
 
-  ZeissMetaFactory::Pointer factoryForId(int idTag);
+  ZeissMetaFactory::Pointer factoryForId(int idTag) const;
 
-  AbstractZeissMetaData::Pointer metaDataForId(int idTag, const QString& value);
+  AbstractZeissMetaData::Pointer metaDataForId(int idTag, const QString& value) const;
 
-  AbstractZeissMetaData::Pointer metaDataForTagName(const QString& name);
+  AbstractZeissMetaData::Pointer metaDataForTagName(const QString& name) const;
 
 protected:
   ZeissTagMapping();
 
-  void initIdNameMap();
-
-  void initNameIdMap();
-
-  void initFactoryMap();
-
-private:
-  ZeissIdNameMap _idNameMap;
-  ZeissNameIdMap _nameIdMap;
-  ZeissFactoryMap _idFactoryMap;
-
 public:
   ZeissTagMapping(const ZeissTagMapping&) = delete;            // Copy Constructor Not Implemented
   ZeissTagMapping(ZeissTagMapping&&) = delete;                 // Move Constructor Not Implemented
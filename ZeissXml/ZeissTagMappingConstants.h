@@ -1164,7 +1164,7 @@ const QString Factor_0("Factor_0");
 const QString Type_0("Type_0");
 const QString Unit_0("Unit_0");
 const QString Origin_0("Origin_0");
-const QString Angle_0("Angle_2");
+const QString Angle_0("Angle_0");
 
 const QString Factor_1("Factor_1");
 const QString Type_1("Type_1");
@@ -1,1689 +0,0 @@
-/* ============================================================================
- * Copyright (c) 2009-2019 BlueQuartz Software, LLC
- * All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without modification,
- * are permitted provided that the following conditions are met:
- *
- * Redistributions of source code must retain the above copyright notice, this
- * list of conditions and the following disclaimer.
- *
- * Redistributions in binary form must reproduce the above copyright notice, this
- * list of conditions and the following disclaimer in the documentation and/or
- * other materials provided with the distribution.
- *
- * Neither the names of any of the BlueQuartz Software contributors
- * may be used to endorse or promote products derived from this software without
- * specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
- * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
- * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
- * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
- * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
- * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
- * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
- * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *
- * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-
-/** THIS FILE WAS AUTO-GENERATED FROM THE ZVI_TAGS.TXT FILE WHICH WAS MANUALLY GENERATED FROM
- * THE ZVI DOCUMENTATION FILE THAT IS DOWNLOADED FROM CARL ZEISS UNDER LICENSE.
- */
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissTagMapping::initIdNameMap()
-{
-  _idNameMap[Zeiss::MetaXML::CompressionId] = Zeiss::MetaXML::Compression;
-  _idNameMap[Zeiss::MetaXML::DateMappingTableId] = Zeiss::MetaXML::DateMappingTable;
-  _idNameMap[Zeiss::MetaXML::BlackValueId] = Zeiss::MetaXML::BlackValue;
-  _idNameMap[Zeiss::MetaXML::WhitevalueId] = Zeiss::MetaXML::Whitevalue;
-  _idNameMap[Zeiss::MetaXML::ImageDataMappingAutoRangeId] = Zeiss::MetaXML::ImageDataMappingAutoRange;
-  _idNameMap[Zeiss::MetaXML::ImageThumbnailId] = Zeiss::MetaXML::ImageThumbnail;
-  _idNameMap[Zeiss::MetaXML::GammaValueId] = Zeiss::MetaXML::GammaValue;
-  _idNameMap[Zeiss::MetaXML::ImageOverExposureId] = Zeiss::MetaXML::ImageOverExposure;
-  _idNameMap[Zeiss::MetaXML::ImageRelativeTime1Id] = Zeiss::MetaXML::ImageRelativeTime1;
-  _idNameMap[Zeiss::MetaXML::ImageRelativeTime2Id] = Zeiss::MetaXML::ImageRelativeTime2;
-  _idNameMap[Zeiss::MetaXML::ImageRelativeTime3Id] = Zeiss::MetaXML::ImageRelativeTime3;
-  _idNameMap[Zeiss::MetaXML::ImageRelativeTime4Id] = Zeiss::MetaXML::ImageRelativeTime4;
-  _idNameMap[Zeiss::MetaXML::ImageRelativeTimeId] = Zeiss::MetaXML::ImageRelativeTime;
-  _idNameMap[Zeiss::MetaXML::ImageBaseTimeFirstId] = Zeiss::MetaXML::ImageBaseTimeFirst;
-  _idNameMap[Zeiss::MetaXML::ImageBaseTime1Id] = Zeiss::MetaXML::ImageBaseTime1;
-  _idNameMap[Zeiss::MetaXML::ImageBaseTime2Id] = Zeiss::MetaXML::ImageBaseTime2;
-  _idNameMap[Zeiss::MetaXML::ImageBaseTime3Id] = Zeiss::MetaXML::ImageBaseTime3;
-  _idNameMap[Zeiss::MetaXML::ImageBaseTime4Id] = Zeiss::MetaXML::ImageBaseTime4;
-  _idNameMap[Zeiss::MetaXML::ImageWidthPixelId] = Zeiss::MetaXML::ImageWidthPixel;
-  _idNameMap[Zeiss::MetaXML::ImageHeightPixelId] = Zeiss::MetaXML::ImageHeightPixel;
-  _idNameMap[Zeiss::MetaXML::ImageCountRawId] = Zeiss::MetaXML::ImageCountRaw;
-  _idNameMap[Zeiss::MetaXML::PixelTypeId] = Zeiss::MetaXML::PixelType;
-  _idNameMap[Zeiss::MetaXML::NumberRawImagesId] = Zeiss::MetaXML::NumberRawImages;
-  _idNameMap[Zeiss::MetaXML::ImageSizeId] = Zeiss::MetaXML::ImageSize;
-  _idNameMap[Zeiss::MetaXML::CompressionFactorForSaveId] = Zeiss::MetaXML::CompressionFactorForSave;
-  _idNameMap[Zeiss::MetaXML::DocumentSaveFlagsId] = Zeiss::MetaXML::DocumentSaveFlags;
-  _idNameMap[Zeiss::MetaXML::AcquisitionpauseannotationId] = Zeiss::MetaXML::Acquisitionpauseannotation;
-  _idNameMap[Zeiss::MetaXML::DocumentSubtypeId] = Zeiss::MetaXML::DocumentSubtype;
-  _idNameMap[Zeiss::MetaXML::AcquisitionBitDepthId] = Zeiss::MetaXML::AcquisitionBitDepth;
-  _idNameMap[Zeiss::MetaXML::Z_StacksinglerepresentativeId] = Zeiss::MetaXML::Z_Stacksinglerepresentative;
-  _idNameMap[Zeiss::MetaXML::ScaleFactorForXId] = Zeiss::MetaXML::ScaleFactorForX;
-  _idNameMap[Zeiss::MetaXML::ScaleUnitforXId] = Zeiss::MetaXML::ScaleUnitforX;
-  _idNameMap[Zeiss::MetaXML::ScaleWidthId] = Zeiss::MetaXML::ScaleWidth;
-  _idNameMap[Zeiss::MetaXML::ScaleFactorForYId] = Zeiss::MetaXML::ScaleFactorForY;
-  _idNameMap[Zeiss::MetaXML::ScaleUnitforYId] = Zeiss::MetaXML::ScaleUnitforY;
-  _idNameMap[Zeiss::MetaXML::ScaleHeightId] = Zeiss::MetaXML::ScaleHeight;
-  _idNameMap[Zeiss::MetaXML::ScaleFactorForZId] = Zeiss::MetaXML::ScaleFactorForZ;
-  _idNameMap[Zeiss::MetaXML::ScaleUnitforZId] = Zeiss::MetaXML::ScaleUnitforZ;
-  _idNameMap[Zeiss::MetaXML::ScaleDepthId] = Zeiss::MetaXML::ScaleDepth;
-  _idNameMap[Zeiss::MetaXML::ScalingParentId] = Zeiss::MetaXML::ScalingParent;
-  _idNameMap[Zeiss::MetaXML::DateId] = Zeiss::MetaXML::Date;
-  _idNameMap[Zeiss::MetaXML::CodeId] = Zeiss::MetaXML::Code;
-  _idNameMap[Zeiss::MetaXML::SourceId] = Zeiss::MetaXML::Source;
-  _idNameMap[Zeiss::MetaXML::MessageId] = Zeiss::MetaXML::Message;
-  _idNameMap[Zeiss::MetaXML::CameraImageAcquisitionTimeId] = Zeiss::MetaXML::CameraImageAcquisitionTime;
-  _idNameMap[Zeiss::MetaXML::Eight_bitAcquisitionId] = Zeiss::MetaXML::Eight_bitAcquisition;
-  _idNameMap[Zeiss::MetaXML::CameraBitDepthId] = Zeiss::MetaXML::CameraBitDepth;
-  _idNameMap[Zeiss::MetaXML::MonoReferenceLowId] = Zeiss::MetaXML::MonoReferenceLow;
-  _idNameMap[Zeiss::MetaXML::MonoReferenceHighId] = Zeiss::MetaXML::MonoReferenceHigh;
-  _idNameMap[Zeiss::MetaXML::RedReferenceLowId] = Zeiss::MetaXML::RedReferenceLow;
-  _idNameMap[Zeiss::MetaXML::RedReferenceHighId] = Zeiss::MetaXML::RedReferenceHigh;
-  _idNameMap[Zeiss::MetaXML::GreenReferenceLowId] = Zeiss::MetaXML::GreenReferenceLow;
-  _idNameMap[Zeiss::MetaXML::GreenReferenceHighId] = Zeiss::MetaXML::GreenReferenceHigh;
-  _idNameMap[Zeiss::MetaXML::BlueReferenceLowId] = Zeiss::MetaXML::BlueReferenceLow;
-  _idNameMap[Zeiss::MetaXML::BlueReferenceHighId] = Zeiss::MetaXML::BlueReferenceHigh;
-  _idNameMap[Zeiss::MetaXML::FramegrabberNameId] = Zeiss::MetaXML::FramegrabberName;
-  _idNameMap[Zeiss::MetaXML::CameraId] = Zeiss::MetaXML::Camera;
-  _idNameMap[Zeiss::MetaXML::CameraTriggerSignalTypeId] = Zeiss::MetaXML::CameraTriggerSignalType;
-  _idNameMap[Zeiss::MetaXML::CameraTriggerEnableId] = Zeiss::MetaXML::CameraTriggerEnable;
-  _idNameMap[Zeiss::MetaXML::GrabberTimeoutId] = Zeiss::MetaXML::GrabberTimeout;
-  _idNameMap[Zeiss::MetaXML::MultiChannelEnabledId] = Zeiss::MetaXML::MultiChannelEnabled;
-  _idNameMap[Zeiss::MetaXML::MultichannelColourId] = Zeiss::MetaXML::MultichannelColour;
-  _idNameMap[Zeiss::MetaXML::MultichannelWeightId] = Zeiss::MetaXML::MultichannelWeight;
-  _idNameMap[Zeiss::MetaXML::ChannelNameId] = Zeiss::MetaXML::ChannelName;
-  _idNameMap[Zeiss::MetaXML::DocumentInformationGroupId] = Zeiss::MetaXML::DocumentInformationGroup;
-  _idNameMap[Zeiss::MetaXML::TitleId] = Zeiss::MetaXML::Title;
-  _idNameMap[Zeiss::MetaXML::AuthorId] = Zeiss::MetaXML::Author;
-  _idNameMap[Zeiss::MetaXML::KeywordsId] = Zeiss::MetaXML::Keywords;
-  _idNameMap[Zeiss::MetaXML::CommentsId] = Zeiss::MetaXML::Comments;
-  _idNameMap[Zeiss::MetaXML::SampleIDId] = Zeiss::MetaXML::SampleID;
-  _idNameMap[Zeiss::MetaXML::SubjectId] = Zeiss::MetaXML::Subject;
-  _idNameMap[Zeiss::MetaXML::RevisionNumberId] = Zeiss::MetaXML::RevisionNumber;
-  _idNameMap[Zeiss::MetaXML::SaveFolderId] = Zeiss::MetaXML::SaveFolder;
-  _idNameMap[Zeiss::MetaXML::FileLinkId] = Zeiss::MetaXML::FileLink;
-  _idNameMap[Zeiss::MetaXML::DocumentTypeId] = Zeiss::MetaXML::DocumentType;
-  _idNameMap[Zeiss::MetaXML::StorageMediaId] = Zeiss::MetaXML::StorageMedia;
-  _idNameMap[Zeiss::MetaXML::FileIDId] = Zeiss::MetaXML::FileID;
-  _idNameMap[Zeiss::MetaXML::ReferenceId] = Zeiss::MetaXML::Reference;
-  _idNameMap[Zeiss::MetaXML::FileDateId] = Zeiss::MetaXML::FileDate;
-  _idNameMap[Zeiss::MetaXML::FileSizeId] = Zeiss::MetaXML::FileSize;
-  _idNameMap[Zeiss::MetaXML::FilenameId] = Zeiss::MetaXML::Filename;
-  _idNameMap[Zeiss::MetaXML::FileAttributesId] = Zeiss::MetaXML::FileAttributes;
-  _idNameMap[Zeiss::MetaXML::ProjectGroupId] = Zeiss::MetaXML::ProjectGroup;
-  _idNameMap[Zeiss::MetaXML::AcquisitionDateId] = Zeiss::MetaXML::AcquisitionDate;
-  _idNameMap[Zeiss::MetaXML::LastmodifiedbyId] = Zeiss::MetaXML::Lastmodifiedby;
-  _idNameMap[Zeiss::MetaXML::UserCompanyId] = Zeiss::MetaXML::UserCompany;
-  _idNameMap[Zeiss::MetaXML::UserCompanyLogoId] = Zeiss::MetaXML::UserCompanyLogo;
-  _idNameMap[Zeiss::MetaXML::ImageId] = Zeiss::MetaXML::Image;
-  _idNameMap[Zeiss::MetaXML::UserIDId] = Zeiss::MetaXML::UserID;
-  _idNameMap[Zeiss::MetaXML::UserNameId] = Zeiss::MetaXML::UserName;
-  _idNameMap[Zeiss::MetaXML::UserCityId] = Zeiss::MetaXML::UserCity;
-  _idNameMap[Zeiss::MetaXML::UserAddressId] = Zeiss::MetaXML::UserAddress;
-  _idNameMap[Zeiss::MetaXML::UserCountryId] = Zeiss::MetaXML::UserCountry;
-  _idNameMap[Zeiss::MetaXML::UserPhoneId] = Zeiss::MetaXML::UserPhone;
-  _idNameMap[Zeiss::MetaXML::UserFaxId] = Zeiss::MetaXML::UserFax;
-  _idNameMap[Zeiss::MetaXML::ObjectiveNameId] = Zeiss::MetaXML::ObjectiveName;
-  _idNameMap[Zeiss::MetaXML::OptovarId] = Zeiss::MetaXML::Optovar;
-  _idNameMap[Zeiss::MetaXML::ReflectorId] = Zeiss::MetaXML::Reflector;
-  _idNameMap[Zeiss::MetaXML::CondenserContrastId] = Zeiss::MetaXML::CondenserContrast;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightFilter1Id] = Zeiss::MetaXML::TransmittedLightFilter1;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightFilter2Id] = Zeiss::MetaXML::TransmittedLightFilter2;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightShutterId] = Zeiss::MetaXML::ReflectedLightShutter;
-  _idNameMap[Zeiss::MetaXML::CondenserFrontLensId] = Zeiss::MetaXML::CondenserFrontLens;
-  _idNameMap[Zeiss::MetaXML::ExcitationFilerNameId] = Zeiss::MetaXML::ExcitationFilerName;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightFieldstopApertureId] = Zeiss::MetaXML::TransmittedLightFieldstopAperture;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightApertureId] = Zeiss::MetaXML::ReflectedLightAperture;
-  _idNameMap[Zeiss::MetaXML::CondenserN_A_Id] = Zeiss::MetaXML::CondenserN_A_;
-  _idNameMap[Zeiss::MetaXML::LightPathId] = Zeiss::MetaXML::LightPath;
-  _idNameMap[Zeiss::MetaXML::HalogenLampOnId] = Zeiss::MetaXML::HalogenLampOn;
-  _idNameMap[Zeiss::MetaXML::HalogenLampModeId] = Zeiss::MetaXML::HalogenLampMode;
-  _idNameMap[Zeiss::MetaXML::HalogenLampVoltageId] = Zeiss::MetaXML::HalogenLampVoltage;
-  _idNameMap[Zeiss::MetaXML::FluorescenceLampLevelId] = Zeiss::MetaXML::FluorescenceLampLevel;
-  _idNameMap[Zeiss::MetaXML::FluorescenceLampIntensityId] = Zeiss::MetaXML::FluorescenceLampIntensity;
-  _idNameMap[Zeiss::MetaXML::LightManagerisEnabledId] = Zeiss::MetaXML::LightManagerisEnabled;
-  _idNameMap[Zeiss::MetaXML::FocusPositionId] = Zeiss::MetaXML::FocusPosition;
-  _idNameMap[Zeiss::MetaXML::StagePositionXId] = Zeiss::MetaXML::StagePositionX;
-  _idNameMap[Zeiss::MetaXML::StagePositionYId] = Zeiss::MetaXML::StagePositionY;
-  _idNameMap[Zeiss::MetaXML::MicroscopeNameId] = Zeiss::MetaXML::MicroscopeName;
-  _idNameMap[Zeiss::MetaXML::ObjectiveMagnificationId] = Zeiss::MetaXML::ObjectiveMagnification;
-  _idNameMap[Zeiss::MetaXML::ObjectiveN_A_Id] = Zeiss::MetaXML::ObjectiveN_A_;
-  _idNameMap[Zeiss::MetaXML::MicroscopeIlluminationId] = Zeiss::MetaXML::MicroscopeIllumination;
-  _idNameMap[Zeiss::MetaXML::ExternalShutter1Id] = Zeiss::MetaXML::ExternalShutter1;
-  _idNameMap[Zeiss::MetaXML::ExternalShutter2Id] = Zeiss::MetaXML::ExternalShutter2;
-  _idNameMap[Zeiss::MetaXML::ExternalShutter3Id] = Zeiss::MetaXML::ExternalShutter3;
-  _idNameMap[Zeiss::MetaXML::ExternalFilterWheel1NameId] = Zeiss::MetaXML::ExternalFilterWheel1Name;
-  _idNameMap[Zeiss::MetaXML::ExternalFilterWheel2NameId] = Zeiss::MetaXML::ExternalFilterWheel2Name;
-  _idNameMap[Zeiss::MetaXML::ParfocalCorrectionId] = Zeiss::MetaXML::ParfocalCorrection;
-  _idNameMap[Zeiss::MetaXML::ExternalShutter4Id] = Zeiss::MetaXML::ExternalShutter4;
-  _idNameMap[Zeiss::MetaXML::ExternalShutter5Id] = Zeiss::MetaXML::ExternalShutter5;
-  _idNameMap[Zeiss::MetaXML::ExternalShutter6Id] = Zeiss::MetaXML::ExternalShutter6;
-  _idNameMap[Zeiss::MetaXML::ExternalFilterWheel3NameId] = Zeiss::MetaXML::ExternalFilterWheel3Name;
-  _idNameMap[Zeiss::MetaXML::ExternalFilterWheel4NameId] = Zeiss::MetaXML::ExternalFilterWheel4Name;
-  _idNameMap[Zeiss::MetaXML::ObjectiveTurretPositionId] = Zeiss::MetaXML::ObjectiveTurretPosition;
-  _idNameMap[Zeiss::MetaXML::ObjectiveContrastMethodId] = Zeiss::MetaXML::ObjectiveContrastMethod;
-  _idNameMap[Zeiss::MetaXML::ObjectiveImmersionTypeId] = Zeiss::MetaXML::ObjectiveImmersionType;
-  _idNameMap[Zeiss::MetaXML::ReflectorPositionId] = Zeiss::MetaXML::ReflectorPosition;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightFilter1PositionId] = Zeiss::MetaXML::TransmittedLightFilter1Position;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightFilter2PositionId] = Zeiss::MetaXML::TransmittedLightFilter2Position;
-  _idNameMap[Zeiss::MetaXML::ExcitationFilterPositionId] = Zeiss::MetaXML::ExcitationFilterPosition;
-  _idNameMap[Zeiss::MetaXML::LampMirrorPositionERSETZTDURCH241Id] = Zeiss::MetaXML::LampMirrorPositionERSETZTDURCH241;
-  _idNameMap[Zeiss::MetaXML::ExternalFilterWheel1PositionId] = Zeiss::MetaXML::ExternalFilterWheel1Position;
-  _idNameMap[Zeiss::MetaXML::ExternalFilterWheel2PositionId] = Zeiss::MetaXML::ExternalFilterWheel2Position;
-  _idNameMap[Zeiss::MetaXML::ExternalFilterWheel3PositionId] = Zeiss::MetaXML::ExternalFilterWheel3Position;
-  _idNameMap[Zeiss::MetaXML::ExternalFilterWheel4PositionId] = Zeiss::MetaXML::ExternalFilterWheel4Position;
-  _idNameMap[Zeiss::MetaXML::LightmanagerModeId] = Zeiss::MetaXML::LightmanagerMode;
-  _idNameMap[Zeiss::MetaXML::HalogenLampCalibrationId] = Zeiss::MetaXML::HalogenLampCalibration;
-  _idNameMap[Zeiss::MetaXML::CondenserNAGoSpeedId] = Zeiss::MetaXML::CondenserNAGoSpeed;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightFieldstopGoSpeedId] = Zeiss::MetaXML::TransmittedLightFieldstopGoSpeed;
-  _idNameMap[Zeiss::MetaXML::OptovarGoSpeedId] = Zeiss::MetaXML::OptovarGoSpeed;
-  _idNameMap[Zeiss::MetaXML::FocuscalibratedId] = Zeiss::MetaXML::Focuscalibrated;
-  _idNameMap[Zeiss::MetaXML::FocusBasicPositionId] = Zeiss::MetaXML::FocusBasicPosition;
-  _idNameMap[Zeiss::MetaXML::FocusPowerId] = Zeiss::MetaXML::FocusPower;
-  _idNameMap[Zeiss::MetaXML::FocusBacklashId] = Zeiss::MetaXML::FocusBacklash;
-  _idNameMap[Zeiss::MetaXML::FocusMeasurementOriginId] = Zeiss::MetaXML::FocusMeasurementOrigin;
-  _idNameMap[Zeiss::MetaXML::FocusMeasurementDistanceId] = Zeiss::MetaXML::FocusMeasurementDistance;
-  _idNameMap[Zeiss::MetaXML::FocusSpeedId] = Zeiss::MetaXML::FocusSpeed;
-  _idNameMap[Zeiss::MetaXML::FocusGoSpeedId] = Zeiss::MetaXML::FocusGoSpeed;
-  _idNameMap[Zeiss::MetaXML::FocusDistanceId] = Zeiss::MetaXML::FocusDistance;
-  _idNameMap[Zeiss::MetaXML::FocusInitPositionId] = Zeiss::MetaXML::FocusInitPosition;
-  _idNameMap[Zeiss::MetaXML::StagecalibratedId] = Zeiss::MetaXML::Stagecalibrated;
-  _idNameMap[Zeiss::MetaXML::StagePowerId] = Zeiss::MetaXML::StagePower;
-  _idNameMap[Zeiss::MetaXML::StageXBacklashId] = Zeiss::MetaXML::StageXBacklash;
-  _idNameMap[Zeiss::MetaXML::StageYBacklashId] = Zeiss::MetaXML::StageYBacklash;
-  _idNameMap[Zeiss::MetaXML::StageSpeedXId] = Zeiss::MetaXML::StageSpeedX;
-  _idNameMap[Zeiss::MetaXML::StageSpeedYId] = Zeiss::MetaXML::StageSpeedY;
-  _idNameMap[Zeiss::MetaXML::StageSpeedId] = Zeiss::MetaXML::StageSpeed;
-  _idNameMap[Zeiss::MetaXML::StageGoSpeedXId] = Zeiss::MetaXML::StageGoSpeedX;
-  _idNameMap[Zeiss::MetaXML::StageGoSpeedYId] = Zeiss::MetaXML::StageGoSpeedY;
-  _idNameMap[Zeiss::MetaXML::StageStepDistanceXId] = Zeiss::MetaXML::StageStepDistanceX;
-  _idNameMap[Zeiss::MetaXML::StageStepDistanceYId] = Zeiss::MetaXML::StageStepDistanceY;
-  _idNameMap[Zeiss::MetaXML::StageInitialisationPositionXId] = Zeiss::MetaXML::StageInitialisationPositionX;
-  _idNameMap[Zeiss::MetaXML::StageInitialisationPositionYId] = Zeiss::MetaXML::StageInitialisationPositionY;
-  _idNameMap[Zeiss::MetaXML::MicroscopeMagnificationId] = Zeiss::MetaXML::MicroscopeMagnification;
-  _idNameMap[Zeiss::MetaXML::ReflectorMagnificationId] = Zeiss::MetaXML::ReflectorMagnification;
-  _idNameMap[Zeiss::MetaXML::LampMirrorPositionId] = Zeiss::MetaXML::LampMirrorPosition;
-  _idNameMap[Zeiss::MetaXML::FocusDepthId] = Zeiss::MetaXML::FocusDepth;
-  _idNameMap[Zeiss::MetaXML::MicroscopeTypeId] = Zeiss::MetaXML::MicroscopeType;
-  _idNameMap[Zeiss::MetaXML::ObjectiveWorkingDistanceId] = Zeiss::MetaXML::ObjectiveWorkingDistance;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightApertureGoSpeedId] = Zeiss::MetaXML::ReflectedLightApertureGoSpeed;
-  _idNameMap[Zeiss::MetaXML::ExternalShutterId] = Zeiss::MetaXML::ExternalShutter;
-  _idNameMap[Zeiss::MetaXML::ObjectiveImmersionStopId] = Zeiss::MetaXML::ObjectiveImmersionStop;
-  _idNameMap[Zeiss::MetaXML::FocusStartSpeedId] = Zeiss::MetaXML::FocusStartSpeed;
-  _idNameMap[Zeiss::MetaXML::FocusAccelerationId] = Zeiss::MetaXML::FocusAcceleration;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightFieldstopId] = Zeiss::MetaXML::ReflectedLightFieldstop;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightFieldstopGoSpeedId] = Zeiss::MetaXML::ReflectedLightFieldstopGoSpeed;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightFilter1Id] = Zeiss::MetaXML::ReflectedLightFilter1;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightFilter2Id] = Zeiss::MetaXML::ReflectedLightFilter2;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightFilter1PositionId] = Zeiss::MetaXML::ReflectedLightFilter1Position;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightFilter2PositionId] = Zeiss::MetaXML::ReflectedLightFilter2Position;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightAttenuatorId] = Zeiss::MetaXML::TransmittedLightAttenuator;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightAttenuatorId] = Zeiss::MetaXML::ReflectedLightAttenuator;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightShutterId] = Zeiss::MetaXML::TransmittedLightShutter;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightAttenuatorGoSpeedId] = Zeiss::MetaXML::TransmittedLightAttenuatorGoSpeed;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightAttenuatorGoSpeedId] = Zeiss::MetaXML::ReflectedLightAttenuatorGoSpeed;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightVirtualFilterPositionId] = Zeiss::MetaXML::TransmittedLightVirtualFilterPosition;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightVirtualFilterId] = Zeiss::MetaXML::TransmittedLightVirtualFilter;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightVirtualFilterPositionId] = Zeiss::MetaXML::ReflectedLightVirtualFilterPosition;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightVirtualFilterId] = Zeiss::MetaXML::ReflectedLightVirtualFilter;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightHalogenLampModeId] = Zeiss::MetaXML::ReflectedLightHalogenLampMode;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightHalogenLampVoltageId] = Zeiss::MetaXML::ReflectedLightHalogenLampVoltage;
-  _idNameMap[Zeiss::MetaXML::ReflectedLightHalogenLampColourTemperatureId] = Zeiss::MetaXML::ReflectedLightHalogenLampColourTemperature;
-  _idNameMap[Zeiss::MetaXML::ContrastmanagerModeId] = Zeiss::MetaXML::ContrastmanagerMode;
-  _idNameMap[Zeiss::MetaXML::DazzleProtectionActiveId] = Zeiss::MetaXML::DazzleProtectionActive;
-  _idNameMap[Zeiss::MetaXML::ZoomId] = Zeiss::MetaXML::Zoom;
-  _idNameMap[Zeiss::MetaXML::ZoomGoSpeedId] = Zeiss::MetaXML::ZoomGoSpeed;
-  _idNameMap[Zeiss::MetaXML::LightZoomId] = Zeiss::MetaXML::LightZoom;
-  _idNameMap[Zeiss::MetaXML::LightZoomGoSpeedId] = Zeiss::MetaXML::LightZoomGoSpeed;
-  _idNameMap[Zeiss::MetaXML::LightzoomCoupledId] = Zeiss::MetaXML::LightzoomCoupled;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightHalogenLampModeId] = Zeiss::MetaXML::TransmittedLightHalogenLampMode;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightHalogenLampVoltageId] = Zeiss::MetaXML::TransmittedLightHalogenLampVoltage;
-  _idNameMap[Zeiss::MetaXML::TransmittedLightHalogenLampColourTemperatureId] = Zeiss::MetaXML::TransmittedLightHalogenLampColourTemperature;
-  _idNameMap[Zeiss::MetaXML::ReflectedColdlightModeId] = Zeiss::MetaXML::ReflectedColdlightMode;
-  _idNameMap[Zeiss::MetaXML::ReflectedColdlightIntensityId] = Zeiss::MetaXML::ReflectedColdlightIntensity;
-  _idNameMap[Zeiss::MetaXML::ReflectedColdlightColourTemperatureId] = Zeiss::MetaXML::ReflectedColdlightColourTemperature;
-  _idNameMap[Zeiss::MetaXML::TransmittedColdlightModeId] = Zeiss::MetaXML::TransmittedColdlightMode;
-  _idNameMap[Zeiss::MetaXML::TransmittedColdlightIntensityId] = Zeiss::MetaXML::TransmittedColdlightIntensity;
-  _idNameMap[Zeiss::MetaXML::TransmittedColdlightColourTemperatureId] = Zeiss::MetaXML::TransmittedColdlightColourTemperature;
-  _idNameMap[Zeiss::MetaXML::InfinityspacePortchangerPositionId] = Zeiss::MetaXML::InfinityspacePortchangerPosition;
-  _idNameMap[Zeiss::MetaXML::BeamsplitterInfinitySpaceId] = Zeiss::MetaXML::BeamsplitterInfinitySpace;
-  _idNameMap[Zeiss::MetaXML::TwoTvVisCamChangerPositionId] = Zeiss::MetaXML::TwoTvVisCamChangerPosition;
-  _idNameMap[Zeiss::MetaXML::BeamsplitterOcularId] = Zeiss::MetaXML::BeamsplitterOcular;
-  _idNameMap[Zeiss::MetaXML::TwoTvCamerasChangerPositionId] = Zeiss::MetaXML::TwoTvCamerasChangerPosition;
-  _idNameMap[Zeiss::MetaXML::BeamsplitterCamerasId] = Zeiss::MetaXML::BeamsplitterCameras;
-  _idNameMap[Zeiss::MetaXML::OcularShutterId] = Zeiss::MetaXML::OcularShutter;
-  _idNameMap[Zeiss::MetaXML::TwoTvCamerasChangerCubeId] = Zeiss::MetaXML::TwoTvCamerasChangerCube;
-  _idNameMap[Zeiss::MetaXML::LightWaveLengthId] = Zeiss::MetaXML::LightWaveLength;
-  _idNameMap[Zeiss::MetaXML::OcularMagnificationId] = Zeiss::MetaXML::OcularMagnification;
-  _idNameMap[Zeiss::MetaXML::CameraAdapterMagnificationId] = Zeiss::MetaXML::CameraAdapterMagnification;
-  _idNameMap[Zeiss::MetaXML::MicroscopePortId] = Zeiss::MetaXML::MicroscopePort;
-  _idNameMap[Zeiss::MetaXML::OcularTotalMagnificationId] = Zeiss::MetaXML::OcularTotalMagnification;
-  _idNameMap[Zeiss::MetaXML::FieldofViewId] = Zeiss::MetaXML::FieldofView;
-  _idNameMap[Zeiss::MetaXML::OcularId] = Zeiss::MetaXML::Ocular;
-  _idNameMap[Zeiss::MetaXML::CameraAdapterId] = Zeiss::MetaXML::CameraAdapter;
-  _idNameMap[Zeiss::MetaXML::StageJoystickEnabledId] = Zeiss::MetaXML::StageJoystickEnabled;
-  _idNameMap[Zeiss::MetaXML::ContrastmanagerContrastMethodId] = Zeiss::MetaXML::ContrastmanagerContrastMethod;
-  _idNameMap[Zeiss::MetaXML::CamerasChangerBeamSplitterTypeId] = Zeiss::MetaXML::CamerasChangerBeamSplitterType;
-  _idNameMap[Zeiss::MetaXML::RearportSliderPositionId] = Zeiss::MetaXML::RearportSliderPosition;
-  _idNameMap[Zeiss::MetaXML::RearportSourceId] = Zeiss::MetaXML::RearportSource;
-  _idNameMap[Zeiss::MetaXML::BeamsplitterTypeInfinitySpaceId] = Zeiss::MetaXML::BeamsplitterTypeInfinitySpace;
-  _idNameMap[Zeiss::MetaXML::FluorescenceAttenuatorId] = Zeiss::MetaXML::FluorescenceAttenuator;
-  _idNameMap[Zeiss::MetaXML::FluorescenceAttenuatorPositionId] = Zeiss::MetaXML::FluorescenceAttenuatorPosition;
-  _idNameMap[Zeiss::MetaXML::CameraFramestartLeftId] = Zeiss::MetaXML::CameraFramestartLeft;
-  _idNameMap[Zeiss::MetaXML::CameraFramestartTopId] = Zeiss::MetaXML::CameraFramestartTop;
-  _idNameMap[Zeiss::MetaXML::CameraFrameWidthId] = Zeiss::MetaXML::CameraFrameWidth;
-  _idNameMap[Zeiss::MetaXML::CameraFrameHeightId] = Zeiss::MetaXML::CameraFrameHeight;
-  _idNameMap[Zeiss::MetaXML::CameraBinningId] = Zeiss::MetaXML::CameraBinning;
-  _idNameMap[Zeiss::MetaXML::CameraFrameFullId] = Zeiss::MetaXML::CameraFrameFull;
-  _idNameMap[Zeiss::MetaXML::CameraFramePixelDistanceId] = Zeiss::MetaXML::CameraFramePixelDistance;
-  _idNameMap[Zeiss::MetaXML::DataFormatUseScalingId] = Zeiss::MetaXML::DataFormatUseScaling;
-  _idNameMap[Zeiss::MetaXML::CameraFrameImageOrientationId] = Zeiss::MetaXML::CameraFrameImageOrientation;
-  _idNameMap[Zeiss::MetaXML::VideoMonochromeSignalTypeId] = Zeiss::MetaXML::VideoMonochromeSignalType;
-  _idNameMap[Zeiss::MetaXML::VideoColorSignalTypeId] = Zeiss::MetaXML::VideoColorSignalType;
-  _idNameMap[Zeiss::MetaXML::MeteorChannelInputId] = Zeiss::MetaXML::MeteorChannelInput;
-  _idNameMap[Zeiss::MetaXML::MeteorChannelSyncId] = Zeiss::MetaXML::MeteorChannelSync;
-  _idNameMap[Zeiss::MetaXML::WhiteBalanceEnabledId] = Zeiss::MetaXML::WhiteBalanceEnabled;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceRedId] = Zeiss::MetaXML::CameraWhiteBalanceRed;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceGreenId] = Zeiss::MetaXML::CameraWhiteBalanceGreen;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceBlueId] = Zeiss::MetaXML::CameraWhiteBalanceBlue;
-  _idNameMap[Zeiss::MetaXML::CameraFrameScalingFactorId] = Zeiss::MetaXML::CameraFrameScalingFactor;
-  _idNameMap[Zeiss::MetaXML::MeteorCameraTypeId] = Zeiss::MetaXML::MeteorCameraType;
-  _idNameMap[Zeiss::MetaXML::ExposureTime_ms_Id] = Zeiss::MetaXML::ExposureTime_ms_;
-  _idNameMap[Zeiss::MetaXML::CameraExposureTimeAutoCalculateId] = Zeiss::MetaXML::CameraExposureTimeAutoCalculate;
-  _idNameMap[Zeiss::MetaXML::MeteorGainValueId] = Zeiss::MetaXML::MeteorGainValue;
-  _idNameMap[Zeiss::MetaXML::MeteorGainAutomaticId] = Zeiss::MetaXML::MeteorGainAutomatic;
-  _idNameMap[Zeiss::MetaXML::MeteorAdjustHueId] = Zeiss::MetaXML::MeteorAdjustHue;
-  _idNameMap[Zeiss::MetaXML::MeteorAdjustSaturationId] = Zeiss::MetaXML::MeteorAdjustSaturation;
-  _idNameMap[Zeiss::MetaXML::MeteorAdjustRedLowId] = Zeiss::MetaXML::MeteorAdjustRedLow;
-  _idNameMap[Zeiss::MetaXML::MeteorAdjustGreenLowId] = Zeiss::MetaXML::MeteorAdjustGreenLow;
-  _idNameMap[Zeiss::MetaXML::MeteorBlueLowId] = Zeiss::MetaXML::MeteorBlueLow;
-  _idNameMap[Zeiss::MetaXML::MeteorAdjustRedHighId] = Zeiss::MetaXML::MeteorAdjustRedHigh;
-  _idNameMap[Zeiss::MetaXML::MeteorAdjustGreenHighId] = Zeiss::MetaXML::MeteorAdjustGreenHigh;
-  _idNameMap[Zeiss::MetaXML::MeteorBlueHighId] = Zeiss::MetaXML::MeteorBlueHigh;
-  _idNameMap[Zeiss::MetaXML::CameraExposureTimeCalculationControlId] = Zeiss::MetaXML::CameraExposureTimeCalculationControl;
-  _idNameMap[Zeiss::MetaXML::AxioCamFadingCorrectionEnableId] = Zeiss::MetaXML::AxioCamFadingCorrectionEnable;
-  _idNameMap[Zeiss::MetaXML::CameraLiveImageId] = Zeiss::MetaXML::CameraLiveImage;
-  _idNameMap[Zeiss::MetaXML::CameraLiveEnabledId] = Zeiss::MetaXML::CameraLiveEnabled;
-  _idNameMap[Zeiss::MetaXML::LiveImageSyncObjectNameId] = Zeiss::MetaXML::LiveImageSyncObjectName;
-  _idNameMap[Zeiss::MetaXML::CameraLiveSpeedId] = Zeiss::MetaXML::CameraLiveSpeed;
-  _idNameMap[Zeiss::MetaXML::CameraImageId] = Zeiss::MetaXML::CameraImage;
-  _idNameMap[Zeiss::MetaXML::CameraImageWidthId] = Zeiss::MetaXML::CameraImageWidth;
-  _idNameMap[Zeiss::MetaXML::CameraImageHeightId] = Zeiss::MetaXML::CameraImageHeight;
-  _idNameMap[Zeiss::MetaXML::CameraImagePixelTypeId] = Zeiss::MetaXML::CameraImagePixelType;
-  _idNameMap[Zeiss::MetaXML::CameraImageShMemoryNameId] = Zeiss::MetaXML::CameraImageShMemoryName;
-  _idNameMap[Zeiss::MetaXML::CameraLiveImageWidthId] = Zeiss::MetaXML::CameraLiveImageWidth;
-  _idNameMap[Zeiss::MetaXML::CameraLiveImageHeightId] = Zeiss::MetaXML::CameraLiveImageHeight;
-  _idNameMap[Zeiss::MetaXML::CameraLiveImagePixelTypeId] = Zeiss::MetaXML::CameraLiveImagePixelType;
-  _idNameMap[Zeiss::MetaXML::CameraLiveImageShMemoryNameId] = Zeiss::MetaXML::CameraLiveImageShMemoryName;
-  _idNameMap[Zeiss::MetaXML::CameraLiveMaximumSpeedId] = Zeiss::MetaXML::CameraLiveMaximumSpeed;
-  _idNameMap[Zeiss::MetaXML::CameraLiveBinningId] = Zeiss::MetaXML::CameraLiveBinning;
-  _idNameMap[Zeiss::MetaXML::CameraLiveGainValueId] = Zeiss::MetaXML::CameraLiveGainValue;
-  _idNameMap[Zeiss::MetaXML::CameraLiveExposureTimeValueId] = Zeiss::MetaXML::CameraLiveExposureTimeValue;
-  _idNameMap[Zeiss::MetaXML::CameraLiveScalingFactorId] = Zeiss::MetaXML::CameraLiveScalingFactor;
-  _idNameMap[Zeiss::MetaXML::ImageIndexUId] = Zeiss::MetaXML::ImageIndexU;
-  _idNameMap[Zeiss::MetaXML::ImageIndexVId] = Zeiss::MetaXML::ImageIndexV;
-  _idNameMap[Zeiss::MetaXML::ImageIndexZId] = Zeiss::MetaXML::ImageIndexZ;
-  _idNameMap[Zeiss::MetaXML::ImageIndexCId] = Zeiss::MetaXML::ImageIndexC;
-  _idNameMap[Zeiss::MetaXML::ImageIndexTId] = Zeiss::MetaXML::ImageIndexT;
-  _idNameMap[Zeiss::MetaXML::ImageTileIndexId] = Zeiss::MetaXML::ImageTileIndex;
-  _idNameMap[Zeiss::MetaXML::ImageacquisitionIndexId] = Zeiss::MetaXML::ImageacquisitionIndex;
-  _idNameMap[Zeiss::MetaXML::ImageCountTilesId] = Zeiss::MetaXML::ImageCountTiles;
-  _idNameMap[Zeiss::MetaXML::ImageCountAId] = Zeiss::MetaXML::ImageCountA;
-  _idNameMap[Zeiss::MetaXML::ImageIndexSId] = Zeiss::MetaXML::ImageIndexS;
-  _idNameMap[Zeiss::MetaXML::ImageIndexRawId] = Zeiss::MetaXML::ImageIndexRaw;
-  _idNameMap[Zeiss::MetaXML::ImageCountZId] = Zeiss::MetaXML::ImageCountZ;
-  _idNameMap[Zeiss::MetaXML::ImageCountCId] = Zeiss::MetaXML::ImageCountC;
-  _idNameMap[Zeiss::MetaXML::ImageCountTId] = Zeiss::MetaXML::ImageCountT;
-  _idNameMap[Zeiss::MetaXML::ImageCountUId] = Zeiss::MetaXML::ImageCountU;
-  _idNameMap[Zeiss::MetaXML::ImageCountVId] = Zeiss::MetaXML::ImageCountV;
-  _idNameMap[Zeiss::MetaXML::ImageCountSId] = Zeiss::MetaXML::ImageCountS;
-  _idNameMap[Zeiss::MetaXML::OriginalStagePositionXId] = Zeiss::MetaXML::OriginalStagePositionX;
-  _idNameMap[Zeiss::MetaXML::OriginalStagePositionYId] = Zeiss::MetaXML::OriginalStagePositionY;
-  _idNameMap[Zeiss::MetaXML::LayerDrawFlagsId] = Zeiss::MetaXML::LayerDrawFlags;
-  _idNameMap[Zeiss::MetaXML::RemainingTimeId] = Zeiss::MetaXML::RemainingTime;
-  _idNameMap[Zeiss::MetaXML::UserField1Id] = Zeiss::MetaXML::UserField1;
-  _idNameMap[Zeiss::MetaXML::UserField2Id] = Zeiss::MetaXML::UserField2;
-  _idNameMap[Zeiss::MetaXML::UserField3Id] = Zeiss::MetaXML::UserField3;
-  _idNameMap[Zeiss::MetaXML::UserField4Id] = Zeiss::MetaXML::UserField4;
-  _idNameMap[Zeiss::MetaXML::UserField5Id] = Zeiss::MetaXML::UserField5;
-  _idNameMap[Zeiss::MetaXML::UserField6Id] = Zeiss::MetaXML::UserField6;
-  _idNameMap[Zeiss::MetaXML::UserField7Id] = Zeiss::MetaXML::UserField7;
-  _idNameMap[Zeiss::MetaXML::UserField8Id] = Zeiss::MetaXML::UserField8;
-  _idNameMap[Zeiss::MetaXML::UserField9Id] = Zeiss::MetaXML::UserField9;
-  _idNameMap[Zeiss::MetaXML::UserField10Id] = Zeiss::MetaXML::UserField10;
-  _idNameMap[Zeiss::MetaXML::IDId] = Zeiss::MetaXML::ID;
-  _idNameMap[Zeiss::MetaXML::NameId] = Zeiss::MetaXML::Name;
-  _idNameMap[Zeiss::MetaXML::ValueId] = Zeiss::MetaXML::Value;
-  _idNameMap[Zeiss::MetaXML::PvCamClockingModeId] = Zeiss::MetaXML::PvCamClockingMode;
-  _idNameMap[Zeiss::MetaXML::AutofocusStatusReportId] = Zeiss::MetaXML::AutofocusStatusReport;
-  _idNameMap[Zeiss::MetaXML::AutofocusPositionId] = Zeiss::MetaXML::AutofocusPosition;
-  _idNameMap[Zeiss::MetaXML::AutofocusPositionOffsetId] = Zeiss::MetaXML::AutofocusPositionOffset;
-  _idNameMap[Zeiss::MetaXML::AutofocusEmptyFieldThresholdId] = Zeiss::MetaXML::AutofocusEmptyFieldThreshold;
-  _idNameMap[Zeiss::MetaXML::AutofocusCalibrationNameId] = Zeiss::MetaXML::AutofocusCalibrationName;
-  _idNameMap[Zeiss::MetaXML::AutofocusCurrentCalibrationItemId] = Zeiss::MetaXML::AutofocusCurrentCalibrationItem;
-  _idNameMap[Zeiss::MetaXML::CameraFrameFullWidthId] = Zeiss::MetaXML::CameraFrameFullWidth;
-  _idNameMap[Zeiss::MetaXML::CameraFrameFullHeightId] = Zeiss::MetaXML::CameraFrameFullHeight;
-  _idNameMap[Zeiss::MetaXML::AxioCamShutterSignalId] = Zeiss::MetaXML::AxioCamShutterSignal;
-  _idNameMap[Zeiss::MetaXML::AxioCamDelayTimeId] = Zeiss::MetaXML::AxioCamDelayTime;
-  _idNameMap[Zeiss::MetaXML::AxioCamShutterControlId] = Zeiss::MetaXML::AxioCamShutterControl;
-  _idNameMap[Zeiss::MetaXML::AxioCamBlackRefIsCalculatedId] = Zeiss::MetaXML::AxioCamBlackRefIsCalculated;
-  _idNameMap[Zeiss::MetaXML::AxioCamBlackReferenceId] = Zeiss::MetaXML::AxioCamBlackReference;
-  _idNameMap[Zeiss::MetaXML::CameraShadingCorrectionId] = Zeiss::MetaXML::CameraShadingCorrection;
-  _idNameMap[Zeiss::MetaXML::AxioCamEnhanceColorId] = Zeiss::MetaXML::AxioCamEnhanceColor;
-  _idNameMap[Zeiss::MetaXML::AxioCamNIRModeId] = Zeiss::MetaXML::AxioCamNIRMode;
-  _idNameMap[Zeiss::MetaXML::CameraShutterCloseDelayId] = Zeiss::MetaXML::CameraShutterCloseDelay;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceAutoCalculateId] = Zeiss::MetaXML::CameraWhiteBalanceAutoCalculate;
-  _idNameMap[Zeiss::MetaXML::AxioCamNIRModeAvailableId] = Zeiss::MetaXML::AxioCamNIRModeAvailable;
-  _idNameMap[Zeiss::MetaXML::AxioCamFadingCorrectionAvailableId] = Zeiss::MetaXML::AxioCamFadingCorrectionAvailable;
-  _idNameMap[Zeiss::MetaXML::AxioCamEnhanceColorAvailableId] = Zeiss::MetaXML::AxioCamEnhanceColorAvailable;
-  _idNameMap[Zeiss::MetaXML::MeteorVideoNormId] = Zeiss::MetaXML::MeteorVideoNorm;
-  _idNameMap[Zeiss::MetaXML::MeteorAdjustWhiteReferenceId] = Zeiss::MetaXML::MeteorAdjustWhiteReference;
-  _idNameMap[Zeiss::MetaXML::MeteorBlackReferenceId] = Zeiss::MetaXML::MeteorBlackReference;
-  _idNameMap[Zeiss::MetaXML::MeteorChannelInputCountMonoId] = Zeiss::MetaXML::MeteorChannelInputCountMono;
-  _idNameMap[Zeiss::MetaXML::MeteorChannelInputCountRGBId] = Zeiss::MetaXML::MeteorChannelInputCountRGB;
-  _idNameMap[Zeiss::MetaXML::MeteorEnableVCRId] = Zeiss::MetaXML::MeteorEnableVCR;
-  _idNameMap[Zeiss::MetaXML::MeteorBrightnessId] = Zeiss::MetaXML::MeteorBrightness;
-  _idNameMap[Zeiss::MetaXML::MeteorContrastId] = Zeiss::MetaXML::MeteorContrast;
-  _idNameMap[Zeiss::MetaXML::AxioCamSelectorId] = Zeiss::MetaXML::AxioCamSelector;
-  _idNameMap[Zeiss::MetaXML::AxioCamTypeId] = Zeiss::MetaXML::AxioCamType;
-  _idNameMap[Zeiss::MetaXML::AxioCamInfoId] = Zeiss::MetaXML::AxioCamInfo;
-  _idNameMap[Zeiss::MetaXML::AxioCamResolutionId] = Zeiss::MetaXML::AxioCamResolution;
-  _idNameMap[Zeiss::MetaXML::AxioCamColourModelId] = Zeiss::MetaXML::AxioCamColourModel;
-  _idNameMap[Zeiss::MetaXML::AxioCamMicroScanningId] = Zeiss::MetaXML::AxioCamMicroScanning;
-  _idNameMap[Zeiss::MetaXML::AmplificationIndexId] = Zeiss::MetaXML::AmplificationIndex;
-  _idNameMap[Zeiss::MetaXML::DeviceCommandId] = Zeiss::MetaXML::DeviceCommand;
-  _idNameMap[Zeiss::MetaXML::BeamLocationId] = Zeiss::MetaXML::BeamLocation;
-  _idNameMap[Zeiss::MetaXML::ComponentTypeId] = Zeiss::MetaXML::ComponentType;
-  _idNameMap[Zeiss::MetaXML::ControllerTypeId] = Zeiss::MetaXML::ControllerType;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceCalculationRedPaintId] = Zeiss::MetaXML::CameraWhiteBalanceCalculationRedPaint;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceCalculationBluePaintId] = Zeiss::MetaXML::CameraWhiteBalanceCalculationBluePaint;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceSetRedId] = Zeiss::MetaXML::CameraWhiteBalanceSetRed;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceSetGreenId] = Zeiss::MetaXML::CameraWhiteBalanceSetGreen;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceSetBlueId] = Zeiss::MetaXML::CameraWhiteBalanceSetBlue;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceSetTargetRedId] = Zeiss::MetaXML::CameraWhiteBalanceSetTargetRed;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceSetTargetGreenId] = Zeiss::MetaXML::CameraWhiteBalanceSetTargetGreen;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceSetTargetBlueId] = Zeiss::MetaXML::CameraWhiteBalanceSetTargetBlue;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamCalibrationModeId] = Zeiss::MetaXML::ApotomeCamCalibrationMode;
-  _idNameMap[Zeiss::MetaXML::ApoTomeGridPositionId] = Zeiss::MetaXML::ApoTomeGridPosition;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamScannerPositionId] = Zeiss::MetaXML::ApotomeCamScannerPosition;
-  _idNameMap[Zeiss::MetaXML::ApoTomeFullPhaseShiftId] = Zeiss::MetaXML::ApoTomeFullPhaseShift;
-  _idNameMap[Zeiss::MetaXML::ApoTomeGridNameId] = Zeiss::MetaXML::ApoTomeGridName;
-  _idNameMap[Zeiss::MetaXML::ApoTomeStainingId] = Zeiss::MetaXML::ApoTomeStaining;
-  _idNameMap[Zeiss::MetaXML::ApoTomeProcessingModeId] = Zeiss::MetaXML::ApoTomeProcessingMode;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamLiveCombineModeId] = Zeiss::MetaXML::ApotomeCamLiveCombineMode;
-  _idNameMap[Zeiss::MetaXML::ApoTomeFilterNameId] = Zeiss::MetaXML::ApoTomeFilterName;
-  _idNameMap[Zeiss::MetaXML::ApotomeFilterStrengthId] = Zeiss::MetaXML::ApotomeFilterStrength;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamFilterHarmonicsId] = Zeiss::MetaXML::ApotomeCamFilterHarmonics;
-  _idNameMap[Zeiss::MetaXML::ApoTomeGratingPeriodId] = Zeiss::MetaXML::ApoTomeGratingPeriod;
-  _idNameMap[Zeiss::MetaXML::ApoTomeAutoShutterUsedId] = Zeiss::MetaXML::ApoTomeAutoShutterUsed;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamStatusId] = Zeiss::MetaXML::ApotomeCamStatus;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamNormalizeId] = Zeiss::MetaXML::ApotomeCamNormalize;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamSettingsManagerId] = Zeiss::MetaXML::ApotomeCamSettingsManager;
-  _idNameMap[Zeiss::MetaXML::DeepviewCamSupervisorModeId] = Zeiss::MetaXML::DeepviewCamSupervisorMode;
-  _idNameMap[Zeiss::MetaXML::DeepViewProcessingId] = Zeiss::MetaXML::DeepViewProcessing;
-  _idNameMap[Zeiss::MetaXML::DeepviewCamFilterNameId] = Zeiss::MetaXML::DeepviewCamFilterName;
-  _idNameMap[Zeiss::MetaXML::DeepviewCamStatusId] = Zeiss::MetaXML::DeepviewCamStatus;
-  _idNameMap[Zeiss::MetaXML::DeepviewCamSettingsManagerId] = Zeiss::MetaXML::DeepviewCamSettingsManager;
-  _idNameMap[Zeiss::MetaXML::DeviceScalingNameId] = Zeiss::MetaXML::DeviceScalingName;
-  _idNameMap[Zeiss::MetaXML::CameraShadingIsCalculatedId] = Zeiss::MetaXML::CameraShadingIsCalculated;
-  _idNameMap[Zeiss::MetaXML::CameraShadingCalculationNameId] = Zeiss::MetaXML::CameraShadingCalculationName;
-  _idNameMap[Zeiss::MetaXML::CameraShadingAutoCalculateId] = Zeiss::MetaXML::CameraShadingAutoCalculate;
-  _idNameMap[Zeiss::MetaXML::CameraTriggerAvailableId] = Zeiss::MetaXML::CameraTriggerAvailable;
-  _idNameMap[Zeiss::MetaXML::CameraShutterAvailableId] = Zeiss::MetaXML::CameraShutterAvailable;
-  _idNameMap[Zeiss::MetaXML::AxioCamShutterMicroScanningEnableId] = Zeiss::MetaXML::AxioCamShutterMicroScanningEnable;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamLiveFocusId] = Zeiss::MetaXML::ApotomeCamLiveFocus;
-  _idNameMap[Zeiss::MetaXML::DeviceInitStatusId] = Zeiss::MetaXML::DeviceInitStatus;
-  _idNameMap[Zeiss::MetaXML::DeviceErrorStatusId] = Zeiss::MetaXML::DeviceErrorStatus;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamSliderInGridPositionId] = Zeiss::MetaXML::ApotomeCamSliderInGridPosition;
-  _idNameMap[Zeiss::MetaXML::OrcaNIRModeUsedId] = Zeiss::MetaXML::OrcaNIRModeUsed;
-  _idNameMap[Zeiss::MetaXML::OrcaAnalogGainId] = Zeiss::MetaXML::OrcaAnalogGain;
-  _idNameMap[Zeiss::MetaXML::OrcaAnalogOffsetId] = Zeiss::MetaXML::OrcaAnalogOffset;
-  _idNameMap[Zeiss::MetaXML::OrcaBinningId] = Zeiss::MetaXML::OrcaBinning;
-  _idNameMap[Zeiss::MetaXML::OrcaBitDepthId] = Zeiss::MetaXML::OrcaBitDepth;
-  _idNameMap[Zeiss::MetaXML::ApoTomeAveragingCountId] = Zeiss::MetaXML::ApoTomeAveragingCount;
-  _idNameMap[Zeiss::MetaXML::DeepViewDoFId] = Zeiss::MetaXML::DeepViewDoF;
-  _idNameMap[Zeiss::MetaXML::DeepViewEDoFId] = Zeiss::MetaXML::DeepViewEDoF;
-  _idNameMap[Zeiss::MetaXML::DeepViewSliderNameId] = Zeiss::MetaXML::DeepViewSliderName;
-  _idNameMap[Zeiss::MetaXML::RoperCamGainId] = Zeiss::MetaXML::RoperCamGain;
-  _idNameMap[Zeiss::MetaXML::RoperCamPixelClockId] = Zeiss::MetaXML::RoperCamPixelClock;
-  _idNameMap[Zeiss::MetaXML::RoperCamTemperatureId] = Zeiss::MetaXML::RoperCamTemperature;
-  _idNameMap[Zeiss::MetaXML::CameraImageMemUnitNamesId] = Zeiss::MetaXML::CameraImageMemUnitNames;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamLivePhaseId] = Zeiss::MetaXML::ApotomeCamLivePhase;
-  _idNameMap[Zeiss::MetaXML::DualAxioCamAlgorithmTypeId] = Zeiss::MetaXML::DualAxioCamAlgorithmType;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamDecayId] = Zeiss::MetaXML::ApotomeCamDecay;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamEpsilonId] = Zeiss::MetaXML::ApotomeCamEpsilon;
-  _idNameMap[Zeiss::MetaXML::AxioCamHSBufferNumberId] = Zeiss::MetaXML::AxioCamHSBufferNumber;
-  _idNameMap[Zeiss::MetaXML::AxioCamHSFrameTimeId] = Zeiss::MetaXML::AxioCamHSFrameTime;
-  _idNameMap[Zeiss::MetaXML::AxioCamAnalogGainEnableId] = Zeiss::MetaXML::AxioCamAnalogGainEnable;
-  _idNameMap[Zeiss::MetaXML::AxioCamAnalogGainAvailableId] = Zeiss::MetaXML::AxioCamAnalogGainAvailable;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamPhaseAnglesId] = Zeiss::MetaXML::ApotomeCamPhaseAngles;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamImageFormatId] = Zeiss::MetaXML::ApotomeCamImageFormat;
-  _idNameMap[Zeiss::MetaXML::CameraShadingCountId] = Zeiss::MetaXML::CameraShadingCount;
-  _idNameMap[Zeiss::MetaXML::CameraImageRawSizeId] = Zeiss::MetaXML::CameraImageRawSize;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamBurstModeId] = Zeiss::MetaXML::ApotomeCamBurstMode;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamGenericCameraNameId] = Zeiss::MetaXML::ApotomeCamGenericCameraName;
-  _idNameMap[Zeiss::MetaXML::AcquisitionDeviceId] = Zeiss::MetaXML::AcquisitionDevice;
-  _idNameMap[Zeiss::MetaXML::ApotomeGratingPeriodMeasuredId] = Zeiss::MetaXML::ApotomeGratingPeriodMeasured;
-  _idNameMap[Zeiss::MetaXML::CameraLutEnableId] = Zeiss::MetaXML::CameraLutEnable;
-  _idNameMap[Zeiss::MetaXML::AxioCamSaturationId] = Zeiss::MetaXML::AxioCamSaturation;
-  _idNameMap[Zeiss::MetaXML::CameraColorCorrectionId] = Zeiss::MetaXML::CameraColorCorrection;
-  _idNameMap[Zeiss::MetaXML::CameraColorProcessingEnableId] = Zeiss::MetaXML::CameraColorProcessingEnable;
-  _idNameMap[Zeiss::MetaXML::CameraAnalogGainId] = Zeiss::MetaXML::CameraAnalogGain;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceTargetPosXId] = Zeiss::MetaXML::CameraWhiteBalanceTargetPosX;
-  _idNameMap[Zeiss::MetaXML::CameraWhiteBalanceTargetPosYId] = Zeiss::MetaXML::CameraWhiteBalanceTargetPosY;
-  _idNameMap[Zeiss::MetaXML::CameraShutterSignalPortId] = Zeiss::MetaXML::CameraShutterSignalPort;
-  _idNameMap[Zeiss::MetaXML::AxioCamICSaturationId] = Zeiss::MetaXML::AxioCamICSaturation;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamCamCalibModeId] = Zeiss::MetaXML::ApotomeCamCamCalibMode;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamCamCalibValueId] = Zeiss::MetaXML::ApotomeCamCamCalibValue;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamAdminCalibModeId] = Zeiss::MetaXML::ApotomeCamAdminCalibMode;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamIsAdminId] = Zeiss::MetaXML::ApotomeCamIsAdmin;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamPwId] = Zeiss::MetaXML::ApotomeCamPw;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamAdminNameId] = Zeiss::MetaXML::ApotomeCamAdminName;
-  _idNameMap[Zeiss::MetaXML::CameraShutterLiveEnableId] = Zeiss::MetaXML::CameraShutterLiveEnable;
-  _idNameMap[Zeiss::MetaXML::CameraExposureTimeAutoLiveEnableId] = Zeiss::MetaXML::CameraExposureTimeAutoLiveEnable;
-  _idNameMap[Zeiss::MetaXML::CameraEMGainId] = Zeiss::MetaXML::CameraEMGain;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamHardwareVersionId] = Zeiss::MetaXML::ApotomeCamHardwareVersion;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamGridPositionId] = Zeiss::MetaXML::ApotomeCamGridPosition;
-  _idNameMap[Zeiss::MetaXML::ApotomeCamAutoGridId] = Zeiss::MetaXML::ApotomeCamAutoGrid;
-  _idNameMap[Zeiss::MetaXML::OrcaCamNumberOfScanModeId] = Zeiss::MetaXML::OrcaCamNumberOfScanMode;
-  _idNameMap[Zeiss::MetaXML::OrcaCamScanModeId] = Zeiss::MetaXML::OrcaCamScanMode;
-  _idNameMap[Zeiss::MetaXML::OrcaCamEMCCDModeId] = Zeiss::MetaXML::OrcaCamEMCCDMode;
-  _idNameMap[Zeiss::MetaXML::OrcaCamEMCCDGainId] = Zeiss::MetaXML::OrcaCamEMCCDGain;
-  _idNameMap[Zeiss::MetaXML::OrcaCamFastAcqId] = Zeiss::MetaXML::OrcaCamFastAcq;
-  _idNameMap[Zeiss::MetaXML::OrcaCamMinExposureTimeId] = Zeiss::MetaXML::OrcaCamMinExposureTime;
-  _idNameMap[Zeiss::MetaXML::OrcaCamNumberOfPhotonImagingModeId] = Zeiss::MetaXML::OrcaCamNumberOfPhotonImagingMode;
-  _idNameMap[Zeiss::MetaXML::OrcaCamPhotonImagingModeId] = Zeiss::MetaXML::OrcaCamPhotonImagingMode;
-  _idNameMap[Zeiss::MetaXML::OrcaCamDirectEMGainAvailableId] = Zeiss::MetaXML::OrcaCamDirectEMGainAvailable;
-  _idNameMap[Zeiss::MetaXML::OrcaCamDirectEMGainId] = Zeiss::MetaXML::OrcaCamDirectEMGain;
-  _idNameMap[Zeiss::MetaXML::OrcaCamEMGainProtectionAvailableId] = Zeiss::MetaXML::OrcaCamEMGainProtectionAvailable;
-  _idNameMap[Zeiss::MetaXML::OrcaCamEMGainProtectionId] = Zeiss::MetaXML::OrcaCamEMGainProtection;
-  _idNameMap[Zeiss::MetaXML::CameraEMGainMinimumId] = Zeiss::MetaXML::CameraEMGainMinimum;
-  _idNameMap[Zeiss::MetaXML::CameraEMGainMaximumId] = Zeiss::MetaXML::CameraEMGainMaximum;
-  _idNameMap[Zeiss::MetaXML::CameraEMGainAvailableId] = Zeiss::MetaXML::CameraEMGainAvailable;
-  _idNameMap[Zeiss::MetaXML::CameraEMGainEnabledId] = Zeiss::MetaXML::CameraEMGainEnabled;
-  _idNameMap[Zeiss::MetaXML::YokogawaSynchronizeId] = Zeiss::MetaXML::YokogawaSynchronize;
-  _idNameMap[Zeiss::MetaXML::YokogawaIsInSyncId] = Zeiss::MetaXML::YokogawaIsInSync;
-  _idNameMap[Zeiss::MetaXML::YokogawaStatusId] = Zeiss::MetaXML::YokogawaStatus;
-  _idNameMap[Zeiss::MetaXML::YokogawaKeepInSyncId] = Zeiss::MetaXML::YokogawaKeepInSync;
-  _idNameMap[Zeiss::MetaXML::YokogawaIsBusyId] = Zeiss::MetaXML::YokogawaIsBusy;
-  _idNameMap[Zeiss::MetaXML::YokogawaStopDiscId] = Zeiss::MetaXML::YokogawaStopDisc;
-  _idNameMap[Zeiss::MetaXML::YokogawaCamExposureTimeId] = Zeiss::MetaXML::YokogawaCamExposureTime;
-  _idNameMap[Zeiss::MetaXML::YokogawaModeId] = Zeiss::MetaXML::YokogawaMode;
-  _idNameMap[Zeiss::MetaXML::YokogawaDepthId] = Zeiss::MetaXML::YokogawaDepth;
-  _idNameMap[Zeiss::MetaXML::YokogawaCamReserved12Id] = Zeiss::MetaXML::YokogawaCamReserved12;
-  _idNameMap[Zeiss::MetaXML::YokogawaCamReserved13Id] = Zeiss::MetaXML::YokogawaCamReserved13;
-  _idNameMap[Zeiss::MetaXML::YokogawaCamReserved14Id] = Zeiss::MetaXML::YokogawaCamReserved14;
-  _idNameMap[Zeiss::MetaXML::YokogawaCamReserved15Id] = Zeiss::MetaXML::YokogawaCamReserved15;
-  _idNameMap[Zeiss::MetaXML::YokogawaCamReserved16Id] = Zeiss::MetaXML::YokogawaCamReserved16;
-  _idNameMap[Zeiss::MetaXML::YokogawaCamReserved17Id] = Zeiss::MetaXML::YokogawaCamReserved17;
-  _idNameMap[Zeiss::MetaXML::YokogawaCamReserved18Id] = Zeiss::MetaXML::YokogawaCamReserved18;
-  _idNameMap[Zeiss::MetaXML::YokogawaCamReserved19Id] = Zeiss::MetaXML::YokogawaCamReserved19;
-  _idNameMap[Zeiss::MetaXML::YokogawaCamReserved20Id] = Zeiss::MetaXML::YokogawaCamReserved20;
-  _idNameMap[Zeiss::MetaXML::AuroxCamStatusId] = Zeiss::MetaXML::AuroxCamStatus;
-  _idNameMap[Zeiss::MetaXML::AuroxCamInputModeId] = Zeiss::MetaXML::AuroxCamInputMode;
-  _idNameMap[Zeiss::MetaXML::AuroxCamLiveModeId] = Zeiss::MetaXML::AuroxCamLiveMode;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCalibrationModeId] = Zeiss::MetaXML::AuroxCamCalibrationMode;
-  _idNameMap[Zeiss::MetaXML::AuroxCamGenericCameraNameId] = Zeiss::MetaXML::AuroxCamGenericCameraName;
-  _idNameMap[Zeiss::MetaXML::AuroxCamButtonModeId] = Zeiss::MetaXML::AuroxCamButtonMode;
-  _idNameMap[Zeiss::MetaXML::AuroxCamDepthId] = Zeiss::MetaXML::AuroxCamDepth;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCenterId] = Zeiss::MetaXML::AuroxCamCenter;
-  _idNameMap[Zeiss::MetaXML::AuroxCamFactorId] = Zeiss::MetaXML::AuroxCamFactor;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCreateRegistrationId] = Zeiss::MetaXML::AuroxCamCreateRegistration;
-  _idNameMap[Zeiss::MetaXML::AuroxCamRegistrationValidId] = Zeiss::MetaXML::AuroxCamRegistrationValid;
-  _idNameMap[Zeiss::MetaXML::AuroxCamRegistrationErrorId] = Zeiss::MetaXML::AuroxCamRegistrationError;
-  _idNameMap[Zeiss::MetaXML::AuroxCamShadingImageModeId] = Zeiss::MetaXML::AuroxCamShadingImageMode;
-  _idNameMap[Zeiss::MetaXML::AuroxCamShadingImageAvailableId] = Zeiss::MetaXML::AuroxCamShadingImageAvailable;
-  _idNameMap[Zeiss::MetaXML::AuroxCamQualityId] = Zeiss::MetaXML::AuroxCamQuality;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCutLeftId] = Zeiss::MetaXML::AuroxCamCutLeft;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCutTopId] = Zeiss::MetaXML::AuroxCamCutTop;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCutRightId] = Zeiss::MetaXML::AuroxCamCutRight;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCutBottomId] = Zeiss::MetaXML::AuroxCamCutBottom;
-  _idNameMap[Zeiss::MetaXML::AuroxCamMeanId] = Zeiss::MetaXML::AuroxCamMean;
-  _idNameMap[Zeiss::MetaXML::AuroxCamNormalizeId] = Zeiss::MetaXML::AuroxCamNormalize;
-  _idNameMap[Zeiss::MetaXML::AuroxCamUseShadingId] = Zeiss::MetaXML::AuroxCamUseShading;
-  _idNameMap[Zeiss::MetaXML::AuroxCamShadingValidId] = Zeiss::MetaXML::AuroxCamShadingValid;
-  _idNameMap[Zeiss::MetaXML::AuroxCamNotificationId] = Zeiss::MetaXML::AuroxCamNotification;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCalibrationIDId] = Zeiss::MetaXML::AuroxCamCalibrationID;
-  _idNameMap[Zeiss::MetaXML::AuroxCamSimpleCalibModeId] = Zeiss::MetaXML::AuroxCamSimpleCalibMode;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCalibrationNameId] = Zeiss::MetaXML::AuroxCamCalibrationName;
-  _idNameMap[Zeiss::MetaXML::AuroxCamRes6Id] = Zeiss::MetaXML::AuroxCamRes6;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCFactorId] = Zeiss::MetaXML::AuroxCamCFactor;
-  _idNameMap[Zeiss::MetaXML::AuroxCamRegistrationCenterId] = Zeiss::MetaXML::AuroxCamRegistrationCenter;
-  _idNameMap[Zeiss::MetaXML::AuroxCamCalibrationID2Id] = Zeiss::MetaXML::AuroxCamCalibrationID2;
-  _idNameMap[Zeiss::MetaXML::AuroxCamAveragingId] = Zeiss::MetaXML::AuroxCamAveraging;
-  _idNameMap[Zeiss::MetaXML::AuroxCamUniqueIDId] = Zeiss::MetaXML::AuroxCamUniqueID;
-  _idNameMap[Zeiss::MetaXML::AuroxCamAutoNormalizeId] = Zeiss::MetaXML::AuroxCamAutoNormalize;
-  _idNameMap[Zeiss::MetaXML::AuroxCamReserved3Id] = Zeiss::MetaXML::AuroxCamReserved3;
-  _idNameMap[Zeiss::MetaXML::AuroxCamReserved4Id] = Zeiss::MetaXML::AuroxCamReserved4;
-  _idNameMap[Zeiss::MetaXML::AuroxCamReserved5Id] = Zeiss::MetaXML::AuroxCamReserved5;
-
-  _idNameMap[Zeiss::MetaXML::Factor_0Id] = Zeiss::MetaXML::Factor_0;
-  _idNameMap[Zeiss::MetaXML::Type_0Id] = Zeiss::MetaXML::Type_0;
-  _idNameMap[Zeiss::MetaXML::Unit_0Id] = Zeiss::MetaXML::Unit_0;
-  _idNameMap[Zeiss::MetaXML::Origin_0Id] = Zeiss::MetaXML::Origin_0;
-  _idNameMap[Zeiss::MetaXML::Angle_0Id] = Zeiss::MetaXML::Angle_0;
-  _idNameMap[Zeiss::MetaXML::Factor_1Id] = Zeiss::MetaXML::Factor_1;
-  _idNameMap[Zeiss::MetaXML::Type_1Id] = Zeiss::MetaXML::Type_1;
-  _idNameMap[Zeiss::MetaXML::Unit_1Id] = Zeiss::MetaXML::Unit_1;
-  _idNameMap[Zeiss::MetaXML::Origin_1Id] = Zeiss::MetaXML::Origin_1;
-  _idNameMap[Zeiss::MetaXML::Angle_1Id] = Zeiss::MetaXML::Angle_1;
-  _idNameMap[Zeiss::MetaXML::Factor_2Id] = Zeiss::MetaXML::Factor_2;
-  _idNameMap[Zeiss::MetaXML::Type_2Id] = Zeiss::MetaXML::Type_2;
-  _idNameMap[Zeiss::MetaXML::Unit_2Id] = Zeiss::MetaXML::Unit_2;
-  _idNameMap[Zeiss::MetaXML::Origin_2Id] = Zeiss::MetaXML::Origin_2;
-  _idNameMap[Zeiss::MetaXML::Angle_2Id] = Zeiss::MetaXML::Angle_2;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissTagMapping::initNameIdMap()
-{
-  _nameIdMap[Zeiss::MetaXML::Compression] = Zeiss::MetaXML::CompressionId;
-  _nameIdMap[Zeiss::MetaXML::DateMappingTable] = Zeiss::MetaXML::DateMappingTableId;
-  _nameIdMap[Zeiss::MetaXML::BlackValue] = Zeiss::MetaXML::BlackValueId;
-  _nameIdMap[Zeiss::MetaXML::Whitevalue] = Zeiss::MetaXML::WhitevalueId;
-  _nameIdMap[Zeiss::MetaXML::ImageDataMappingAutoRange] = Zeiss::MetaXML::ImageDataMappingAutoRangeId;
-  _nameIdMap[Zeiss::MetaXML::ImageThumbnail] = Zeiss::MetaXML::ImageThumbnailId;
-  _nameIdMap[Zeiss::MetaXML::GammaValue] = Zeiss::MetaXML::GammaValueId;
-  _nameIdMap[Zeiss::MetaXML::ImageOverExposure] = Zeiss::MetaXML::ImageOverExposureId;
-  _nameIdMap[Zeiss::MetaXML::ImageRelativeTime1] = Zeiss::MetaXML::ImageRelativeTime1Id;
-  _nameIdMap[Zeiss::MetaXML::ImageRelativeTime2] = Zeiss::MetaXML::ImageRelativeTime2Id;
-  _nameIdMap[Zeiss::MetaXML::ImageRelativeTime3] = Zeiss::MetaXML::ImageRelativeTime3Id;
-  _nameIdMap[Zeiss::MetaXML::ImageRelativeTime4] = Zeiss::MetaXML::ImageRelativeTime4Id;
-  _nameIdMap[Zeiss::MetaXML::ImageRelativeTime] = Zeiss::MetaXML::ImageRelativeTimeId;
-  _nameIdMap[Zeiss::MetaXML::ImageBaseTimeFirst] = Zeiss::MetaXML::ImageBaseTimeFirstId;
-  _nameIdMap[Zeiss::MetaXML::ImageBaseTime1] = Zeiss::MetaXML::ImageBaseTime1Id;
-  _nameIdMap[Zeiss::MetaXML::ImageBaseTime2] = Zeiss::MetaXML::ImageBaseTime2Id;
-  _nameIdMap[Zeiss::MetaXML::ImageBaseTime3] = Zeiss::MetaXML::ImageBaseTime3Id;
-  _nameIdMap[Zeiss::MetaXML::ImageBaseTime4] = Zeiss::MetaXML::ImageBaseTime4Id;
-  _nameIdMap[Zeiss::MetaXML::ImageWidthPixel] = Zeiss::MetaXML::ImageWidthPixelId;
-  _nameIdMap[Zeiss::MetaXML::ImageHeightPixel] = Zeiss::MetaXML::ImageHeightPixelId;
-  _nameIdMap[Zeiss::MetaXML::ImageCountRaw] = Zeiss::MetaXML::ImageCountRawId;
-  _nameIdMap[Zeiss::MetaXML::PixelType] = Zeiss::MetaXML::PixelTypeId;
-  _nameIdMap[Zeiss::MetaXML::NumberRawImages] = Zeiss::MetaXML::NumberRawImagesId;
-  _nameIdMap[Zeiss::MetaXML::ImageSize] = Zeiss::MetaXML::ImageSizeId;
-  _nameIdMap[Zeiss::MetaXML::CompressionFactorForSave] = Zeiss::MetaXML::CompressionFactorForSaveId;
-  _nameIdMap[Zeiss::MetaXML::DocumentSaveFlags] = Zeiss::MetaXML::DocumentSaveFlagsId;
-  _nameIdMap[Zeiss::MetaXML::Acquisitionpauseannotation] = Zeiss::MetaXML::AcquisitionpauseannotationId;
-  _nameIdMap[Zeiss::MetaXML::DocumentSubtype] = Zeiss::MetaXML::DocumentSubtypeId;
-  _nameIdMap[Zeiss::MetaXML::AcquisitionBitDepth] = Zeiss::MetaXML::AcquisitionBitDepthId;
-  _nameIdMap[Zeiss::MetaXML::Z_Stacksinglerepresentative] = Zeiss::MetaXML::Z_StacksinglerepresentativeId;
-  _nameIdMap[Zeiss::MetaXML::ScaleFactorForX] = Zeiss::MetaXML::ScaleFactorForXId;
-  _nameIdMap[Zeiss::MetaXML::ScaleUnitforX] = Zeiss::MetaXML::ScaleUnitforXId;
-  _nameIdMap[Zeiss::MetaXML::ScaleWidth] = Zeiss::MetaXML::ScaleWidthId;
-  _nameIdMap[Zeiss::MetaXML::ScaleFactorForY] = Zeiss::MetaXML::ScaleFactorForYId;
-  _nameIdMap[Zeiss::MetaXML::ScaleUnitforY] = Zeiss::MetaXML::ScaleUnitforYId;
-  _nameIdMap[Zeiss::MetaXML::ScaleHeight] = Zeiss::MetaXML::ScaleHeightId;
-  _nameIdMap[Zeiss::MetaXML::ScaleFactorForZ] = Zeiss::MetaXML::ScaleFactorForZId;
-  _nameIdMap[Zeiss::MetaXML::ScaleUnitforZ] = Zeiss::MetaXML::ScaleUnitforZId;
-  _nameIdMap[Zeiss::MetaXML::ScaleDepth] = Zeiss::MetaXML::ScaleDepthId;
-  _nameIdMap[Zeiss::MetaXML::ScalingParent] = Zeiss::MetaXML::ScalingParentId;
-  _nameIdMap[Zeiss::MetaXML::Date] = Zeiss::MetaXML::DateId;
-  _nameIdMap[Zeiss::MetaXML::Code] = Zeiss::MetaXML::CodeId;
-  _nameIdMap[Zeiss::MetaXML::Source] = Zeiss::MetaXML::SourceId;
-  _nameIdMap[Zeiss::MetaXML::Message] = Zeiss::MetaXML::MessageId;
-  _nameIdMap[Zeiss::MetaXML::CameraImageAcquisitionTime] = Zeiss::MetaXML::CameraImageAcquisitionTimeId;
-  _nameIdMap[Zeiss::MetaXML::Eight_bitAcquisition] = Zeiss::MetaXML::Eight_bitAcquisitionId;
-  _nameIdMap[Zeiss::MetaXML::CameraBitDepth] = Zeiss::MetaXML::CameraBitDepthId;
-  _nameIdMap[Zeiss::MetaXML::MonoReferenceLow] = Zeiss::MetaXML::MonoReferenceLowId;
-  _nameIdMap[Zeiss::MetaXML::MonoReferenceHigh] = Zeiss::MetaXML::MonoReferenceHighId;
-  _nameIdMap[Zeiss::MetaXML::RedReferenceLow] = Zeiss::MetaXML::RedReferenceLowId;
-  _nameIdMap[Zeiss::MetaXML::RedReferenceHigh] = Zeiss::MetaXML::RedReferenceHighId;
-  _nameIdMap[Zeiss::MetaXML::GreenReferenceLow] = Zeiss::MetaXML::GreenReferenceLowId;
-  _nameIdMap[Zeiss::MetaXML::GreenReferenceHigh] = Zeiss::MetaXML::GreenReferenceHighId;
-  _nameIdMap[Zeiss::MetaXML::BlueReferenceLow] = Zeiss::MetaXML::BlueReferenceLowId;
-  _nameIdMap[Zeiss::MetaXML::BlueReferenceHigh] = Zeiss::MetaXML::BlueReferenceHighId;
-  _nameIdMap[Zeiss::MetaXML::FramegrabberName] = Zeiss::MetaXML::FramegrabberNameId;
-  _nameIdMap[Zeiss::MetaXML::Camera] = Zeiss::MetaXML::CameraId;
-  _nameIdMap[Zeiss::MetaXML::CameraTriggerSignalType] = Zeiss::MetaXML::CameraTriggerSignalTypeId;
-  _nameIdMap[Zeiss::MetaXML::CameraTriggerEnable] = Zeiss::MetaXML::CameraTriggerEnableId;
-  _nameIdMap[Zeiss::MetaXML::GrabberTimeout] = Zeiss::MetaXML::GrabberTimeoutId;
-  _nameIdMap[Zeiss::MetaXML::MultiChannelEnabled] = Zeiss::MetaXML::MultiChannelEnabledId;
-  _nameIdMap[Zeiss::MetaXML::MultichannelColour] = Zeiss::MetaXML::MultichannelColourId;
-  _nameIdMap[Zeiss::MetaXML::MultichannelWeight] = Zeiss::MetaXML::MultichannelWeightId;
-  _nameIdMap[Zeiss::MetaXML::ChannelName] = Zeiss::MetaXML::ChannelNameId;
-  _nameIdMap[Zeiss::MetaXML::DocumentInformationGroup] = Zeiss::MetaXML::DocumentInformationGroupId;
-  _nameIdMap[Zeiss::MetaXML::Title] = Zeiss::MetaXML::TitleId;
-  _nameIdMap[Zeiss::MetaXML::Author] = Zeiss::MetaXML::AuthorId;
-  _nameIdMap[Zeiss::MetaXML::Keywords] = Zeiss::MetaXML::KeywordsId;
-  _nameIdMap[Zeiss::MetaXML::Comments] = Zeiss::MetaXML::CommentsId;
-  _nameIdMap[Zeiss::MetaXML::SampleID] = Zeiss::MetaXML::SampleIDId;
-  _nameIdMap[Zeiss::MetaXML::Subject] = Zeiss::MetaXML::SubjectId;
-  _nameIdMap[Zeiss::MetaXML::RevisionNumber] = Zeiss::MetaXML::RevisionNumberId;
-  _nameIdMap[Zeiss::MetaXML::SaveFolder] = Zeiss::MetaXML::SaveFolderId;
-  _nameIdMap[Zeiss::MetaXML::FileLink] = Zeiss::MetaXML::FileLinkId;
-  _nameIdMap[Zeiss::MetaXML::DocumentType] = Zeiss::MetaXML::DocumentTypeId;
-  _nameIdMap[Zeiss::MetaXML::StorageMedia] = Zeiss::MetaXML::StorageMediaId;
-  _nameIdMap[Zeiss::MetaXML::FileID] = Zeiss::MetaXML::FileIDId;
-  _nameIdMap[Zeiss::MetaXML::Reference] = Zeiss::MetaXML::ReferenceId;
-  _nameIdMap[Zeiss::MetaXML::FileDate] = Zeiss::MetaXML::FileDateId;
-  _nameIdMap[Zeiss::MetaXML::FileSize] = Zeiss::MetaXML::FileSizeId;
-  _nameIdMap[Zeiss::MetaXML::Filename] = Zeiss::MetaXML::FilenameId;
-  _nameIdMap[Zeiss::MetaXML::FileAttributes] = Zeiss::MetaXML::FileAttributesId;
-  _nameIdMap[Zeiss::MetaXML::ProjectGroup] = Zeiss::MetaXML::ProjectGroupId;
-  _nameIdMap[Zeiss::MetaXML::AcquisitionDate] = Zeiss::MetaXML::AcquisitionDateId;
-  _nameIdMap[Zeiss::MetaXML::Lastmodifiedby] = Zeiss::MetaXML::LastmodifiedbyId;
-  _nameIdMap[Zeiss::MetaXML::UserCompany] = Zeiss::MetaXML::UserCompanyId;
-  _nameIdMap[Zeiss::MetaXML::UserCompanyLogo] = Zeiss::MetaXML::UserCompanyLogoId;
-  _nameIdMap[Zeiss::MetaXML::Image] = Zeiss::MetaXML::ImageId;
-  _nameIdMap[Zeiss::MetaXML::UserID] = Zeiss::MetaXML::UserIDId;
-  _nameIdMap[Zeiss::MetaXML::UserName] = Zeiss::MetaXML::UserNameId;
-  _nameIdMap[Zeiss::MetaXML::UserCity] = Zeiss::MetaXML::UserCityId;
-  _nameIdMap[Zeiss::MetaXML::UserAddress] = Zeiss::MetaXML::UserAddressId;
-  _nameIdMap[Zeiss::MetaXML::UserCountry] = Zeiss::MetaXML::UserCountryId;
-  _nameIdMap[Zeiss::MetaXML::UserPhone] = Zeiss::MetaXML::UserPhoneId;
-  _nameIdMap[Zeiss::MetaXML::UserFax] = Zeiss::MetaXML::UserFaxId;
-  _nameIdMap[Zeiss::MetaXML::ObjectiveName] = Zeiss::MetaXML::ObjectiveNameId;
-  _nameIdMap[Zeiss::MetaXML::Optovar] = Zeiss::MetaXML::OptovarId;
-  _nameIdMap[Zeiss::MetaXML::Reflector] = Zeiss::MetaXML::ReflectorId;
-  _nameIdMap[Zeiss::MetaXML::CondenserContrast] = Zeiss::MetaXML::CondenserContrastId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightFilter1] = Zeiss::MetaXML::TransmittedLightFilter1Id;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightFilter2] = Zeiss::MetaXML::TransmittedLightFilter2Id;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightShutter] = Zeiss::MetaXML::ReflectedLightShutterId;
-  _nameIdMap[Zeiss::MetaXML::CondenserFrontLens] = Zeiss::MetaXML::CondenserFrontLensId;
-  _nameIdMap[Zeiss::MetaXML::ExcitationFilerName] = Zeiss::MetaXML::ExcitationFilerNameId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightFieldstopAperture] = Zeiss::MetaXML::TransmittedLightFieldstopApertureId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightAperture] = Zeiss::MetaXML::ReflectedLightApertureId;
-  _nameIdMap[Zeiss::MetaXML::CondenserN_A_] = Zeiss::MetaXML::CondenserN_A_Id;
-  _nameIdMap[Zeiss::MetaXML::LightPath] = Zeiss::MetaXML::LightPathId;
-  _nameIdMap[Zeiss::MetaXML::HalogenLampOn] = Zeiss::MetaXML::HalogenLampOnId;
-  _nameIdMap[Zeiss::MetaXML::HalogenLampMode] = Zeiss::MetaXML::HalogenLampModeId;
-  _nameIdMap[Zeiss::MetaXML::HalogenLampVoltage] = Zeiss::MetaXML::HalogenLampVoltageId;
-  _nameIdMap[Zeiss::MetaXML::FluorescenceLampLevel] = Zeiss::MetaXML::FluorescenceLampLevelId;
-  _nameIdMap[Zeiss::MetaXML::FluorescenceLampIntensity] = Zeiss::MetaXML::FluorescenceLampIntensityId;
-  _nameIdMap[Zeiss::MetaXML::LightManagerisEnabled] = Zeiss::MetaXML::LightManagerisEnabledId;
-  _nameIdMap[Zeiss::MetaXML::FocusPosition] = Zeiss::MetaXML::FocusPositionId;
-  _nameIdMap[Zeiss::MetaXML::StagePositionX] = Zeiss::MetaXML::StagePositionXId;
-  _nameIdMap[Zeiss::MetaXML::StagePositionY] = Zeiss::MetaXML::StagePositionYId;
-  _nameIdMap[Zeiss::MetaXML::MicroscopeName] = Zeiss::MetaXML::MicroscopeNameId;
-  _nameIdMap[Zeiss::MetaXML::ObjectiveMagnification] = Zeiss::MetaXML::ObjectiveMagnificationId;
-  _nameIdMap[Zeiss::MetaXML::ObjectiveN_A_] = Zeiss::MetaXML::ObjectiveN_A_Id;
-  _nameIdMap[Zeiss::MetaXML::MicroscopeIllumination] = Zeiss::MetaXML::MicroscopeIlluminationId;
-  _nameIdMap[Zeiss::MetaXML::ExternalShutter1] = Zeiss::MetaXML::ExternalShutter1Id;
-  _nameIdMap[Zeiss::MetaXML::ExternalShutter2] = Zeiss::MetaXML::ExternalShutter2Id;
-  _nameIdMap[Zeiss::MetaXML::ExternalShutter3] = Zeiss::MetaXML::ExternalShutter3Id;
-  _nameIdMap[Zeiss::MetaXML::ExternalFilterWheel1Name] = Zeiss::MetaXML::ExternalFilterWheel1NameId;
-  _nameIdMap[Zeiss::MetaXML::ExternalFilterWheel2Name] = Zeiss::MetaXML::ExternalFilterWheel2NameId;
-  _nameIdMap[Zeiss::MetaXML::ParfocalCorrection] = Zeiss::MetaXML::ParfocalCorrectionId;
-  _nameIdMap[Zeiss::MetaXML::ExternalShutter4] = Zeiss::MetaXML::ExternalShutter4Id;
-  _nameIdMap[Zeiss::MetaXML::ExternalShutter5] = Zeiss::MetaXML::ExternalShutter5Id;
-  _nameIdMap[Zeiss::MetaXML::ExternalShutter6] = Zeiss::MetaXML::ExternalShutter6Id;
-  _nameIdMap[Zeiss::MetaXML::ExternalFilterWheel3Name] = Zeiss::MetaXML::ExternalFilterWheel3NameId;
-  _nameIdMap[Zeiss::MetaXML::ExternalFilterWheel4Name] = Zeiss::MetaXML::ExternalFilterWheel4NameId;
-  _nameIdMap[Zeiss::MetaXML::ObjectiveTurretPosition] = Zeiss::MetaXML::ObjectiveTurretPositionId;
-  _nameIdMap[Zeiss::MetaXML::ObjectiveContrastMethod] = Zeiss::MetaXML::ObjectiveContrastMethodId;
-  _nameIdMap[Zeiss::MetaXML::ObjectiveImmersionType] = Zeiss::MetaXML::ObjectiveImmersionTypeId;
-  _nameIdMap[Zeiss::MetaXML::ReflectorPosition] = Zeiss::MetaXML::ReflectorPositionId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightFilter1Position] = Zeiss::MetaXML::TransmittedLightFilter1PositionId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightFilter2Position] = Zeiss::MetaXML::TransmittedLightFilter2PositionId;
-  _nameIdMap[Zeiss::MetaXML::ExcitationFilterPosition] = Zeiss::MetaXML::ExcitationFilterPositionId;
-  _nameIdMap[Zeiss::MetaXML::LampMirrorPositionERSETZTDURCH241] = Zeiss::MetaXML::LampMirrorPositionERSETZTDURCH241Id;
-  _nameIdMap[Zeiss::MetaXML::ExternalFilterWheel1Position] = Zeiss::MetaXML::ExternalFilterWheel1PositionId;
-  _nameIdMap[Zeiss::MetaXML::ExternalFilterWheel2Position] = Zeiss::MetaXML::ExternalFilterWheel2PositionId;
-  _nameIdMap[Zeiss::MetaXML::ExternalFilterWheel3Position] = Zeiss::MetaXML::ExternalFilterWheel3PositionId;
-  _nameIdMap[Zeiss::MetaXML::ExternalFilterWheel4Position] = Zeiss::MetaXML::ExternalFilterWheel4PositionId;
-  _nameIdMap[Zeiss::MetaXML::LightmanagerMode] = Zeiss::MetaXML::LightmanagerModeId;
-  _nameIdMap[Zeiss::MetaXML::HalogenLampCalibration] = Zeiss::MetaXML::HalogenLampCalibrationId;
-  _nameIdMap[Zeiss::MetaXML::CondenserNAGoSpeed] = Zeiss::MetaXML::CondenserNAGoSpeedId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightFieldstopGoSpeed] = Zeiss::MetaXML::TransmittedLightFieldstopGoSpeedId;
-  _nameIdMap[Zeiss::MetaXML::OptovarGoSpeed] = Zeiss::MetaXML::OptovarGoSpeedId;
-  _nameIdMap[Zeiss::MetaXML::Focuscalibrated] = Zeiss::MetaXML::FocuscalibratedId;
-  _nameIdMap[Zeiss::MetaXML::FocusBasicPosition] = Zeiss::MetaXML::FocusBasicPositionId;
-  _nameIdMap[Zeiss::MetaXML::FocusPower] = Zeiss::MetaXML::FocusPowerId;
-  _nameIdMap[Zeiss::MetaXML::FocusBacklash] = Zeiss::MetaXML::FocusBacklashId;
-  _nameIdMap[Zeiss::MetaXML::FocusMeasurementOrigin] = Zeiss::MetaXML::FocusMeasurementOriginId;
-  _nameIdMap[Zeiss::MetaXML::FocusMeasurementDistance] = Zeiss::MetaXML::FocusMeasurementDistanceId;
-  _nameIdMap[Zeiss::MetaXML::FocusSpeed] = Zeiss::MetaXML::FocusSpeedId;
-  _nameIdMap[Zeiss::MetaXML::FocusGoSpeed] = Zeiss::MetaXML::FocusGoSpeedId;
-  _nameIdMap[Zeiss::MetaXML::FocusDistance] = Zeiss::MetaXML::FocusDistanceId;
-  _nameIdMap[Zeiss::MetaXML::FocusInitPosition] = Zeiss::MetaXML::FocusInitPositionId;
-  _nameIdMap[Zeiss::MetaXML::Stagecalibrated] = Zeiss::MetaXML::StagecalibratedId;
-  _nameIdMap[Zeiss::MetaXML::StagePower] = Zeiss::MetaXML::StagePowerId;
-  _nameIdMap[Zeiss::MetaXML::StageXBacklash] = Zeiss::MetaXML::StageXBacklashId;
-  _nameIdMap[Zeiss::MetaXML::StageYBacklash] = Zeiss::MetaXML::StageYBacklashId;
-  _nameIdMap[Zeiss::MetaXML::StageSpeedX] = Zeiss::MetaXML::StageSpeedXId;
-  _nameIdMap[Zeiss::MetaXML::StageSpeedY] = Zeiss::MetaXML::StageSpeedYId;
-  _nameIdMap[Zeiss::MetaXML::StageSpeed] = Zeiss::MetaXML::StageSpeedId;
-  _nameIdMap[Zeiss::MetaXML::StageGoSpeedX] = Zeiss::MetaXML::StageGoSpeedXId;
-  _nameIdMap[Zeiss::MetaXML::StageGoSpeedY] = Zeiss::MetaXML::StageGoSpeedYId;
-  _nameIdMap[Zeiss::MetaXML::StageStepDistanceX] = Zeiss::MetaXML::StageStepDistanceXId;
-  _nameIdMap[Zeiss::MetaXML::StageStepDistanceY] = Zeiss::MetaXML::StageStepDistanceYId;
-  _nameIdMap[Zeiss::MetaXML::StageInitialisationPositionX] = Zeiss::MetaXML::StageInitialisationPositionXId;
-  _nameIdMap[Zeiss::MetaXML::StageInitialisationPositionY] = Zeiss::MetaXML::StageInitialisationPositionYId;
-  _nameIdMap[Zeiss::MetaXML::MicroscopeMagnification] = Zeiss::MetaXML::MicroscopeMagnificationId;
-  _nameIdMap[Zeiss::MetaXML::ReflectorMagnification] = Zeiss::MetaXML::ReflectorMagnificationId;
-  _nameIdMap[Zeiss::MetaXML::LampMirrorPosition] = Zeiss::MetaXML::LampMirrorPositionId;
-  _nameIdMap[Zeiss::MetaXML::FocusDepth] = Zeiss::MetaXML::FocusDepthId;
-  _nameIdMap[Zeiss::MetaXML::MicroscopeType] = Zeiss::MetaXML::MicroscopeTypeId;
-  _nameIdMap[Zeiss::MetaXML::ObjectiveWorkingDistance] = Zeiss::MetaXML::ObjectiveWorkingDistanceId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightApertureGoSpeed] = Zeiss::MetaXML::ReflectedLightApertureGoSpeedId;
-  _nameIdMap[Zeiss::MetaXML::ExternalShutter] = Zeiss::MetaXML::ExternalShutterId;
-  _nameIdMap[Zeiss::MetaXML::ObjectiveImmersionStop] = Zeiss::MetaXML::ObjectiveImmersionStopId;
-  _nameIdMap[Zeiss::MetaXML::FocusStartSpeed] = Zeiss::MetaXML::FocusStartSpeedId;
-  _nameIdMap[Zeiss::MetaXML::FocusAcceleration] = Zeiss::MetaXML::FocusAccelerationId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightFieldstop] = Zeiss::MetaXML::ReflectedLightFieldstopId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightFieldstopGoSpeed] = Zeiss::MetaXML::ReflectedLightFieldstopGoSpeedId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightFilter1] = Zeiss::MetaXML::ReflectedLightFilter1Id;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightFilter2] = Zeiss::MetaXML::ReflectedLightFilter2Id;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightFilter1Position] = Zeiss::MetaXML::ReflectedLightFilter1PositionId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightFilter2Position] = Zeiss::MetaXML::ReflectedLightFilter2PositionId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightAttenuator] = Zeiss::MetaXML::TransmittedLightAttenuatorId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightAttenuator] = Zeiss::MetaXML::ReflectedLightAttenuatorId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightShutter] = Zeiss::MetaXML::TransmittedLightShutterId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightAttenuatorGoSpeed] = Zeiss::MetaXML::TransmittedLightAttenuatorGoSpeedId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightAttenuatorGoSpeed] = Zeiss::MetaXML::ReflectedLightAttenuatorGoSpeedId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightVirtualFilterPosition] = Zeiss::MetaXML::TransmittedLightVirtualFilterPositionId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightVirtualFilter] = Zeiss::MetaXML::TransmittedLightVirtualFilterId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightVirtualFilterPosition] = Zeiss::MetaXML::ReflectedLightVirtualFilterPositionId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightVirtualFilter] = Zeiss::MetaXML::ReflectedLightVirtualFilterId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightHalogenLampMode] = Zeiss::MetaXML::ReflectedLightHalogenLampModeId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightHalogenLampVoltage] = Zeiss::MetaXML::ReflectedLightHalogenLampVoltageId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedLightHalogenLampColourTemperature] = Zeiss::MetaXML::ReflectedLightHalogenLampColourTemperatureId;
-  _nameIdMap[Zeiss::MetaXML::ContrastmanagerMode] = Zeiss::MetaXML::ContrastmanagerModeId;
-  _nameIdMap[Zeiss::MetaXML::DazzleProtectionActive] = Zeiss::MetaXML::DazzleProtectionActiveId;
-  _nameIdMap[Zeiss::MetaXML::Zoom] = Zeiss::MetaXML::ZoomId;
-  _nameIdMap[Zeiss::MetaXML::ZoomGoSpeed] = Zeiss::MetaXML::ZoomGoSpeedId;
-  _nameIdMap[Zeiss::MetaXML::LightZoom] = Zeiss::MetaXML::LightZoomId;
-  _nameIdMap[Zeiss::MetaXML::LightZoomGoSpeed] = Zeiss::MetaXML::LightZoomGoSpeedId;
-  _nameIdMap[Zeiss::MetaXML::LightzoomCoupled] = Zeiss::MetaXML::LightzoomCoupledId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightHalogenLampMode] = Zeiss::MetaXML::TransmittedLightHalogenLampModeId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightHalogenLampVoltage] = Zeiss::MetaXML::TransmittedLightHalogenLampVoltageId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedLightHalogenLampColourTemperature] = Zeiss::MetaXML::TransmittedLightHalogenLampColourTemperatureId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedColdlightMode] = Zeiss::MetaXML::ReflectedColdlightModeId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedColdlightIntensity] = Zeiss::MetaXML::ReflectedColdlightIntensityId;
-  _nameIdMap[Zeiss::MetaXML::ReflectedColdlightColourTemperature] = Zeiss::MetaXML::ReflectedColdlightColourTemperatureId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedColdlightMode] = Zeiss::MetaXML::TransmittedColdlightModeId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedColdlightIntensity] = Zeiss::MetaXML::TransmittedColdlightIntensityId;
-  _nameIdMap[Zeiss::MetaXML::TransmittedColdlightColourTemperature] = Zeiss::MetaXML::TransmittedColdlightColourTemperatureId;
-  _nameIdMap[Zeiss::MetaXML::InfinityspacePortchangerPosition] = Zeiss::MetaXML::InfinityspacePortchangerPositionId;
-  _nameIdMap[Zeiss::MetaXML::BeamsplitterInfinitySpace] = Zeiss::MetaXML::BeamsplitterInfinitySpaceId;
-  _nameIdMap[Zeiss::MetaXML::TwoTvVisCamChangerPosition] = Zeiss::MetaXML::TwoTvVisCamChangerPositionId;
-  _nameIdMap[Zeiss::MetaXML::BeamsplitterOcular] = Zeiss::MetaXML::BeamsplitterOcularId;
-  _nameIdMap[Zeiss::MetaXML::TwoTvCamerasChangerPosition] = Zeiss::MetaXML::TwoTvCamerasChangerPositionId;
-  _nameIdMap[Zeiss::MetaXML::BeamsplitterCameras] = Zeiss::MetaXML::BeamsplitterCamerasId;
-  _nameIdMap[Zeiss::MetaXML::OcularShutter] = Zeiss::MetaXML::OcularShutterId;
-  _nameIdMap[Zeiss::MetaXML::TwoTvCamerasChangerCube] = Zeiss::MetaXML::TwoTvCamerasChangerCubeId;
-  _nameIdMap[Zeiss::MetaXML::LightWaveLength] = Zeiss::MetaXML::LightWaveLengthId;
-  _nameIdMap[Zeiss::MetaXML::OcularMagnification] = Zeiss::MetaXML::OcularMagnificationId;
-  _nameIdMap[Zeiss::MetaXML::CameraAdapterMagnification] = Zeiss::MetaXML::CameraAdapterMagnificationId;
-  _nameIdMap[Zeiss::MetaXML::MicroscopePort] = Zeiss::MetaXML::MicroscopePortId;
-  _nameIdMap[Zeiss::MetaXML::OcularTotalMagnification] = Zeiss::MetaXML::OcularTotalMagnificationId;
-  _nameIdMap[Zeiss::MetaXML::FieldofView] = Zeiss::MetaXML::FieldofViewId;
-  _nameIdMap[Zeiss::MetaXML::Ocular] = Zeiss::MetaXML::OcularId;
-  _nameIdMap[Zeiss::MetaXML::CameraAdapter] = Zeiss::MetaXML::CameraAdapterId;
-  _nameIdMap[Zeiss::MetaXML::StageJoystickEnabled] = Zeiss::MetaXML::StageJoystickEnabledId;
-  _nameIdMap[Zeiss::MetaXML::ContrastmanagerContrastMethod] = Zeiss::MetaXML::ContrastmanagerContrastMethodId;
-  _nameIdMap[Zeiss::MetaXML::CamerasChangerBeamSplitterType] = Zeiss::MetaXML::CamerasChangerBeamSplitterTypeId;
-  _nameIdMap[Zeiss::MetaXML::RearportSliderPosition] = Zeiss::MetaXML::RearportSliderPositionId;
-  _nameIdMap[Zeiss::MetaXML::RearportSource] = Zeiss::MetaXML::RearportSourceId;
-  _nameIdMap[Zeiss::MetaXML::BeamsplitterTypeInfinitySpace] = Zeiss::MetaXML::BeamsplitterTypeInfinitySpaceId;
-  _nameIdMap[Zeiss::MetaXML::FluorescenceAttenuator] = Zeiss::MetaXML::FluorescenceAttenuatorId;
-  _nameIdMap[Zeiss::MetaXML::FluorescenceAttenuatorPosition] = Zeiss::MetaXML::FluorescenceAttenuatorPositionId;
-  _nameIdMap[Zeiss::MetaXML::CameraFramestartLeft] = Zeiss::MetaXML::CameraFramestartLeftId;
-  _nameIdMap[Zeiss::MetaXML::CameraFramestartTop] = Zeiss::MetaXML::CameraFramestartTopId;
-  _nameIdMap[Zeiss::MetaXML::CameraFrameWidth] = Zeiss::MetaXML::CameraFrameWidthId;
-  _nameIdMap[Zeiss::MetaXML::CameraFrameHeight] = Zeiss::MetaXML::CameraFrameHeightId;
-  _nameIdMap[Zeiss::MetaXML::CameraBinning] = Zeiss::MetaXML::CameraBinningId;
-  _nameIdMap[Zeiss::MetaXML::CameraFrameFull] = Zeiss::MetaXML::CameraFrameFullId;
-  _nameIdMap[Zeiss::MetaXML::CameraFramePixelDistance] = Zeiss::MetaXML::CameraFramePixelDistanceId;
-  _nameIdMap[Zeiss::MetaXML::DataFormatUseScaling] = Zeiss::MetaXML::DataFormatUseScalingId;
-  _nameIdMap[Zeiss::MetaXML::CameraFrameImageOrientation] = Zeiss::MetaXML::CameraFrameImageOrientationId;
-  _nameIdMap[Zeiss::MetaXML::VideoMonochromeSignalType] = Zeiss::MetaXML::VideoMonochromeSignalTypeId;
-  _nameIdMap[Zeiss::MetaXML::VideoColorSignalType] = Zeiss::MetaXML::VideoColorSignalTypeId;
-  _nameIdMap[Zeiss::MetaXML::MeteorChannelInput] = Zeiss::MetaXML::MeteorChannelInputId;
-  _nameIdMap[Zeiss::MetaXML::MeteorChannelSync] = Zeiss::MetaXML::MeteorChannelSyncId;
-  _nameIdMap[Zeiss::MetaXML::WhiteBalanceEnabled] = Zeiss::MetaXML::WhiteBalanceEnabledId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceRed] = Zeiss::MetaXML::CameraWhiteBalanceRedId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceGreen] = Zeiss::MetaXML::CameraWhiteBalanceGreenId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceBlue] = Zeiss::MetaXML::CameraWhiteBalanceBlueId;
-  _nameIdMap[Zeiss::MetaXML::CameraFrameScalingFactor] = Zeiss::MetaXML::CameraFrameScalingFactorId;
-  _nameIdMap[Zeiss::MetaXML::MeteorCameraType] = Zeiss::MetaXML::MeteorCameraTypeId;
-  _nameIdMap[Zeiss::MetaXML::ExposureTime_ms_] = Zeiss::MetaXML::ExposureTime_ms_Id;
-  _nameIdMap[Zeiss::MetaXML::CameraExposureTimeAutoCalculate] = Zeiss::MetaXML::CameraExposureTimeAutoCalculateId;
-  _nameIdMap[Zeiss::MetaXML::MeteorGainValue] = Zeiss::MetaXML::MeteorGainValueId;
-  _nameIdMap[Zeiss::MetaXML::MeteorGainAutomatic] = Zeiss::MetaXML::MeteorGainAutomaticId;
-  _nameIdMap[Zeiss::MetaXML::MeteorAdjustHue] = Zeiss::MetaXML::MeteorAdjustHueId;
-  _nameIdMap[Zeiss::MetaXML::MeteorAdjustSaturation] = Zeiss::MetaXML::MeteorAdjustSaturationId;
-  _nameIdMap[Zeiss::MetaXML::MeteorAdjustRedLow] = Zeiss::MetaXML::MeteorAdjustRedLowId;
-  _nameIdMap[Zeiss::MetaXML::MeteorAdjustGreenLow] = Zeiss::MetaXML::MeteorAdjustGreenLowId;
-  _nameIdMap[Zeiss::MetaXML::MeteorBlueLow] = Zeiss::MetaXML::MeteorBlueLowId;
-  _nameIdMap[Zeiss::MetaXML::MeteorAdjustRedHigh] = Zeiss::MetaXML::MeteorAdjustRedHighId;
-  _nameIdMap[Zeiss::MetaXML::MeteorAdjustGreenHigh] = Zeiss::MetaXML::MeteorAdjustGreenHighId;
-  _nameIdMap[Zeiss::MetaXML::MeteorBlueHigh] = Zeiss::MetaXML::MeteorBlueHighId;
-  _nameIdMap[Zeiss::MetaXML::CameraExposureTimeCalculationControl] = Zeiss::MetaXML::CameraExposureTimeCalculationControlId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamFadingCorrectionEnable] = Zeiss::MetaXML::AxioCamFadingCorrectionEnableId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveImage] = Zeiss::MetaXML::CameraLiveImageId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveEnabled] = Zeiss::MetaXML::CameraLiveEnabledId;
-  _nameIdMap[Zeiss::MetaXML::LiveImageSyncObjectName] = Zeiss::MetaXML::LiveImageSyncObjectNameId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveSpeed] = Zeiss::MetaXML::CameraLiveSpeedId;
-  _nameIdMap[Zeiss::MetaXML::CameraImage] = Zeiss::MetaXML::CameraImageId;
-  _nameIdMap[Zeiss::MetaXML::CameraImageWidth] = Zeiss::MetaXML::CameraImageWidthId;
-  _nameIdMap[Zeiss::MetaXML::CameraImageHeight] = Zeiss::MetaXML::CameraImageHeightId;
-  _nameIdMap[Zeiss::MetaXML::CameraImagePixelType] = Zeiss::MetaXML::CameraImagePixelTypeId;
-  _nameIdMap[Zeiss::MetaXML::CameraImageShMemoryName] = Zeiss::MetaXML::CameraImageShMemoryNameId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveImageWidth] = Zeiss::MetaXML::CameraLiveImageWidthId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveImageHeight] = Zeiss::MetaXML::CameraLiveImageHeightId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveImagePixelType] = Zeiss::MetaXML::CameraLiveImagePixelTypeId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveImageShMemoryName] = Zeiss::MetaXML::CameraLiveImageShMemoryNameId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveMaximumSpeed] = Zeiss::MetaXML::CameraLiveMaximumSpeedId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveBinning] = Zeiss::MetaXML::CameraLiveBinningId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveGainValue] = Zeiss::MetaXML::CameraLiveGainValueId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveExposureTimeValue] = Zeiss::MetaXML::CameraLiveExposureTimeValueId;
-  _nameIdMap[Zeiss::MetaXML::CameraLiveScalingFactor] = Zeiss::MetaXML::CameraLiveScalingFactorId;
-  _nameIdMap[Zeiss::MetaXML::ImageIndexU] = Zeiss::MetaXML::ImageIndexUId;
-  _nameIdMap[Zeiss::MetaXML::ImageIndexV] = Zeiss::MetaXML::ImageIndexVId;
-  _nameIdMap[Zeiss::MetaXML::ImageIndexZ] = Zeiss::MetaXML::ImageIndexZId;
-  _nameIdMap[Zeiss::MetaXML::ImageIndexC] = Zeiss::MetaXML::ImageIndexCId;
-  _nameIdMap[Zeiss::MetaXML::ImageIndexT] = Zeiss::MetaXML::ImageIndexTId;
-  _nameIdMap[Zeiss::MetaXML::ImageTileIndex] = Zeiss::MetaXML::ImageTileIndexId;
-  _nameIdMap[Zeiss::MetaXML::ImageacquisitionIndex] = Zeiss::MetaXML::ImageacquisitionIndexId;
-  _nameIdMap[Zeiss::MetaXML::ImageCountTiles] = Zeiss::MetaXML::ImageCountTilesId;
-  _nameIdMap[Zeiss::MetaXML::ImageCountA] = Zeiss::MetaXML::ImageCountAId;
-  _nameIdMap[Zeiss::MetaXML::ImageIndexS] = Zeiss::MetaXML::ImageIndexSId;
-  _nameIdMap[Zeiss::MetaXML::ImageIndexRaw] = Zeiss::MetaXML::ImageIndexRawId;
-  _nameIdMap[Zeiss::MetaXML::ImageCountZ] = Zeiss::MetaXML::ImageCountZId;
-  _nameIdMap[Zeiss::MetaXML::ImageCountC] = Zeiss::MetaXML::ImageCountCId;
-  _nameIdMap[Zeiss::MetaXML::ImageCountT] = Zeiss::MetaXML::ImageCountTId;
-  _nameIdMap[Zeiss::MetaXML::ImageCountU] = Zeiss::MetaXML::ImageCountUId;
-  _nameIdMap[Zeiss::MetaXML::ImageCountV] = Zeiss::MetaXML::ImageCountVId;
-  _nameIdMap[Zeiss::MetaXML::ImageCountS] = Zeiss::MetaXML::ImageCountSId;
-  _nameIdMap[Zeiss::MetaXML::OriginalStagePositionX] = Zeiss::MetaXML::OriginalStagePositionXId;
-  _nameIdMap[Zeiss::MetaXML::OriginalStagePositionY] = Zeiss::MetaXML::OriginalStagePositionYId;
-  _nameIdMap[Zeiss::MetaXML::LayerDrawFlags] = Zeiss::MetaXML::LayerDrawFlagsId;
-  _nameIdMap[Zeiss::MetaXML::RemainingTime] = Zeiss::MetaXML::RemainingTimeId;
-  _nameIdMap[Zeiss::MetaXML::UserField1] = Zeiss::MetaXML::UserField1Id;
-  _nameIdMap[Zeiss::MetaXML::UserField2] = Zeiss::MetaXML::UserField2Id;
-  _nameIdMap[Zeiss::MetaXML::UserField3] = Zeiss::MetaXML::UserField3Id;
-  _nameIdMap[Zeiss::MetaXML::UserField4] = Zeiss::MetaXML::UserField4Id;
-  _nameIdMap[Zeiss::MetaXML::UserField5] = Zeiss::MetaXML::UserField5Id;
-  _nameIdMap[Zeiss::MetaXML::UserField6] = Zeiss::MetaXML::UserField6Id;
-  _nameIdMap[Zeiss::MetaXML::UserField7] = Zeiss::MetaXML::UserField7Id;
-  _nameIdMap[Zeiss::MetaXML::UserField8] = Zeiss::MetaXML::UserField8Id;
-  _nameIdMap[Zeiss::MetaXML::UserField9] = Zeiss::MetaXML::UserField9Id;
-  _nameIdMap[Zeiss::MetaXML::UserField10] = Zeiss::MetaXML::UserField10Id;
-  _nameIdMap[Zeiss::MetaXML::ID] = Zeiss::MetaXML::IDId;
-  _nameIdMap[Zeiss::MetaXML::Name] = Zeiss::MetaXML::NameId;
-  _nameIdMap[Zeiss::MetaXML::Value] = Zeiss::MetaXML::ValueId;
-  _nameIdMap[Zeiss::MetaXML::PvCamClockingMode] = Zeiss::MetaXML::PvCamClockingModeId;
-  _nameIdMap[Zeiss::MetaXML::AutofocusStatusReport] = Zeiss::MetaXML::AutofocusStatusReportId;
-  _nameIdMap[Zeiss::MetaXML::AutofocusPosition] = Zeiss::MetaXML::AutofocusPositionId;
-  _nameIdMap[Zeiss::MetaXML::AutofocusPositionOffset] = Zeiss::MetaXML::AutofocusPositionOffsetId;
-  _nameIdMap[Zeiss::MetaXML::AutofocusEmptyFieldThreshold] = Zeiss::MetaXML::AutofocusEmptyFieldThresholdId;
-  _nameIdMap[Zeiss::MetaXML::AutofocusCalibrationName] = Zeiss::MetaXML::AutofocusCalibrationNameId;
-  _nameIdMap[Zeiss::MetaXML::AutofocusCurrentCalibrationItem] = Zeiss::MetaXML::AutofocusCurrentCalibrationItemId;
-  _nameIdMap[Zeiss::MetaXML::CameraFrameFullWidth] = Zeiss::MetaXML::CameraFrameFullWidthId;
-  _nameIdMap[Zeiss::MetaXML::CameraFrameFullHeight] = Zeiss::MetaXML::CameraFrameFullHeightId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamShutterSignal] = Zeiss::MetaXML::AxioCamShutterSignalId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamDelayTime] = Zeiss::MetaXML::AxioCamDelayTimeId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamShutterControl] = Zeiss::MetaXML::AxioCamShutterControlId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamBlackRefIsCalculated] = Zeiss::MetaXML::AxioCamBlackRefIsCalculatedId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamBlackReference] = Zeiss::MetaXML::AxioCamBlackReferenceId;
-  _nameIdMap[Zeiss::MetaXML::CameraShadingCorrection] = Zeiss::MetaXML::CameraShadingCorrectionId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamEnhanceColor] = Zeiss::MetaXML::AxioCamEnhanceColorId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamNIRMode] = Zeiss::MetaXML::AxioCamNIRModeId;
-  _nameIdMap[Zeiss::MetaXML::CameraShutterCloseDelay] = Zeiss::MetaXML::CameraShutterCloseDelayId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceAutoCalculate] = Zeiss::MetaXML::CameraWhiteBalanceAutoCalculateId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamNIRModeAvailable] = Zeiss::MetaXML::AxioCamNIRModeAvailableId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamFadingCorrectionAvailable] = Zeiss::MetaXML::AxioCamFadingCorrectionAvailableId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamEnhanceColorAvailable] = Zeiss::MetaXML::AxioCamEnhanceColorAvailableId;
-  _nameIdMap[Zeiss::MetaXML::MeteorVideoNorm] = Zeiss::MetaXML::MeteorVideoNormId;
-  _nameIdMap[Zeiss::MetaXML::MeteorAdjustWhiteReference] = Zeiss::MetaXML::MeteorAdjustWhiteReferenceId;
-  _nameIdMap[Zeiss::MetaXML::MeteorBlackReference] = Zeiss::MetaXML::MeteorBlackReferenceId;
-  _nameIdMap[Zeiss::MetaXML::MeteorChannelInputCountMono] = Zeiss::MetaXML::MeteorChannelInputCountMonoId;
-  _nameIdMap[Zeiss::MetaXML::MeteorChannelInputCountRGB] = Zeiss::MetaXML::MeteorChannelInputCountRGBId;
-  _nameIdMap[Zeiss::MetaXML::MeteorEnableVCR] = Zeiss::MetaXML::MeteorEnableVCRId;
-  _nameIdMap[Zeiss::MetaXML::MeteorBrightness] = Zeiss::MetaXML::MeteorBrightnessId;
-  _nameIdMap[Zeiss::MetaXML::MeteorContrast] = Zeiss::MetaXML::MeteorContrastId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamSelector] = Zeiss::MetaXML::AxioCamSelectorId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamType] = Zeiss::MetaXML::AxioCamTypeId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamInfo] = Zeiss::MetaXML::AxioCamInfoId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamResolution] = Zeiss::MetaXML::AxioCamResolutionId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamColourModel] = Zeiss::MetaXML::AxioCamColourModelId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamMicroScanning] = Zeiss::MetaXML::AxioCamMicroScanningId;
-  _nameIdMap[Zeiss::MetaXML::AmplificationIndex] = Zeiss::MetaXML::AmplificationIndexId;
-  _nameIdMap[Zeiss::MetaXML::DeviceCommand] = Zeiss::MetaXML::DeviceCommandId;
-  _nameIdMap[Zeiss::MetaXML::BeamLocation] = Zeiss::MetaXML::BeamLocationId;
-  _nameIdMap[Zeiss::MetaXML::ComponentType] = Zeiss::MetaXML::ComponentTypeId;
-  _nameIdMap[Zeiss::MetaXML::ControllerType] = Zeiss::MetaXML::ControllerTypeId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceCalculationRedPaint] = Zeiss::MetaXML::CameraWhiteBalanceCalculationRedPaintId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceCalculationBluePaint] = Zeiss::MetaXML::CameraWhiteBalanceCalculationBluePaintId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceSetRed] = Zeiss::MetaXML::CameraWhiteBalanceSetRedId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceSetGreen] = Zeiss::MetaXML::CameraWhiteBalanceSetGreenId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceSetBlue] = Zeiss::MetaXML::CameraWhiteBalanceSetBlueId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceSetTargetRed] = Zeiss::MetaXML::CameraWhiteBalanceSetTargetRedId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceSetTargetGreen] = Zeiss::MetaXML::CameraWhiteBalanceSetTargetGreenId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceSetTargetBlue] = Zeiss::MetaXML::CameraWhiteBalanceSetTargetBlueId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamCalibrationMode] = Zeiss::MetaXML::ApotomeCamCalibrationModeId;
-  _nameIdMap[Zeiss::MetaXML::ApoTomeGridPosition] = Zeiss::MetaXML::ApoTomeGridPositionId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamScannerPosition] = Zeiss::MetaXML::ApotomeCamScannerPositionId;
-  _nameIdMap[Zeiss::MetaXML::ApoTomeFullPhaseShift] = Zeiss::MetaXML::ApoTomeFullPhaseShiftId;
-  _nameIdMap[Zeiss::MetaXML::ApoTomeGridName] = Zeiss::MetaXML::ApoTomeGridNameId;
-  _nameIdMap[Zeiss::MetaXML::ApoTomeStaining] = Zeiss::MetaXML::ApoTomeStainingId;
-  _nameIdMap[Zeiss::MetaXML::ApoTomeProcessingMode] = Zeiss::MetaXML::ApoTomeProcessingModeId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamLiveCombineMode] = Zeiss::MetaXML::ApotomeCamLiveCombineModeId;
-  _nameIdMap[Zeiss::MetaXML::ApoTomeFilterName] = Zeiss::MetaXML::ApoTomeFilterNameId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeFilterStrength] = Zeiss::MetaXML::ApotomeFilterStrengthId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamFilterHarmonics] = Zeiss::MetaXML::ApotomeCamFilterHarmonicsId;
-  _nameIdMap[Zeiss::MetaXML::ApoTomeGratingPeriod] = Zeiss::MetaXML::ApoTomeGratingPeriodId;
-  _nameIdMap[Zeiss::MetaXML::ApoTomeAutoShutterUsed] = Zeiss::MetaXML::ApoTomeAutoShutterUsedId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamStatus] = Zeiss::MetaXML::ApotomeCamStatusId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamNormalize] = Zeiss::MetaXML::ApotomeCamNormalizeId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamSettingsManager] = Zeiss::MetaXML::ApotomeCamSettingsManagerId;
-  _nameIdMap[Zeiss::MetaXML::DeepviewCamSupervisorMode] = Zeiss::MetaXML::DeepviewCamSupervisorModeId;
-  _nameIdMap[Zeiss::MetaXML::DeepViewProcessing] = Zeiss::MetaXML::DeepViewProcessingId;
-  _nameIdMap[Zeiss::MetaXML::DeepviewCamFilterName] = Zeiss::MetaXML::DeepviewCamFilterNameId;
-  _nameIdMap[Zeiss::MetaXML::DeepviewCamStatus] = Zeiss::MetaXML::DeepviewCamStatusId;
-  _nameIdMap[Zeiss::MetaXML::DeepviewCamSettingsManager] = Zeiss::MetaXML::DeepviewCamSettingsManagerId;
-  _nameIdMap[Zeiss::MetaXML::DeviceScalingName] = Zeiss::MetaXML::DeviceScalingNameId;
-  _nameIdMap[Zeiss::MetaXML::CameraShadingIsCalculated] = Zeiss::MetaXML::CameraShadingIsCalculatedId;
-  _nameIdMap[Zeiss::MetaXML::CameraShadingCalculationName] = Zeiss::MetaXML::CameraShadingCalculationNameId;
-  _nameIdMap[Zeiss::MetaXML::CameraShadingAutoCalculate] = Zeiss::MetaXML::CameraShadingAutoCalculateId;
-  _nameIdMap[Zeiss::MetaXML::CameraTriggerAvailable] = Zeiss::MetaXML::CameraTriggerAvailableId;
-  _nameIdMap[Zeiss::MetaXML::CameraShutterAvailable] = Zeiss::MetaXML::CameraShutterAvailableId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamShutterMicroScanningEnable] = Zeiss::MetaXML::AxioCamShutterMicroScanningEnableId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamLiveFocus] = Zeiss::MetaXML::ApotomeCamLiveFocusId;
-  _nameIdMap[Zeiss::MetaXML::DeviceInitStatus] = Zeiss::MetaXML::DeviceInitStatusId;
-  _nameIdMap[Zeiss::MetaXML::DeviceErrorStatus] = Zeiss::MetaXML::DeviceErrorStatusId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamSliderInGridPosition] = Zeiss::MetaXML::ApotomeCamSliderInGridPositionId;
-  _nameIdMap[Zeiss::MetaXML::OrcaNIRModeUsed] = Zeiss::MetaXML::OrcaNIRModeUsedId;
-  _nameIdMap[Zeiss::MetaXML::OrcaAnalogGain] = Zeiss::MetaXML::OrcaAnalogGainId;
-  _nameIdMap[Zeiss::MetaXML::OrcaAnalogOffset] = Zeiss::MetaXML::OrcaAnalogOffsetId;
-  _nameIdMap[Zeiss::MetaXML::OrcaBinning] = Zeiss::MetaXML::OrcaBinningId;
-  _nameIdMap[Zeiss::MetaXML::OrcaBitDepth] = Zeiss::MetaXML::OrcaBitDepthId;
-  _nameIdMap[Zeiss::MetaXML::ApoTomeAveragingCount] = Zeiss::MetaXML::ApoTomeAveragingCountId;
-  _nameIdMap[Zeiss::MetaXML::DeepViewDoF] = Zeiss::MetaXML::DeepViewDoFId;
-  _nameIdMap[Zeiss::MetaXML::DeepViewEDoF] = Zeiss::MetaXML::DeepViewEDoFId;
-  _nameIdMap[Zeiss::MetaXML::DeepViewSliderName] = Zeiss::MetaXML::DeepViewSliderNameId;
-  _nameIdMap[Zeiss::MetaXML::RoperCamGain] = Zeiss::MetaXML::RoperCamGainId;
-  _nameIdMap[Zeiss::MetaXML::RoperCamPixelClock] = Zeiss::MetaXML::RoperCamPixelClockId;
-  _nameIdMap[Zeiss::MetaXML::RoperCamTemperature] = Zeiss::MetaXML::RoperCamTemperatureId;
-  _nameIdMap[Zeiss::MetaXML::CameraImageMemUnitNames] = Zeiss::MetaXML::CameraImageMemUnitNamesId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamLivePhase] = Zeiss::MetaXML::ApotomeCamLivePhaseId;
-  _nameIdMap[Zeiss::MetaXML::DualAxioCamAlgorithmType] = Zeiss::MetaXML::DualAxioCamAlgorithmTypeId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamDecay] = Zeiss::MetaXML::ApotomeCamDecayId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamEpsilon] = Zeiss::MetaXML::ApotomeCamEpsilonId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamHSBufferNumber] = Zeiss::MetaXML::AxioCamHSBufferNumberId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamHSFrameTime] = Zeiss::MetaXML::AxioCamHSFrameTimeId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamAnalogGainEnable] = Zeiss::MetaXML::AxioCamAnalogGainEnableId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamAnalogGainAvailable] = Zeiss::MetaXML::AxioCamAnalogGainAvailableId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamPhaseAngles] = Zeiss::MetaXML::ApotomeCamPhaseAnglesId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamImageFormat] = Zeiss::MetaXML::ApotomeCamImageFormatId;
-  _nameIdMap[Zeiss::MetaXML::CameraShadingCount] = Zeiss::MetaXML::CameraShadingCountId;
-  _nameIdMap[Zeiss::MetaXML::CameraImageRawSize] = Zeiss::MetaXML::CameraImageRawSizeId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamBurstMode] = Zeiss::MetaXML::ApotomeCamBurstModeId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamGenericCameraName] = Zeiss::MetaXML::ApotomeCamGenericCameraNameId;
-  _nameIdMap[Zeiss::MetaXML::AcquisitionDevice] = Zeiss::MetaXML::AcquisitionDeviceId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeGratingPeriodMeasured] = Zeiss::MetaXML::ApotomeGratingPeriodMeasuredId;
-  _nameIdMap[Zeiss::MetaXML::CameraLutEnable] = Zeiss::MetaXML::CameraLutEnableId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamSaturation] = Zeiss::MetaXML::AxioCamSaturationId;
-  _nameIdMap[Zeiss::MetaXML::CameraColorCorrection] = Zeiss::MetaXML::CameraColorCorrectionId;
-  _nameIdMap[Zeiss::MetaXML::CameraColorProcessingEnable] = Zeiss::MetaXML::CameraColorProcessingEnableId;
-  _nameIdMap[Zeiss::MetaXML::CameraAnalogGain] = Zeiss::MetaXML::CameraAnalogGainId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceTargetPosX] = Zeiss::MetaXML::CameraWhiteBalanceTargetPosXId;
-  _nameIdMap[Zeiss::MetaXML::CameraWhiteBalanceTargetPosY] = Zeiss::MetaXML::CameraWhiteBalanceTargetPosYId;
-  _nameIdMap[Zeiss::MetaXML::CameraShutterSignalPort] = Zeiss::MetaXML::CameraShutterSignalPortId;
-  _nameIdMap[Zeiss::MetaXML::AxioCamICSaturation] = Zeiss::MetaXML::AxioCamICSaturationId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamCamCalibMode] = Zeiss::MetaXML::ApotomeCamCamCalibModeId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamCamCalibValue] = Zeiss::MetaXML::ApotomeCamCamCalibValueId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamAdminCalibMode] = Zeiss::MetaXML::ApotomeCamAdminCalibModeId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamIsAdmin] = Zeiss::MetaXML::ApotomeCamIsAdminId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamPw] = Zeiss::MetaXML::ApotomeCamPwId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamAdminName] = Zeiss::MetaXML::ApotomeCamAdminNameId;
-  _nameIdMap[Zeiss::MetaXML::CameraShutterLiveEnable] = Zeiss::MetaXML::CameraShutterLiveEnableId;
-  _nameIdMap[Zeiss::MetaXML::CameraExposureTimeAutoLiveEnable] = Zeiss::MetaXML::CameraExposureTimeAutoLiveEnableId;
-  _nameIdMap[Zeiss::MetaXML::CameraEMGain] = Zeiss::MetaXML::CameraEMGainId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamHardwareVersion] = Zeiss::MetaXML::ApotomeCamHardwareVersionId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamGridPosition] = Zeiss::MetaXML::ApotomeCamGridPositionId;
-  _nameIdMap[Zeiss::MetaXML::ApotomeCamAutoGrid] = Zeiss::MetaXML::ApotomeCamAutoGridId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamNumberOfScanMode] = Zeiss::MetaXML::OrcaCamNumberOfScanModeId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamScanMode] = Zeiss::MetaXML::OrcaCamScanModeId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamEMCCDMode] = Zeiss::MetaXML::OrcaCamEMCCDModeId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamEMCCDGain] = Zeiss::MetaXML::OrcaCamEMCCDGainId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamFastAcq] = Zeiss::MetaXML::OrcaCamFastAcqId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamMinExposureTime] = Zeiss::MetaXML::OrcaCamMinExposureTimeId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamNumberOfPhotonImagingMode] = Zeiss::MetaXML::OrcaCamNumberOfPhotonImagingModeId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamPhotonImagingMode] = Zeiss::MetaXML::OrcaCamPhotonImagingModeId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamDirectEMGainAvailable] = Zeiss::MetaXML::OrcaCamDirectEMGainAvailableId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamDirectEMGain] = Zeiss::MetaXML::OrcaCamDirectEMGainId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamEMGainProtectionAvailable] = Zeiss::MetaXML::OrcaCamEMGainProtectionAvailableId;
-  _nameIdMap[Zeiss::MetaXML::OrcaCamEMGainProtection] = Zeiss::MetaXML::OrcaCamEMGainProtectionId;
-  _nameIdMap[Zeiss::MetaXML::CameraEMGainMinimum] = Zeiss::MetaXML::CameraEMGainMinimumId;
-  _nameIdMap[Zeiss::MetaXML::CameraEMGainMaximum] = Zeiss::MetaXML::CameraEMGainMaximumId;
-  _nameIdMap[Zeiss::MetaXML::CameraEMGainAvailable] = Zeiss::MetaXML::CameraEMGainAvailableId;
-  _nameIdMap[Zeiss::MetaXML::CameraEMGainEnabled] = Zeiss::MetaXML::CameraEMGainEnabledId;
-  _nameIdMap[Zeiss::MetaXML::YokogawaSynchronize] = Zeiss::MetaXML::YokogawaSynchronizeId;
-  _nameIdMap[Zeiss::MetaXML::YokogawaIsInSync] = Zeiss::MetaXML::YokogawaIsInSyncId;
-  _nameIdMap[Zeiss::MetaXML::YokogawaStatus] = Zeiss::MetaXML::YokogawaStatusId;
-  _nameIdMap[Zeiss::MetaXML::YokogawaKeepInSync] = Zeiss::MetaXML::YokogawaKeepInSyncId;
-  _nameIdMap[Zeiss::MetaXML::YokogawaIsBusy] = Zeiss::MetaXML::YokogawaIsBusyId;
-  _nameIdMap[Zeiss::MetaXML::YokogawaStopDisc] = Zeiss::MetaXML::YokogawaStopDiscId;
-  _nameIdMap[Zeiss::MetaXML::YokogawaCamExposureTime] = Zeiss::MetaXML::YokogawaCamExposureTimeId;
-  _nameIdMap[Zeiss::MetaXML::YokogawaMode] = Zeiss::MetaXML::YokogawaModeId;
-  _nameIdMap[Zeiss::MetaXML::YokogawaDepth] = Zeiss::MetaXML::YokogawaDepthId;
-  _nameIdMap[Zeiss::MetaXML::YokogawaCamReserved12] = Zeiss::MetaXML::YokogawaCamReserved12Id;
-  _nameIdMap[Zeiss::MetaXML::YokogawaCamReserved13] = Zeiss::MetaXML::YokogawaCamReserved13Id;
-  _nameIdMap[Zeiss::MetaXML::YokogawaCamReserved14] = Zeiss::MetaXML::YokogawaCamReserved14Id;
-  _nameIdMap[Zeiss::MetaXML::YokogawaCamReserved15] = Zeiss::MetaXML::YokogawaCamReserved15Id;
-  _nameIdMap[Zeiss::MetaXML::YokogawaCamReserved16] = Zeiss::MetaXML::YokogawaCamReserved16Id;
-  _nameIdMap[Zeiss::MetaXML::YokogawaCamReserved17] = Zeiss::MetaXML::YokogawaCamReserved17Id;
-  _nameIdMap[Zeiss::MetaXML::YokogawaCamReserved18] = Zeiss::MetaXML::YokogawaCamReserved18Id;
-  _nameIdMap[Zeiss::MetaXML::YokogawaCamReserved19] = Zeiss::MetaXML::YokogawaCamReserved19Id;
-  _nameIdMap[Zeiss::MetaXML::YokogawaCamReserved20] = Zeiss::MetaXML::YokogawaCamReserved20Id;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamStatus] = Zeiss::MetaXML::AuroxCamStatusId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamInputMode] = Zeiss::MetaXML::AuroxCamInputModeId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamLiveMode] = Zeiss::MetaXML::AuroxCamLiveModeId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCalibrationMode] = Zeiss::MetaXML::AuroxCamCalibrationModeId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamGenericCameraName] = Zeiss::MetaXML::AuroxCamGenericCameraNameId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamButtonMode] = Zeiss::MetaXML::AuroxCamButtonModeId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamDepth] = Zeiss::MetaXML::AuroxCamDepthId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCenter] = Zeiss::MetaXML::AuroxCamCenterId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamFactor] = Zeiss::MetaXML::AuroxCamFactorId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCreateRegistration] = Zeiss::MetaXML::AuroxCamCreateRegistrationId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamRegistrationValid] = Zeiss::MetaXML::AuroxCamRegistrationValidId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamRegistrationError] = Zeiss::MetaXML::AuroxCamRegistrationErrorId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamShadingImageMode] = Zeiss::MetaXML::AuroxCamShadingImageModeId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamShadingImageAvailable] = Zeiss::MetaXML::AuroxCamShadingImageAvailableId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamQuality] = Zeiss::MetaXML::AuroxCamQualityId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCutLeft] = Zeiss::MetaXML::AuroxCamCutLeftId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCutTop] = Zeiss::MetaXML::AuroxCamCutTopId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCutRight] = Zeiss::MetaXML::AuroxCamCutRightId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCutBottom] = Zeiss::MetaXML::AuroxCamCutBottomId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamMean] = Zeiss::MetaXML::AuroxCamMeanId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamNormalize] = Zeiss::MetaXML::AuroxCamNormalizeId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamUseShading] = Zeiss::MetaXML::AuroxCamUseShadingId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamShadingValid] = Zeiss::MetaXML::AuroxCamShadingValidId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamNotification] = Zeiss::MetaXML::AuroxCamNotificationId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCalibrationID] = Zeiss::MetaXML::AuroxCamCalibrationIDId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamSimpleCalibMode] = Zeiss::MetaXML::AuroxCamSimpleCalibModeId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCalibrationName] = Zeiss::MetaXML::AuroxCamCalibrationNameId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamRes6] = Zeiss::MetaXML::AuroxCamRes6Id;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCFactor] = Zeiss::MetaXML::AuroxCamCFactorId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamRegistrationCenter] = Zeiss::MetaXML::AuroxCamRegistrationCenterId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamCalibrationID2] = Zeiss::MetaXML::AuroxCamCalibrationID2Id;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamAveraging] = Zeiss::MetaXML::AuroxCamAveragingId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamUniqueID] = Zeiss::MetaXML::AuroxCamUniqueIDId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamAutoNormalize] = Zeiss::MetaXML::AuroxCamAutoNormalizeId;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamReserved3] = Zeiss::MetaXML::AuroxCamReserved3Id;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamReserved4] = Zeiss::MetaXML::AuroxCamReserved4Id;
-  _nameIdMap[Zeiss::MetaXML::AuroxCamReserved5] = Zeiss::MetaXML::AuroxCamReserved5Id;
-
-  _nameIdMap[Zeiss::MetaXML::Factor_0] = Zeiss::MetaXML::Factor_0Id;
-  _nameIdMap[Zeiss::MetaXML::Type_0] = Zeiss::MetaXML::Type_0Id;
-  _nameIdMap[Zeiss::MetaXML::Unit_0] = Zeiss::MetaXML::Unit_0Id;
-  _nameIdMap[Zeiss::MetaXML::Origin_0] = Zeiss::MetaXML::Origin_0Id;
-  _nameIdMap[Zeiss::MetaXML::Angle_0] = Zeiss::MetaXML::Angle_0Id;
-  _nameIdMap[Zeiss::MetaXML::Factor_1] = Zeiss::MetaXML::Factor_1Id;
-  _nameIdMap[Zeiss::MetaXML::Type_1] = Zeiss::MetaXML::Type_1Id;
-  _nameIdMap[Zeiss::MetaXML::Unit_1] = Zeiss::MetaXML::Unit_1Id;
-  _nameIdMap[Zeiss::MetaXML::Origin_1] = Zeiss::MetaXML::Origin_1Id;
-  _nameIdMap[Zeiss::MetaXML::Angle_1] = Zeiss::MetaXML::Angle_1Id;
-  _nameIdMap[Zeiss::MetaXML::Factor_2] = Zeiss::MetaXML::Factor_2Id;
-  _nameIdMap[Zeiss::MetaXML::Type_2] = Zeiss::MetaXML::Type_2Id;
-  _nameIdMap[Zeiss::MetaXML::Unit_2] = Zeiss::MetaXML::Unit_2Id;
-  _nameIdMap[Zeiss::MetaXML::Origin_2] = Zeiss::MetaXML::Origin_2Id;
-  _nameIdMap[Zeiss::MetaXML::Angle_2] = Zeiss::MetaXML::Angle_2Id;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissTagMapping::initFactoryMap()
-{
-  _idFactoryMap[Zeiss::MetaXML::CompressionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DateMappingTableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::BlackValueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::WhitevalueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageDataMappingAutoRangeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageThumbnailId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::GammaValueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageOverExposureId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageRelativeTime1Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageRelativeTime2Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageRelativeTime3Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageRelativeTime4Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageRelativeTimeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageBaseTimeFirstId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageBaseTime1Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageBaseTime2Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageBaseTime3Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageBaseTime4Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageWidthPixelId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageHeightPixelId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageCountRawId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::PixelTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::NumberRawImagesId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageSizeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CompressionFactorForSaveId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DocumentSaveFlagsId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AcquisitionpauseannotationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DocumentSubtypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AcquisitionBitDepthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Z_StacksinglerepresentativeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ScaleFactorForXId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ScaleUnitforXId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ScaleWidthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ScaleFactorForYId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ScaleUnitforYId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ScaleHeightId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ScaleFactorForZId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ScaleUnitforZId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ScaleDepthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ScalingParentId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DateId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CodeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::SourceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MessageId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraImageAcquisitionTimeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Eight_bitAcquisitionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraBitDepthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MonoReferenceLowId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MonoReferenceHighId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::RedReferenceLowId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::RedReferenceHighId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::GreenReferenceLowId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::GreenReferenceHighId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::BlueReferenceLowId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::BlueReferenceHighId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FramegrabberNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraTriggerSignalTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraTriggerEnableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::GrabberTimeoutId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MultiChannelEnabledId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MultichannelColourId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MultichannelWeightId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ChannelNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DocumentInformationGroupId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TitleId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuthorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::KeywordsId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CommentsId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::SampleIDId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::SubjectId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::RevisionNumberId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::SaveFolderId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FileLinkId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DocumentTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StorageMediaId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FileIDId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReferenceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FileDateId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FileSizeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FilenameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FileAttributesId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ProjectGroupId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AcquisitionDateId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LastmodifiedbyId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserCompanyId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserCompanyLogoId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserIDId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserCityId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserAddressId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserCountryId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserPhoneId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserFaxId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ObjectiveNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OptovarId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CondenserContrastId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightFilter1Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightFilter2Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightShutterId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CondenserFrontLensId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExcitationFilerNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightFieldstopApertureId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightApertureId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CondenserN_A_Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LightPathId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::HalogenLampOnId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::HalogenLampModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::HalogenLampVoltageId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FluorescenceLampLevelId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FluorescenceLampIntensityId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LightManagerisEnabledId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StagePositionXId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StagePositionYId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MicroscopeNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ObjectiveMagnificationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ObjectiveN_A_Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MicroscopeIlluminationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalShutter1Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalShutter2Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalShutter3Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalFilterWheel1NameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalFilterWheel2NameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ParfocalCorrectionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalShutter4Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalShutter5Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalShutter6Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalFilterWheel3NameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalFilterWheel4NameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ObjectiveTurretPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ObjectiveContrastMethodId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ObjectiveImmersionTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectorPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightFilter1PositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightFilter2PositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExcitationFilterPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LampMirrorPositionERSETZTDURCH241Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalFilterWheel1PositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalFilterWheel2PositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalFilterWheel3PositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalFilterWheel4PositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LightmanagerModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::HalogenLampCalibrationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CondenserNAGoSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightFieldstopGoSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OptovarGoSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocuscalibratedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusBasicPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusPowerId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusBacklashId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusMeasurementOriginId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusMeasurementDistanceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusGoSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusDistanceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusInitPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StagecalibratedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StagePowerId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageXBacklashId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageYBacklashId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageSpeedXId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageSpeedYId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageGoSpeedXId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageGoSpeedYId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageStepDistanceXId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageStepDistanceYId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageInitialisationPositionXId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageInitialisationPositionYId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MicroscopeMagnificationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectorMagnificationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LampMirrorPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusDepthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MicroscopeTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ObjectiveWorkingDistanceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightApertureGoSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExternalShutterId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ObjectiveImmersionStopId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusStartSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FocusAccelerationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightFieldstopId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightFieldstopGoSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightFilter1Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightFilter2Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightFilter1PositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightFilter2PositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightAttenuatorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightAttenuatorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightShutterId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightAttenuatorGoSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightAttenuatorGoSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightVirtualFilterPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightVirtualFilterId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightVirtualFilterPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightVirtualFilterId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightHalogenLampModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightHalogenLampVoltageId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedLightHalogenLampColourTemperatureId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ContrastmanagerModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DazzleProtectionActiveId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ZoomId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ZoomGoSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LightZoomId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LightZoomGoSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LightzoomCoupledId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightHalogenLampModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightHalogenLampVoltageId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedLightHalogenLampColourTemperatureId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedColdlightModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedColdlightIntensityId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ReflectedColdlightColourTemperatureId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedColdlightModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedColdlightIntensityId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TransmittedColdlightColourTemperatureId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::InfinityspacePortchangerPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::BeamsplitterInfinitySpaceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TwoTvVisCamChangerPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::BeamsplitterOcularId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TwoTvCamerasChangerPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::BeamsplitterCamerasId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OcularShutterId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::TwoTvCamerasChangerCubeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LightWaveLengthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OcularMagnificationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraAdapterMagnificationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MicroscopePortId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OcularTotalMagnificationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FieldofViewId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OcularId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraAdapterId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::StageJoystickEnabledId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ContrastmanagerContrastMethodId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CamerasChangerBeamSplitterTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::RearportSliderPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::RearportSourceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::BeamsplitterTypeInfinitySpaceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FluorescenceAttenuatorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::FluorescenceAttenuatorPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraFramestartLeftId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraFramestartTopId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraFrameWidthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraFrameHeightId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraBinningId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraFrameFullId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraFramePixelDistanceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DataFormatUseScalingId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraFrameImageOrientationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::VideoMonochromeSignalTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::VideoColorSignalTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorChannelInputId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorChannelSyncId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::WhiteBalanceEnabledId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceRedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceGreenId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceBlueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraFrameScalingFactorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorCameraTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ExposureTime_ms_Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraExposureTimeAutoCalculateId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorGainValueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorGainAutomaticId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorAdjustHueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorAdjustSaturationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorAdjustRedLowId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorAdjustGreenLowId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorBlueLowId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorAdjustRedHighId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorAdjustGreenHighId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorBlueHighId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraExposureTimeCalculationControlId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamFadingCorrectionEnableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveImageId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveEnabledId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LiveImageSyncObjectNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraImageId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraImageWidthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraImageHeightId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraImagePixelTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraImageShMemoryNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveImageWidthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveImageHeightId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveImagePixelTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveImageShMemoryNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveMaximumSpeedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveBinningId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveGainValueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveExposureTimeValueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLiveScalingFactorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageIndexUId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageIndexVId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageIndexZId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageIndexCId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageIndexTId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageTileIndexId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageacquisitionIndexId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageCountTilesId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageCountAId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageIndexSId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageIndexRawId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageCountZId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageCountCId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageCountTId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageCountUId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageCountVId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ImageCountSId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OriginalStagePositionXId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OriginalStagePositionYId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::LayerDrawFlagsId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::RemainingTimeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserField1Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserField2Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserField3Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserField4Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserField5Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserField6Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserField7Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserField8Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserField9Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::UserField10Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::IDId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::NameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ValueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::PvCamClockingModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AutofocusStatusReportId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AutofocusPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AutofocusPositionOffsetId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AutofocusEmptyFieldThresholdId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AutofocusCalibrationNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AutofocusCurrentCalibrationItemId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraFrameFullWidthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraFrameFullHeightId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamShutterSignalId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamDelayTimeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamShutterControlId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamBlackRefIsCalculatedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamBlackReferenceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraShadingCorrectionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamEnhanceColorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamNIRModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraShutterCloseDelayId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceAutoCalculateId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamNIRModeAvailableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamFadingCorrectionAvailableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamEnhanceColorAvailableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorVideoNormId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorAdjustWhiteReferenceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorBlackReferenceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorChannelInputCountMonoId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorChannelInputCountRGBId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorEnableVCRId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorBrightnessId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::MeteorContrastId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamSelectorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamInfoId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamResolutionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamColourModelId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamMicroScanningId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AmplificationIndexId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeviceCommandId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::BeamLocationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ComponentTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ControllerTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceCalculationRedPaintId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceCalculationBluePaintId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceSetRedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceSetGreenId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceSetBlueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceSetTargetRedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceSetTargetGreenId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceSetTargetBlueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamCalibrationModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApoTomeGridPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamScannerPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApoTomeFullPhaseShiftId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApoTomeGridNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApoTomeStainingId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApoTomeProcessingModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamLiveCombineModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApoTomeFilterNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeFilterStrengthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamFilterHarmonicsId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApoTomeGratingPeriodId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApoTomeAutoShutterUsedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamStatusId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamNormalizeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamSettingsManagerId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeepviewCamSupervisorModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeepViewProcessingId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeepviewCamFilterNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeepviewCamStatusId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeepviewCamSettingsManagerId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeviceScalingNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraShadingIsCalculatedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraShadingCalculationNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraShadingAutoCalculateId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraTriggerAvailableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraShutterAvailableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamShutterMicroScanningEnableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamLiveFocusId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeviceInitStatusId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeviceErrorStatusId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamSliderInGridPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaNIRModeUsedId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaAnalogGainId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaAnalogOffsetId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaBinningId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaBitDepthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApoTomeAveragingCountId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeepViewDoFId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeepViewEDoFId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DeepViewSliderNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::RoperCamGainId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::RoperCamPixelClockId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::RoperCamTemperatureId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraImageMemUnitNamesId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamLivePhaseId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::DualAxioCamAlgorithmTypeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamDecayId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamEpsilonId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamHSBufferNumberId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamHSFrameTimeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamAnalogGainEnableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamAnalogGainAvailableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamPhaseAnglesId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamImageFormatId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraShadingCountId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraImageRawSizeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamBurstModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamGenericCameraNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AcquisitionDeviceId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeGratingPeriodMeasuredId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraLutEnableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamSaturationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraColorCorrectionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraColorProcessingEnableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraAnalogGainId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceTargetPosXId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraWhiteBalanceTargetPosYId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraShutterSignalPortId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AxioCamICSaturationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamCamCalibModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamCamCalibValueId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamAdminCalibModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamIsAdminId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamPwId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamAdminNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraShutterLiveEnableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraExposureTimeAutoLiveEnableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraEMGainId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamHardwareVersionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamGridPositionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::ApotomeCamAutoGridId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamNumberOfScanModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamScanModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamEMCCDModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamEMCCDGainId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamFastAcqId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamMinExposureTimeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamNumberOfPhotonImagingModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamPhotonImagingModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamDirectEMGainAvailableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamDirectEMGainId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamEMGainProtectionAvailableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::OrcaCamEMGainProtectionId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraEMGainMinimumId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraEMGainMaximumId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraEMGainAvailableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::CameraEMGainEnabledId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaSynchronizeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaIsInSyncId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaStatusId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaKeepInSyncId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaIsBusyId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaStopDiscId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaCamExposureTimeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaDepthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaCamReserved12Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaCamReserved13Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaCamReserved14Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaCamReserved15Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaCamReserved16Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaCamReserved17Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaCamReserved18Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaCamReserved19Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::YokogawaCamReserved20Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamStatusId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamInputModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamLiveModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCalibrationModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamGenericCameraNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamButtonModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamDepthId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCenterId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamFactorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCreateRegistrationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamRegistrationValidId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamRegistrationErrorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamShadingImageModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamShadingImageAvailableId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamQualityId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCutLeftId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCutTopId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCutRightId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCutBottomId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamMeanId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamNormalizeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamUseShadingId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamShadingValidId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamNotificationId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCalibrationIDId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamSimpleCalibModeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCalibrationNameId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamRes6Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCFactorId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamRegistrationCenterId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamCalibrationID2Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamAveragingId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamUniqueIDId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamAutoNormalizeId] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamReserved3Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamReserved4Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::AuroxCamReserved5Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-
-  _idFactoryMap[Zeiss::MetaXML::Factor_0Id] = FloatZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Type_0Id] = Int32ZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Unit_0Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Origin_0Id] = FloatZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Angle_0Id] = FloatZeissMetaFactory::NewZeissMetaFactory();
-
-  _idFactoryMap[Zeiss::MetaXML::Factor_1Id] = FloatZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Type_1Id] = Int32ZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Unit_1Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Origin_1Id] = FloatZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Angle_1Id] = FloatZeissMetaFactory::NewZeissMetaFactory();
-
-  _idFactoryMap[Zeiss::MetaXML::Factor_2Id] = FloatZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Type_2Id] = Int32ZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Unit_2Id] = StringZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Origin_2Id] = FloatZeissMetaFactory::NewZeissMetaFactory();
-  _idFactoryMap[Zeiss::MetaXML::Angle_2Id] = FloatZeissMetaFactory::NewZeissMetaFactory();
-}
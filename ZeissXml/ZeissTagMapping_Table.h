@@ -0,0 +1,814 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+/** THIS FILE WAS AUTO-GENERATED FROM THE ZVI_TAGS.TXT FILE BY Utilities/GenerateZeissTagTable.py.
+ * DO NOT EDIT BY HAND, RERUN THE SCRIPT INSTEAD.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace ZeissTagTable
+{
+
+enum class ValueType : uint8_t
+{
+  String,
+  Int32,
+  Int64,
+  Float
+};
+
+struct TagEntry
+{
+  int32_t Id;
+  std::string_view Name;
+  ValueType Type;
+};
+
+/**
+ * @brief FNV-1a hash of a tag name. GenerateZeissTagTable.py uses the same function to build the tables.
+ */
+constexpr uint32_t HashName(std::string_view name, uint32_t seed)
+{
+  uint32_t hash = 2166136261u ^ seed;
+  for(char c : name)
+  {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * @brief Murmur3 finalizer of a tag id. GenerateZeissTagTable.py uses the same function to build the tables.
+ */
+constexpr uint32_t HashId(int32_t id, uint32_t seed)
+{
+  uint32_t hash = static_cast<uint32_t>(id) ^ (seed * 0x9E3779B9u);
+  hash ^= hash >> 16;
+  hash *= 0x85EBCA6Bu;
+  hash ^= hash >> 13;
+  hash *= 0xC2B2AE35u;
+  hash ^= hash >> 16;
+  return hash;
+}
+
+constexpr size_t k_TagCount = 543;
+constexpr size_t k_IdCount = 541;
+constexpr size_t k_MaxNameLength = 44;
+
+// Sorted by id
+constexpr std::array<TagEntry, k_TagCount> k_Tags = {{
+    {222, "Compression", ValueType::String},
+    {257, "DateMappingTable", ValueType::String},
+    {258, "BlackValue", ValueType::Float},
+    {259, "Whitevalue", ValueType::Float},
+    {260, "ImageDataMappingAutoRange", ValueType::String},
+    {261, "ImageThumbnail", ValueType::String},
+    {262, "GammaValue", ValueType::Float},
+    {264, "ImageOverExposure", ValueType::Int32},
+    {265, "ImageRelativeTime1", ValueType::String},
+    {266, "ImageRelativeTime2", ValueType::String},
+    {267, "ImageRelativeTime3", ValueType::String},
+    {268, "ImageRelativeTime4", ValueType::String},
+    {300, "ImageRelativeTime", ValueType::String},
+    {301, "ImageBaseTimeFirst", ValueType::String},
+    {301, "ImageBaseTime1", ValueType::String},
+    {302, "ImageBaseTime2", ValueType::String},
+    {303, "ImageBaseTime3", ValueType::String},
+    {304, "ImageBaseTime4", ValueType::String},
+    {515, "ImageWidthPixel", ValueType::Int32},
+    {516, "ImageHeightPixel", ValueType::Int32},
+    {517, "ImageCountRaw", ValueType::Int32},
+    {518, "PixelType", ValueType::Int32},
+    {519, "NumberRawImages", ValueType::Int32},
+    {520, "ImageSize", ValueType::Int32},
+    {521, "CompressionFactorForSave", ValueType::Int32},
+    {522, "DocumentSaveFlags", ValueType::Int32},
+    {523, "Acquisitionpauseannotation", ValueType::String},
+    {530, "DocumentSubtype", ValueType::String},
+    {531, "AcquisitionBitDepth", ValueType::Int32},
+    {534, "Z_Stacksinglerepresentative", ValueType::Int32},
+    {769, "ScaleFactorForX", ValueType::Float},
+    {770, "ScaleUnitforX", ValueType::Int32},
+    {771, "ScaleWidth", ValueType::Float},
+    {772, "ScaleFactorForY", ValueType::Float},
+    {773, "ScaleUnitforY", ValueType::Int32},
+    {774, "ScaleHeight", ValueType::Float},
+    {775, "ScaleFactorForZ", ValueType::Float},
+    {776, "ScaleUnitforZ", ValueType::Int32},
+    {777, "ScaleDepth", ValueType::Float},
+    {778, "ScalingParent", ValueType::String},
+    {1001, "Date", ValueType::String},
+    {1002, "Code", ValueType::String},
+    {1003, "Source", ValueType::String},
+    {1004, "Message", ValueType::String},
+    {1025, "CameraImageAcquisitionTime", ValueType::String},
+    {1026, "Eight_bitAcquisition", ValueType::Int32},
+    {1027, "CameraBitDepth", ValueType::Int32},
+    {1029, "MonoReferenceLow", ValueType::Float},
+    {1030, "MonoReferenceHigh", ValueType::Float},
+    {1031, "RedReferenceLow", ValueType::Float},
+    {1032, "RedReferenceHigh", ValueType::Float},
+    {1033, "GreenReferenceLow", ValueType::Float},
+    {1034, "GreenReferenceHigh", ValueType::Float},
+    {1035, "BlueReferenceLow", ValueType::Float},
+    {1036, "BlueReferenceHigh", ValueType::Float},
+    {1041, "FramegrabberName", ValueType::String},
+    {1042, "Camera", ValueType::String},
+    {1044, "CameraTriggerSignalType", ValueType::Int32},
+    {1045, "CameraTriggerEnable", ValueType::Int32},
+    {1046, "GrabberTimeout", ValueType::Int32},
+    {1281, "MultiChannelEnabled", ValueType::Int32},
+    {1282, "MultichannelColour", ValueType::Int32},
+    {1283, "MultichannelWeight", ValueType::Float},
+    {1284, "ChannelName", ValueType::String},
+    {1536, "DocumentInformationGroup", ValueType::String},
+    {1537, "Title", ValueType::String},
+    {1538, "Author", ValueType::String},
+    {1539, "Keywords", ValueType::String},
+    {1540, "Comments", ValueType::String},
+    {1541, "SampleID", ValueType::String},
+    {1542, "Subject", ValueType::String},
+    {1543, "RevisionNumber", ValueType::String},
+    {1544, "SaveFolder", ValueType::String},
+    {1545, "FileLink", ValueType::String},
+    {1546, "DocumentType", ValueType::String},
+    {1547, "StorageMedia", ValueType::String},
+    {1548, "FileID", ValueType::String},
+    {1549, "Reference", ValueType::String},
+    {1550, "FileDate", ValueType::String},
+    {1551, "FileSize", ValueType::Int64},
+    {1553, "Filename", ValueType::String},
+    {1554, "FileAttributes", ValueType::Int32},
+    {1792, "ProjectGroup", ValueType::String},
+    {1793, "AcquisitionDate", ValueType::String},
+    {1794, "Lastmodifiedby", ValueType::String},
+    {1795, "UserCompany", ValueType::String},
+    {1796, "UserCompanyLogo", ValueType::String},
+    {1797, "Image", ValueType::String},
+    {1800, "UserID", ValueType::String},
+    {1801, "UserName", ValueType::String},
+    {1802, "UserCity", ValueType::String},
+    {1803, "UserAddress", ValueType::String},
+    {1804, "UserCountry", ValueType::String},
+    {1805, "UserPhone", ValueType::String},
+    {1806, "UserFax", ValueType::String},
+    {2049, "ObjectiveName", ValueType::String},
+    {2050, "Optovar", ValueType::Float},
+    {2051, "Reflector", ValueType::String},
+    {2052, "CondenserContrast", ValueType::String},
+    {2053, "TransmittedLightFilter1", ValueType::String},
+    {2054, "TransmittedLightFilter2", ValueType::String},
+    {2055, "ReflectedLightShutter", ValueType::Int32},
+    {2056, "CondenserFrontLens", ValueType::Int32},
+    {2057, "ExcitationFilerName", ValueType::String},
+    {2060, "TransmittedLightFieldstopAperture", ValueType::Float},
+    {2061, "ReflectedLightAperture", ValueType::Float},
+    {2062, "CondenserN_A_", ValueType::Float},
+    {2063, "LightPath", ValueType::Int32},
+    {2064, "HalogenLampOn", ValueType::Int32},
+    {2065, "HalogenLampMode", ValueType::Int32},
+    {2066, "HalogenLampVoltage", ValueType::Float},
+    {2068, "FluorescenceLampLevel", ValueType::Float},
+    {2069, "FluorescenceLampIntensity", ValueType::Float},
+    {2070, "LightManagerisEnabled", ValueType::Int32},
+    {2072, "FocusPosition", ValueType::Float},
+    {2073, "StagePositionX", ValueType::Float},
+    {2074, "StagePositionY", ValueType::Float},
+    {2075, "MicroscopeName", ValueType::String},
+    {2076, "ObjectiveMagnification", ValueType::Float},
+    {2077, "ObjectiveN_A_", ValueType::Float},
+    {2078, "MicroscopeIllumination", ValueType::Int32},
+    {2079, "ExternalShutter1", ValueType::Int32},
+    {2080, "ExternalShutter2", ValueType::Int32},
+    {2081, "ExternalShutter3", ValueType::Int32},
+    {2082, "ExternalFilterWheel1Name", ValueType::String},
+    {2083, "ExternalFilterWheel2Name", ValueType::String},
+    {2084, "ParfocalCorrection", ValueType::Int32},
+    {2086, "ExternalShutter4", ValueType::Int32},
+    {2087, "ExternalShutter5", ValueType::Int32},
+    {2088, "ExternalShutter6", ValueType::Int32},
+    {2089, "ExternalFilterWheel3Name", ValueType::String},
+    {2090, "ExternalFilterWheel4Name", ValueType::String},
+    {2103, "ObjectiveTurretPosition", ValueType::Int32},
+    {2104, "ObjectiveContrastMethod", ValueType::Int32},
+    {2105, "ObjectiveImmersionType", ValueType::Int32},
+    {2107, "ReflectorPosition", ValueType::Int32},
+    {2109, "TransmittedLightFilter1Position", ValueType::Int32},
+    {2110, "TransmittedLightFilter2Position", ValueType::Int32},
+    {2112, "ExcitationFilterPosition", ValueType::Int32},
+    {2113, "LampMirrorPositionERSETZTDURCH241", ValueType::Int32},
+    {2114, "ExternalFilterWheel1Position", ValueType::Int32},
+    {2115, "ExternalFilterWheel2Position", ValueType::Int32},
+    {2116, "ExternalFilterWheel3Position", ValueType::Int32},
+    {2117, "ExternalFilterWheel4Position", ValueType::Int32},
+    {2118, "LightmanagerMode", ValueType::Int32},
+    {2119, "HalogenLampCalibration", ValueType::Int32},
+    {2120, "CondenserNAGoSpeed", ValueType::Float},
+    {2121, "TransmittedLightFieldstopGoSpeed", ValueType::Float},
+    {2122, "OptovarGoSpeed", ValueType::Float},
+    {2123, "Focuscalibrated", ValueType::Int32},
+    {2124, "FocusBasicPosition", ValueType::Float},
+    {2125, "FocusPower", ValueType::Int32},
+    {2126, "FocusBacklash", ValueType::Float},
+    {2127, "FocusMeasurementOrigin", ValueType::Float},
+    {2128, "FocusMeasurementDistance", ValueType::Float},
+    {2129, "FocusSpeed", ValueType::Float},
+    {2130, "FocusGoSpeed", ValueType::Float},
+    {2131, "FocusDistance", ValueType::Float},
+    {2132, "FocusInitPosition", ValueType::Float},
+    {2133, "Stagecalibrated", ValueType::Int32},
+    {2134, "StagePower", ValueType::Int32},
+    {2135, "StageXBacklash", ValueType::Float},
+    {2136, "StageYBacklash", ValueType::Float},
+    {2137, "StageSpeedX", ValueType::Float},
+    {2138, "StageSpeedY", ValueType::Float},
+    {2139, "StageSpeed", ValueType::Float},
+    {2140, "StageGoSpeedX", ValueType::Float},
+    {2141, "StageGoSpeedY", ValueType::Float},
+    {2142, "StageStepDistanceX", ValueType::Float},
+    {2143, "StageStepDistanceY", ValueType::Float},
+    {2144, "StageInitialisationPositionX", ValueType::Float},
+    {2145, "StageInitialisationPositionY", ValueType::Float},
+    {2146, "MicroscopeMagnification", ValueType::Float},
+    {2147, "ReflectorMagnification", ValueType::Float},
+    {2148, "LampMirrorPosition", ValueType::Int32},
+    {2149, "FocusDepth", ValueType::Float},
+    {2150, "MicroscopeType", ValueType::Int32},
+    {2151, "ObjectiveWorkingDistance", ValueType::Float},
+    {2152, "ReflectedLightApertureGoSpeed", ValueType::Float},
+    {2153, "ExternalShutter", ValueType::Int32},
+    {2154, "ObjectiveImmersionStop", ValueType::Int32},
+    {2155, "FocusStartSpeed", ValueType::Float},
+    {2156, "FocusAcceleration", ValueType::Float},
+    {2157, "ReflectedLightFieldstop", ValueType::Float},
+    {2158, "ReflectedLightFieldstopGoSpeed", ValueType::Float},
+    {2159, "ReflectedLightFilter1", ValueType::String},
+    {2160, "ReflectedLightFilter2", ValueType::String},
+    {2161, "ReflectedLightFilter1Position", ValueType::Int32},
+    {2162, "ReflectedLightFilter2Position", ValueType::Int32},
+    {2163, "TransmittedLightAttenuator", ValueType::Float},
+    {2164, "ReflectedLightAttenuator", ValueType::Float},
+    {2165, "TransmittedLightShutter", ValueType::Int32},
+    {2166, "TransmittedLightAttenuatorGoSpeed", ValueType::Float},
+    {2167, "ReflectedLightAttenuatorGoSpeed", ValueType::Float},
+    {2176, "TransmittedLightVirtualFilterPosition", ValueType::Int32},
+    {2177, "TransmittedLightVirtualFilter", ValueType::String},
+    {2178, "ReflectedLightVirtualFilterPosition", ValueType::Int32},
+    {2179, "ReflectedLightVirtualFilter", ValueType::String},
+    {2180, "ReflectedLightHalogenLampMode", ValueType::Int32},
+    {2181, "ReflectedLightHalogenLampVoltage", ValueType::Float},
+    {2182, "ReflectedLightHalogenLampColourTemperature", ValueType::Float},
+    {2183, "ContrastmanagerMode", ValueType::Int32},
+    {2184, "DazzleProtectionActive", ValueType::Int32},
+    {2195, "Zoom", ValueType::Float},
+    {2196, "ZoomGoSpeed", ValueType::Float},
+    {2197, "LightZoom", ValueType::Float},
+    {2198, "LightZoomGoSpeed", ValueType::Float},
+    {2199, "LightzoomCoupled", ValueType::Int32},
+    {2200, "TransmittedLightHalogenLampMode", ValueType::Int32},
+    {2201, "TransmittedLightHalogenLampVoltage", ValueType::Float},
+    {2202, "TransmittedLightHalogenLampColourTemperature", ValueType::Float},
+    {2203, "ReflectedColdlightMode", ValueType::Int32},
+    {2204, "ReflectedColdlightIntensity", ValueType::Float},
+    {2205, "ReflectedColdlightColourTemperature", ValueType::Float},
+    {2206, "TransmittedColdlightMode", ValueType::Int32},
+    {2207, "TransmittedColdlightIntensity", ValueType::Float},
+    {2208, "TransmittedColdlightColourTemperature", ValueType::Float},
+    {2209, "InfinityspacePortchangerPosition", ValueType::Int32},
+    {2210, "BeamsplitterInfinitySpace", ValueType::String},
+    {2211, "TwoTvVisCamChangerPosition", ValueType::Int32},
+    {2212, "BeamsplitterOcular", ValueType::String},
+    {2213, "TwoTvCamerasChangerPosition", ValueType::Int32},
+    {2214, "BeamsplitterCameras", ValueType::String},
+    {2215, "OcularShutter", ValueType::Int32},
+    {2216, "TwoTvCamerasChangerCube", ValueType::String},
+    {2217, "LightWaveLength", ValueType::Float},
+    {2218, "OcularMagnification", ValueType::Float},
+    {2219, "CameraAdapterMagnification", ValueType::Float},
+    {2220, "MicroscopePort", ValueType::Int32},
+    {2221, "OcularTotalMagnification", ValueType::Float},
+    {2222, "FieldofView", ValueType::Float},
+    {2223, "Ocular", ValueType::String},
+    {2224, "CameraAdapter", ValueType::String},
+    {2225, "StageJoystickEnabled", ValueType::Int32},
+    {2226, "ContrastmanagerContrastMethod", ValueType::Int32},
+    {2229, "CamerasChangerBeamSplitterType", ValueType::Int32},
+    {2235, "RearportSliderPosition", ValueType::Int32},
+    {2236, "RearportSource", ValueType::Int32},
+    {2237, "BeamsplitterTypeInfinitySpace", ValueType::Int32},
+    {2238, "FluorescenceAttenuator", ValueType::String},
+    {2239, "FluorescenceAttenuatorPosition", ValueType::Int32},
+    {2307, "CameraFramestartLeft", ValueType::Int32},
+    {2308, "CameraFramestartTop", ValueType::Int32},
+    {2309, "CameraFrameWidth", ValueType::Int32},
+    {2310, "CameraFrameHeight", ValueType::Int32},
+    {2311, "CameraBinning", ValueType::Int32},
+    {2312, "CameraFrameFull", ValueType::Int32},
+    {2313, "CameraFramePixelDistance", ValueType::Float},
+    {2318, "DataFormatUseScaling", ValueType::Int32},
+    {2319, "CameraFrameImageOrientation", ValueType::Int32},
+    {2320, "VideoMonochromeSignalType", ValueType::Int32},
+    {2321, "VideoColorSignalType", ValueType::Int32},
+    {2322, "MeteorChannelInput", ValueType::Int32},
+    {2323, "MeteorChannelSync", ValueType::Int32},
+    {2324, "WhiteBalanceEnabled", ValueType::Int32},
+    {2325, "CameraWhiteBalanceRed", ValueType::Float},
+    {2326, "CameraWhiteBalanceGreen", ValueType::Float},
+    {2327, "CameraWhiteBalanceBlue", ValueType::Float},
+    {2331, "CameraFrameScalingFactor", ValueType::Float},
+    {2562, "MeteorCameraType", ValueType::Int32},
+    {2564, "ExposureTime_ms_", ValueType::Float},
+    {2568, "CameraExposureTimeAutoCalculate", ValueType::Int32},
+    {2569, "MeteorGainValue", ValueType::Float},
+    {2571, "MeteorGainAutomatic", ValueType::Int32},
+    {2572, "MeteorAdjustHue", ValueType::Float},
+    {2573, "MeteorAdjustSaturation", ValueType::Float},
+    {2574, "MeteorAdjustRedLow", ValueType::Float},
+    {2575, "MeteorAdjustGreenLow", ValueType::Float},
+    {2576, "MeteorBlueLow", ValueType::Float},
+    {2577, "MeteorAdjustRedHigh", ValueType::Float},
+    {2578, "MeteorAdjustGreenHigh", ValueType::Float},
+    {2579, "MeteorBlueHigh", ValueType::Float},
+    {2582, "CameraExposureTimeCalculationControl", ValueType::Int32},
+    {2585, "AxioCamFadingCorrectionEnable", ValueType::Int32},
+    {2587, "CameraLiveImage", ValueType::Int32},
+    {2588, "CameraLiveEnabled", ValueType::Int32},
+    {2589, "LiveImageSyncObjectName", ValueType::String},
+    {2590, "CameraLiveSpeed", ValueType::Int32},
+    {2591, "CameraImage", ValueType::String},
+    {2592, "CameraImageWidth", ValueType::Int32},
+    {2593, "CameraImageHeight", ValueType::Int32},
+    {2594, "CameraImagePixelType", ValueType::Int32},
+    {2595, "CameraImageShMemoryName", ValueType::String},
+    {2596, "CameraLiveImageWidth", ValueType::Int32},
+    {2597, "CameraLiveImageHeight", ValueType::Int32},
+    {2598, "CameraLiveImagePixelType", ValueType::Int32},
+    {2599, "CameraLiveImageShMemoryName", ValueType::String},
+    {2600, "CameraLiveMaximumSpeed", ValueType::Float},
+    {2601, "CameraLiveBinning", ValueType::Int32},
+    {2602, "CameraLiveGainValue", ValueType::Float},
+    {2603, "CameraLiveExposureTimeValue", ValueType::Float},
+    {2604, "CameraLiveScalingFactor", ValueType::Float},
+    {2817, "ImageIndexU", ValueType::Int32},
+    {2818, "ImageIndexV", ValueType::Int32},
+    {2819, "ImageIndexZ", ValueType::Int32},
+    {2820, "ImageIndexC", ValueType::Int32},
+    {2821, "ImageIndexT", ValueType::Int32},
+    {2822, "ImageTileIndex", ValueType::Int32},
+    {2823, "ImageacquisitionIndex", ValueType::Int32},
+    {2824, "ImageCountTiles", ValueType::Int32},
+    {2825, "ImageCountA", ValueType::Int32},
+    {2827, "ImageIndexS", ValueType::Int32},
+    {2828, "ImageIndexRaw", ValueType::Int32},
+    {2832, "ImageCountZ", ValueType::Int32},
+    {2833, "ImageCountC", ValueType::Int32},
+    {2834, "ImageCountT", ValueType::Int32},
+    {2838, "ImageCountU", ValueType::Int32},
+    {2839, "ImageCountV", ValueType::Int32},
+    {2840, "ImageCountS", ValueType::Int32},
+    {2841, "OriginalStagePositionX", ValueType::Float},
+    {2842, "OriginalStagePositionY", ValueType::Float},
+    {3088, "LayerDrawFlags", ValueType::Int32},
+    {3334, "RemainingTime", ValueType::String},
+    {3585, "UserField1", ValueType::String},
+    {3586, "UserField2", ValueType::String},
+    {3587, "UserField3", ValueType::String},
+    {3588, "UserField4", ValueType::String},
+    {3589, "UserField5", ValueType::String},
+    {3590, "UserField6", ValueType::String},
+    {3591, "UserField7", ValueType::String},
+    {3592, "UserField8", ValueType::String},
+    {3593, "UserField9", ValueType::String},
+    {3594, "UserField10", ValueType::String},
+    {3840, "ID", ValueType::String},
+    {3841, "Name", ValueType::String},
+    {3842, "Value", ValueType::String},
+    {5501, "PvCamClockingMode", ValueType::Int32},
+    {8193, "AutofocusStatusReport", ValueType::Int32},
+    {8194, "AutofocusPosition", ValueType::Float},
+    {8195, "AutofocusPositionOffset", ValueType::Float},
+    {8196, "AutofocusEmptyFieldThreshold", ValueType::Float},
+    {8197, "AutofocusCalibrationName", ValueType::String},
+    {8198, "AutofocusCurrentCalibrationItem", ValueType::Int32},
+    {20000, "Factor_0", ValueType::Float},
+    {20001, "Type_0", ValueType::Int32},
+    {20002, "Unit_0", ValueType::String},
+    {20003, "Origin_0", ValueType::Float},
+    {20004, "Angle_0", ValueType::Float},
+    {20005, "Factor_1", ValueType::Float},
+    {20006, "Type_1", ValueType::Int32},
+    {20007, "Unit_1", ValueType::String},
+    {20008, "Origin_1", ValueType::Float},
+    {20009, "Angle_1", ValueType::Float},
+    {20010, "Factor_2", ValueType::Float},
+    {20011, "Type_2", ValueType::Int32},
+    {20012, "Unit_2", ValueType::String},
+    {20013, "Origin_2", ValueType::Float},
+    {20014, "Angle_2", ValueType::Float},
+    {65537, "CameraFrameFullWidth", ValueType::Int32},
+    {65538, "CameraFrameFullHeight", ValueType::Int32},
+    {65541, "AxioCamShutterSignal", ValueType::Int32},
+    {65542, "AxioCamDelayTime", ValueType::Float},
+    {65543, "AxioCamShutterControl", ValueType::Int32},
+    {65544, "AxioCamBlackRefIsCalculated", ValueType::Int32},
+    {65545, "AxioCamBlackReference", ValueType::Int32},
+    {65547, "CameraShadingCorrection", ValueType::Int32},
+    {65550, "AxioCamEnhanceColor", ValueType::Int32},
+    {65551, "AxioCamNIRMode", ValueType::Int32},
+    {65552, "CameraShutterCloseDelay", ValueType::Float},
+    {65553, "CameraWhiteBalanceAutoCalculate", ValueType::Int32},
+    {65556, "AxioCamNIRModeAvailable", ValueType::Int32},
+    {65557, "AxioCamFadingCorrectionAvailable", ValueType::Int32},
+    {65559, "AxioCamEnhanceColorAvailable", ValueType::Int32},
+    {65565, "MeteorVideoNorm", ValueType::Int32},
+    {65566, "MeteorAdjustWhiteReference", ValueType::Int32},
+    {65567, "MeteorBlackReference", ValueType::Int32},
+    {65568, "MeteorChannelInputCountMono", ValueType::Int32},
+    {65570, "MeteorChannelInputCountRGB", ValueType::Int32},
+    {65571, "MeteorEnableVCR", ValueType::Int32},
+    {65572, "MeteorBrightness", ValueType::Float},
+    {65573, "MeteorContrast", ValueType::Float},
+    {65575, "AxioCamSelector", ValueType::Int32},
+    {65576, "AxioCamType", ValueType::Int32},
+    {65577, "AxioCamInfo", ValueType::String},
+    {65580, "AxioCamResolution", ValueType::Int32},
+    {65581, "AxioCamColourModel", ValueType::Int32},
+    {65582, "AxioCamMicroScanning", ValueType::Int32},
+    {65585, "AmplificationIndex", ValueType::Int32},
+    {65586, "DeviceCommand", ValueType::String},
+    {65587, "BeamLocation", ValueType::Int32},
+    {65588, "ComponentType", ValueType::Int32},
+    {65589, "ControllerType", ValueType::Int32},
+    {65590, "CameraWhiteBalanceCalculationRedPaint", ValueType::Float},
+    {65591, "CameraWhiteBalanceCalculationBluePaint", ValueType::Float},
+    {65592, "CameraWhiteBalanceSetRed", ValueType::Float},
+    {65593, "CameraWhiteBalanceSetGreen", ValueType::Float},
+    {65594, "CameraWhiteBalanceSetBlue", ValueType::Float},
+    {65595, "CameraWhiteBalanceSetTargetRed", ValueType::Float},
+    {65596, "CameraWhiteBalanceSetTargetGreen", ValueType::Float},
+    {65597, "CameraWhiteBalanceSetTargetBlue", ValueType::Float},
+    {65598, "ApotomeCamCalibrationMode", ValueType::Int32},
+    {65599, "ApoTomeGridPosition", ValueType::Int32},
+    {65600, "ApotomeCamScannerPosition", ValueType::Int32},
+    {65601, "ApoTomeFullPhaseShift", ValueType::Float},
+    {65602, "ApoTomeGridName", ValueType::String},
+    {65603, "ApoTomeStaining", ValueType::String},
+    {65604, "ApoTomeProcessingMode", ValueType::Int32},
+    {65605, "ApotomeCamLiveCombineMode", ValueType::Int32},
+    {65606, "ApoTomeFilterName", ValueType::String},
+    {65607, "ApotomeFilterStrength", ValueType::Float},
+    {65608, "ApotomeCamFilterHarmonics", ValueType::Int32},
+    {65609, "ApoTomeGratingPeriod", ValueType::Float},
+    {65610, "ApoTomeAutoShutterUsed", ValueType::Int32},
+    {65611, "ApotomeCamStatus", ValueType::Int32},
+    {65612, "ApotomeCamNormalize", ValueType::Int32},
+    {65613, "ApotomeCamSettingsManager", ValueType::String},
+    {65614, "DeepviewCamSupervisorMode", ValueType::Int32},
+    {65615, "DeepViewProcessing", ValueType::Int32},
+    {65616, "DeepviewCamFilterName", ValueType::String},
+    {65617, "DeepviewCamStatus", ValueType::Int32},
+    {65618, "DeepviewCamSettingsManager", ValueType::String},
+    {65619, "DeviceScalingName", ValueType::String},
+    {65620, "CameraShadingIsCalculated", ValueType::Int32},
+    {65621, "CameraShadingCalculationName", ValueType::String},
+    {65622, "CameraShadingAutoCalculate", ValueType::Int32},
+    {65623, "CameraTriggerAvailable", ValueType::Int32},
+    {65626, "CameraShutterAvailable", ValueType::Int32},
+    {65627, "AxioCamShutterMicroScanningEnable", ValueType::Int32},
+    {65628, "ApotomeCamLiveFocus", ValueType::Int32},
+    {65629, "DeviceInitStatus", ValueType::Int32},
+    {65630, "DeviceErrorStatus", ValueType::Int32},
+    {65631, "ApotomeCamSliderInGridPosition", ValueType::Int32},
+    {65632, "OrcaNIRModeUsed", ValueType::Int32},
+    {65633, "OrcaAnalogGain", ValueType::Float},
+    {65634, "OrcaAnalogOffset", ValueType::Float},
+    {65635, "OrcaBinning", ValueType::Int32},
+    {65636, "OrcaBitDepth", ValueType::Int32},
+    {65637, "ApoTomeAveragingCount", ValueType::Int32},
+    {65638, "DeepViewDoF", ValueType::Float},
+    {65639, "DeepViewEDoF", ValueType::Float},
+    {65643, "DeepViewSliderName", ValueType::String},
+    {65644, "RoperCamGain", ValueType::Float},
+    {65646, "RoperCamPixelClock", ValueType::Float},
+    {65647, "RoperCamTemperature", ValueType::Float},
+    {65648, "CameraImageMemUnitNames", ValueType::String},
+    {65649, "ApotomeCamLivePhase", ValueType::Int32},
+    {65650, "DualAxioCamAlgorithmType", ValueType::Int32},
+    {65651, "ApotomeCamDecay", ValueType::Float},
+    {65652, "ApotomeCamEpsilon", ValueType::Float},
+    {65653, "AxioCamHSBufferNumber", ValueType::Int32},
+    {65654, "AxioCamHSFrameTime", ValueType::Float},
+    {65655, "AxioCamAnalogGainEnable", ValueType::Int32},
+    {65656, "AxioCamAnalogGainAvailable", ValueType::Int32},
+    {65657, "ApotomeCamPhaseAngles", ValueType::String},
+    {65658, "ApotomeCamImageFormat", ValueType::Int32},
+    {65659, "CameraShadingCount", ValueType::Int32},
+    {65660, "CameraImageRawSize", ValueType::Int32},
+    {65661, "ApotomeCamBurstMode", ValueType::Int32},
+    {65662, "ApotomeCamGenericCameraName", ValueType::String},
+    {65663, "AcquisitionDevice", ValueType::String},
+    {65664, "ApotomeGratingPeriodMeasured", ValueType::Float},
+    {65665, "CameraLutEnable", ValueType::Int32},
+    {65666, "AxioCamSaturation", ValueType::Float},
+    {65667, "CameraColorCorrection", ValueType::Int32},
+    {65668, "CameraColorProcessingEnable", ValueType::Int32},
+    {65669, "CameraAnalogGain", ValueType::Float},
+    {65670, "CameraWhiteBalanceTargetPosX", ValueType::Float},
+    {65671, "CameraWhiteBalanceTargetPosY", ValueType::Float},
+    {65672, "CameraShutterSignalPort", ValueType::Int32},
+    {65673, "AxioCamICSaturation", ValueType::Float},
+    {65674, "ApotomeCamCamCalibMode", ValueType::Int32},
+    {65675, "ApotomeCamCamCalibValue", ValueType::Float},
+    {65676, "ApotomeCamAdminCalibMode", ValueType::Int32},
+    {65677, "ApotomeCamIsAdmin", ValueType::Int32},
+    {65678, "ApotomeCamPw", ValueType::String},
+    {65679, "ApotomeCamAdminName", ValueType::String},
+    {65680, "CameraShutterLiveEnable", ValueType::Int32},
+    {65681, "CameraExposureTimeAutoLiveEnable", ValueType::String},
+    {65682, "CameraEMGain", ValueType::String},
+    {65683, "ApotomeCamHardwareVersion", ValueType::String},
+    {65684, "ApotomeCamGridPosition", ValueType::String},
+    {65685, "ApotomeCamAutoGrid", ValueType::String},
+    {65703, "OrcaCamNumberOfScanMode", ValueType::String},
+    {65704, "OrcaCamScanMode", ValueType::String},
+    {65705, "OrcaCamEMCCDMode", ValueType::String},
+    {65706, "OrcaCamEMCCDGain", ValueType::String},
+    {65707, "OrcaCamFastAcq", ValueType::String},
+    {65708, "OrcaCamMinExposureTime", ValueType::String},
+    {65709, "OrcaCamNumberOfPhotonImagingMode", ValueType::String},
+    {65710, "OrcaCamPhotonImagingMode", ValueType::String},
+    {65711, "OrcaCamDirectEMGainAvailable", ValueType::String},
+    {65712, "OrcaCamDirectEMGain", ValueType::String},
+    {65713, "OrcaCamEMGainProtectionAvailable", ValueType::String},
+    {65714, "OrcaCamEMGainProtection", ValueType::String},
+    {65716, "CameraEMGainMinimum", ValueType::String},
+    {65717, "CameraEMGainMaximum", ValueType::String},
+    {65718, "CameraEMGainAvailable", ValueType::String},
+    {65719, "CameraEMGainEnabled", ValueType::String},
+    {65736, "YokogawaSynchronize", ValueType::String},
+    {65737, "YokogawaIsInSync", ValueType::String},
+    {65738, "YokogawaStatus", ValueType::String},
+    {65739, "YokogawaKeepInSync", ValueType::String},
+    {65740, "YokogawaIsBusy", ValueType::String},
+    {65741, "YokogawaStopDisc", ValueType::String},
+    {65742, "YokogawaCamExposureTime", ValueType::String},
+    {65743, "YokogawaMode", ValueType::String},
+    {65744, "YokogawaDepth", ValueType::String},
+    {65745, "YokogawaCamReserved12", ValueType::String},
+    {65746, "YokogawaCamReserved13", ValueType::String},
+    {65747, "YokogawaCamReserved14", ValueType::String},
+    {65748, "YokogawaCamReserved15", ValueType::String},
+    {65749, "YokogawaCamReserved16", ValueType::String},
+    {65750, "YokogawaCamReserved17", ValueType::String},
+    {65751, "YokogawaCamReserved18", ValueType::String},
+    {65752, "YokogawaCamReserved19", ValueType::String},
+    {65753, "YokogawaCamReserved20", ValueType::String},
+    {65754, "AuroxCamStatus", ValueType::String},
+    {65755, "AuroxCamInputMode", ValueType::String},
+    {65756, "AuroxCamLiveMode", ValueType::String},
+    {65757, "AuroxCamCalibrationMode", ValueType::String},
+    {65758, "AuroxCamGenericCameraName", ValueType::String},
+    {65759, "AuroxCamButtonMode", ValueType::String},
+    {65760, "AuroxCamDepth", ValueType::String},
+    {65761, "AuroxCamCenter", ValueType::String},
+    {65762, "AuroxCamFactor", ValueType::String},
+    {65763, "AuroxCamCreateRegistration", ValueType::String},
+    {65764, "AuroxCamRegistrationValid", ValueType::String},
+    {65765, "AuroxCamRegistrationError", ValueType::String},
+    {65766, "AuroxCamShadingImageMode", ValueType::String},
+    {65767, "AuroxCamShadingImageAvailable", ValueType::String},
+    {65768, "AuroxCamQuality", ValueType::String},
+    {65769, "AuroxCamCutLeft", ValueType::String},
+    {65770, "AuroxCamCutTop", ValueType::String},
+    {65771, "AuroxCamCutRight", ValueType::String},
+    {65772, "AuroxCamCutBottom", ValueType::String},
+    {65773, "AuroxCamMean", ValueType::String},
+    {65774, "AuroxCamNormalize", ValueType::String},
+    {65775, "AuroxCamUseShading", ValueType::String},
+    {65776, "AuroxCamShadingValid", ValueType::String},
+    {65777, "AuroxCamNotification", ValueType::String},
+    {65778, "AuroxCamCalibrationID", ValueType::String},
+    {65779, "AuroxCamSimpleCalibMode", ValueType::String},
+    {65780, "AuroxCamCalibrationName", ValueType::String},
+    {65781, "AuroxCamRes6", ValueType::String},
+    {65781, "AuroxCamCFactor", ValueType::String},
+    {65782, "AuroxCamRegistrationCenter", ValueType::String},
+    {65783, "AuroxCamCalibrationID2", ValueType::String},
+    {65784, "AuroxCamAveraging", ValueType::String},
+    {65785, "AuroxCamUniqueID", ValueType::String},
+    {65786, "AuroxCamAutoNormalize", ValueType::String},
+    {65787, "AuroxCamReserved3", ValueType::String},
+    {65788, "AuroxCamReserved4", ValueType::String},
+    {65789, "AuroxCamReserved5", ValueType::String},
+}};
+
+constexpr std::array<int32_t, k_TagCount> k_NameDisplacements = {{
+    3, -540, 0, 0, -537, 0, -533, 0, -530, 0, 0, 0, 0, 2, 0, 0,
+    0, -527, -521, -518, -516, 0, -509, 0, -501, 0, -499, 0, 1, 0, 2, 0,
+    1, 2, 0, 0, -490, 0, 0, 0, 1, 2, -489, 2, -483, -481, 0, -478,
+    1, 2, 1, -476, 2, -475, 0, 0, 3, 1, -472, 0, 7, 2, 2, 0,
+    0, -470, -458, 0, 0, -455, 1, 0, -453, -450, 1, -448, -447, 0, 0, 0,
+    0, -446, -438, 0, 0, 0, 1, 0, 2, 0, -435, 9, 0, -430, 1, 0,
+    0, -428, 1, 0, 5, 0, 0, 1, -426, 1, -418, 1, 0, -414, 0, -411,
+    0, -407, -400, 0, 0, -393, 0, 0, 5, 4, 1, 1, -387, 10, 0, 1,
+    -386, 1, 1, 0, 1, -384, -376, -375, -374, -372, 0, 0, -371, 0, 0, -370,
+    4, -367, 0, -360, 0, -357, 0, -351, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 2, 3, 0, 1, -346, 0, 5, 1, 2, 0, -344, -341, 0,
+    -339, 0, -335, 0, 0, 4, -331, -325, -317, 2, 3, 0, 0, 1, 0, 5,
+    0, 1, 0, -314, 0, 5, 0, 0, 0, 0, -308, -305, 0, 3, -303, 2,
+    -300, 0, -298, -297, 0, -295, 0, 0, -294, 0, -281, 4, 1, 0, -280, -275,
+    5, 0, 0, 4, 10, 0, -274, 2, 0, 3, 0, -271, 3, 1, 0, 0,
+    0, 2, 0, 0, 1, 0, 1, -270, 0, -269, 0, 1, -266, 0, 0, -264,
+    -261, -258, -255, 0, 0, 1, 6, -253, -252, -246, 1, 2, 0, 1, 1, 3,
+    -245, 4, 0, 0, 0, -241, 1, 2, -234, -233, -229, 0, -225, 1, 4, -224,
+    -223, -222, -221, 0, 6, 0, -218, -217, 6, 0, -216, -213, 1, 2, 0, -208,
+    0, 2, 0, 0, 4, -203, 0, -200, 0, 0, 0, 0, 1, 0, -198, 2,
+    -197, 8, -196, 4, 2, 2, -192, 0, 2, 0, -189, -181, -174, 2, -173, 0,
+    0, -171, 0, -168, -167, -163, 4, -162, 0, -157, 0, 0, 3, 0, 4, 0,
+    0, 0, 10, -155, -151, 0, -150, 0, -145, -144, 0, 1, 0, -141, 0, 11,
+    0, 5, 0, -134, 1, -131, 1, 0, -129, 0, 0, 0, 8, -128, 3, 3,
+    -126, 0, -125, 0, -121, 0, -120, -119, 1, 2, 2, -116, 0, 0, -115, 4,
+    0, -113, 3, 0, -112, 7, 0, 0, -111, -110, -108, -106, 0, -104, 0, -101,
+    0, 0, 0, 0, 2, 0, 5, 3, 0, -98, -93, 0, -91, 0, 0, -90,
+    0, 13, 1, 5, 12, 0, 5, -88, 6, 9, 1, -87, -86, 0, 1, 0,
+    -85, 11, 7, 1, -69, -66, -65, -64, 0, -62, 3, 10, 0, -59, 0, 0,
+    5, 1, -58, 0, -57, 8, 0, 1, -55, 0, 0, 0, -51, 0, 15, -50,
+    4, 0, 0, -44, 2, 3, 3, 28, 0, 0, 3, 0, 0, -39, -36, 0,
+    0, -32, -28, -26, 0, 12, 1, -23, 0, -21, 0, -18, -15, 0, 0, 0,
+    -14, 0, -10, 4, 0, -9, 11, 0, -8, 0, 0, 0, -7, 0, -5, 0,
+    -4, 0, 1, 0, 2, 0, 0, 15, 0, 1, 1, 0, 0, 0, 7,
+}};
+
+constexpr std::array<uint16_t, k_TagCount> k_NameSlots = {{
+    522, 336, 0, 256, 272, 219, 41, 167, 147, 420, 136, 387, 262, 141, 273, 280,
+    437, 100, 29, 218, 191, 428, 451, 12, 94, 276, 99, 260, 195, 176, 257, 400,
+    111, 65, 264, 472, 266, 197, 220, 121, 114, 32, 362, 90, 351, 404, 2, 61,
+    519, 464, 16, 388, 4, 369, 373, 380, 44, 151, 17, 128, 529, 460, 62, 30,
+    170, 383, 402, 52, 35, 411, 235, 174, 42, 450, 143, 172, 486, 474, 222, 149,
+    103, 269, 310, 5, 435, 8, 3, 9, 69, 379, 18, 341, 516, 56, 75, 133,
+    485, 445, 164, 356, 449, 268, 14, 110, 156, 367, 467, 244, 233, 145, 496, 142,
+    124, 518, 270, 77, 198, 533, 283, 364, 542, 138, 295, 512, 301, 43, 493, 243,
+    292, 144, 322, 352, 130, 296, 471, 163, 438, 267, 509, 71, 366, 226, 159, 293,
+    116, 430, 146, 101, 230, 540, 173, 87, 72, 160, 115, 278, 258, 13, 254, 427,
+    349, 304, 491, 409, 484, 431, 423, 1, 421, 461, 190, 434, 91, 463, 175, 161,
+    414, 263, 344, 466, 192, 245, 201, 384, 327, 188, 40, 214, 127, 259, 520, 332,
+    453, 339, 392, 158, 129, 334, 89, 96, 169, 171, 37, 242, 217, 510, 39, 480,
+    490, 98, 48, 232, 311, 224, 524, 47, 123, 108, 281, 68, 57, 81, 307, 186,
+    64, 406, 488, 132, 312, 286, 306, 418, 313, 104, 508, 370, 240, 495, 6, 153,
+    117, 439, 207, 297, 447, 399, 477, 294, 470, 93, 137, 473, 308, 365, 162, 363,
+    448, 189, 325, 109, 316, 459, 45, 74, 442, 181, 70, 139, 282, 28, 212, 11,
+    505, 231, 113, 515, 507, 320, 265, 539, 374, 396, 376, 202, 211, 441, 208, 514,
+    526, 324, 381, 206, 209, 50, 403, 166, 433, 210, 378, 193, 185, 525, 513, 148,
+    527, 303, 33, 395, 51, 330, 88, 357, 106, 417, 375, 150, 247, 408, 416, 107,
+    251, 216, 215, 482, 26, 157, 131, 314, 290, 252, 58, 120, 317, 321, 535, 530,
+    302, 360, 494, 196, 187, 361, 319, 234, 469, 179, 326, 318, 446, 429, 229, 289,
+    134, 274, 97, 443, 83, 300, 405, 531, 253, 78, 118, 284, 36, 410, 25, 331,
+    277, 182, 371, 46, 38, 22, 248, 345, 54, 454, 452, 66, 497, 238, 199, 528,
+    353, 426, 335, 348, 541, 340, 152, 458, 287, 468, 390, 271, 95, 155, 223, 329,
+    377, 315, 178, 368, 227, 478, 532, 53, 255, 347, 412, 291, 358, 457, 79, 500,
+    398, 165, 82, 337, 503, 67, 239, 140, 23, 456, 59, 424, 372, 343, 511, 536,
+    489, 391, 385, 382, 84, 415, 309, 135, 499, 275, 517, 397, 19, 27, 393, 221,
+    323, 386, 279, 203, 537, 299, 76, 126, 305, 249, 462, 10, 204, 63, 487, 422,
+    475, 455, 498, 444, 401, 389, 476, 394, 105, 168, 102, 246, 506, 342, 80, 425,
+    288, 501, 125, 112, 241, 31, 502, 122, 250, 355, 34, 200, 236, 194, 55, 86,
+    432, 177, 492, 228, 440, 225, 285, 20, 479, 24, 73, 359, 60, 180, 49, 354,
+    298, 346, 481, 183, 521, 534, 413, 7, 92, 119, 15, 504, 419, 21, 205, 184,
+    465, 436, 407, 213, 261, 333, 538, 350, 85, 154, 338, 237, 328, 523, 483,
+}};
+
+constexpr std::array<int32_t, k_IdCount> k_IdDisplacements = {{
+    -540, -539, 0, 0, 0, 0, 2, 1, 0, 1, 8, 1, 1, -536, 2, 6,
+    -534, -527, -523, -519, 0, 0, 0, -514, 1, -512, -509, -508, 0, 0, -507, 0,
+    -503, 1, 1, -502, 1, -501, 1, -493, 0, -492, 0, -487, 0, 0, 1, 3,
+    -486, 0, 1, 0, -485, 0, 0, -483, 0, -481, -478, -476, -475, 1, 0, 0,
+    -474, 0, 1, 0, 0, 0, 0, -473, -471, 0, 1, 1, 0, 0, 0, 0,
+    0, -470, 0, 3, 2, -469, -465, -457, 0, 0, 0, -455, -450, 0, 0, -449,
+    0, 0, 1, -442, -441, -440, 2, -436, 4, 1, 0, -432, -430, -426, -425, -424,
+    0, 0, 0, 0, 0, -418, 0, 1, 1, 1, -417, 5, 0, 3, -414, -411,
+    0, -408, -405, 0, 1, 0, 1, -402, 0, 0, 3, 0, 0, 0, -401, -393,
+    0, 0, 0, -390, 1, 1, -389, 1, 0, 2, -387, -382, 1, -380, 2, 0,
+    -379, 1, 1, -377, -376, 0, 0, 2, 0, 0, 0, -370, 1, -369, 1, -367,
+    -366, 0, -363, 0, -353, 1, 0, 0, 1, -350, 4, -349, -343, 3, 0, 5,
+    -342, -341, -339, -338, 2, 0, 0, 1, 0, -337, 0, -335, -334, 8, 2, -333,
+    0, 0, 0, 2, -331, -321, 1, 0, -318, 0, -311, 2, -309, 0, 0, -308,
+    0, 0, 0, -307, 0, 0, -305, 2, 0, 0, 3, -302, -300, -299, 1, 0,
+    1, -297, -295, -293, -289, 0, -287, 0, -286, 0, 2, 0, -283, -279, -278, 0,
+    2, 12, 1, -274, 0, -266, 0, 3, 8, -265, 5, 0, 0, 0, 0, 2,
+    0, 0, -262, -261, -258, -256, 1, 1, 0, -253, 0, 0, 4, 5, 7, 0,
+    2, 0, 0, 2, 2, -251, 0, 2, 0, 2, 2, 2, -244, 1, -242, 0,
+    0, 2, 4, 0, 0, -232, 0, -229, -228, 0, 0, -227, 0, -222, 0, 0,
+    -221, 5, -218, -217, -208, 2, 1, 1, 0, 0, 0, 0, 3, -201, 0, 8,
+    2, 0, 0, 1, 0, 3, 1, 1, -200, 0, 0, 3, 0, -197, 3, 1,
+    -194, 7, 0, 17, -191, -189, 6, 0, 0, 0, 2, -187, -184, 0, 5, 0,
+    0, -182, 0, 1, -178, -177, 19, -173, -172, 0, 0, 0, 5, 0, 4, 5,
+    0, 0, -170, 0, -166, 0, 0, 1, -163, -162, 6, -160, -156, 0, 4, 0,
+    3, 1, -154, 0, -151, 2, -149, -146, 0, 0, 0, 0, 0, -144, 0, 0,
+    2, 0, -143, 0, 0, 0, 0, 4, 3, -141, 0, 0, 12, -138, 0, 4,
+    -137, 8, -135, 6, -132, 2, -123, 1, 0, 2, 15, 5, -120, -114, 0, 0,
+    0, 1, -109, 0, 2, 0, 1, 1, -106, -105, 0, -104, -101, -99, 2, 0,
+    1, -97, 0, 9, 0, 7, -96, 0, -95, -93, -88, 0, -85, 1, 5, 0,
+    -84, 0, -83, -79, 0, -77, -76, 8, 12, 1, 0, -75, 0, -74, 7, -71,
+    -69, 0, -68, -64, 11, 0, 1, -62, 2, -54, 0, 0, 0, -53, 0, 0,
+    0, -52, -49, 10, 0, -46, 4, -45, -44, -43, 0, -40, 0, 0, -32, 0,
+    5, -29, 1, -26, 0, -23, -17, -11, -7, 0, -6, -4, 0,
+}};
+
+constexpr std::array<uint16_t, k_IdCount> k_IdSlots = {{
+    191, 474, 538, 386, 399, 302, 198, 477, 39, 205, 356, 443, 82, 7, 527, 306,
+    175, 196, 284, 31, 334, 140, 408, 316, 394, 387, 413, 117, 186, 308, 185, 14,
+    445, 221, 144, 433, 170, 207, 58, 103, 220, 105, 255, 242, 320, 89, 222, 498,
+    478, 137, 305, 214, 166, 344, 365, 217, 457, 530, 363, 352, 78, 286, 123, 331,
+    329, 202, 224, 250, 176, 133, 96, 411, 480, 262, 56, 87, 510, 219, 194, 436,
+    472, 488, 272, 50, 403, 486, 495, 75, 0, 60, 502, 109, 516, 505, 253, 309,
+    402, 49, 438, 300, 192, 328, 156, 303, 80, 464, 238, 57, 68, 36, 229, 184,
+    280, 107, 42, 94, 397, 142, 33, 257, 318, 281, 90, 295, 350, 277, 234, 48,
+    215, 423, 91, 289, 345, 157, 28, 349, 336, 456, 203, 69, 243, 395, 522, 97,
+    462, 376, 29, 116, 11, 52, 473, 70, 168, 288, 378, 197, 79, 55, 434, 102,
+    40, 401, 206, 261, 240, 361, 292, 174, 283, 227, 322, 149, 463, 496, 304, 108,
+    485, 448, 247, 104, 51, 183, 230, 325, 314, 148, 118, 38, 359, 455, 15, 301,
+    384, 459, 180, 201, 330, 163, 374, 20, 419, 246, 53, 167, 267, 17, 404, 34,
+    435, 177, 122, 417, 353, 312, 450, 164, 348, 212, 339, 367, 73, 519, 147, 514,
+    475, 332, 513, 390, 211, 226, 541, 375, 59, 2, 270, 187, 383, 354, 114, 429,
+    400, 251, 160, 113, 3, 22, 61, 85, 154, 152, 451, 209, 389, 398, 311, 298,
+    112, 106, 422, 100, 461, 24, 275, 210, 16, 204, 526, 494, 99, 418, 6, 171,
+    333, 444, 297, 414, 324, 143, 501, 92, 138, 9, 440, 260, 482, 327, 406, 158,
+    371, 263, 5, 19, 460, 362, 135, 46, 67, 1, 86, 232, 381, 338, 415, 420,
+    465, 326, 76, 500, 233, 507, 23, 8, 503, 511, 521, 27, 313, 237, 421, 504,
+    493, 188, 290, 98, 124, 189, 534, 517, 405, 341, 346, 268, 235, 509, 380, 537,
+    218, 213, 388, 236, 360, 340, 252, 491, 159, 453, 179, 12, 115, 178, 136, 21,
+    337, 134, 276, 454, 528, 468, 392, 291, 245, 409, 127, 370, 407, 515, 161, 54,
+    88, 131, 424, 410, 181, 315, 146, 282, 32, 296, 492, 162, 426, 26, 279, 128,
+    287, 256, 539, 540, 518, 66, 293, 317, 216, 249, 430, 65, 269, 83, 483, 437,
+    169, 391, 264, 10, 84, 62, 368, 470, 225, 119, 278, 130, 467, 335, 72, 129,
+    208, 190, 351, 172, 110, 323, 120, 357, 200, 41, 299, 71, 274, 369, 307, 484,
+    532, 248, 476, 4, 531, 111, 439, 379, 458, 74, 373, 385, 254, 141, 466, 126,
+    449, 524, 132, 319, 43, 182, 490, 427, 258, 452, 479, 63, 145, 265, 81, 432,
+    285, 487, 396, 44, 520, 523, 377, 294, 266, 121, 241, 223, 412, 193, 310, 45,
+    37, 342, 469, 228, 47, 355, 536, 153, 101, 489, 358, 151, 471, 155, 499, 347,
+    199, 93, 497, 441, 139, 431, 416, 529, 364, 77, 165, 508, 150, 64, 425, 244,
+    231, 35, 125, 428, 366, 30, 481, 273, 535, 173, 542, 525, 446, 195, 343, 506,
+    393, 271, 512, 259, 25, 95, 442, 372, 239, 321, 447, 18, 382,
+}};
+
+/**
+ * @brief Returns the entry for a tag id or nullptr if the id is unknown. An unknown id lands on an
+ * arbitrary slot, so the id stored in that slot is always compared.
+ */
+constexpr const TagEntry* FindById(int32_t id)
+{
+  int32_t displacement = k_IdDisplacements[HashId(id, 0) % k_IdCount];
+  size_t slot = displacement < 0 ? static_cast<size_t>(-displacement - 1) : HashId(id, static_cast<uint32_t>(displacement)) % k_IdCount;
+  const TagEntry& entry = k_Tags[k_IdSlots[slot]];
+  return entry.Id == id ? &entry : nullptr;
+}
+
+/**
+ * @brief Returns the entry for a tag name or nullptr if the name is unknown.
+ */
+constexpr const TagEntry* FindByName(std::string_view name)
+{
+  int32_t displacement = k_NameDisplacements[HashName(name, 0) % k_TagCount];
+  size_t slot = displacement < 0 ? static_cast<size_t>(-displacement - 1) : HashName(name, static_cast<uint32_t>(displacement)) % k_TagCount;
+  const TagEntry& entry = k_Tags[k_NameSlots[slot]];
+  return entry.Name == name ? &entry : nullptr;
+}
+
+static_assert(FindById(515) != nullptr && FindById(515)->Name == "ImageWidthPixel", "Zeiss id lookup is broken");
+static_assert(FindByName("StagePositionX") != nullptr && FindByName("StagePositionX")->Id == 2073, "Zeiss name lookup is broken");
+static_assert(FindById(-1) == nullptr && FindByName("NotAZeissTag") == nullptr, "Zeiss lookups must reject unknown keys");
+
+} // namespace ZeissTagTable
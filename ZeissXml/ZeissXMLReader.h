@@ -30,28 +30,29 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
-#error THIS FILE IS NO LONGER USED. WE are now using the QtXML framework instead of Expat
-//-- C++ Includes
+#include <functional>
 #include <memory>
-
-#include <sstream>
-#include <string>
 #include <vector>
 
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
 #include "SIMPLib/SIMPLib.h"
 
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
-#include "ZeissTagsXmlSection.h"
+#include "ITKImageProcessing/ZeissXml/ZeissTagsXmlSection.h"
+
+class QIODevice;
+class QXmlStreamReader;
 
 /**
- * @class ZeissXMLReader ZeissXMLReader.h Importer/ZeissXMLReader.h
- * @brief  This class reads the xml file that is produced by the Zeiss software
- * during an image export.
- * @author Mike Jackson
- * @date Oct 2007
- * @version $Revision: 1.1 $
+ * @class ZeissXMLReader ZeissXMLReader.h ZeissXml/ZeissXMLReader.h
+ * @brief This class reads the _meta.xml file that is produced by the Zeiss AxioVision
+ * software in a single streaming pass. The <ROOT><Tags> and <ROOT><Scaling> sections are
+ * kept, while each <ROOT><pXXX> element is handed to the PhotoHandler as soon as it has
+ * been read and then released, so memory use does not grow with the number of tiles.
  */
-class ITKImageProcessing_EXPORT ZeissXMLReader : public ExpatEvtHandler
+class ITKImageProcessing_EXPORT ZeissXMLReader
 {
 public:
   using Self = ZeissXMLReader;
@@ -64,163 +65,113 @@ public:
   /**
    * @brief Returns the name of the class for ZeissXMLReader
    */
-  QString getNameOfClass() const override;
+  QString getNameOfClass() const;
   /**
    * @brief Returns the name of the class for ZeissXMLReader
    */
   static QString ClassName();
 
   /**
-   * @brief Creates a new Object which is wrapped in a shared_ptr
-   * @param filename The filename of the xml file to read
-   * @slice The slice number that the xml file corresponds to
+   * @brief Creates a new reader for the given xml file
+   * @param fileName The path to the _meta.xml file
    * @return Shared Pointer
    */
-  static Pointer New(const std::string& filename)
-  {
-    Pointer ptr(new ZeissXMLReader(filename));
-    return ptr;
-  }
+  static Pointer New(const QString& fileName);
 
   virtual ~ZeissXMLReader();
 
   /**
-   * @brief Sets the input file to parse
-   * @param inputFile The path to an xml file
+   * @brief Called for every <pXXX> element. photoIndex is the XXX part of the element name and
+   * photoTag the full element name. Return false to stop parsing.
    */
-  void setXMLInputFile(const std::string& inputFile)
-  {
-    this->_xmlFilename = inputFile;
-  }
+  using PhotoHandler = std::function<bool(int32_t photoIndex, const QString& photoTag, const ZeissTagsXmlSection::Pointer& photoTagsSection)>;
 
   /**
-   * @brief returns the XML File that this importer is using
+   * @brief Error codes reported by parse()
    */
-  std::string getXMLInputFile()
+  enum ErrorCodes : int32_t
   {
-    return this->_xmlFilename;
-  }
+    ParseError = -70000,
+    RootTagsError = -70001,
+    MissingPhotoTags = -70003,
+    PhotoTagsError = -70004,
+    FileOpenError = -70005
+  };
 
   /**
-   * @brief Reads the Data Model from an XML File/
-   * @return Error: Negative is error Condition
+   * @brief Setter property for PhotoHandler
    */
-  int32_t parse();
-
-  // -----------------------------------------------------------------------------
-  //  ExpatEvtHandler Implementation
-  // -----------------------------------------------------------------------------
-  // Over ride from ExpatEvtHandler class
-  void OnStartElement(const XML_Char* name, const XML_Char** attrs);
-
-  // Over ride from ExpatEvtHandler class
-  void OnEndElement(const XML_Char* name);
-
-  // Over ride from ExpatEvtHandler class
-  void OnCharacterData(const XML_Char* data, int32_t len);
+  void setPhotoHandler(const PhotoHandler& value);
 
   /**
-   * @brief Returns the current parser error.
+   * @brief Reads the whole file.
+   * @return false if the file could not be parsed or the PhotoHandler stopped the parsing.
+   * getErrorCode() is negative only in the first case.
    */
-  int32_t getParseError();
+  bool parse();
 
   /**
-   * @brief Print some statistics about this parser and the values it extracted
-   * from the xml file
-   * @param out A std::ostream Object reference
+   * @brief Getter property for ErrorCode
+   * @return Value of ErrorCode
    */
-  void printStats(std::ostream& out);
+  int32_t getErrorCode() const;
 
   /**
-   * @brief Setter property for TagsSection;
-   */
-  void setTagsSection;
-  (const ZeissTagsXmlSection::Pointer& value);
-  /**
-   * @brief Getter property for TagsSection;
-   * @return Value of TagsSection;
+   * @brief Getter property for ErrorMessage
+   * @return Value of ErrorMessage
    */
-  ZeissTagsXmlSection::Pointer getTagsSection;
-  () const;
+  QString getErrorMessage() const;
 
   /**
-   * @brief Setter property for ImageTags;
+   * @brief Returns the parsed <ROOT><Tags> section
    */
-  void setImageTags;
-  (const std::vector<ZeissTagsXmlSection::Pointer>& value);
+  ZeissTagsXmlSection::Pointer getRootTagsSection() const;
+
   /**
-   * @brief Getter property for ImageTags;
-   * @return Value of ImageTags;
+   * @brief Returns the text of a direct child of <ROOT><Scaling> such as "Factor_0", or an
+   * empty string if the element was not in the file.
+   * @param name
+   * @return
    */
-  std::vector<ZeissTagsXmlSection::Pointer> getImageTags;
-  () const;
+  QString getScalingValue(const QString& name) const;
 
 protected:
-  ZeissXMLReader(const std::string& xmlFile);
-
-private:
-  ZeissTagsXmlSection::Pointer m_TagsSection;
-  = {};
-  std::vector<ZeissTagsXmlSection::Pointer> m_ImageTags;
-  = {};
-
-  std::string _xmlFilename;
-  int32_t _xmlParseError;
-  ExpatParser* _parser;
-  std::string _errorMessage;
-  std::string _charData;
-  bool _parseData;
-
-  int _xmlSection;
-  std::string _vTagContent;
-  int _tileSection;
-
-  ZeissTagsXmlSection::Pointer m_CurrentTagSection;
-
-  ZeissXMLReader(const ZeissXMLReader&); // Not Implemented
-  void operator=(const ZeissXMLReader&); // Not Implemented
+  explicit ZeissXMLReader(const QString& fileName);
 
   /**
-   * @brief Runs the actual parsing of the XML File
-   * @return Error condition
+   * @brief Reads the children of a <Tags> element. The reader must be positioned on its start element.
+   * @param xml
+   * @return The section or nullptr if the Count entry is missing
    */
-  int32_t _parseXMLFile();
-
-  // -----------------------------------------------------------------------------
-  //  Tags that deliniate sections of the XML file:
-  // -----------------------------------------------------------------------------
-  // <ROOT>
-  void onRoot_StartTag(const XML_Char* name, const XML_Char** attrs);
-  void onRoot_EndTag(const XML_Char* name);
-
-  // <p00>
-  void onTags_StartTag(const XML_Char* name, const XML_Char** attrs);
-  void onTags_EndTag(const XML_Char* name);
-
-  void onTile_StartTag(const XML_Char* name, const XML_Char** attrs);
-  void onTile_EndTag(const XML_Char* name);
-
-  // <V00>
-  void onVx_StartTag(const XML_Char* name, const XML_Char** attrs);
-  void onVx_EndTag(const XML_Char* name);
+  ZeissTagsXmlSection::Pointer readTagsSection(QXmlStreamReader& xml);
 
-  // <I00>
-  void onIx_StartTag(const XML_Char* name, const XML_Char** attrs);
-  void onIx_EndTag(const XML_Char* name);
+  /**
+   * @brief Reads one <pXXX> element and passes it to the PhotoHandler
+   * @param xml
+   * @param photoIndex
+   * @return false if parsing should stop
+   */
+  bool readPhoto(QXmlStreamReader& xml, int32_t photoIndex);
 
   /**
-   * @brief This will extract a single value from Character Data
-   * @param data The Character data to extract the value from
-   * @param value The variable to store the value into
+   * @brief Reads the children of the <Scaling> element
+   * @param xml
    */
-  template <typename T>
-  void extractValue(const std::string& data, T& value)
-  {
+  void readScalingSection(QXmlStreamReader& xml);
+
+  void setError(int32_t code, const QString& message);
 
-    std::istringstream istream(data);
-    while(istream.good())
-    {
-      istream >> value;
-    }
-  }
+private:
+  QString m_FileName;
+  PhotoHandler m_PhotoHandler;
+  int32_t m_ErrorCode = 0;
+  QString m_ErrorMessage;
+  ZeissTagsXmlSection::Pointer m_RootTagsSection;
+  QHash<QString, QString> m_ScalingValues;
+
+public:
+  ZeissXMLReader(const ZeissXMLReader&) = delete;            // Copy Constructor Not Implemented
+  ZeissXMLReader(ZeissXMLReader&&) = delete;                 // Move Constructor Not Implemented
+  ZeissXMLReader& operator=(const ZeissXMLReader&) = delete; // Copy Assignment Not Implemented
+  ZeissXMLReader& operator=(ZeissXMLReader&&) = delete;      // Move Assignment Not Implemented
 };
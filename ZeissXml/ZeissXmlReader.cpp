@@ -28,78 +28,39 @@
  * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-#error THIS FILE IS NO LONGER USED. WE are now using the QtXML framework instead of Expat
 
 #include "ZeissXMLReader.h"
 
-#include <cstdio>
-#include <iostream>
+#include <QtCore/QFile>
+#include <QtCore/QObject>
+#include <QtCore/QXmlStreamReader>
 
+#include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ZeissXml/ZeissTagMapping.h"
 
-#define BUFFER_SIZE 1024
-
-namespace Zeiss
-{
-namespace MicroScope
+namespace
 {
-const std::string AxioObserverZ1("Axio Observer.Z1");    // CMU's Microscope
-const std::string Axiovert200MMAT("Axiovert 200 M MAT"); // WPAFB Microscope
-} // namespace MicroScope
-
-namespace XML
+/**
+ * @brief Splits an element name such as "p12" or "V3" into its prefix and index
+ */
+bool SplitIndexedName(const QString& name, QChar prefix, int32_t& index)
 {
-// Mosaic XML file
-//    const std::string V3("V3");
-//    const std::string V4("V4");
-//    const std::string V15("V15");
-//    const std::string V16("V16");
-//    const std::string V71("V71");
-//    const std::string V72("V72");
-//    const std::string V73("V73");
-//    const std::string V74("V74");
-//    const std::string V87("V87");
-//    const std::string V116("V116");
-//    const std::string V117("V117");
-//    const std::string V118("V118");
-//    const std::string V119("V119");
-//    const std::string Factor_0("Factor_0");
-
-/* These are for the Slice XML File */
-//    const std::string V25("V25");
-//    const std::string V26("V26");
-//    const std::string V29("V29");
-//    const std::string V30("V30");
-//    const std::string V32("V32");
-//    const std::string V33("V33");
-const std::string Root("ROOT");
-const std::string Tags("Tags");
-
-//   const std::string Scaling("Scaling");
-
-const std::string V2072("V2072");
-const std::string V2121("V2121");
-const std::string V2149("V2149");
-
-int RootSection = 1;
-//    int MosaicSection = 2;
-//    int ScaleSection = 3;
-int TileSection = 4;
-int TagsSection = 5;
-
-} // namespace XML
-} // namespace Zeiss
+  if(name.size() < 2 || name.at(0) != prefix)
+  {
+    return false;
+  }
+  bool ok = false;
+  index = name.midRef(1).toInt(&ok, 10);
+  return ok && index >= 0;
+}
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-ZeissXMLReader::ZeissXMLReader(const std::string& xmlFile)
-: _xmlFilename(xmlFile)
-, _xmlParseError(0)
-, _parseData(false)
+ZeissXMLReader::ZeissXMLReader(const QString& fileName)
+: m_FileName(fileName)
 {
-  _xmlSection = Zeiss::XML::RootSection;
-  _tileSection = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -107,295 +68,229 @@ ZeissXMLReader::ZeissXMLReader(const std::string& xmlFile)
 // -----------------------------------------------------------------------------
 ZeissXMLReader::~ZeissXMLReader() = default;
 
-// -----------------------------------------------------------------------------
-// Call back struct to sort Commands and properties based on their name
-// -----------------------------------------------------------------------------
-template <typename T>
-struct Compare : std::binary_function<const T, const T, bool>
-{
-  bool operator()(const T lhs, const T rhs) const
-  {
-
-    return (lhs.first < rhs.first);
-  }
-};
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int32_t ZeissXMLReader::parse()
+bool ZeissXMLReader::parse()
 {
+  m_ErrorCode = 0;
+  m_ErrorMessage.clear();
+  m_RootTagsSection = ZeissTagsXmlSection::NullPointer();
+  m_ScalingValues.clear();
 
-  if(this->_xmlFilename.empty())
+  QFile xmlFile(m_FileName);
+  if(!xmlFile.open(QIODevice::ReadOnly))
   {
-    std::cout << "Input XML File must be set." << std::endl;
-    _xmlParseError = -3;
-    return _xmlParseError;
+    setError(FileOpenError, QObject::tr("Could not open the xml file '%1'").arg(m_FileName));
+    return false;
   }
 
-  // Parse the XML Configuration file
-  _xmlParseError = 1; // Clear the error flag
-  _xmlParseError = this->_parseXMLFile();
-
-  if(_xmlParseError < 0)
+  QXmlStreamReader xml(&xmlFile);
+  // Position the reader on the <ROOT> element and walk its children
+  if(xml.readNextStartElement())
   {
-    return _xmlParseError;
+    while(xml.readNextStartElement())
+    {
+      QString name = xml.name().toString();
+      int32_t photoIndex = -1;
+      if(name == ITKImageProcessingConstants::Xml::Tags && nullptr == m_RootTagsSection)
+      {
+        m_RootTagsSection = readTagsSection(xml);
+        if(nullptr == m_RootTagsSection)
+        {
+          setError(RootTagsError, QObject::tr("Error Parsing 'Count' Tag in Root 'Tags' DOM element"));
+          return false;
+        }
+      }
+      else if(name == ITKImageProcessingConstants::Xml::Scaling)
+      {
+        readScalingSection(xml);
+      }
+      else if(SplitIndexedName(name, 'p', photoIndex))
+      {
+        if(!readPhoto(xml, photoIndex))
+        {
+          return false;
+        }
+      }
+      else
+      {
+        xml.skipCurrentElement();
+      }
+    }
   }
 
-  return _xmlParseError;
-}
-
-// -----------------------------------------------------------------------------
-int32_t ZeissXMLReader::_parseXMLFile()
-{
-
-  // Clear any error messages that have been hanging around from previous imports
-  _errorMessage.clear();
-  _charData.clear();
-  char buf[BUFFER_SIZE];
-  // Create and initialise an instance of the parser.
-  ExpatParser parser(static_cast<ExpatEvtHandler*>(this));
-  // this->_parser = &parser;
-  parser.Create(nullptr, nullptr);
-  parser.EnableElementHandler();
-  parser.EnableCharacterDataHandler();
-  // Load the XML file.
-  FILE* fh = fopen(_xmlFilename.c_str(), "r");
-  if(nullptr == fh)
+  if(xml.hasError())
   {
-    std::cout << "Could Not Open XML File for reading: " << _xmlFilename << std::endl;
-    return -1;
+    setError(ParseError, QObject::tr("Parse error at line %1, column %2:\n%3").arg(xml.lineNumber()).arg(xml.columnNumber()).arg(xml.errorString()));
+    return false;
   }
-  bool atEnd = false;
-  size_t nRead;
-  while(!atEnd && this->_xmlParseError >= 0)
+  if(nullptr == m_RootTagsSection)
   {
-    // Read a block from the XML file and pass it to the parser
-    nRead = fread(buf, 1, BUFFER_SIZE, fh);
-    atEnd = feof(fh);
-    parser.Parse(buf, nRead, atEnd);
+    setError(RootTagsError, QObject::tr("Could not find the <ROOT><Tags> element. Aborting Parsing. Is the file a Zeiss _meta.xml file"));
+    return false;
   }
-  fclose(fh);
-
-  return this->_xmlParseError;
+  return true;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ZeissXMLReader::OnStartElement(const XML_Char* name, const XML_Char** attrs)
+ZeissTagsXmlSection::Pointer ZeissXMLReader::readTagsSection(QXmlStreamReader& xml)
 {
-  std::string currentTag(name);
-  // std::cout << "currentTag: " << name << std::endl;
-  if(currentTag.compare(Zeiss::XML::Tags) == 0)
-  {
-    onTags_StartTag(name, attrs);
-    _xmlSection = Zeiss::XML::TagsSection;
-  }
-  else if(name[0] == 'V') // The value of this tag
-  {
-    onVx_StartTag(name, attrs);
-  }
-  else if(name[0] == 'I') // The ID of the unique Tag
+  int32_t count = -1;
+  bool countOk = false;
+  QHash<int32_t, QString> values;
+  QHash<int32_t, int32_t> ids;
+
+  while(xml.readNextStartElement())
   {
-    onIx_StartTag(name, attrs);
+    QString name = xml.name().toString();
+    int32_t index = -1;
+    if(name == ITKImageProcessingConstants::Xml::Count)
+    {
+      count = xml.readElementText(QXmlStreamReader::SkipChildElements).toInt(&countOk, 10);
+    }
+    else if(SplitIndexedName(name, 'V', index))
+    {
+      values.insert(index, xml.readElementText(QXmlStreamReader::SkipChildElements));
+    }
+    else if(SplitIndexedName(name, 'I', index))
+    {
+      ids.insert(index, xml.readElementText(QXmlStreamReader::SkipChildElements).toInt(nullptr, 10));
+    }
+    else
+    {
+      xml.skipCurrentElement();
+    }
   }
-  else if(name[0] == 'A')
+  if(!countOk)
   {
+    return ZeissTagsXmlSection::NullPointer();
   }
-  else if(name[0] == 'p')
+
+  ZeissTagsXmlSection::Pointer tagsSection = ZeissTagsXmlSection::New();
+  ZeissTagMapping::Pointer tagMapping = ZeissTagMapping::instance();
+  for(int32_t c = 0; c < count; c++)
   {
-    onTile_StartTag(name, attrs);
+    QString value = values.value(c);
+    if(value.isEmpty())
+    {
+      continue;
+    }
+    AbstractZeissMetaData::Pointer ptr = tagMapping->metaDataForId(ids.value(c), value);
+    if(nullptr != ptr.get())
+    {
+      tagsSection->addMetaDataEntry(ptr);
+    }
   }
-
-  //    else
-  //    {
-  //      std::cout << logTime() << "No XML Section Defined" << std::endl;
-  //    }
+  return tagsSection;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ZeissXMLReader::OnEndElement(const XML_Char* name)
+bool ZeissXMLReader::readPhoto(QXmlStreamReader& xml, int32_t photoIndex)
 {
-  std::string currentTag(name);
-  if(currentTag.compare(Zeiss::XML::Tags) == 0)
+  QString photoTag = xml.name().toString();
+  ZeissTagsXmlSection::Pointer photoTagsSection;
+  bool foundTags = false;
+  while(xml.readNextStartElement())
   {
-    onTags_EndTag(name);
+    if(!foundTags && xml.name() == ITKImageProcessingConstants::Xml::Tags)
+    {
+      foundTags = true;
+      photoTagsSection = readTagsSection(xml);
+    }
+    else
+    {
+      xml.skipCurrentElement();
+    }
   }
-  else if(name[0] == 'V') // The value of this tag
+  if(xml.hasError())
   {
-    onVx_EndTag(name);
+    // Reported by parse()
+    return true;
   }
-  else if(name[0] == 'I') // The ID of the unique Tag
+  if(!foundTags)
   {
-    onIx_EndTag(name);
+    setError(MissingPhotoTags, QObject::tr("Could not find the <ROOT><%1><Tags> element. Aborting Parsing. Is the file a Zeiss _meta.xml file").arg(photoTag));
+    return false;
   }
-  else if(name[0] == 'p')
+  if(nullptr == photoTagsSection)
   {
-    onTile_EndTag(name);
+    setError(PhotoTagsError, QObject::tr("Error Parsing the <ROOT><%1><Tags> element. Aborting Parsing. Is the file a Zeiss AxioVision _meta.xml file").arg(photoTag));
+    return false;
   }
-  //  else if (name[0] == 'A')
-  //  {
-  //
-  //  }
-  //  else
-  //  {
-  //    std::cout << logTime() << "No XML Section Defined" << std::endl;
-  //  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::onTags_StartTag(const XML_Char* name, const XML_Char** attrs)
-{
-  //  std::cout << "Starting: " << name << std::endl;
-  if(m_CurrentTagSection.get() == nullptr)
+  if(m_PhotoHandler)
   {
-    m_CurrentTagSection = ZeissTagsXmlSection::New();
+    return m_PhotoHandler(photoIndex, photoTag, photoTagsSection);
   }
-  _xmlSection = Zeiss::XML::TagsSection;
+  return true;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ZeissXMLReader::onTags_EndTag(const XML_Char* name)
+void ZeissXMLReader::readScalingSection(QXmlStreamReader& xml)
 {
-  //   std::cout << "  Ending Section: " << name << std::endl;
-  _xmlSection = Zeiss::XML::RootSection;
-  if(_tileSection == 0)
+  while(xml.readNextStartElement())
   {
-    m_TagsSection = m_CurrentTagSection;
+    QString name = xml.name().toString();
+    m_ScalingValues.insert(name, xml.readElementText(QXmlStreamReader::SkipChildElements));
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ZeissXMLReader::onTile_StartTag(const XML_Char* name, const XML_Char** attrs)
+void ZeissXMLReader::setError(int32_t code, const QString& message)
 {
-  //  std::cout << "Starting: " << name << std::endl;
-  _xmlSection = Zeiss::XML::TileSection;
-  _tileSection = 1;
-  m_CurrentTagSection = ZeissTagsXmlSection::New();
+  m_ErrorCode = code;
+  m_ErrorMessage = message;
 }
 
 // -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::onTile_EndTag(const XML_Char* name)
+void ZeissXMLReader::setPhotoHandler(const PhotoHandler& value)
 {
-  //  std::cout << "  Ending Section: " << name << std::endl;
-  if(_tileSection == 1)
-  {
-    m_ImageTags.push_back(m_CurrentTagSection);
-  }
-  _tileSection = 0;
+  m_PhotoHandler = value;
 }
 
 // -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::onVx_StartTag(const XML_Char* name, const XML_Char** attrs)
+int32_t ZeissXMLReader::getErrorCode() const
 {
-  this->_charData.clear();
-  this->_parseData = true;
+  return m_ErrorCode;
 }
 
 // -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::onVx_EndTag(const XML_Char* name)
-{
-  if(this->_xmlParseError < 0)
-  {
-    return;
-  }
-  this->_vTagContent = this->_charData;
-  this->_parseData = false; // Stop parsing character data
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::onIx_StartTag(const XML_Char* name, const XML_Char** attrs)
-{
-  this->_charData.clear();
-  this->_parseData = true;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::onIx_EndTag(const XML_Char* name)
-{
-  if(this->_xmlParseError < 0)
-  {
-    return;
-  }
-  int32_t idValue;
-  this->extractValue(this->_charData, idValue);
-  this->_parseData = false; // Stop parsing character data
-  AbstractZeissMetaData::Pointer ptr = ZeissTagMapping::instance()->metaDataForId(idValue, this->_vTagContent);
-  if(nullptr != ptr.get() && _vTagContent.size() > 0)
-  {
-    if(_xmlSection == Zeiss::XML::TagsSection)
-    {
-      m_CurrentTagSection->addMetaDataEntry(ptr);
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::OnCharacterData(const XML_Char* data, int32_t len)
-{
-  if(this->_parseData)
-  {
-    this->_charData.append(data, len);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::printStats(std::ostream& out)
+QString ZeissXMLReader::getErrorMessage() const
 {
-  std::cout << "RoboMet XML Reader Statistics" << std::endl;
+  return m_ErrorMessage;
 }
 
 // -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-
-void ZeissXMLReader::onRoot_StartTag(const XML_Char* name, const XML_Char** attrs)
+ZeissTagsXmlSection::Pointer ZeissXMLReader::getRootTagsSection() const
 {
-  this->_charData.clear();
+  return m_RootTagsSection;
 }
 
 // -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::onRoot_EndTag(const XML_Char* name)
+QString ZeissXMLReader::getScalingValue(const QString& name) const
 {
+  return m_ScalingValues.value(name);
 }
 
 // -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int ZeissXMLReader::getParseError()
+ZeissXMLReader::Pointer ZeissXMLReader::NullPointer()
 {
-  return _xmlParseError;
+  return Pointer(static_cast<Self*>(nullptr));
 }
 
 // -----------------------------------------------------------------------------
-ZeissXMLReader::Pointer ZeissXMLReader::NullPointer()
+ZeissXMLReader::Pointer ZeissXMLReader::New(const QString& fileName)
 {
-  return Pointer(static_cast<Self*>(nullptr));
+  Pointer sharedPtr(new ZeissXMLReader(fileName));
+  return sharedPtr;
 }
 
 // -----------------------------------------------------------------------------
@@ -409,35 +304,3 @@ QString ZeissXMLReader::ClassName()
 {
   return QString("ZeissXMLReader");
 }
-
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::setTagsSection;
-(const ZeissTagsXmlSection::Pointer& value)
-{
-  m_TagsSection;
-  = value;
-}
-
-// -----------------------------------------------------------------------------
-ZeissTagsXmlSection::Pointer ZeissXMLReader::getTagsSection;
-() const
-{
-  return m_TagsSection;
-  ;
-}
-
-// -----------------------------------------------------------------------------
-void ZeissXMLReader::setImageTags;
-(const std::vector<ZeissTagsXmlSection::Pointer>& value)
-{
-  m_ImageTags;
-  = value;
-}
-
-// -----------------------------------------------------------------------------
-std::vector<ZeissTagsXmlSection::Pointer> ZeissXMLReader::getImageTags;
-() const
-{
-  return m_ImageTags;
-  ;
-}